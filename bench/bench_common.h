@@ -0,0 +1,51 @@
+#ifndef BENCH_BENCH_COMMON_H_
+#define BENCH_BENCH_COMMON_H_
+
+#include <benchmark/benchmark.h>
+#include <stddef.h>
+
+namespace whatwgurl {
+namespace bench {
+
+// Absolute URLs of the shapes the parser has dedicated code paths for.
+#define ABSOLUTE_URL_SHAPES(V)                                                 \
+  V(ShortHttp, "http://example.com/")                                          \
+  V(LongQuery,                                                                 \
+    "https://www.example.com/search/results?q=whatwg+url+parser&lang=en-US"    \
+    "&page=12&per_page=50&sort=relevance&utm_source=newsletter&utm_medium="    \
+    "email&utm_campaign=2022-spring&session=9f86d081884c7d659a2feaa0c55ad015"  \
+    "&filters%5Bcolor%5D=red&filters%5Bsize%5D=xl#results")                    \
+  V(IPv4, "http://192.168.0.1:8080/admin/index.html")                          \
+  V(IPv6, "http://[2001:db8:85a3::8a2e:370:7334]:8080/status?verbose")         \
+  V(IDN, "https://b\xC3\xBC" "cher.example.de/stra\xC3\x9F" "e?q=\xC3\xA4")    \
+  V(File, "file:///home/user/documents/reports/2022/summary.pdf")              \
+  V(OpaquePath, "mailto:someone@example.com?subject=Hello%20World")
+
+// Relative inputs, parsed against `kBaseURL`.
+#define RELATIVE_URL_SHAPES(V)                                                 \
+  V(PathRelative, "../images/logo.png?v=2")                                    \
+  V(PathAbsolute, "/api/v1/users/42")                                          \
+  V(SchemeRelative, "//cdn.example.net/lib/app.js")                            \
+  V(QueryOnly, "?page=2&sort=desc")                                            \
+  V(FragmentOnly, "#section-3")
+
+constexpr char kBaseURL[] =
+    "https://www.example.com/docs/guide/getting-started.html?lang=en#intro";
+
+// Reports throughput for a benchmark that processes one URL of `bytes` bytes
+// per iteration: URLs/s, bytes/s and the mean CPU time per URL.
+inline void SetURLCounters(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    size_t bytes) {
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * bytes);
+  state.counters["time/URL"] =
+      benchmark::Counter(static_cast<double>(state.iterations()),
+                         benchmark::Counter::kIsRate |
+                             benchmark::Counter::kInvert);
+}
+
+}  // namespace bench
+}  // namespace whatwgurl
+
+#endif  // BENCH_BENCH_COMMON_H_
@@ -0,0 +1,318 @@
+// Throughput of `URLCore` over newline-delimited URL corpora.
+//
+//   corpus_bench [--threads=N] [--repeat=R] [--profile] <corpus>...
+//
+// Each line of a corpus is a URL, or a URL and a base separated by a tab, so
+// URLs with tabs or newlines in them cannot be part of one.
+//
+// bench/corpus/edge_cases.txt is taken from the web-platform-tests URL parser
+// tests, under their BSD license; see bench/corpus/LICENSE.wpt.
+// Every corpus is parsed single-threaded and then with N threads (defaults to
+// the number of CPUs), R times each, reporting URLs/s, MB/s, heap allocations
+// per URL and the peak RSS of the process.
+//
+// With `--profile`, the per-state parser profile of every corpus is printed
+// too, which needs a build with `whatwgurl_parser_profile=1`.
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>  // NOLINT(build/c++11)
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+#include "parser_profile.h"
+#include "url_core.h"
+
+// Every heap allocation of the process goes through here, so that the runner
+// can tell how many allocations parsing a URL takes. The counter is per thread
+// to keep the workers from contending on it.
+static thread_local uint64_t allocation_count = 0;
+
+static void* CountedAllocate(size_t size) {
+  ++allocation_count;
+  void* ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) abort();
+  return ptr;
+}
+
+void* operator new(size_t size) {
+  return CountedAllocate(size);
+}
+
+void* operator new[](size_t size) {
+  return CountedAllocate(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  ++allocation_count;
+  return malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  ++allocation_count;
+  return malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+namespace whatwgurl {
+namespace bench {
+
+using std::string;
+using std::vector;
+
+struct CorpusLine {
+  const char* input;
+  size_t input_length;
+  const char* base;
+  size_t base_length;
+};
+
+class Corpus {
+ public:
+  Corpus() = default;
+  Corpus(const Corpus&) = delete;
+  Corpus& operator=(const Corpus&) = delete;
+
+  ~Corpus() {
+    if (_data != nullptr) munmap(const_cast<char*>(_data), _size);
+  }
+
+  bool Load(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+      perror(path);
+      return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+      fprintf(stderr, "%s: empty or unreadable corpus\n", path);
+      close(fd);
+      return false;
+    }
+
+    _size = st.st_size;
+    void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+      perror(path);
+      return false;
+    }
+
+    _data = static_cast<const char*>(data);
+    madvise(data, _size, MADV_SEQUENTIAL);
+    Index();
+    return true;
+  }
+
+  inline const vector<CorpusLine>& lines() const { return _lines; }
+  inline size_t bytes() const { return _bytes; }
+
+ private:
+  void Index() {
+    const char* ptr = _data;
+    const char* end = _data + _size;
+    while (ptr < end) {
+      const char* eol = static_cast<const char*>(memchr(ptr, '\n', end - ptr));
+      if (eol == nullptr) eol = end;
+
+      const char* line_end = eol;
+      if (line_end > ptr && line_end[-1] == '\r') --line_end;
+
+      if (line_end > ptr) {
+        const char* tab =
+            static_cast<const char*>(memchr(ptr, '\t', line_end - ptr));
+        CorpusLine line = {ptr, static_cast<size_t>(line_end - ptr), "", 0};
+        if (tab != nullptr) {
+          line.input_length = tab - ptr;
+          line.base = tab + 1;
+          line.base_length = line_end - tab - 1;
+        }
+
+        _lines.push_back(line);
+        _bytes += line.input_length;
+      }
+
+      ptr = eol + 1;
+    }
+  }
+
+  const char* _data = nullptr;
+  size_t _size = 0;
+  size_t _bytes = 0;
+  vector<CorpusLine> _lines;
+};
+
+struct RunResult {
+  uint64_t urls = 0;
+  uint64_t failures = 0;
+  uint64_t allocations = 0;
+};
+
+// Parses `lines[begin, end)` `repeat` times. Consecutive lines with the same
+// base share one parsed base, like a crawler resolving the links of a page.
+static void ParseRange(const vector<CorpusLine>& lines,
+                       size_t begin,
+                       size_t end,
+                       int repeat,
+                       RunResult* result) {
+  uint64_t allocations_before = allocation_count;
+  string input;
+  string base_input;
+  std::unique_ptr<URLCore> base;
+
+  for (int r = 0; r < repeat; r++) {
+    for (size_t i = begin; i < end; i++) {
+      const CorpusLine& line = lines[i];
+      input.assign(line.input, line.input_length);
+
+      bool failed;
+      if (line.base_length == 0) {
+        URLCore url(input);
+        failed = url.failed();
+      } else {
+        if (base.get() == nullptr ||
+            base_input.compare(0, string::npos, line.base, line.base_length)) {
+          base_input.assign(line.base, line.base_length);
+          base.reset(new URLCore(base_input));
+        }
+
+        URLCore url(input, *base);
+        failed = url.failed();
+      }
+
+      result->urls++;
+      if (failed) result->failures++;
+    }
+  }
+
+  result->allocations = allocation_count - allocations_before;
+}
+
+static void Run(const Corpus& corpus,
+                const char* name,
+                unsigned threads,
+                int repeat) {
+  const vector<CorpusLine>& lines = corpus.lines();
+  vector<RunResult> results(threads);
+
+  auto start = std::chrono::steady_clock::now();
+  if (threads == 1) {
+    ParseRange(lines, 0, lines.size(), repeat, &results[0]);
+  } else {
+    vector<std::thread> workers;
+    size_t chunk = (lines.size() + threads - 1) / threads;
+    for (unsigned i = 0; i < threads; i++) {
+      size_t begin = std::min(lines.size(), i * chunk);
+      size_t end = std::min(lines.size(), begin + chunk);
+      workers.emplace_back(
+          ParseRange, std::cref(lines), begin, end, repeat, &results[i]);
+    }
+    for (auto& worker : workers) worker.join();
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+  RunResult total;
+  for (const RunResult& result : results) {
+    total.urls += result.urls;
+    total.failures += result.failures;
+    total.allocations += result.allocations;
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  double mb = static_cast<double>(corpus.bytes()) * repeat / (1024 * 1024);
+  printf("%-28s %3u thread%s %10.0f URLs/s %8.2f MB/s %7.2f allocs/URL "
+         "%6llu failed %8ld KB peak RSS\n",
+         name,
+         threads,
+         threads == 1 ? " " : "s",
+         total.urls / seconds,
+         mb / seconds,
+         static_cast<double>(total.allocations) / total.urls,
+         static_cast<unsigned long long>(total.failures / repeat),  // NOLINT
+         usage.ru_maxrss);
+}
+
+static int Main(int argc, char* argv[]) {
+  unsigned threads = std::thread::hardware_concurrency();
+  int repeat = 10;
+  bool profile = false;
+  vector<const char*> paths;
+
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--threads=", 10) == 0) {
+      threads = atoi(argv[i] + 10);
+    } else if (strncmp(argv[i], "--repeat=", 9) == 0) {
+      repeat = atoi(argv[i] + 9);
+    } else if (strcmp(argv[i], "--profile") == 0) {
+      profile = true;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+
+  if (paths.empty() || repeat <= 0) {
+    fprintf(stderr,
+            "Usage: %s [--threads=N] [--repeat=R] [--profile] <corpus>...\n",
+            argv[0]);
+    return 1;
+  }
+  if (threads == 0) threads = 1;
+
+  if (profile && !ParserProfileEnabled()) {
+    fprintf(stderr,
+            "--profile needs a build with whatwgurl_parser_profile=1\n");
+    return 1;
+  }
+
+  for (const char* path : paths) {
+    Corpus corpus;
+    if (!corpus.Load(path)) return 1;
+
+    const char* name = strrchr(path, '/');
+    name = name == nullptr ? path : name + 1;
+
+    ResetParserProfile();
+    Run(corpus, name, 1, repeat);
+    if (threads > 1) Run(corpus, name, threads, repeat);
+
+    if (profile) printf("\n%s\n", GetParserProfile().ToTable().c_str());
+  }
+
+  return 0;
+}
+
+}  // namespace bench
+}  // namespace whatwgurl
+
+int main(int argc, char* argv[]) {
+  return whatwgurl::bench::Main(argc, argv);
+}
@@ -0,0 +1,91 @@
+#include <memory>
+#include <string>
+#include "base_resolver.h"
+#include "bench_common.h"
+#include "parse.h"
+#include "url_core.h"
+
+namespace whatwgurl {
+namespace bench {
+
+using std::shared_ptr;
+using std::string;
+
+static void BM_Parse(benchmark::State& state,  // NOLINT(runtime/references)
+                     const char* input) {
+  string url(input);
+  for (auto _ : state) {
+    shared_ptr<ParsedURL> parsed;
+    bool validation_error;
+    bool succeeded = Parse(url, nullptr, &parsed, &validation_error);
+    benchmark::DoNotOptimize(succeeded);
+    benchmark::DoNotOptimize(parsed);
+  }
+  SetURLCounters(state, url.length());
+}
+
+static void BM_ParseWithBase(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input) {
+  shared_ptr<ParsedURL> base;
+  bool validation_error;
+  CHECK(Parse(kBaseURL, nullptr, &base, &validation_error));
+
+  string url(input);
+  for (auto _ : state) {
+    shared_ptr<ParsedURL> parsed;
+    bool succeeded = Parse(url, base.get(), &parsed, &validation_error);
+    benchmark::DoNotOptimize(succeeded);
+    benchmark::DoNotOptimize(parsed);
+  }
+  SetURLCounters(state, url.length());
+}
+
+// Resolve against a `BaseResolver` built once, i.e. what a crawler pays per
+// link of a page.
+static void BM_ResolveWithBase(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input) {
+  BaseResolver resolver(kBaseURL);
+  CHECK(!resolver.failed());
+
+  string url(input);
+  for (auto _ : state) {
+    string href;
+    bool succeeded = resolver.Resolve(url, &href);
+    benchmark::DoNotOptimize(succeeded);
+    benchmark::DoNotOptimize(href);
+  }
+  SetURLCounters(state, url.length());
+}
+
+// Parse and serialize, i.e. what `new URL(input).href` costs.
+static void BM_ParseAndSerialize(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input) {
+  string url(input);
+  for (auto _ : state) {
+    URLCore core(url);
+    string href = core.href();
+    benchmark::DoNotOptimize(href);
+  }
+  SetURLCounters(state, url.length());
+}
+
+#define V(name, input)                                                         \
+  BENCHMARK_CAPTURE(BM_Parse, name, input);                                    \
+  BENCHMARK_CAPTURE(BM_ParseAndSerialize, name, input);
+ABSOLUTE_URL_SHAPES(V)
+#undef V
+
+#define V(name, input) BENCHMARK_CAPTURE(BM_ParseWithBase, name, input);
+ABSOLUTE_URL_SHAPES(V)
+RELATIVE_URL_SHAPES(V)
+#undef V
+
+#define V(name, input) BENCHMARK_CAPTURE(BM_ResolveWithBase, name, input);
+RELATIVE_URL_SHAPES(V)
+#undef V
+
+}  // namespace bench
+}  // namespace whatwgurl
@@ -0,0 +1,71 @@
+#include <string>
+#include "bench_common.h"
+#include "percent_encode.h"
+
+namespace whatwgurl {
+namespace bench {
+
+using std::string;
+
+#define PERCENT_ENCODE_INPUTS(V)                                               \
+  V(ASCII, "/static/js/app.bundle.min.js")                                     \
+  V(Spaces, "hello world, this is a sentence with spaces")                     \
+  V(UTF8,                                                                      \
+    "\xE4\xBD\xA0\xE5\xA5\xBD\xE4\xB8\x96\xE7\x95\x8C/"                        \
+    "J\xC3\xBCrgen/stra\xC3\x9F" "e")
+
+#define PERCENT_DECODE_INPUTS(V)                                               \
+  V(ASCII, "/static/js/app.bundle.min.js")                                     \
+  V(Encoded,                                                                   \
+    "%E4%BD%A0%E5%A5%BD%E4%B8%96%E7%95%8C%2FJ%C3%BCrgen%2Fstra%C3%9Fe")
+
+static void BM_PercentEncode(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input,
+    const uint8_t* percent_encode_set) {
+  string str(input);
+  TempStringBuffer output;
+  for (auto _ : state) {
+    percent_encode::Encode(
+        reinterpret_cast<const unsigned char*>(str.c_str()),
+        str.length(),
+        percent_encode_set,
+        &output);
+    benchmark::DoNotOptimize(output.string());
+  }
+  SetURLCounters(state, str.length());
+}
+
+static void BM_PercentDecode(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input) {
+  string str(input);
+  TempStringBuffer output;
+  for (auto _ : state) {
+    percent_encode::Decode(
+        reinterpret_cast<const unsigned char*>(str.c_str()),
+        str.length(),
+        &output);
+    benchmark::DoNotOptimize(output.string());
+  }
+  SetURLCounters(state, str.length());
+}
+
+#define V(name, input)                                                         \
+  BENCHMARK_CAPTURE(BM_PercentEncode,                                          \
+                    Path##name,                                                \
+                    input,                                                     \
+                    percent_encode::kPathPercentEncodeSet);                    \
+  BENCHMARK_CAPTURE(BM_PercentEncode,                                          \
+                    Component##name,                                           \
+                    input,                                                     \
+                    percent_encode::kComponentPercentEncodeSet);
+PERCENT_ENCODE_INPUTS(V)
+#undef V
+
+#define V(name, input) BENCHMARK_CAPTURE(BM_PercentDecode, name, input);
+PERCENT_DECODE_INPUTS(V)
+#undef V
+
+}  // namespace bench
+}  // namespace whatwgurl
@@ -0,0 +1,68 @@
+#include <string>
+#include "bench_common.h"
+#include "url_search_params.h"
+
+namespace whatwgurl {
+namespace bench {
+
+using std::string;
+
+#define SEARCH_PARAMS_SHAPES(V)                                                \
+  V(Short, "a=1&b=2")                                                          \
+  V(Tracking,                                                                  \
+    "utm_source=newsletter&utm_medium=email&utm_campaign=spring-sale&"         \
+    "utm_term=running+shoes&utm_content=hero-banner&gclid=EAIaIQobChMI")       \
+  V(Encoded,                                                                   \
+    "q=%E4%BD%A0%E5%A5%BD+%E4%B8%96%E7%95%8C&name=J%C3%BCrgen&"                \
+    "path=%2Fhome%2Fuser&emoji=%F0%9F%98%80")                                  \
+  V(Unsorted,                                                                  \
+    "z=26&y=25&x=24&w=23&v=22&u=21&t=20&s=19&r=18&q=17&p=16&o=15&n=14&"        \
+    "m=13&l=12&k=11&j=10&i=9&h=8&g=7&f=6&e=5&d=4&c=3&b=2&a=1")
+
+static void BM_SearchParamsParse(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input) {
+  string init(input);
+  for (auto _ : state) {
+    URLSearchParams params(init);
+    benchmark::DoNotOptimize(params);
+  }
+  SetURLCounters(state, init.length());
+}
+
+static void BM_SearchParamsSerialize(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input) {
+  string init(input);
+  URLSearchParams params(init);
+  for (auto _ : state) {
+    string serialized = params.Stringify();
+    benchmark::DoNotOptimize(serialized);
+  }
+  SetURLCounters(state, init.length());
+}
+
+// Sorting an already sorted list is cheap, so every iteration starts from a
+// fresh copy; the copy is part of the measured time.
+static void BM_SearchParamsSort(
+    benchmark::State& state,  // NOLINT(runtime/references)
+    const char* input) {
+  string init(input);
+  URLSearchParams original(init);
+  for (auto _ : state) {
+    URLSearchParams params(original.list());
+    params.Sort();
+    benchmark::DoNotOptimize(params);
+  }
+  SetURLCounters(state, init.length());
+}
+
+#define V(name, input)                                                         \
+  BENCHMARK_CAPTURE(BM_SearchParamsParse, name, input);                        \
+  BENCHMARK_CAPTURE(BM_SearchParamsSerialize, name, input);                    \
+  BENCHMARK_CAPTURE(BM_SearchParamsSort, name, input);
+SEARCH_PARAMS_SHAPES(V)
+#undef V
+
+}  // namespace bench
+}  // namespace whatwgurl
@@ -5,8 +5,11 @@
       "libwhatwgurl.gyp:libwhatwgurl",
     ],
     "sources": [
+      "binding/node_stats.cc",
+      "binding/node_string.cc",
       "binding/node_url_search_params.cc",
       "binding/node_url.cc",
+      "binding/node_url_batch.cc",
     ],
     "include_dirs": [
       "<!(node -e \"require('nan')\")",
@@ -0,0 +1,91 @@
+#include "node_stats.h"
+#include <string.h>
+#include <string>
+#include "allocation_stats.h"
+#include "parser_profile.h"
+#include "utils/assert.h"
+
+namespace whatwgurl {
+
+using std::string;
+using v8::Boolean;
+using v8::Local;
+using v8::Number;
+using v8::Object;
+using v8::String;
+
+static inline void SetNumber(Local<Object> target,
+                             const char* key,
+                             uint64_t value) {
+  Nan::Set(target,
+           Nan::New<String>(key).ToLocalChecked(),
+           Nan::New<Number>(static_cast<double>(value)));
+}
+
+static Local<Object> NewSiteStats(const AllocationSiteStats& stats) {
+  Local<Object> ret = Nan::New<Object>();
+  SetNumber(ret, "allocations", stats.allocations);
+  SetNumber(ret, "bytes", stats.bytes);
+  SetNumber(ret, "regrowths", stats.regrowths);
+  return ret;
+}
+
+NAN_MODULE_INIT(InitStats) {
+  Nan::SetMethod(target, "getAllocationStats", GetAllocationStats);
+  Nan::SetMethod(target, "resetAllocationStats", ResetAllocationStats);
+  Nan::SetMethod(target, "getParserProfile", GetParserProfile);
+  Nan::SetMethod(target, "resetParserProfile", ResetParserProfile);
+}
+
+NAN_METHOD(GetAllocationStats) {
+  AllocationStats stats = whatwgurl::GetAllocationStats();
+
+  Local<Object> sites = Nan::New<Object>();
+#define V(name, _)                                                             \
+  Nan::Set(sites,                                                              \
+           Nan::New<String>(#name).ToLocalChecked(),                           \
+           NewSiteStats(stats.name));
+  ALLOCATION_SITES(V)
+#undef V
+
+  Local<Object> ret = Nan::New<Object>();
+  Nan::Set(ret,
+           Nan::New<String>("enabled").ToLocalChecked(),
+           Nan::New<Boolean>(AllocationStatsEnabled()));
+  SetNumber(ret, "parses", stats.parses);
+  Nan::Set(ret,
+           Nan::New<String>("total").ToLocalChecked(),
+           NewSiteStats(stats.total()));
+  Nan::Set(ret, Nan::New<String>("sites").ToLocalChecked(), sites);
+
+  info.GetReturnValue().Set(ret);
+}
+
+NAN_METHOD(ResetAllocationStats) {
+  whatwgurl::ResetAllocationStats();
+}
+
+NAN_METHOD(GetParserProfile) {
+  CHECK_EQ(info.Length(), 1);
+  CHECK(info[0]->IsString());
+
+  Nan::Utf8String format(info[0]);
+  ParserProfile profile = whatwgurl::GetParserProfile();
+  string ret;
+  if (strcmp(*format, "json") == 0) {
+    ret = profile.ToJSON();
+  } else if (strcmp(*format, "table") == 0) {
+    ret = profile.ToTable();
+  } else {
+    Nan::ThrowTypeError("The format must be 'json' or 'table'");
+    return;
+  }
+
+  info.GetReturnValue().Set(Nan::New<String>(ret).ToLocalChecked());
+}
+
+NAN_METHOD(ResetParserProfile) {
+  whatwgurl::ResetParserProfile();
+}
+
+}  // namespace whatwgurl
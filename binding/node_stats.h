@@ -0,0 +1,34 @@
+#ifndef BINDING_NODE_STATS_H_
+#define BINDING_NODE_STATS_H_
+
+#include <nan.h>
+
+namespace whatwgurl {
+
+// Exposes `getAllocationStats()`, `resetAllocationStats()`,
+// `getParserProfile()` and `resetParserProfile()` on the module.
+NAN_MODULE_INIT(InitStats);
+
+// getAllocationStats()
+//
+// Returns `{ enabled, parses, total, sites }`, where `total` and every
+// `sites[name]` (see `ALLOCATION_SITES`) are `{ allocations, bytes, regrowths
+// }`. Everything is 0 unless the addon was built with
+// `whatwgurl_allocation_stats=1`.
+NAN_METHOD(GetAllocationStats);
+
+// resetAllocationStats()
+NAN_METHOD(ResetAllocationStats);
+
+// getParserProfile(format: 'json' | 'table')
+//
+// Returns `ParserProfile::ToJSON()` or `ParserProfile::ToTable()`. The profile
+// is empty unless the addon was built with `whatwgurl_parser_profile=1`.
+NAN_METHOD(GetParserProfile);
+
+// resetParserProfile()
+NAN_METHOD(ResetParserProfile);
+
+}  // namespace whatwgurl
+
+#endif  // BINDING_NODE_STATS_H_
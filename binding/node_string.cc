@@ -0,0 +1,49 @@
+#include "node_string.h"
+#include <utility>
+
+namespace whatwgurl {
+
+using std::string;
+using v8::MaybeLocal;
+using v8::String;
+
+namespace {
+
+class OwnedOneByteStringResource : public Nan::ExternalOneByteStringResource {
+ public:
+  explicit OwnedOneByteStringResource(string&& str) : _str(std::move(str)) {}
+
+  const char* data() const override { return _str.data(); }
+  size_t length() const override { return _str.length(); }
+
+ private:
+  const string _str;
+};
+
+}  // namespace
+
+MaybeLocal<String> NewV8String(const char* data, size_t length) {
+  if (IsASCIIString(data, length)) {
+    return Nan::NewOneByteString(reinterpret_cast<const uint8_t*>(data),
+                                 static_cast<int>(length));
+  }
+
+  return Nan::New<String>(data, static_cast<int>(length));
+}
+
+MaybeLocal<String> NewV8String(string&& str) {
+  if (str.length() < kExternalStringThreshold ||
+      !IsASCIIString(str.c_str(), str.length())) {
+    return NewV8String(str.c_str(), str.length());
+  }
+
+  // V8 takes ownership of the resource and deletes it when the string dies,
+  // but only if the string could be created.
+  OwnedOneByteStringResource* resource =
+      new OwnedOneByteStringResource(std::move(str));
+  MaybeLocal<String> ret = Nan::New<String>(resource);
+  if (ret.IsEmpty()) delete resource;
+  return ret;
+}
+
+}  // namespace whatwgurl
@@ -0,0 +1,36 @@
+#ifndef BINDING_NODE_STRING_H_
+#define BINDING_NODE_STRING_H_
+
+#include <nan.h>
+#include <string>
+
+namespace whatwgurl {
+
+// Strings at least this long are handed to V8 as external strings instead of
+// being copied into the V8 heap.
+constexpr size_t kExternalStringThreshold = 1024;
+
+inline bool IsASCIIString(const char* data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (static_cast<unsigned char>(data[i]) >= 0x80) return false;
+  }
+  return true;
+}
+
+// Creates a V8 string from `data`. ASCII input (e.g. every serialized URL
+// component) is copied as a one-byte string without UTF-8 decoding; anything
+// else goes through the UTF-8 decoder.
+v8::MaybeLocal<v8::String> NewV8String(const char* data, size_t length);
+
+inline v8::MaybeLocal<v8::String> NewV8String(const std::string& str) {
+  return NewV8String(str.c_str(), str.length());
+}
+
+// Same as above, but takes ownership of `str`. A long ASCII string is not
+// copied at all: it is moved into an external one-byte string resource which
+// V8 frees once the JavaScript string is collected.
+v8::MaybeLocal<v8::String> NewV8String(std::string&& str);
+
+}  // namespace whatwgurl
+
+#endif  // BINDING_NODE_STRING_H_
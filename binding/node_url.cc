@@ -1,4 +1,7 @@
 #include "node_url.h"
+#include "node_stats.h"
+#include "node_string.h"
+#include "node_url_batch.h"
 
 namespace whatwgurl {
 
@@ -22,69 +25,24 @@ using v8::Value;
 
 const char kURLName[] = "NativeURL";
 
-MaybeLocal<Object> URLInternal::ToStructedV8Object() const {
-  Nan::EscapableHandleScope scope;
-  Local<Object> obj = Nan::New<Object>();
-
-  string value = href();
-  Nan::Set(obj,
-           Nan::New<String>("href").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = origin();
-  Nan::Set(obj,
-           Nan::New<String>("origin").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = protocol();
-  Nan::Set(obj,
-           Nan::New<String>("protocol").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = username();
-  Nan::Set(obj,
-           Nan::New<String>("username").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = password();
-  Nan::Set(obj,
-           Nan::New<String>("password").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = host();
-  Nan::Set(obj,
-           Nan::New<String>("host").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = hostname();
-  Nan::Set(obj,
-           Nan::New<String>("hostname").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = port();
-  Nan::Set(obj,
-           Nan::New<String>("port").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = pathname();
-  Nan::Set(obj,
-           Nan::New<String>("pathname").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = search();
-  Nan::Set(obj,
-           Nan::New<String>("search").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-  value = hash();
-  Nan::Set(obj,
-           Nan::New<String>("hash").ToLocalChecked(),
-           Nan::New<String>(value.c_str(), value.length()).ToLocalChecked());
-
-  return scope.Escape(obj);
-}
-
 Nan::Global<Function> NodeURL::constructor;
 
 NAN_MODULE_INIT(NodeURL::Init) {
   Local<String> name = Nan::New<String>(kURLName).ToLocalChecked();
   Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(New);
 
-  Nan::SetPrototypeMethod(tpl, "toStructed", ToStructed);
+  Nan::SetMethod(tpl, "canParse", CanParse);
   Nan::SetPrototypeMethod(tpl, "getURLSearchParams", GetURLSearchParams);
   Nan::SetPrototypeMethod(
       tpl, "setOnPassivelyUpdateFunction", SetOnPassivelyUpdateFunction);
 
+#define V(name, camel_name)                                                    \
+  Nan::SetPrototypeMethod(tpl, "get" #camel_name, Get##camel_name);
+
+  URL_GETTERS(V)
+
+#undef V
+
   Nan::SetPrototypeMethod(tpl, "setHref", SetHref);
 #define V(name, camel_name)                                                    \
   Nan::SetPrototypeMethod(tpl, "set" #camel_name, Set##camel_name);
@@ -109,8 +67,8 @@ NAN_METHOD(NodeURL::New) {
     case 1: {
       CHECK(info[0]->IsString());
       Nan::Utf8String url(info[0].As<String>());
-      unique_ptr<URLInternal> url_internal =
-          make_unique<URLInternal>(string(*url, url.length()));
+      unique_ptr<URLCore> url_internal =
+          make_unique<URLCore>(string(*url, url.length()));
       if (url_internal->failed()) {
         Nan::ThrowError("Invalid URL");
         return;
@@ -122,20 +80,20 @@ NAN_METHOD(NodeURL::New) {
 
     case 2: {
       CHECK(info[0]->IsString());
-      unique_ptr<URLInternal> url_internal;
+      unique_ptr<URLCore> url_internal;
       Nan::Utf8String url(info[0].As<String>());
 
       if (info[1]->IsString()) {
         Nan::Utf8String base(info[1].As<String>());
 
-        URLInternal base_internal(string(*base, base.length()));
+        URLCore base_internal(string(*base, base.length()));
         if (base_internal.failed()) {
           Nan::ThrowError("Invalid base URL");
           return;
         }
 
         url_internal =
-            make_unique<URLInternal>(string(*url, url.length()), base_internal);
+            make_unique<URLCore>(string(*url, url.length()), base_internal);
       } else if (info[1]->IsObject()) {
         NodeURL* base = Nan::ObjectWrap::Unwrap<NodeURL>(info[1].As<Object>());
         if (base == nullptr || !base->_internal.get() ||
@@ -144,7 +102,7 @@ NAN_METHOD(NodeURL::New) {
           return;
         }
 
-        url_internal = make_unique<URLInternal>(*url, *base->_internal);
+        url_internal = make_unique<URLCore>(*url, *base->_internal);
       } else {
         Nan::ThrowError("Invalid base URL");
         return;
@@ -168,16 +126,47 @@ NAN_METHOD(NodeURL::New) {
   info.GetReturnValue().Set(info.This());
 }
 
-NAN_METHOD(NodeURL::ToStructed) {
-  NodeURL* url = Nan::ObjectWrap::Unwrap<NodeURL>(info.Holder());
-
-  CHECK(url->_internal.get());
-  MaybeLocal<Object> obj = url->_internal->ToStructedV8Object();
-  CHECK(!obj.IsEmpty());
+// NativeURL.canParse(url[, base])
+//
+// `base` is a string or a `NativeURL`.
+NAN_METHOD(NodeURL::CanParse) {
+  CHECK(info.Length() >= 1 && info[0]->IsString());
+  Nan::Utf8String url(info[0].As<String>());
+  string url_string(*url, url.length());
+
+  bool ret;
+  if (info.Length() < 2 || info[1]->IsUndefined()) {
+    ret = URLCore::CanParse(url_string);
+  } else if (info[1]->IsString()) {
+    Nan::Utf8String base(info[1].As<String>());
+    ret = URLCore::CanParse(url_string, string(*base, base.length()));
+  } else if (info[1]->IsObject()) {
+    NodeURL* base = Nan::ObjectWrap::Unwrap<NodeURL>(info[1].As<Object>());
+    ret = base != nullptr && base->_internal.get() &&
+          URLCore::CanParse(url_string, *base->_internal);
+  } else {
+    ret = false;
+  }
 
-  info.GetReturnValue().Set(obj.ToLocalChecked());
+  info.GetReturnValue().Set(ret);
 }
 
+#define V(name, camel_name)                                                    \
+  NAN_METHOD(NodeURL::Get##camel_name) {                                       \
+    NodeURL* url = Nan::ObjectWrap::Unwrap<NodeURL>(info.Holder());            \
+    CHECK(url);                                                                \
+    CHECK(url->_internal.get());                                               \
+                                                                               \
+    MaybeLocal<String> ret = NewV8String(url->_internal->name());              \
+    CHECK(!ret.IsEmpty());                                                     \
+                                                                               \
+    info.GetReturnValue().Set(ret.ToLocalChecked());                           \
+  }
+
+URL_GETTERS(V)
+
+#undef V
+
 NAN_METHOD(NodeURL::GetURLSearchParams) {
   NodeURL* url = Nan::ObjectWrap::Unwrap<NodeURL>(info.Holder());
 
@@ -234,7 +223,7 @@ URL_SETTERS(V)
 
 #undef V
 
-NodeURL::NodeURL(Isolate* isolate, unique_ptr<URLInternal> url)
+NodeURL::NodeURL(Isolate* isolate, unique_ptr<URLCore> url)
     : _internal(std::move(url)), _isolate(isolate) {
   _internal->SetOnPassivelyUpdateFunction(
       [](void* context) {
@@ -244,17 +233,19 @@ NodeURL::NodeURL(Isolate* isolate, unique_ptr<URLInternal> url)
       this);
 }
 
+// Tells the JavaScript side that the URL has changed, so that it drops the
+// property values it has cached. The values themselves are built lazily by the
+// `get*()` methods.
 void NodeURL::OnPassivelyUpdate() {
+  if (_on_passively_update.IsEmpty()) return;
+
   Local<Context> context = Nan::GetCurrentContext();
   Local<Function> on_passively_update =
       Nan::New<Function>(_on_passively_update);
-  MaybeLocal<Object> structed = _internal->ToStructedV8Object();
-  CHECK(!structed.IsEmpty());
 
   Nan::TryCatch try_cache;
-  Local<Value> argv[] = {structed.ToLocalChecked()};
   MaybeLocal<Value> ret =
-      on_passively_update->Call(context, v8::Undefined(_isolate), 1, argv);
+      on_passively_update->Call(context, v8::Undefined(_isolate), 0, nullptr);
 
   if (try_cache.HasCaught()) {
     try_cache.ReThrow();
@@ -299,17 +290,29 @@ int32_t ToASCII(std::string* buf,
   return -1;
 }
 
+bool IsIDNAThreadSafe() {
+  return GetIDNAEnvironment()->to_ascii != ToASCII;
+}
+
+// init(options)
+//
+// `options.toASCII`, if given, replaces the built-in Punycode "domain to
+// ASCII" (see `PunycodeToASCII()`) with a JavaScript implementation.
 NAN_METHOD(InitEnvironment) {
-  Local<Object> options = info[0].As<Object>();
-  Local<Function> local_to_ascii =
-      Nan::Get(options, Nan::New("toASCII").ToLocalChecked())
-          .ToLocalChecked()
-          .As<Function>();
+  InitParams params;
+  params.idna_to_ascii = PunycodeToASCII;
 
-  to_ascii.Reset(local_to_ascii);
+  if (info.Length() >= 1 && info[0]->IsObject()) {
+    Local<Object> options = info[0].As<Object>();
+    Local<Value> local_to_ascii =
+        Nan::Get(options, Nan::New("toASCII").ToLocalChecked())
+            .ToLocalChecked();
 
-  InitParams params;
-  params.idna_to_ascii = ToASCII;
+    if (local_to_ascii->IsFunction()) {
+      to_ascii.Reset(local_to_ascii.As<Function>());
+      params.idna_to_ascii = ToASCII;
+    }
+  }
 
   InitEnvironment(params);
 }
@@ -317,6 +320,8 @@ NAN_METHOD(InitEnvironment) {
 NAN_MODULE_INIT(Init) {
   NodeURL::Init(target);
   NodeURLSearchParams::Init(target);
+  InitURLBatch(target);
+  InitStats(target);
   Nan::SetMethod(target, "init", InitEnvironment);
 }
 
@@ -8,15 +8,6 @@
 
 namespace whatwgurl {
 
-class URLInternal : public URLCore {
- public:
-  inline explicit URLInternal(const std::string& url) : URLCore(url) {}
-  inline URLInternal(const std::string& url, const URLInternal& base)
-      : URLCore(url, base) {}
-
-  v8::MaybeLocal<v8::Object> ToStructedV8Object() const;
-};
-
 #define URL_SETTERS(V)                                                         \
   V(protocol, Protocol)                                                        \
   V(username, Username)                                                        \
@@ -28,29 +19,44 @@ class URLInternal : public URLCore {
   V(search, Search)                                                            \
   V(hash, Hash)
 
+#define URL_GETTERS(V)                                                         \
+  V(href, Href)                                                                \
+  V(origin, Origin)                                                            \
+  URL_SETTERS(V)
+
+// Returns false if "domain to ASCII" calls into JavaScript, i.e. the URL parser
+// may only run on the main thread.
+bool IsIDNAThreadSafe();
+
 class NodeURL : public Nan::ObjectWrap {
  public:
   static NAN_MODULE_INIT(Init);
 
+  inline const URLCore* internal() const { return _internal.get(); }
+
  public:
   static NAN_METHOD(New);
-  static NAN_METHOD(ToStructed);
+  static NAN_METHOD(CanParse);
   static NAN_METHOD(GetURLSearchParams);
   static NAN_METHOD(SetOnPassivelyUpdateFunction);
 
+#define V(_, camel_name) static NAN_METHOD(Get##camel_name);
+  URL_GETTERS(V)
+#undef V
+
   static NAN_METHOD(SetHref);
 #define V(_, camel_name) static NAN_METHOD(Set##camel_name);
   URL_SETTERS(V)
 #undef V
 
  private:
-  NodeURL(v8::Isolate* isolate, std::unique_ptr<URLInternal> url);
+  NodeURL(v8::Isolate* isolate, std::unique_ptr<URLCore> url);
   void OnPassivelyUpdate();
 
  private:
   static Nan::Global<v8::Function> constructor;
 
-  std::unique_ptr<URLInternal> _internal;
+  std::unique_ptr<URLCore> _internal;
   Nan::Global<v8::Function> _on_passively_update;
   v8::Isolate* _isolate;
 };
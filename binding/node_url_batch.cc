@@ -0,0 +1,372 @@
+#include "node_url_batch.h"
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "idna.h"
+#include "node_string.h"
+#include "node_url.h"
+#include "parse_batch.h"
+#include "parser_context.h"
+#include "url_core.h"
+#include "utils/assert.h"
+
+namespace whatwgurl {
+
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using v8::Array;
+using v8::ArrayBuffer;
+using v8::Function;
+using v8::Isolate;
+using v8::Local;
+using v8::MaybeLocal;
+using v8::Object;
+using v8::String;
+using v8::Uint32Array;
+using v8::Value;
+
+constexpr size_t kURLComponentsFieldCount =
+    sizeof(URLComponents) / sizeof(uint32_t);
+
+// Converts `value` to UTF-8 into `out`, reusing whatever `out` has already
+// allocated. Lone surrogates are replaced by U+FFFD, which is what
+// `toUSVString()` would do on the JavaScript side.
+static void WriteUtf8(Isolate* isolate, Local<String> value, string* out) {
+  // A UTF-16 code unit never takes more than 3 bytes in UTF-8.
+  out->resize(static_cast<size_t>(value->Length()) * 3);
+  int written =
+      value->WriteUtf8(isolate,
+                       &(*out)[0],
+                       static_cast<int>(out->size()),
+                       nullptr,
+                       String::NO_NULL_TERMINATION |
+                           String::REPLACE_INVALID_UTF8);
+  out->resize(written);
+}
+
+// Reads the optional base argument of `parseBatch()` / `parseBatchAsync()`.
+// Returns false (with an exception thrown) if it is not a valid URL.
+static bool GetBase(Isolate* isolate,
+                    Local<Value> value,
+                    unique_ptr<URLCore>* base) {
+  if (value->IsUndefined()) return true;
+
+  string scratch;
+  if (value->IsString()) {
+    WriteUtf8(isolate, value.As<String>(), &scratch);
+  } else if (value->IsObject()) {
+    // Take a snapshot of the href: the `NativeURL` can still be changed from
+    // JavaScript while an asynchronous batch is running.
+    NodeURL* url = Nan::ObjectWrap::Unwrap<NodeURL>(value.As<Object>());
+    if (url != nullptr && url->internal() != nullptr &&
+        !url->internal()->failed()) {
+      scratch = url->internal()->href();
+    }
+  }
+
+  base->reset(new URLCore(scratch));
+  if ((*base)->failed()) {
+    Nan::ThrowError("Invalid base URL");
+    return false;
+  }
+
+  return true;
+}
+
+// Parses `input` against `base` (which may be null) with `context` (null
+// means the default one), and stores its href and one row of components. A
+// failed input gets a row of `kOmittedComponent`.
+static bool ParseOne(const string& input,
+                     const URLCore* base,
+                     ParserContext* context,
+                     string* href,
+                     uint32_t* row) {
+  unique_ptr<URLCore> url(base == nullptr
+                              ? new URLCore(input, context)
+                              : new URLCore(input, *base, context));
+  if (url->failed()) {
+    for (size_t i = 0; i < kURLComponentsFieldCount; i++) {
+      row[i] = URLComponents::kOmittedComponent;
+    }
+    return false;
+  }
+
+  URLComponents components;
+  *href = url->href(&components);
+
+  size_t i = 0;
+#define V(name) row[i++] = components.name;
+  URL_COMPONENTS_FIELDS(V)
+#undef V
+
+  return true;
+}
+
+static Local<Uint32Array> NewComponentsArray(Isolate* isolate,
+                                             size_t count,
+                                             uint32_t** data) {
+  size_t length = count * kURLComponentsFieldCount;
+  Local<ArrayBuffer> buffer =
+      ArrayBuffer::New(isolate, length * sizeof(uint32_t));
+  Local<Uint32Array> components = Uint32Array::New(buffer, 0, length);
+
+  Nan::TypedArrayContents<uint32_t> contents(components);
+  CHECK_EQ(contents.length(), length);
+  *data = *contents;
+
+  return components;
+}
+
+static Local<Object> NewBatchResult(Local<Array> hrefs,
+                                    Local<Uint32Array> components) {
+  Local<Object> ret = Nan::New<Object>();
+  Nan::Set(ret, Nan::New<String>("hrefs").ToLocalChecked(), hrefs);
+  Nan::Set(ret, Nan::New<String>("components").ToLocalChecked(), components);
+  return ret;
+}
+
+template <typename T>
+static void FreeColumn(char* data, void* hint) {
+  delete static_cast<T*>(hint);
+}
+
+// Hands the storage of `*column` over to a Buffer without copying it; the
+// storage is freed along with the Buffer.
+template <typename T>
+static Local<Object> NewColumnBuffer(T* column) {
+  if (column->empty()) return Nan::NewBuffer(0).ToLocalChecked();
+
+  T* owned = new T(std::move(*column));
+  char* data = reinterpret_cast<char*>(&(*owned)[0]);
+  size_t length = owned->size() * sizeof((*owned)[0]);
+  return Nan::NewBuffer(data, length, FreeColumn<T>, owned).ToLocalChecked();
+}
+
+// Parses a batch on the libuv threadpool. The inputs are converted to UTF-8
+// up front on the main thread, and the results are only turned into
+// JavaScript values once the work is done.
+//
+// The batch is parsed with the "domain to ASCII" provider that was current,
+// and thread-safe, when it was queued: `init()` may install another one
+// while it runs.
+class ParseBatchWorker : public Nan::AsyncWorker {
+ public:
+  ParseBatchWorker(Nan::Callback* callback,
+                   vector<string>&& inputs,
+                   unique_ptr<URLCore> base,
+                   IDNAToASCIIFunction to_ascii)
+      : Nan::AsyncWorker(callback, "whatwgurl:ParseBatch"),
+        _inputs(std::move(inputs)),
+        _base(std::move(base)),
+        _context(to_ascii),
+        _hrefs(_inputs.size()),
+        _succeeded(_inputs.size()),
+        _components(_inputs.size() * kURLComponentsFieldCount) {}
+
+  void Execute() override {
+    for (size_t i = 0; i < _inputs.size(); i++) {
+      _succeeded[i] = ParseOne(_inputs[i],
+                               _base.get(),
+                               &_context,
+                               &_hrefs[i],
+                               &_components[i * kURLComponentsFieldCount]);
+    }
+  }
+
+ protected:
+  void HandleOKCallback() override {
+    Nan::HandleScope scope;
+    Isolate* isolate = Isolate::GetCurrent();
+
+    uint32_t* data;
+    Local<Uint32Array> components =
+        NewComponentsArray(isolate, _inputs.size(), &data);
+    memcpy(data, _components.data(), _components.size() * sizeof(uint32_t));
+
+    Local<Array> hrefs = Nan::New<Array>(_hrefs.size());
+    for (size_t i = 0; i < _hrefs.size(); i++) {
+      if (!_succeeded[i]) {
+        Nan::Set(hrefs, i, Nan::Null());
+        continue;
+      }
+
+      MaybeLocal<String> href = NewV8String(std::move(_hrefs[i]));
+      CHECK(!href.IsEmpty());
+      Nan::Set(hrefs, i, href.ToLocalChecked());
+    }
+
+    Local<Value> argv[] = {Nan::Null(), NewBatchResult(hrefs, components)};
+    callback->Call(2, argv, async_resource);
+  }
+
+ private:
+  vector<string> _inputs;
+  unique_ptr<URLCore> _base;
+  ParserContext _context;
+
+  vector<string> _hrefs;
+  vector<uint8_t> _succeeded;
+  vector<uint32_t> _components;
+};
+
+NAN_MODULE_INIT(InitURLBatch) {
+  Local<Array> fields = Nan::New<Array>(kURLComponentsFieldCount);
+  uint32_t index = 0;
+#define V(name)                                                                \
+  Nan::Set(fields, index++, Nan::New<String>(#name).ToLocalChecked());
+  URL_COMPONENTS_FIELDS(V)
+#undef V
+  CHECK_EQ(index, kURLComponentsFieldCount);
+
+  Nan::Set(target,
+           Nan::New<String>("urlComponentFields").ToLocalChecked(),
+           fields);
+  Nan::SetMethod(target, "parseBatch", ParseBatch);
+  Nan::SetMethod(target, "parseBatchAsync", ParseBatchAsync);
+  Nan::SetMethod(target, "parseBatchColumns", ParseBatchIntoColumns);
+}
+
+NAN_METHOD(ParseBatch) {
+  CHECK_GE(info.Length(), 1);
+  CHECK(info[0]->IsArray());
+
+  Isolate* isolate = info.GetIsolate();
+  Local<Array> inputs = info[0].As<Array>();
+  uint32_t length = inputs->Length();
+
+  unique_ptr<URLCore> base;
+  if (info.Length() >= 2 && !GetBase(isolate, info[1], &base)) return;
+
+  uint32_t* row;
+  Local<Uint32Array> components = NewComponentsArray(isolate, length, &row);
+
+  Local<Array> hrefs = Nan::New<Array>(length);
+  string input;
+  string href;
+  for (uint32_t i = 0; i < length; i++, row += kURLComponentsFieldCount) {
+    MaybeLocal<Value> maybe_input = Nan::Get(inputs, i);
+    CHECK(!maybe_input.IsEmpty());
+    Local<Value> value = maybe_input.ToLocalChecked();
+    CHECK(value->IsString());
+    WriteUtf8(isolate, value.As<String>(), &input);
+
+    if (!ParseOne(input, base.get(), nullptr, &href, row)) {
+      Nan::Set(hrefs, i, Nan::Null());
+      continue;
+    }
+
+    MaybeLocal<String> ret = NewV8String(std::move(href));
+    CHECK(!ret.IsEmpty());
+    Nan::Set(hrefs, i, ret.ToLocalChecked());
+  }
+
+  info.GetReturnValue().Set(NewBatchResult(hrefs, components));
+}
+
+NAN_METHOD(ParseBatchAsync) {
+  CHECK_EQ(info.Length(), 3);
+  CHECK(info[0]->IsArray());
+  CHECK(info[2]->IsFunction());
+
+  // The worker threads must never call back into JavaScript.
+  IDNAToASCIIFunction to_ascii = GetIDNAEnvironment()->to_ascii;
+  if (!IsIDNAThreadSafe()) {
+    Nan::ThrowError(
+        "parseBatchAsync() is not available with a JavaScript toASCII()");
+    return;
+  }
+
+  Isolate* isolate = info.GetIsolate();
+  Local<Array> inputs = info[0].As<Array>();
+  uint32_t length = inputs->Length();
+
+  unique_ptr<URLCore> base;
+  if (!GetBase(isolate, info[1], &base)) return;
+
+  vector<string> utf8_inputs(length);
+  for (uint32_t i = 0; i < length; i++) {
+    MaybeLocal<Value> maybe_input = Nan::Get(inputs, i);
+    CHECK(!maybe_input.IsEmpty());
+    Local<Value> value = maybe_input.ToLocalChecked();
+    CHECK(value->IsString());
+    WriteUtf8(isolate, value.As<String>(), &utf8_inputs[i]);
+  }
+
+  Nan::Callback* callback = new Nan::Callback(info[2].As<Function>());
+  Nan::AsyncQueueWorker(
+      new ParseBatchWorker(
+          callback, std::move(utf8_inputs), std::move(base), to_ascii));
+}
+
+NAN_METHOD(ParseBatchIntoColumns) {
+  CHECK_GE(info.Length(), 1);
+  CHECK(info[0]->IsArray());
+
+  Isolate* isolate = info.GetIsolate();
+  Local<Array> inputs = info[0].As<Array>();
+  uint32_t length = inputs->Length();
+
+  unique_ptr<URLCore> base;
+  if (info.Length() >= 2 && !GetBase(isolate, info[1], &base)) return;
+
+  vector<string> utf8_inputs(length);
+  for (uint32_t i = 0; i < length; i++) {
+    MaybeLocal<Value> maybe_input = Nan::Get(inputs, i);
+    CHECK(!maybe_input.IsEmpty());
+    Local<Value> value = maybe_input.ToLocalChecked();
+    CHECK(value->IsString());
+    WriteUtf8(isolate, value.As<String>(), &utf8_inputs[i]);
+  }
+
+  // The parsing threads must never call back into JavaScript.
+  ParseBatchOptions options;
+  if (!IsIDNAThreadSafe()) options.threads = 1;
+
+  string base_href;
+  if (base) base_href = base->href();
+
+  BatchColumns columns;
+  CHECK(ParseBatchColumns(utf8_inputs.data(),
+                          utf8_inputs.size(),
+                          base ? &base_href : nullptr,
+                          &columns,
+                          options));
+
+  Local<Object> ret = Nan::New<Object>();
+  Nan::Set(ret,
+           Nan::New<String>("count").ToLocalChecked(),
+           Nan::New<v8::Number>(static_cast<double>(columns.count)));
+  Nan::Set(ret,
+           Nan::New<String>("failures").ToLocalChecked(),
+           Nan::New<v8::Number>(static_cast<double>(columns.failures)));
+  Nan::Set(ret,
+           Nan::New<String>("arena").ToLocalChecked(),
+           NewColumnBuffer(&columns.arena));
+  Nan::Set(ret,
+           Nan::New<String>("failed").ToLocalChecked(),
+           NewColumnBuffer(&columns.failed));
+  Nan::Set(ret,
+           Nan::New<String>("schemeIds").ToLocalChecked(),
+           NewColumnBuffer(&columns.scheme_ids));
+  Nan::Set(ret,
+           Nan::New<String>("hostTypes").ToLocalChecked(),
+           NewColumnBuffer(&columns.host_types));
+  Nan::Set(ret,
+           Nan::New<String>("ports").ToLocalChecked(),
+           NewColumnBuffer(&columns.ports));
+#define V(name)                                                                \
+  Nan::Set(ret,                                                                \
+           Nan::New<String>(#name "Offsets").ToLocalChecked(),                 \
+           NewColumnBuffer(&columns.name##_offsets));                          \
+  Nan::Set(ret,                                                                \
+           Nan::New<String>(#name "Lengths").ToLocalChecked(),                 \
+           NewColumnBuffer(&columns.name##_lengths));
+  BATCH_COLUMNS(V)
+#undef V
+
+  info.GetReturnValue().Set(ret);
+}
+
+}  // namespace whatwgurl
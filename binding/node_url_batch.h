@@ -0,0 +1,39 @@
+#ifndef BINDING_NODE_URL_BATCH_H_
+#define BINDING_NODE_URL_BATCH_H_
+
+#include <nan.h>
+
+namespace whatwgurl {
+
+// Exposes `parseBatch()`, `parseBatchAsync()`, `parseBatchColumns()` and
+// `urlComponentFields` on the module.
+NAN_MODULE_INIT(InitURLBatch);
+
+// parseBatch(inputs: string[], base?: string | NativeURL)
+//
+// Parses every input in one call and returns `{ hrefs, components }`.
+// `hrefs[i]` is the serialized URL, or null if `inputs[i]` failed to parse.
+// `components` is a Uint32Array holding `urlComponentFields.length` values per
+// input, in the layout of `URLComponents` (all of them are
+// `URLComponents::kOmittedComponent` for a failed input).
+NAN_METHOD(ParseBatch);
+
+// parseBatchAsync(inputs: string[], base: string | NativeURL | undefined,
+//                 callback: (err, result) => void)
+//
+// Same as `parseBatch()`, but parses on the libuv threadpool and passes the
+// result to `callback`. Not available while IDNA is delegated to JavaScript.
+NAN_METHOD(ParseBatchAsync);
+
+// parseBatchColumns(inputs: string[], base?: string | NativeURL)
+//
+// Same as `parseBatch()`, with the results as the columns of a
+// `BatchColumns`: `{ count, failures, arena, failed, schemeIds, hostTypes,
+// ports, hrefOffsets, hrefLengths, ... }`. Every column is a Buffer over the
+// native array, handed over without a copy. Parses on several threads unless
+// IDNA is delegated to JavaScript.
+NAN_METHOD(ParseBatchIntoColumns);
+
+}  // namespace whatwgurl
+
+#endif  // BINDING_NODE_URL_BATCH_H_
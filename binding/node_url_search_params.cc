@@ -1,4 +1,5 @@
 #include "node_url_search_params.h"
+#include "node_string.h"
 #include "utils/assert.h"
 
 namespace whatwgurl {
@@ -93,10 +94,9 @@ NAN_METHOD(NodeURLSearchParams::New) {
         CHECK(content->IsString());
         Nan::Utf8String key_utf8(key);
         Nan::Utf8String content_utf8(content);
-        list.push_back(URLSearchParamsKVPairWithIndex(
+        list.push_back(URLSearchParamsKVPair(
             string(*key_utf8, key_utf8.length()),
-            string(*content_utf8, content_utf8.length()),
-            i));
+            string(*content_utf8, content_utf8.length())));
       }
 
       intrnl = make_shared<URLSearchParams>(list);
@@ -157,15 +157,14 @@ NAN_METHOD(NodeURLSearchParams::Get) {
   NodeURLSearchParams* self =
       Nan::ObjectWrap::Unwrap<NodeURLSearchParams>(info.Holder());
 
-  MaybeNullURLSearchParamsKVPair p =
-      self->_internal->Get(string(*key_utf8, key_utf8.length()));
-  if (p.is_null()) {
+  StringView value;
+  if (!self->_internal->Get(StringView(*key_utf8, key_utf8.length()),
+                            &value)) {
     info.GetReturnValue().SetNull();
     return;
   }
 
-  MaybeLocal<String> maybe_value =
-      Nan::New<String>((*p).value.c_str(), (*p).value.length());
+  MaybeLocal<String> maybe_value = NewV8String(value.data(), value.length());
   CHECK(!maybe_value.IsEmpty());
 
   info.GetReturnValue().Set(maybe_value.ToLocalChecked());
@@ -181,13 +180,13 @@ NAN_METHOD(NodeURLSearchParams::GetAll) {
   NodeURLSearchParams* self =
       Nan::ObjectWrap::Unwrap<NodeURLSearchParams>(info.Holder());
 
-  URLSearchParamsList list;
-  self->_internal->GetAll(string(*key_utf8, key_utf8.length()), &list);
+  std::vector<StringView> values;
+  self->_internal->GetAll(StringView(*key_utf8, key_utf8.length()), &values);
 
-  Local<Array> ret = Nan::New<Array>(list.size());
-  for (size_t i = 0; i < list.size(); ++i) {
+  Local<Array> ret = Nan::New<Array>(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
     MaybeLocal<String> second =
-        Nan::New<String>(list[i].value.c_str(), list[i].value.length());
+        NewV8String(values[i].data(), values[i].length());
     CHECK(!second.IsEmpty());
     Nan::Set(ret, i, second.ToLocalChecked());
   }
@@ -237,7 +236,7 @@ NAN_METHOD(NodeURLSearchParams::ToString) {
       Nan::ObjectWrap::Unwrap<NodeURLSearchParams>(info.Holder());
   string ret = self->_internal->Stringify();
 
-  MaybeLocal<String> maybe_value = Nan::New<String>(ret.c_str(), ret.length());
+  MaybeLocal<String> maybe_value = NewV8String(std::move(ret));
   CHECK(!maybe_value.IsEmpty());
 
   info.GetReturnValue().Set(maybe_value.ToLocalChecked());
@@ -285,12 +284,10 @@ void NodeURLSearchParams::GenerateIterableArray(Local<Array>* array) {
 
   Local<Array>& ret = *array;
   for (size_t i = 0; i < list.size(); ++i) {
-    MaybeLocal<String> first =
-        Nan::New<String>(list[i].key.c_str(), list[i].key.length());
+    MaybeLocal<String> first = NewV8String(list[i].key);
     CHECK(!first.IsEmpty());
 
-    MaybeLocal<String> second =
-        Nan::New<String>(list[i].value.c_str(), list[i].value.length());
+    MaybeLocal<String> second = NewV8String(list[i].value);
     CHECK(!second.IsEmpty());
 
     Local<Object> p = Nan::New<Array>(2);
@@ -0,0 +1,109 @@
+#ifndef INCLUDE_ALLOCATION_STATS_H_
+#define INCLUDE_ALLOCATION_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace whatwgurl {
+
+// Allocation counting is compiled in only when `WHATWGURL_ALLOCATION_STATS` is
+// defined (`-Dwhatwgurl_allocation_stats=1` with gyp). Otherwise the recording
+// functions below are empty and `GetAllocationStats()` returns zeros.
+//
+// Where the parser allocates:
+//
+//   parsed_url          `make_shared<ParsedURL>()` of a new URL.
+//   input               The copy of the input that is trimmed before parsing.
+//   resizable_buffer    `ResizableBuffer::Realloc()` outside of
+//                       `TempStringBuffer`, e.g. the copies in `ip_util`.
+//   temp_string_buffer  `TempStringBuffer`'s buffer, including its growth in
+//                       `Append()` / `Prepend()`.
+//   scheme ... fragment The `std::string`s a parsed `ParsedURL` ends up
+//                       owning. Strings short enough for the small string
+//                       optimization do not allocate and are not counted.
+#define ALLOCATION_SITES(V)                                                    \
+  V(parsed_url, ParsedURL)                                                     \
+  V(input, Input)                                                              \
+  V(resizable_buffer, ResizableBuffer)                                         \
+  V(temp_string_buffer, TempStringBuffer)                                      \
+  V(scheme, Scheme)                                                            \
+  V(username, Username)                                                        \
+  V(password, Password)                                                        \
+  V(host, Host)                                                                \
+  V(path, Path)                                                                \
+  V(query, Query)                                                              \
+  V(fragment, Fragment)
+
+enum AllocationSite {
+#define V(_, camel_name) k##camel_name##Allocation,
+  ALLOCATION_SITES(V)
+#undef V
+  kAllocationSiteCount,
+};
+
+struct AllocationSiteStats {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+
+  // Number of times a buffer had to be replaced by a bigger one.
+  uint64_t regrowths = 0;
+};
+
+struct AllocationStats {
+  // Number of (non state-override) parses; divide by it for per-parse figures.
+  uint64_t parses = 0;
+
+#define V(name, _) AllocationSiteStats name;
+  ALLOCATION_SITES(V)
+#undef V
+
+  AllocationSiteStats total() const;
+};
+
+constexpr bool AllocationStatsEnabled() {
+#ifdef WHATWGURL_ALLOCATION_STATS
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Sums the counters of every thread that has parsed since the last
+// `ResetAllocationStats()`.
+AllocationStats GetAllocationStats();
+void ResetAllocationStats();
+
+namespace allocation_stats {
+
+// Out-of-line halves of the functions below. Every thread counts into its own
+// counters, so recording never contends with other threads.
+void Record(AllocationSite site, size_t bytes, bool regrowth);
+void RecordRegrowth(AllocationSite site);
+void RecordParse();
+
+}  // namespace allocation_stats
+
+inline void RecordAllocation(AllocationSite site,
+                             size_t bytes,
+                             bool regrowth = false) {
+#ifdef WHATWGURL_ALLOCATION_STATS
+  allocation_stats::Record(site, bytes, regrowth);
+#endif
+}
+
+// Counts a regrowth whose allocation has already been recorded.
+inline void RecordRegrowth(AllocationSite site) {
+#ifdef WHATWGURL_ALLOCATION_STATS
+  allocation_stats::RecordRegrowth(site);
+#endif
+}
+
+inline void RecordParse() {
+#ifdef WHATWGURL_ALLOCATION_STATS
+  allocation_stats::RecordParse();
+#endif
+}
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_ALLOCATION_STATS_H_
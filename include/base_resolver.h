@@ -0,0 +1,97 @@
+#ifndef INCLUDE_BASE_RESOLVER_H_
+#define INCLUDE_BASE_RESOLVER_H_
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include "host/host_item.h"
+#include "parser_context.h"
+#include "url_core.h"
+
+namespace whatwgurl {
+
+// Resolves many URLs against one base, e.g. the links of a page against the
+// page's URL.
+//
+// The base is parsed once, and its serialization is kept split at the end of
+// the host, of the path and of the query. References of the common shapes are
+// then resolved by appending to those pieces, without running the state
+// machine or copying the base's components:
+//
+//   ""               the base without its fragment
+//   "#fragment"      the base without its fragment, then the fragment
+//   "?query"         the base up to its path, then the query (and fragment)
+//   "/path"          the base up to its host, then the path with its dot
+//                    segments removed (and query and fragment)
+//   "path", "../p"   the same, starting from the base's directory
+//
+// Only references made of printable ASCII that the parser would copy as is,
+// without any validation error, take these paths; the path ones also need a
+// base with a host and a path that is not opaque, and whose scheme is not
+// "file". Anything else goes through the basic URL parser, so the result is
+// always the same as `URLCore(url, base).href()`.
+//
+// `Resolve()` may be called from several threads at once.
+class BaseResolver {
+ public:
+  // `context`, if given, is used for the base and for every URL resolved
+  // against it, and must outlive the resolver. Null means
+  // `ParserContext::Default()`.
+  explicit BaseResolver(const std::string& base,
+                        ParserContext* context = nullptr);
+  explicit BaseResolver(const URLCore& base, ParserContext* context = nullptr);
+
+  BaseResolver(const BaseResolver&) = delete;
+  BaseResolver& operator=(const BaseResolver&) = delete;
+
+  // Whether the base itself failed to parse; nothing resolves against it then.
+  inline bool failed() const { return _failed; }
+
+  // The serialized base, without its fragment.
+  inline const std::string& href() const { return _href; }
+
+  // Resolves `url` against the base into `*href` and, if given,
+  // `*components`; `*host_type`, if given, gets the type of its host, or
+  // `kNotInitialized` if that is null. Returns false if `url` does not parse
+  // against the base.
+  bool Resolve(const std::string& url,
+               std::string* href,
+               URLComponents* components = nullptr,
+               HostType* host_type = nullptr) const;
+
+  // Resolves `url` against the base into a full `URLCore`, for callers that
+  // need more than the href. Always runs the basic URL parser.
+  std::unique_ptr<URLCore> ResolveURL(const std::string& url) const;
+
+ private:
+  void Init();
+
+  bool ResolveFast(const std::string& url,
+                   std::string* href,
+                   URLComponents* components) const;
+
+  ParserContext* _context;
+  std::unique_ptr<URLCore> _base;
+  bool _failed = false;
+
+  // The base without its fragment, and its components.
+  std::string _href;
+  URLComponents _components;
+
+  // The type of the base's host, which the fast paths keep.
+  HostType _host_type = kNotInitialized;
+
+  // Whether "path" and "/path" references may take the fast path.
+  bool _resolves_paths = false;
+
+  // Whether the base's path is opaque, i.e. only "#fragment" references
+  // resolve against it.
+  bool _opaque_path = false;
+
+  // The percent-encode set of the base's query state.
+  const uint8_t* _query_percent_encode_set = nullptr;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_BASE_RESOLVER_H_
@@ -0,0 +1,69 @@
+#ifndef INCLUDE_CACHE_KEY_H_
+#define INCLUDE_CACHE_KEY_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "url_core.h"
+
+namespace whatwgurl {
+
+// Builds cache keys out of URLs: the href without its fragment, with the
+// query's parameters optionally sorted and some of them removed. The scheme
+// and host are already lowercased, and a default port dropped, by the parser.
+//
+// When the query is touched at all (sorting, or any removed parameter), the
+// key is exactly what the steps below would leave in `href()`, fragment
+// aside:
+//
+//   auto params = url.search_params();
+//   params->Sort();                     // if `sort_query`
+//   params->Delete(name);               // for every removed name
+//
+// but without building any of it: the href is written straight into the key,
+// the query rewritten from the URL's, and parameters are only decoded and
+// re-encoded when they hold something the serializer would write
+// differently.
+//
+// `Hash()` is the XXH64 of the key, computed without building it. A
+// `CacheKey` may be used from several threads at once.
+class CacheKey {
+ public:
+  struct Options {
+    // Stable-sorts the query's parameters by name, comparing code units like
+    // `URLSearchParams::Sort()`.
+    bool sort_query = false;
+
+    // Names of the query parameters to remove, compared after decoding. A
+    // name ending in "*" removes every parameter starting with the rest of
+    // it, e.g. "utm_*".
+    std::vector<std::string> removed_parameters;
+  };
+
+  CacheKey() : CacheKey(Options()) {}
+  explicit CacheKey(const Options& options);
+
+  // The key of `url`, into `*key`. `url` must not have failed.
+  void Key(const URLCore& url, std::string* key) const;
+  inline std::string Key(const URLCore& url) const {
+    std::string key;
+    Key(url, &key);
+    return key;
+  }
+
+  uint64_t Hash(const URLCore& url, uint64_t seed = 0) const;
+
+ private:
+  bool IsRemoved(const char* name, size_t length) const;
+
+  template <typename Writer>
+  void Write(const URLCore& url, Writer* writer) const;
+
+  bool _sort_query;
+  std::vector<std::string> _removed_names;
+  std::vector<std::string> _removed_prefixes;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_CACHE_KEY_H_
@@ -31,11 +31,11 @@ namespace whatwgurl {
 
 // An ASCII upper hex digit is an ASCII digit or a code point in the range
 // U+0041 (A) to U+0046 (F), inclusive.
-#define IsASCIIUpperHexDigit(c) (c >= 'A' && c <= 'F')
+#define IsASCIIUpperHexDigit(c) (IsASCIIDigit(c) || (c >= 'A' && c <= 'F'))
 
 // An ASCII lower hex digit is an ASCII digit or a code point in the range
 // U+0061 (a) to U+0066 (f), inclusive.
-#define IsASCIILowerHexDigit(c) (c >= 'a' && c <= 'f')
+#define IsASCIILowerHexDigit(c) (IsASCIIDigit(c) || (c >= 'a' && c <= 'f'))
 
 // An ASCII hex digit is an ASCII upper hex digit or ASCII lower hex digit.
 #define IsASCIIHexDigit(c) (IsASCIIUpperHexDigit(c) || IsASCIILowerHexDigit(c))
@@ -157,11 +157,39 @@ inline bool ReadUtfChar(const CharT*& first,  // NOLINT(runtime/references)
 }
 
 // Ref: https://github.com/rmisev/url_whatwg/blob/9388886/src/url_utf.cpp#L75
-inline int CompareByCodeUnits(const std::string& lhs, const std::string& rhs) {
-  const char* it1 = lhs.c_str();
-  const char* it2 = rhs.c_str();
-  const char* last1 = it1 + lhs.size();
-  const char* last2 = it2 + rhs.size();
+inline int CompareByCodeUnits(const char* lhs,
+                              size_t lhs_length,
+                              const char* rhs,
+                              size_t rhs_length) {
+  // Skip the common prefix byte by byte. `boundary` is the position right
+  // after the last ASCII byte of the prefix: ASCII bytes are never consumed as
+  // trail bytes by `ReadUtfChar`, so it is always a code point boundary for
+  // both strings.
+  size_t min_length = lhs_length < rhs_length ? lhs_length : rhs_length;
+  size_t boundary = 0;
+  size_t i = 0;
+  while (i < min_length && lhs[i] == rhs[i]) {
+    if (static_cast<unsigned char>(lhs[i]) < 0x80) boundary = i + 1;
+    ++i;
+  }
+
+  // UTF-8 byte order equals code unit order unless supplementary code points
+  // (surrogate pairs) are compared with U+E000..U+FFFF, so a plain byte
+  // compare is enough when the strings diverge at an ASCII code point.
+  unsigned char c1 = i < lhs_length ? static_cast<unsigned char>(lhs[i]) : 0;
+  unsigned char c2 = i < rhs_length ? static_cast<unsigned char>(rhs[i]) : 0;
+  if ((c1 < 0x80 && c2 < 0x80) ||
+      (i == boundary && (c1 < 0x80 || c2 < 0x80))) {
+    if (i == min_length) {
+      return lhs_length == rhs_length ? 0 : (lhs_length < rhs_length ? -1 : 1);
+    }
+    return static_cast<int>(c1) - static_cast<int>(c2);
+  }
+
+  const char* it1 = lhs + boundary;
+  const char* it2 = rhs + boundary;
+  const char* last1 = lhs + lhs_length;
+  const char* last2 = rhs + rhs_length;
   while (it1 != last1 && it2 != last2) {
     if (static_cast<unsigned char>(*it1) < 0x80 ||
         static_cast<unsigned char>(*it2) < 0x80) {
@@ -196,6 +224,10 @@ inline int CompareByCodeUnits(const std::string& lhs, const std::string& rhs) {
   return 0;
 }
 
+inline int CompareByCodeUnits(const std::string& lhs, const std::string& rhs) {
+  return CompareByCodeUnits(lhs.c_str(), lhs.size(), rhs.c_str(), rhs.size());
+}
+
 }  // namespace whatwgurl
 
 #endif  // INCLUDE_CODE_POINTS_H_
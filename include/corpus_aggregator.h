@@ -0,0 +1,203 @@
+#ifndef INCLUDE_CORPUS_AGGREGATOR_H_
+#define INCLUDE_CORPUS_AGGREGATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "parse_batch.h"
+#include "parsed_url.h"
+#include "parser_context.h"
+
+namespace whatwgurl {
+
+// Estimates the number of distinct 64-bit hashes added to it, in
+// `2^precision` bytes, with a standard error of about
+// `1.04 / sqrt(2^precision)` (0.8% at the default precision).
+class HyperLogLog {
+ public:
+  static constexpr unsigned kMinPrecision = 4;
+  static constexpr unsigned kMaxPrecision = 18;
+
+  explicit HyperLogLog(unsigned precision = 14);
+
+  inline void Add(uint64_t hash) {
+    // The first `precision` bits pick the register; it keeps the highest
+    // rank (position of the first 1 bit) of the other bits seen so far.
+    size_t index = hash >> (64 - _precision);
+    uint64_t rest = (hash << _precision) | (uint64_t{1} << (_precision - 1));
+    uint8_t rank = static_cast<uint8_t>(__builtin_clzll(rest) + 1);
+    if (rank > _registers[index]) _registers[index] = rank;
+  }
+
+  // Adds the hashes `other` has seen. Both must have the same precision.
+  void Merge(const HyperLogLog& other);
+
+  double Estimate() const;
+
+ private:
+  unsigned _precision;
+  std::vector<uint8_t> _registers;
+};
+
+// Finds the most frequent keys of a stream in bounded memory, with the
+// space-saving algorithm (Metwally et al., "Efficient Computation of Frequent
+// and Top-k Elements in Data Streams"): it monitors up to `capacity` keys, and
+// a key that is not monitored replaces the least frequent one, inheriting its
+// count as the upper bound of its error. Every key whose frequency is above
+// `1 / capacity` of the stream is guaranteed to be monitored.
+//
+// Keys are told apart by their 64-bit hash alone. Their bytes are only copied
+// when they start being monitored.
+class SpaceSaving {
+ public:
+  struct Entry {
+    std::string key;
+    uint64_t hash;
+
+    // An upper bound of the key's frequency, which overestimates it by at
+    // most `error`.
+    uint64_t count;
+    uint64_t error;
+  };
+
+  explicit SpaceSaving(size_t capacity);
+
+  void Add(uint64_t hash, const char* key, size_t length, uint64_t count = 1);
+
+  // Combines the summaries of two streams into one of their concatenation
+  // (Agarwal et al., "Mergeable Summaries"). Both must have the same capacity.
+  void Merge(const SpaceSaving& other);
+
+  // The `k` keys with the highest counts, highest first.
+  std::vector<Entry> Top(size_t k) const;
+
+  inline size_t capacity() const { return _capacity; }
+
+ private:
+  static constexpr uint32_t kEmptySlot = 0xffffffff;
+
+  // The count a key that is not monitored may have at most.
+  inline uint64_t MissingCount() const {
+    return _entries.size() == _capacity ? _entries[_heap[0]].count : 0;
+  }
+
+  size_t FindSlot(uint64_t hash) const;
+  void EraseSlot(size_t slot);
+  void SiftDown(size_t position);
+  void SiftUp(size_t position);
+  void Rebuild(std::vector<Entry>* entries);
+
+  size_t _capacity;
+
+  // The monitored keys, and a min-heap of their indices by count.
+  std::vector<Entry> _entries;
+  std::vector<uint32_t> _heap;
+  std::vector<uint32_t> _heap_positions;
+
+  // An open-addressing table of indices into `_entries`, by hash.
+  std::vector<uint32_t> _slots;
+};
+
+// Bounded-memory statistics over a stream of URLs, e.g. the request URLs of
+// an access log: how many parsed, their schemes and host types, the most
+// frequent hosts, the number of distinct hosts and pathnames, and histograms
+// of path depths and query parameter counts.
+//
+// Every URL is parsed into a `ParsedURL` the aggregator reuses, and the
+// statistics are taken from its fields; nothing is serialized. Hosts are
+// hashed as their raw value (the address of an IP address) and pathnames as
+// the serialized pathname would be, a segment at a time.
+//
+// An aggregator is not thread-safe. To aggregate on several threads, give
+// each its own and `Merge()` them once they are done.
+class CorpusAggregator {
+ public:
+  // Histograms have one bucket per value up to `kHistogramBuckets - 2`, and a
+  // last one for that and anything above.
+  static constexpr size_t kHistogramBuckets = 16;
+
+  struct Options {
+    // How many hosts the top-host summary monitors. Hosts making up more than
+    // `1 / top_hosts` of the URLs are always in it.
+    size_t top_hosts = 1024;
+
+    // The precision of the distinct-count estimates; see `HyperLogLog`.
+    unsigned distinct_precision = 14;
+
+    // Used for every parse; null means `ParserContext::Default()`.
+    ParserContext* context = nullptr;
+  };
+
+  struct HostCount {
+    std::string host;
+    uint64_t count;
+    uint64_t error;
+  };
+
+  CorpusAggregator() : CorpusAggregator(Options()) {}
+  explicit CorpusAggregator(const Options& options);
+
+  // Parses `url`, against `base` if it is non-null, and adds it. Returns
+  // false, and only counts a failure, if it does not parse.
+  bool Add(const std::string& url, const ParsedURL* base = nullptr);
+
+  // Adds a URL parsed already.
+  void Add(const ParsedURL& url);
+
+  // Adds what `other` has aggregated. Both must have the same options.
+  void Merge(const CorpusAggregator& other);
+
+  inline uint64_t urls() const { return _urls; }
+  inline uint64_t failures() const { return _failures; }
+
+  // URLs per `BatchSchemeId`.
+  inline const uint64_t* scheme_counts() const { return _scheme_counts; }
+
+  // URLs per `HostType`, with the URLs whose host is null last.
+  inline const uint64_t* host_type_counts() const { return _host_type_counts; }
+  static constexpr size_t kNullHostTypeIndex = kEmptyHost + 1;
+
+  // URLs per number of path segments (0 for an opaque path) and per number of
+  // query parameters (0 for a null query), in `kHistogramBuckets` buckets.
+  inline const uint64_t* path_depths() const { return _path_depths; }
+  inline const uint64_t* query_parameter_counts() const {
+    return _query_parameter_counts;
+  }
+
+  // Estimates of the number of distinct hosts (among the non-null ones) and
+  // distinct pathnames.
+  inline double DistinctHosts() const { return _distinct_hosts.Estimate(); }
+  inline double DistinctPaths() const { return _distinct_paths.Estimate(); }
+
+  // The (at most) `k` most frequent hosts, serialized, most frequent first.
+  std::vector<HostCount> TopHosts(size_t k) const;
+
+  // {"urls": n, "failures": n, "schemes": {"<scheme>": n},
+  //  "host_types": {"<type>": n}, "distinct_hosts": n, "distinct_paths": n,
+  //  "path_depths": [n], "query_parameter_counts": [n],
+  //  "top_hosts": [{"host": "<host>", "count": n, "error": n}]}
+  //
+  // Lists at most `top_hosts` hosts.
+  std::string ToJSON(size_t top_hosts = 20) const;
+
+ private:
+  ParserContext* _context;
+  ParsedURL _scratch;
+  std::string _key;
+
+  uint64_t _urls = 0;
+  uint64_t _failures = 0;
+  uint64_t _scheme_counts[kWssSchemeId + 1] = {};
+  uint64_t _host_type_counts[kNullHostTypeIndex + 1] = {};
+  uint64_t _path_depths[kHistogramBuckets] = {};
+  uint64_t _query_parameter_counts[kHistogramBuckets] = {};
+
+  SpaceSaving _top_hosts;
+  HyperLogLog _distinct_hosts;
+  HyperLogLog _distinct_paths;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_CORPUS_AGGREGATOR_H_
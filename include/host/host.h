@@ -3,16 +3,23 @@
 
 #include "host_item.h"
 #include "maybe.h"
+#include "parser_context.h"
 #include "temp_string_buffer.h"
+#include "validation_error.h"
 
 namespace whatwgurl {
 
 class Host : public MaybeNull<HostItem> {
  public:
+  // Validation errors go to `errors`, at offsets counted from `offset`, where
+  // `input` starts in the string being parsed. `context` provides "domain to
+  // ASCII"; null means `ParserContext::Default()`.
   static bool Parse(const TempStringBuffer& input,
                     Host* host,
-                    bool* validation_error,
-                    bool is_not_special = false);
+                    ValidationErrorReporter* errors,
+                    size_t offset,
+                    bool is_not_special = false,
+                    ParserContext* context = nullptr);
 
   inline virtual Host& operator=(const Host& other) {
     if (this == &other) {
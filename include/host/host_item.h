@@ -95,16 +95,8 @@ struct HostItem {
   }
 
   inline std::string ipv4_address_string() const {
-    CHECK(type == kIPv4Address);
     char ip[kMaxFormattedHostIPv4Len + 1];
-    unsigned char bytes[4];
-    bytes[0] = (host.ipv4_address >> 24) & 0xff;
-    bytes[1] = (host.ipv4_address >> 16) & 0xff;
-    bytes[2] = (host.ipv4_address >> 8) & 0xff;
-    bytes[3] = host.ipv4_address & 0xff;
-    snprintf(
-        ip, sizeof(ip), "%d.%d.%d.%d", bytes[0], bytes[1], bytes[2], bytes[3]);
-    return ip;
+    return std::string(ip, FormatIPv4Address(ip));
   }
 
   inline const uint16_t* ipv6_address() const {
@@ -113,30 +105,8 @@ struct HostItem {
   }
 
   inline std::string ipv6_address_string() const {
-    CHECK(type == kIPv6Address);
-
-    std::string ipv6_str = "";
-    const uint16_t* start = host.ipv6_address;
-    const uint16_t* compress_pointer = FindLongestZeroSequence(start, 8);
-    bool ignore0 = false;
-    for (int n = 0; n <= 7; n++) {
-      const uint16_t* piece = host.ipv6_address + n;
-      if (ignore0 && *piece == 0)
-        continue;
-      else if (ignore0)
-        ignore0 = false;
-      if (compress_pointer == piece) {
-        ipv6_str += n == 0 ? "::" : ":";
-        ignore0 = true;
-        continue;
-      }
-      char buf[5];
-      snprintf(buf, sizeof(buf), "%x", *piece);
-      ipv6_str += buf;
-      if (n < 7) ipv6_str += ':';
-    }
-
-    return ipv6_str;
+    char ip[kMaxFormattedHostIPv6Len + 1];
+    return std::string(ip, FormatIPv6Address(ip));
   }
 
   inline std::string Serialize() const {
@@ -167,8 +137,119 @@ struct HostItem {
     }
   }
 
+  // Appends `Serialize()` to `writer` (see `URLCore::Write()`), without
+  // building a string.
+  template <typename Writer>
+  inline void Write(Writer* writer) const {
+    char ip[kMaxFormattedHostIPv6Len + 3];
+    switch (type) {
+      case kIPv4Address:
+        writer->Append(ip, FormatIPv4Address(ip));
+        break;
+
+      case kIPv6Address: {
+        ip[0] = '[';
+        size_t length = 1 + FormatIPv6Address(ip + 1);
+        ip[length++] = ']';
+        writer->Append(ip, length);
+        break;
+      }
+
+      case kDomain:
+        writer->Append(host.domain.data(), host.domain.length());
+        break;
+
+      case kOpaqueHost:
+        writer->Append(host.opaque_host.data(), host.opaque_host.length());
+        break;
+
+      case kEmptyHost:
+        break;
+
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  // `Serialize().length()`, without building the string for a domain, an
+  // opaque host or an empty host.
+  inline size_t SerializedLength() const {
+    switch (type) {
+      case kDomain:
+        return host.domain.length();
+
+      case kOpaqueHost:
+        return host.opaque_host.length();
+
+      case kEmptyHost:
+        return 0;
+
+      default:
+        return Serialize().length();
+    }
+  }
+
  private:
+  // The IPv4 serializer, into `ip`, which must hold
+  // `kMaxFormattedHostIPv4Len + 1` bytes. Returns the length.
+  inline size_t FormatIPv4Address(char* ip) const {
+    CHECK(type == kIPv4Address);
+    unsigned char bytes[4];
+    bytes[0] = (host.ipv4_address >> 24) & 0xff;
+    bytes[1] = (host.ipv4_address >> 16) & 0xff;
+    bytes[2] = (host.ipv4_address >> 8) & 0xff;
+    bytes[3] = host.ipv4_address & 0xff;
+    int n = snprintf(ip,
+                     kMaxFormattedHostIPv4Len + 1,
+                     "%d.%d.%d.%d",
+                     bytes[0],
+                     bytes[1],
+                     bytes[2],
+                     bytes[3]);
+    CHECK_GE(n, 0);
+    return n;
+  }
+
+  // The IPv6 serializer, into `ip`, which must hold
+  // `kMaxFormattedHostIPv6Len + 1` bytes. Returns the length.
+  inline size_t FormatIPv6Address(char* ip) const {
+    CHECK(type == kIPv6Address);
+
+    size_t length = 0;
+    const uint16_t* start = host.ipv6_address;
+    const uint16_t* compress_pointer = FindLongestZeroSequence(start, 8);
+    bool ignore0 = false;
+    for (int n = 0; n <= 7; n++) {
+      const uint16_t* piece = host.ipv6_address + n;
+      if (ignore0 && *piece == 0)
+        continue;
+      else if (ignore0)
+        ignore0 = false;
+      if (compress_pointer == piece) {
+        if (n == 0) ip[length++] = ':';
+        ip[length++] = ':';
+        ignore0 = true;
+        continue;
+      }
+      length += snprintf(ip + length, 5, "%x", *piece);
+      if (n < 7) ip[length++] = ':';
+    }
+
+    ip[length] = '\0';
+    return length;
+  }
+
   inline void Set(const HostItem& other) {
+    // A string host replacing one of the same type reuses its buffer.
+    if (type == other.type && type == kDomain) {
+      host.domain = other.host.domain;
+      return;
+    }
+    if (type == other.type && type == kOpaqueHost) {
+      host.opaque_host = other.host.opaque_host;
+      return;
+    }
+
     Destruct();
     type = other.type;
     switch (type) {
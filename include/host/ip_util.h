@@ -7,6 +7,7 @@
 namespace whatwgurl {
 
 #define kMaxFormattedHostIPv4Len (15)
+#define kMaxFormattedHostIPv6Len (39)
 
 enum IPv6FormatResult : int8_t {
   kIPv6FormatOK = 0,
@@ -26,7 +27,13 @@ enum IPv4TransformSegmentResult : int8_t {
 };
 
 IPv6FormatResult FormatIPv6(const char* in, int in_len, uint16_t* out);
-IPv4FormatResult FormatIPv4(const char* in, int in_len, uint32_t* out);
+// On `kIPv4FormatOK`, `*validation_error`, if given, tells whether the IPv4
+// parser raises validation errors on the way: an empty last part, a part that
+// is not decimal, or a last part over 255.
+IPv4FormatResult FormatIPv4(const char* in,
+                            int in_len,
+                            uint32_t* out,
+                            bool* validation_error = nullptr);
 
 inline IPv4TransformSegmentResult TransformIPv4SegmentFromHex(
     const char* segment, unsigned int max_range, unsigned int* out);
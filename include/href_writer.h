@@ -0,0 +1,54 @@
+#ifndef INCLUDE_HREF_WRITER_H_
+#define INCLUDE_HREF_WRITER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include "xxhash64.h"
+
+namespace whatwgurl {
+
+// Writers for `URLCore::Write()`, which hands them an href a piece at a time.
+// A writer has `Append(const char*, size_t)`, `Append(char)` and `length()`,
+// the number of bytes appended so far.
+
+// Appends the pieces to a string.
+class StringWriter {
+ public:
+  explicit StringWriter(std::string* output) : _output(output) {}
+
+  inline void Append(const char* data, size_t length) {
+    _output->append(data, length);
+  }
+  inline void Append(char c) { _output->push_back(c); }
+  inline size_t length() const { return _output->length(); }
+
+ private:
+  std::string* _output;
+};
+
+// Hashes the pieces as they come, giving the XXH64 of their concatenation.
+class HashWriter {
+ public:
+  explicit HashWriter(uint64_t seed = 0) : _hash(seed) {}
+
+  inline void Append(const char* data, size_t length) {
+    _hash.Update(data, length);
+    _length += length;
+  }
+  inline void Append(char c) {
+    _hash.Update(c);
+    _length++;
+  }
+  inline size_t length() const { return _length; }
+
+  inline uint64_t Digest() const { return _hash.Digest(); }
+
+ private:
+  XXH64 _hash;
+  size_t _length = 0;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_HREF_WRITER_H_
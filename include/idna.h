@@ -22,7 +22,35 @@ typedef int32_t (*IDNAToASCIIFunction)(std::string* buf,
                                        size_t length,
                                        IDNAMode mode);
 
-extern IDNAToASCIIFunction kIDNAToASCII;
+// The "domain to ASCII" provider used by the host parser. An environment is
+// never modified once published, nor freed before exit, so a parser that has
+// loaded it can keep using it while another thread installs a new one.
+struct IDNAEnvironment {
+  IDNAToASCIIFunction to_ascii;
+};
+
+// Returns the current environment. It is never null.
+const IDNAEnvironment* GetIDNAEnvironment();
+
+// Atomically publishes an environment using `function`, or the default
+// `PunycodeToASCII()` if `function` is null. There is one environment per
+// function, so installing a function again reuses its environment.
+void SetIDNAToASCIIFunction(IDNAToASCIIFunction function);
+
+// A self-contained "domain to ASCII" that needs neither ICU nor a JavaScript
+// engine, so it can be used from any thread. Labels are split on U+002E (.),
+// U+3002, U+FF0E and U+FF61, ASCII upper alphas are lowercased, and every label
+// that contains a non-ASCII code point is Punycode-encoded with an "xn--"
+// prefix. It does not apply the rest of the UTS #46 mapping. `kIDNAStrict`
+// then requires labels of ASCII lower alphas, digits and U+002D (-) only, 1
+// to 63 bytes long, in a domain of at most 253 bytes.
+//
+// Writes the result to `buf` and returns its length, or returns -1 if `input`
+// is not valid UTF-8, cannot be encoded, or fails the strict checks.
+int32_t PunycodeToASCII(std::string* buf,
+                        const char* input,
+                        size_t length,
+                        IDNAMode mode);
 
 }  // namespace whatwgurl
 
@@ -120,6 +120,8 @@ class MaybeList {
     return _list.size();
   }
 
+  inline size_t capacity() const { return _list.capacity(); }
+
   virtual inline void PushBack(const T& value) {
     CHECK(_is_list);
     _list.push_back(value);
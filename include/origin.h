@@ -3,6 +3,7 @@
 
 #include <string>
 #include "host/host_item.h"
+#include "href_writer.h"
 #include "maybe.h"
 #include "port.h"
 
@@ -22,32 +23,48 @@ class TupleOrigin : public MaybeNull<TupleOriginItem> {
     return *this;
   }
 
+  // Makes this a tuple origin and returns its item to be filled in. The
+  // strings of the item keep their buffers, so an origin filled over and over
+  // stops allocating.
+  inline TupleOriginItem* SetTuple() {
+    _is_null = false;
+    return &_value;
+  }
+
   // The serialization of an origin is the string obtained by applying the
   // following algorithm to the given origin origin:
   inline std::string Serialize() const {
+    std::string result;
+    StringWriter writer(&result);
+    Write(&writer);
+    return result;
+  }
+
+  // `Serialize()`, appended to `writer` (see href_writer.h).
+  template <typename Writer>
+  inline void Write(Writer* writer) const {
     // If origin is an opaque origin, then return "null".
     if (is_null()) {
-      return "null";
+      writer->Append("null", 4);
+      return;
     }
 
     // Otherwise, let result be origin's scheme.
-    std::string result = (*this)->scheme;
+    const std::string& scheme = (*this)->scheme;
+    writer->Append(scheme.data(), scheme.length());
 
     // Append "://" to result.
-    result += "://";
+    writer->Append("://", 3);
 
     // Append origin's host, serialized, to result.
-    result += (*this)->host.Serialize();
+    (*this)->host.Write(writer);
 
     // If origin's port is non-null, append a U+003A COLON character (:), and
     // origin's port, serialized, to result.
     if (!(*this)->port.is_null()) {
-      result += ":";
-      result += (*this)->port.Serialize();
+      writer->Append(':');
+      (*this)->port.Write(writer);
     }
-
-    // Return result.
-    return result;
   }
 
   void Dump() {
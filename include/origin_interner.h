@@ -0,0 +1,108 @@
+#ifndef INCLUDE_ORIGIN_INTERNER_H_
+#define INCLUDE_ORIGIN_INTERNER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+#include <vector>
+#include "origin.h"
+#include "url_core.h"
+
+namespace whatwgurl {
+
+typedef uint32_t OriginId;
+
+// Every opaque origin is a new one, equal to no other, so they all share an
+// ID that is never same-origin with anything.
+constexpr OriginId kOpaqueOriginId = 0;
+
+inline bool IsSameOrigin(OriginId a, OriginId b) {
+  return a == b && a != kOpaqueOriginId;
+}
+
+// Maps the tuple origins of URLs to small integers, 1 upwards in the order
+// they are first seen, so that a same-origin check is an integer compare. IDs
+// are stable for the life of the interner.
+//
+// It is thread-safe. Looking up an origin that is already interned takes no
+// lock: the table is open-addressed over atomic slots, and is replaced rather
+// than resized when it fills up, so a reader holding the old one stays safe.
+// Only the first sight of an origin locks. A thread fills its origins and
+// their serializations into buffers of its own, so steady-state lookups do
+// not allocate either.
+class OriginInterner {
+ public:
+  OriginInterner();
+  ~OriginInterner();
+
+  OriginInterner(const OriginInterner&) = delete;
+  OriginInterner& operator=(const OriginInterner&) = delete;
+
+  // The ID of the origin of `url`, which must not have failed, interning it
+  // if it is new.
+  OriginId Intern(const URLCore& url);
+  OriginId Intern(const TupleOrigin& origin);
+
+  // Like `Intern()`, but without interning: false if the origin is opaque or
+  // has not been interned.
+  bool Find(const URLCore& url, OriginId* id) const;
+  bool Find(const TupleOrigin& origin, OriginId* id) const;
+
+  // The serialization of the origin `id` stands for, "null" for
+  // `kOpaqueOriginId`.
+  const std::string& Serialize(OriginId id) const;
+
+  // The number of origins interned.
+  inline size_t size() const { return _size.load(std::memory_order_acquire); }
+
+ private:
+  struct Entry {
+    uint64_t hash;
+    std::string serialization;
+  };
+
+  // Slots hold IDs, 0 when empty.
+  struct Table {
+    explicit Table(size_t capacity);
+
+    size_t mask;
+    std::unique_ptr<std::atomic<OriginId>[]> slots;
+  };
+
+  // Entries live in chunks of doubling sizes, which never move once
+  // allocated.
+  static constexpr size_t kFirstChunkBits = 6;
+  static constexpr size_t kMaxChunks = 32 - kFirstChunkBits;
+
+  // The chunk of the entry at `index` (the ID minus 1), and the index of the
+  // first entry of `chunk`.
+  static inline size_t ChunkOf(size_t index) {
+    return 63 - __builtin_clzll((index >> kFirstChunkBits) + 1);
+  }
+  static inline size_t ChunkStart(size_t chunk) {
+    return ((size_t{1} << chunk) - 1) << kFirstChunkBits;
+  }
+
+  const Entry& EntryAt(OriginId id) const;
+  OriginId Lookup(const Table* table,
+                  uint64_t hash,
+                  const std::string& serialization) const;
+  OriginId Insert(uint64_t hash, const std::string& serialization);
+  void Grow();
+
+  std::atomic<Table*> _table;
+  std::atomic<Entry*> _chunks[kMaxChunks];
+  std::atomic<size_t> _size;
+
+  // Taken to add an origin. Holds the current table and every one it
+  // replaced, which readers may still be in.
+  std::mutex _mutex;
+  std::vector<std::unique_ptr<Table>> _tables;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_ORIGIN_INTERNER_H_
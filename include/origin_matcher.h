@@ -0,0 +1,98 @@
+#ifndef INCLUDE_ORIGIN_MATCHER_H_
+#define INCLUDE_ORIGIN_MATCHER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "parse_batch.h"
+#include "parsed_url.h"
+#include "url_core.h"
+
+namespace whatwgurl {
+
+// Tells whether the origin of a URL is one of a set of allowed origins, e.g.
+// for CORS. The set is built out of origins and patterns:
+//
+//   https://example.com        the origin itself
+//   https://example.com:8443   a port other than the default
+//   https://*.example.com      any host strictly below example.com
+//   http://localhost:*         any port, the default one included
+//
+// Hosts and ports go through the URL parser, so "HTTPS://EXAMPLE.COM:443"
+// is "https://example.com". Only tuple origins can match, that is those of
+// URLs with a special scheme other than "file", and of blob URLs wrapping
+// one; opaque origins never do.
+//
+// Checks compare the URL's components against a trie of the allowed hosts,
+// one per scheme, keyed by their labels from right to left: they neither
+// serialize the origin nor allocate. After it is built, a matcher may be
+// used from several threads at once.
+class OriginMatcher {
+ public:
+  OriginMatcher();
+
+  // Allows the origins `pattern` stands for. Returns false, and allows
+  // nothing, if it is not an origin or pattern as above.
+  bool Add(const std::string& pattern);
+
+  bool Matches(const ParsedURL& url) const;
+  bool Matches(const URLCore& url) const;
+
+  // The number of patterns added.
+  inline size_t size() const { return _size; }
+
+ private:
+  // The ports a pattern allows: null is the scheme's default port.
+  struct PortSet {
+    bool any = false;
+    bool null = false;
+    std::vector<uint16_t> ports;
+
+    void Add(const Port& port, bool any_port);
+    bool Contains(const Port& port) const;
+  };
+
+  // A node of a trie stands for a domain: its parent's with one more label
+  // to the left.
+  struct Node {
+    struct Child {
+      std::string label;
+      uint32_t node;
+    };
+
+    // Sorted by label.
+    std::vector<Child> children;
+
+    // The ports allowed on the domain itself, and on every domain below it.
+    PortSet exact;
+    PortSet below;
+  };
+
+  // Hosts that are IP addresses only match exactly, by their serialization.
+  struct Address {
+    std::string host;
+    PortSet ports;
+  };
+
+  uint32_t FindChild(uint32_t node, const char* label, size_t length) const;
+  uint32_t AddChild(uint32_t node, const char* label, size_t length);
+  bool MatchesDomain(BatchSchemeId scheme,
+                     const std::string& domain,
+                     const Port& port) const;
+  bool MatchesAddress(BatchSchemeId scheme,
+                      const HostItem& host,
+                      const Port& port) const;
+
+  // `_nodes[scheme]` is the root of the trie of `scheme`.
+  std::vector<Node> _nodes;
+
+  // Sorted by host.
+  std::vector<Address> _addresses[kWssSchemeId + 1];
+
+  size_t _size = 0;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_ORIGIN_MATCHER_H_
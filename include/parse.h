@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include "parsed_url.h"
+#include "parser_context.h"
 
 namespace whatwgurl {
 
@@ -34,11 +35,33 @@ enum ParseState {
   kParseErrorState = -2,
 };
 
+// Runs the basic URL parser. `context` supplies IDNA and strictness settings;
+// null means `ParserContext::Default()`.
 bool Parse(const std::string& input,
            const ParsedURL* base,
            std::shared_ptr<ParsedURL>* url,
            bool* validation_error,
-           ParseState state_override = kNotGiven);
+           ParseState state_override = kNotGiven,
+           ParserContext* context = nullptr);
+
+// Same as `Parse()` without a state override, into a `ParsedURL` the caller
+// owns. `*url` is cleared first, so one `ParsedURL` can take many URLs in
+// turn without allocating a new one each time.
+bool ParseInto(const std::string& input,
+               const ParsedURL* base,
+               ParsedURL* url,
+               bool* validation_error,
+               ParserContext* context = nullptr);
+
+// Runs the basic URL parser on `input` only to find out whether it parses.
+// The URL is kept on the stack, its username, password, query and fragment
+// are measured rather than built, and nothing is serialized. On success,
+// `href_length`, if non-null, receives the length of the URL's href.
+bool Validate(const std::string& input,
+              const ParsedURL* base,
+              size_t* href_length,
+              bool* validation_error,
+              ParserContext* context = nullptr);
 
 }  // namespace whatwgurl
 
@@ -0,0 +1,144 @@
+#ifndef INCLUDE_PARSE_BATCH_H_
+#define INCLUDE_PARSE_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "parser_context.h"
+#include "scheme.h"
+#include "url_core.h"
+
+namespace whatwgurl {
+
+struct ParseBatchOptions {
+  // Number of threads parsing, the calling one included. 0 means one per CPU.
+  unsigned threads = 0;
+
+  // Number of inputs a thread takes at a time. Smaller chunks balance uneven
+  // inputs better, larger ones cost less synchronization.
+  size_t chunk_size = 256;
+
+  // Used for the base and for every input; null means
+  // `ParserContext::Default()`. It is shared by all the threads.
+  ParserContext* context = nullptr;
+};
+
+// The results of `ParseBatch()`, in the order of the inputs.
+struct ParseBatchOutput {
+  // The href of every input, empty for the ones that failed.
+  std::vector<std::string> hrefs;
+
+  // The components of every href; all `URLComponents::kOmittedComponent` for
+  // the inputs that failed.
+  std::vector<URLComponents> components;
+
+  // 1 for the inputs that parsed, 0 for the others.
+  std::vector<uint8_t> succeeded;
+
+  size_t failures = 0;
+};
+
+// Identifies the scheme of a URL in `BatchColumns`: the special schemes
+// in the order of `kSpecialSchemes`, and every other scheme as one.
+enum BatchSchemeId : uint8_t {
+  kOtherSchemeId = 0,
+  kFtpSchemeId,
+  kFileSchemeId,
+  kHttpSchemeId,
+  kHttpsSchemeId,
+  kWsSchemeId,
+  kWssSchemeId,
+};
+
+// The `BatchSchemeId` of the scheme `[scheme, scheme + length)`.
+inline BatchSchemeId GetBatchSchemeId(const char* scheme, size_t length) {
+  const SpecialScheme* special = FindSpecialScheme(scheme, length);
+  if (special == nullptr) return kOtherSchemeId;
+  return static_cast<BatchSchemeId>(kFtpSchemeId + (special - kSpecialSchemes));
+}
+
+// The components `BatchColumns` has offset and length columns for. The
+// ranges are those of the href: the scheme without its ":", the serialized
+// host (IPv6 addresses with their brackets), the serialized path, and the
+// query and fragment without their "?" and "#".
+#define BATCH_COLUMNS(V)                                                       \
+  V(href)                                                                      \
+  V(scheme)                                                                    \
+  V(host)                                                                      \
+  V(path)                                                                      \
+  V(query)                                                                     \
+  V(fragment)
+
+// The results of `ParseBatchColumns()` as columns: one array per field,
+// indexed like the inputs, and the hrefs back to back in a single arena.
+//
+// A component that is null (or belongs to an input that failed) has
+// `URLComponents::kOmittedComponent` as its offset and 0 as its length; an
+// empty query or fragment has a real offset and a length of 0.
+struct BatchColumns {
+  static constexpr uint8_t kNullHostType = 0xff;
+
+  size_t count = 0;
+  size_t failures = 0;
+
+  // Every href of the batch. Offsets are `uint32_t`, so a batch can produce
+  // up to 4 GiB of hrefs.
+  std::string arena;
+
+  // Bit `i % 64` of `failed[i / 64]` is set if input `i` failed.
+  std::vector<uint64_t> failed;
+
+  // A `BatchSchemeId` per input.
+  std::vector<uint8_t> scheme_ids;
+
+  // A `HostType` per input, or `kNullHostType` when its host is null.
+  std::vector<uint8_t> host_types;
+
+  // The port number, or `URLComponents::kOmittedComponent` when it is null.
+  std::vector<uint32_t> ports;
+
+#define V(name)                                                                \
+  std::vector<uint32_t> name##_offsets;                                        \
+  std::vector<uint32_t> name##_lengths;
+  BATCH_COLUMNS(V)
+#undef V
+
+  inline bool IsFailed(size_t i) const {
+    return (failed[i / 64] >> (i % 64)) & 1;
+  }
+};
+
+// Parses `inputs[0, count)`, against `base` if it is non-null, on a pool of
+// threads. Every thread starts with an even share of the inputs and takes
+// them `chunk_size` at a time; a thread that runs out steals half of what is
+// left of the busiest share, so long URLs clustered in one part of the input
+// do not hold the batch back.
+//
+// Relative inputs go through a `BaseResolver` shared by the threads. Returns
+// false, and leaves `output` untouched, if `base` is not a valid URL.
+bool ParseBatch(const std::string* inputs,
+                size_t count,
+                const std::string* base,
+                ParseBatchOutput* output,
+                const ParseBatchOptions& options = ParseBatchOptions());
+
+// Same as `ParseBatch()`, with the results as columns. Every thread appends
+// the hrefs it produces to an arena of its own; the arenas are joined once
+// the threads are done.
+bool ParseBatchColumns(const std::string* inputs,
+                       size_t count,
+                       const std::string* base,
+                       BatchColumns* output,
+                       const ParseBatchOptions& options = ParseBatchOptions());
+
+inline bool ParseBatch(const std::vector<std::string>& inputs,
+                       const std::string* base,
+                       ParseBatchOutput* output,
+                       const ParseBatchOptions& options = ParseBatchOptions()) {
+  return ParseBatch(inputs.data(), inputs.size(), base, output, options);
+}
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_PARSE_BATCH_H_
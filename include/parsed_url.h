@@ -66,6 +66,16 @@ struct ParsedURL {
            host->type == kEmptyHost || scheme == "file";
   }
 
+  // Whether both serialize to the same href (without their fragments if
+  // `exclude_fragment`), compared component by component.
+  bool Equals(const ParsedURL& other, bool exclude_fragment = false) const;
+
+  // A total order consistent with `Equals()`: negative, zero or positive as
+  // this sorts before, with or after `other`. It goes by scheme, username,
+  // password, host, port, path, query and fragment, nulls first; this is not
+  // the order of the hrefs.
+  int Compare(const ParsedURL& other, bool exclude_fragment = false) const;
+
   inline void Dump() {
     printf("scheme: %s\n", scheme.c_str());
     printf("username: %s\n", username.c_str());
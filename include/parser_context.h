@@ -0,0 +1,139 @@
+#ifndef INCLUDE_PARSER_CONTEXT_H_
+#define INCLUDE_PARSER_CONTEXT_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <list>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+#include <unordered_map>
+#include "idna.h"
+#include "validation_error.h"
+
+namespace whatwgurl {
+
+#define PARSER_COUNTERS(V)                                                     \
+  V(parses)                                                                    \
+  V(failures)                                                                  \
+  V(validation_errors)                                                         \
+  V(idna_calls)                                                                \
+  V(idna_cache_hits)
+
+// A snapshot of `ParserContext`'s counters.
+struct ParserCounters {
+#define V(name) uint64_t name = 0;
+  PARSER_COUNTERS(V)
+#undef V
+};
+
+// Settings and state shared by every parse that is given this context: the
+// IDNA provider and mode, an optional cache of "domain to ASCII" results,
+// strictness, counters and a validation error sink.
+//
+// A context may be shared by any number of threads once it is configured; the
+// setters are not synchronized with parsing and must be called before that.
+// It must outlive every `URLCore` constructed with it.
+class ParserContext {
+ public:
+  // Follows the global IDNA environment (see `SetIDNAToASCIIFunction()`) with
+  // `kIDNADefault`.
+  ParserContext();
+  explicit ParserContext(IDNAToASCIIFunction to_ascii,
+                         IDNAMode idna_mode = kIDNADefault);
+
+  ParserContext(const ParserContext&) = delete;
+  ParserContext& operator=(const ParserContext&) = delete;
+
+  // The context used when none is given. It follows the global IDNA
+  // environment, has no IDNA cache and does not collect counters.
+  static ParserContext* Default();
+
+  inline IDNAMode idna_mode() const { return _idna_mode; }
+  void set_idna_mode(IDNAMode mode);
+
+  // Memory budget of the IDNA cache in bytes, 0 (the default) disables it.
+  // Least recently used entries are evicted once the budget is exceeded.
+  inline size_t idna_cache_budget() const { return _idna_cache_budget; }
+  void set_idna_cache_budget(size_t bytes);
+
+  // Makes a parse that reports a validation error fail, instead of only
+  // setting `validation_error`. State-override parses (the URL setters) are
+  // not affected.
+  inline bool fail_on_validation_error() const {
+    return _fail_on_validation_error;
+  }
+  inline void set_fail_on_validation_error(bool fail) {
+    _fail_on_validation_error = fail;
+  }
+
+  // Also feeds `GetValidationErrorCounts()`.
+  inline bool collect_counters() const { return _collect_counters; }
+  inline void set_collect_counters(bool collect) {
+    _collect_counters = collect;
+  }
+
+  // Receives every validation error, with its code and offset, of the parses
+  // given this context; null (the default) disables it. `sink` must be safe
+  // to call from every thread that parses with this context.
+  inline ValidationErrorSink validation_error_sink() const {
+    return _validation_error_sink;
+  }
+  inline void* validation_error_sink_data() const {
+    return _validation_error_sink_data;
+  }
+  inline void set_validation_error_sink(ValidationErrorSink sink,
+                                        void* data = nullptr) {
+    _validation_error_sink = sink;
+    _validation_error_sink_data = data;
+  }
+
+  ParserCounters counters() const;
+  void ResetCounters();
+
+  // Runs "domain to ASCII" with this context's provider, mode and cache. Same
+  // contract as `IDNAToASCIIFunction`.
+  int32_t DomainToASCII(std::string* buf, const char* input, size_t length);
+
+  // Called by `Parse()` once a (non state-override) parse has finished.
+  inline void CountParse(bool succeeded, bool validation_error) {
+    if (!_collect_counters) return;
+    _parses.fetch_add(1, std::memory_order_relaxed);
+    if (!succeeded) _failures.fetch_add(1, std::memory_order_relaxed);
+    if (validation_error) {
+      _validation_errors.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  struct IDNACacheEntry {
+    std::string key;
+    std::string value;
+    int32_t result;
+  };
+  typedef std::list<IDNACacheEntry> IDNACacheList;
+
+  IDNAToASCIIFunction GetToASCII() const;
+  void EvictIDNACache();
+
+  IDNAToASCIIFunction _idna_to_ascii;
+  IDNAMode _idna_mode;
+  size_t _idna_cache_budget = 0;
+  bool _fail_on_validation_error = false;
+  bool _collect_counters = false;
+  ValidationErrorSink _validation_error_sink = nullptr;
+  void* _validation_error_sink_data = nullptr;
+
+  std::mutex _idna_cache_mutex;
+  IDNACacheList _idna_cache_list;
+  std::unordered_map<std::string, IDNACacheList::iterator> _idna_cache;
+  size_t _idna_cache_size = 0;
+  IDNAToASCIIFunction _idna_cache_owner = nullptr;
+
+#define V(name) std::atomic<uint64_t> _##name{0};
+  PARSER_COUNTERS(V)
+#undef V
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_PARSER_CONTEXT_H_
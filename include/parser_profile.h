@@ -0,0 +1,109 @@
+#ifndef INCLUDE_PARSER_PROFILE_H_
+#define INCLUDE_PARSER_PROFILE_H_
+
+#include <stdint.h>
+#include <string>
+#include "parse.h"
+
+#ifdef WHATWGURL_PARSER_PROFILE
+#include <chrono>  // NOLINT(build/c++11)
+#endif
+
+namespace whatwgurl {
+
+// Per-state profiling of the basic URL parser is compiled in only when
+// `WHATWGURL_PARSER_PROFILE` is defined (`-Dwhatwgurl_parser_profile=1` with
+// gyp). Otherwise `ParseStateProfiler` does nothing and `GetParserProfile()`
+// returns zeros.
+
+constexpr int kParseStateCount = kFragmentState + 1;
+
+// The state's name as the spec spells it, e.g. "path start".
+const char* ParseStateName(ParseState state);
+
+struct ParseStateProfile {
+  // How many times the state machine switched to this state.
+  uint64_t entries = 0;
+
+  // Code points the state consumed, counting the ones it consumed again after
+  // the pointer was moved back, but not the EOF code point.
+  uint64_t bytes = 0;
+
+  // Wall time spent in the state.
+  uint64_t nanoseconds = 0;
+};
+
+struct ParserProfile {
+  // Number of runs of the basic URL parser, including the state-override ones.
+  uint64_t parses = 0;
+
+  ParseStateProfile states[kParseStateCount];
+
+  // `transitions[from][to]`, the number of times `from` switched to `to`.
+  uint64_t transitions[kParseStateCount][kParseStateCount] = {};
+
+  // A text table of the states and of the transitions that happened, for
+  // reading in a terminal.
+  std::string ToTable() const;
+
+  // {"parses": n, "states": {"<name>": {"entries", "bytes", "nanoseconds"}},
+  //  "transitions": [{"from": "<name>", "to": "<name>", "count": n}]}
+  //
+  // Only states that were entered and transitions that happened are listed.
+  std::string ToJSON() const;
+};
+
+constexpr bool ParserProfileEnabled() {
+#ifdef WHATWGURL_PARSER_PROFILE
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Sums what every thread profiled since the last `ResetParserProfile()`.
+ParserProfile GetParserProfile();
+void ResetParserProfile();
+
+#ifdef WHATWGURL_PARSER_PROFILE
+
+// Follows one run of the basic URL parser. `Step()` is called once per turn
+// of the state machine; the clock is only read when the state changes, and
+// everything is flushed into the calling thread's counters on destruction.
+class ParseStateProfiler {
+ public:
+  explicit ParseStateProfiler(ParseState state);
+  ~ParseStateProfiler();
+
+  ParseStateProfiler(const ParseStateProfiler&) = delete;
+  ParseStateProfiler& operator=(const ParseStateProfiler&) = delete;
+
+  inline void Step(ParseState state, bool eof) {
+    if (state != _state) Transition(state);
+    if (!eof) _bytes++;
+  }
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  void Transition(ParseState state);
+  void Flush(Clock::time_point now);
+
+  ParseState _state;
+  uint64_t _bytes = 0;
+  Clock::time_point _entered;
+};
+
+#else
+
+class ParseStateProfiler {
+ public:
+  explicit inline ParseStateProfiler(ParseState) {}
+  inline void Step(ParseState, bool) {}
+};
+
+#endif  // WHATWGURL_PARSER_PROFILE
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_PARSER_PROFILE_H_
@@ -14,15 +14,27 @@ class Port : public MaybeNull<uint16_t> {
   }
 
   inline std::string Serialize() const {
+    char buff[6];
+    return std::string(buff, Format(buff));
+  }
+
+  // Appends `Serialize()` to `writer` (see `URLCore::Write()`).
+  template <typename Writer>
+  inline void Write(Writer* writer) const {
+    char buff[6];
+    writer->Append(buff, Format(buff));
+  }
+
+ private:
+  inline size_t Format(char* buff) const {
     CHECK(!is_null());
 
     // To serialize an integer, represent it as the shortest possible decimal
     // number.
-    char buff[6];
-    int n = snprintf(buff, sizeof(buff), "%u", value());
+    int n = snprintf(buff, 6, "%u", value());
     CHECK_GE(n, 0);
 
-    return std::string(buff, n);
+    return n;
   }
 };
 
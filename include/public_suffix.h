@@ -0,0 +1,75 @@
+#ifndef INCLUDE_PUBLIC_SUFFIX_H_
+#define INCLUDE_PUBLIC_SUFFIX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "host/host_item.h"
+#include "utils/string_view.h"
+
+namespace whatwgurl {
+
+// Public suffixes ("effective top-level domains") and registrable domains
+// ("eTLD+1"), after the URL Standard's host public suffix and host
+// registrable domain, by a snapshot of the Public Suffix List compiled into
+// the library (src/public_suffix-data.cc, generated by
+// tools/gen_public_suffix_data.py):
+//
+//   www.example.co.uk   public suffix "co.uk", registrable domain
+//                       "example.co.uk"
+//   co.uk               public suffix "co.uk", no registrable domain
+//   example.co.uk.      public suffix "co.uk.", registrable domain
+//                       "example.co.uk."
+//
+// Both return false for a host that is not a domain. Otherwise the results
+// are views into the domain, found without allocating. With `icann_only`, the
+// rules of the list's private section (e.g. "github.io") are left out.
+bool PublicSuffix(const HostItem& host,
+                  StringView* suffix,
+                  bool icann_only = false);
+bool RegistrableDomain(const HostItem& host,
+                       StringView* domain,
+                       bool icann_only = false);
+
+// The same on a domain as the host parser makes them: ASCII, lowercase.
+bool PublicSuffix(const StringView& domain,
+                  StringView* suffix,
+                  bool icann_only = false);
+bool RegistrableDomain(const StringView& domain,
+                       StringView* registrable_domain,
+                       bool icann_only = false);
+
+namespace public_suffix {
+
+// The list as a trie of the labels of its rules, right to left. A node's
+// children are contiguous in `kNodes` and sorted by label; node 0 is the root.
+struct Node {
+  // The label is `kLabels[label, label + label_length)`.
+  uint32_t label;
+  uint8_t label_length;
+  uint8_t flags;
+  uint16_t child_count;
+  uint32_t first_child;
+};
+
+// What rules end at a node: the node's domain itself ("example.com"), any
+// domain one label below it ("*.example.com"), or an exception to the latter
+// ("!www.example.com"). Each also has a flag for when it comes from the
+// private section of the list.
+enum NodeFlags : uint8_t {
+  kRule = 1 << 0,
+  kWildcard = 1 << 1,
+  kException = 1 << 2,
+  kPrivateRule = 1 << 3,
+  kPrivateWildcard = 1 << 4,
+  kPrivateException = 1 << 5,
+};
+
+extern const char kLabels[];
+extern const Node kNodes[];
+extern const size_t kNodeCount;
+
+}  // namespace public_suffix
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_PUBLIC_SUFFIX_H_
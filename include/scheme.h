@@ -2,7 +2,6 @@
 #define INCLUDE_SCHEME_H_
 
 #include <string.h>
-#include <map>
 #include <string>
 
 namespace whatwgurl {
@@ -15,20 +14,11 @@ struct DefaultPortResult {
   uint16_t port;
 };
 
-extern std::map<std::string, DefaultPortResult> kSchemePorts;
-extern char const kSpecialSchemas[SPECIAL_SCHEMA_COUNT + 1]
-                                 [SPECIAL_SCHEMA_MAX_LENGTH + 1];
-
-void InitSchemePorts();
-
-inline bool IsSpecialScheme(std::string scheme) {
-  for (int i = 0; i < SPECIAL_SCHEMA_COUNT; i++) {
-    if (strcmp(scheme.c_str(), kSpecialSchemas[i]) == 0) {
-      return true;
-    }
-  }
-  return false;
-}
+struct SpecialScheme {
+  const char* name;
+  size_t length;
+  DefaultPortResult default_port;
+};
 
 // The default port for a special scheme is listed in the second column on the
 // same row. The default port for any other ASCII string is null.
@@ -41,13 +31,51 @@ inline bool IsSpecialScheme(std::string scheme) {
 // | wss    | 443          |
 // | ftp    | 21           |
 // | file   | null         |
-inline DefaultPortResult GetDefaultPort(std::string scheme) {
-  auto it = kSchemePorts.find(scheme);
-  if (it == kSchemePorts.end()) {
+//
+// The table is constant data, so it can be read from any thread without any
+// initialization.
+constexpr SpecialScheme kSpecialSchemes[SPECIAL_SCHEMA_COUNT] = {
+    {"ftp", 3, {false, 21}},
+    {"file", 4, {true, 0}},
+    {"http", 4, {false, 80}},
+    {"https", 5, {false, 443}},
+    {"ws", 2, {false, 80}},
+    {"wss", 3, {false, 443}},
+};
+
+inline const SpecialScheme* FindSpecialScheme(const char* scheme,
+                                              size_t length) {
+  if (length < 2 || length > SPECIAL_SCHEMA_MAX_LENGTH) return nullptr;
+
+  for (int i = 0; i < SPECIAL_SCHEMA_COUNT; i++) {
+    if (kSpecialSchemes[i].length == length &&
+        memcmp(scheme, kSpecialSchemes[i].name, length) == 0) {
+      return &kSpecialSchemes[i];
+    }
+  }
+  return nullptr;
+}
+
+inline bool IsSpecialScheme(const char* scheme, size_t length) {
+  return FindSpecialScheme(scheme, length) != nullptr;
+}
+
+inline bool IsSpecialScheme(const char* scheme) {
+  return IsSpecialScheme(scheme, strlen(scheme));
+}
+
+inline bool IsSpecialScheme(const std::string& scheme) {
+  return IsSpecialScheme(scheme.c_str(), scheme.length());
+}
+
+inline DefaultPortResult GetDefaultPort(const std::string& scheme) {
+  const SpecialScheme* special =
+      FindSpecialScheme(scheme.c_str(), scheme.length());
+  if (special == nullptr) {
     return {true, 0};
   }
 
-  return it->second;
+  return special->default_port;
 }
 
 }  // namespace whatwgurl
@@ -27,6 +27,7 @@ inline bool TrimLeft(std::string* str, IsSomeCharFunction is_some_char) {
                std::find_if(str->begin(), str->end(), [&](unsigned char c) {
                  return !is_some_char(c);
                }));
+    return true;
   }
   return false;
 }
@@ -38,12 +39,15 @@ inline bool TrimRight(std::string* str, IsSomeCharFunction is_some_char) {
                             [&](unsigned char c) { return !is_some_char(c); })
                    .base(),
                str->end());
+    return true;
   }
   return false;
 }
 
 inline bool Trim(std::string* str, IsSomeCharFunction is_some_char) {
-  return TrimLeft(str, is_some_char) || TrimRight(str, is_some_char);
+  bool trimmed_left = TrimLeft(str, is_some_char);
+  bool trimmed_right = TrimRight(str, is_some_char);
+  return trimmed_left || trimmed_right;
 }
 
 inline bool Remove(std::string* str, IsSomeCharFunction is_some_char) {
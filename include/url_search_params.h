@@ -1,39 +1,35 @@
 #ifndef INCLUDE_URL_SEARCH_PARAMS_H_
 #define INCLUDE_URL_SEARCH_PARAMS_H_
 
+#include <inttypes.h>
 #include <map>
 #include <string>
 #include <utility>
 #include <vector>
 #include "maybe.h"
+#include "utils/string_view.h"
 
 namespace whatwgurl {
 
-struct URLSearchParamsKVPairWithIndex {
+struct URLSearchParamsKVPair {
  public:
-  inline URLSearchParamsKVPairWithIndex() : index(0), key(), value() {}
-  inline URLSearchParamsKVPairWithIndex(std::string key,
-                                        std::string value,
-                                        uint32_t index)
-      : index(index), key(key), value(value) {}
-  ~URLSearchParamsKVPairWithIndex() = default;
-
-  uint32_t index;
+  inline URLSearchParamsKVPair() : key(), value() {}
+  inline URLSearchParamsKVPair(std::string key, std::string value)
+      : key(std::move(key)), value(std::move(value)) {}
+  ~URLSearchParamsKVPair() = default;
+
   std::string key;
   std::string value;
 };
 
-class MaybeNullURLSearchParamsKVPair
-    : public MaybeNull<URLSearchParamsKVPairWithIndex> {
+class MaybeNullURLSearchParamsKVPair : public MaybeNull<URLSearchParamsKVPair> {
  public:
-  explicit MaybeNullURLSearchParamsKVPair(
-      const URLSearchParamsKVPairWithIndex& p)
-      : MaybeNull<URLSearchParamsKVPairWithIndex>(p) {}
-  MaybeNullURLSearchParamsKVPair()
-      : MaybeNull<URLSearchParamsKVPairWithIndex>() {}
+  explicit MaybeNullURLSearchParamsKVPair(const URLSearchParamsKVPair& p)
+      : MaybeNull<URLSearchParamsKVPair>(p) {}
+  MaybeNullURLSearchParamsKVPair() : MaybeNull<URLSearchParamsKVPair>() {}
 };
 
-typedef std::vector<URLSearchParamsKVPairWithIndex> URLSearchParamsList;
+typedef std::vector<URLSearchParamsKVPair> URLSearchParamsList;
 typedef void (*OnPassivelyUpdateFunction)(void* context);
 
 class URLCore;
@@ -54,6 +50,34 @@ class URLSearchParams {
   void Set(const std::string& name, const std::string& value);
   void Sort();
 
+  // Typed accessors. They look at the value of the first name-value pair whose
+  // name is `name` and parse it in place, without copying it. They return false
+  // and leave `result` untouched if there is no such pair or its value cannot
+  // be parsed. `GetAll()` looks at every such pair, and replaces the contents
+  // of `values` with their values, none if there is no such pair. Returned
+  // views are invalidated by the next mutation of this.
+  bool Get(const StringView& name, StringView* value) const;
+  void GetAll(const StringView& name, std::vector<StringView>* values) const;
+
+  // An optionally signed decimal integer, e.g. "-42".
+  bool GetInteger(const StringView& name, int64_t* result) const;
+
+  // A finite decimal or hexadecimal floating point number as accepted by
+  // `strtod` in the current locale, without leading whitespace. Infinities,
+  // NaNs and values that overflow or underflow a `double` are rejected.
+  bool GetFloat(const StringView& name, double* result) const;
+
+  // An ASCII case-insensitive "true", "1", "yes", "on" or "false", "0", "no",
+  // "off". An empty value (e.g. "?verbose") counts as true.
+  bool GetBoolean(const StringView& name, bool* result) const;
+
+  // Splits the value on `separator` into `result`, replacing its contents.
+  // ASCII whitespace around items is trimmed and empty items are skipped, so
+  // "a, b,,c" gives ["a", "b", "c"].
+  bool GetList(const StringView& name,
+               std::vector<StringView>* result,
+               char separator = ',') const;
+
   inline const URLSearchParamsList& list() const { return _list; }
   std::string Stringify();
 
@@ -67,6 +91,8 @@ class URLSearchParams {
   void Initialize(const std::string& init);
   void Update();
 
+  const URLSearchParamsKVPair* Find(const StringView& name) const;
+
   inline void EmitPassivelyUpdate() {
     if (_on_passively_update) {
       _on_passively_update(_on_passively_update_context);
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include "allocation_stats.h"
 #include "utils/assert.h"
 
 // Refer: https://github.com/XadillaX/node-sfml/blob/main/src/resizable_buffer.h
@@ -52,6 +53,7 @@ class ResizableBuffer {
       return;
     }
 
+    bool regrowth = _buffer != nullptr;
     if (_buffer != nullptr) {
       free(_buffer);
       _buffer = nullptr;
@@ -71,6 +73,18 @@ class ResizableBuffer {
     }
 
     memset(byte_buffer(), 0, _byte_length);
+#ifdef WHATWGURL_ALLOCATION_STATS
+    RecordAllocation(_allocation_site, _byte_length, regrowth);
+#else
+    (void)regrowth;
+#endif
+  }
+
+  // Which `AllocationSite` `Realloc()` counts its allocations as.
+  inline void set_allocation_site(AllocationSite site) {
+#ifdef WHATWGURL_ALLOCATION_STATS
+    _allocation_site = site;
+#endif
   }
 
   inline ReleasedResizableBuffer<T> Release() {
@@ -115,6 +129,9 @@ class ResizableBuffer {
   size_t _real_length;
   size_t _byte_length;
   size_t _page_size;
+#ifdef WHATWGURL_ALLOCATION_STATS
+  AllocationSite _allocation_site = kResizableBufferAllocation;
+#endif
 };
 
 }  // namespace whatwgurl
@@ -0,0 +1,60 @@
+#ifndef INCLUDE_UTILS_STRING_VIEW_H_
+#define INCLUDE_UTILS_STRING_VIEW_H_
+
+#include <string.h>
+#include <string>
+#include "utils/assert.h"
+
+namespace whatwgurl {
+
+// A non-owning view of a byte sequence. The viewed memory must outlive the
+// view; views into a `URLSearchParams` or a `ParsedURL` are invalidated by the
+// next mutation of that object.
+class StringView {
+ public:
+  inline StringView() : _data(""), _length(0) {}
+  inline StringView(const char* data, size_t length)
+      : _data(data), _length(length) {}
+  inline StringView(const char* str)  // NOLINT(runtime/explicit)
+      : _data(str), _length(strlen(str)) {}
+  inline StringView(const std::string& str)  // NOLINT(runtime/explicit)
+      : _data(str.c_str()), _length(str.length()) {}
+
+  inline const char* data() const { return _data; }
+  inline size_t length() const { return _length; }
+  inline size_t size() const { return _length; }
+  inline bool empty() const { return _length == 0; }
+
+  inline const char* begin() const { return _data; }
+  inline const char* end() const { return _data + _length; }
+
+  inline char operator[](size_t index) const {
+    CHECK_LT(index, _length);
+    return _data[index];
+  }
+
+  inline StringView Substring(size_t pos, size_t length) const {
+    CHECK_LE(pos, _length);
+    if (length > _length - pos) length = _length - pos;
+    return StringView(_data + pos, length);
+  }
+
+  inline std::string ToString() const { return std::string(_data, _length); }
+
+  inline bool operator==(const StringView& other) const {
+    return _length == other._length &&
+           (_length == 0 || memcmp(_data, other._data, _length) == 0);
+  }
+
+  inline bool operator!=(const StringView& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  const char* _data;
+  size_t _length;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_UTILS_STRING_VIEW_H_
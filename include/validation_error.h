@@ -0,0 +1,126 @@
+#ifndef INCLUDE_VALIDATION_ERROR_H_
+#define INCLUDE_VALIDATION_ERROR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace whatwgurl {
+
+class ParserContext;
+
+// The validation errors the URL Standard names, with their spec names.
+// https://url.spec.whatwg.org/#validation-error
+#define VALIDATION_ERRORS(V)                                                   \
+  V(DomainToASCII, "domain-to-ASCII")                                          \
+  V(DomainInvalidCodePoint, "domain-invalid-code-point")                       \
+  V(HostInvalidCodePoint, "host-invalid-code-point")                           \
+  V(IPv4EmptyPart, "IPv4-empty-part")                                          \
+  V(IPv4TooManyParts, "IPv4-too-many-parts")                                   \
+  V(IPv4NonNumericPart, "IPv4-non-numeric-part")                               \
+  V(IPv4NonDecimalPart, "IPv4-non-decimal-part")                               \
+  V(IPv4OutOfRangePart, "IPv4-out-of-range-part")                              \
+  V(IPv6Unclosed, "IPv6-unclosed")                                             \
+  V(IPv6InvalidCompression, "IPv6-invalid-compression")                        \
+  V(IPv6TooManyPieces, "IPv6-too-many-pieces")                                 \
+  V(IPv6MultipleCompression, "IPv6-multiple-compression")                      \
+  V(IPv6InvalidCodePoint, "IPv6-invalid-code-point")                           \
+  V(IPv6TooFewPieces, "IPv6-too-few-pieces")                                   \
+  V(IPv4InIPv6TooManyPieces, "IPv4-in-IPv6-too-many-pieces")                   \
+  V(IPv4InIPv6InvalidCodePoint, "IPv4-in-IPv6-invalid-code-point")             \
+  V(IPv4InIPv6OutOfRangePart, "IPv4-in-IPv6-out-of-range-part")                \
+  V(IPv4InIPv6TooFewParts, "IPv4-in-IPv6-too-few-parts")                       \
+  V(InvalidURLUnit, "invalid-URL-unit")                                        \
+  V(SpecialSchemeMissingFollowingSolidus,                                      \
+    "special-scheme-missing-following-solidus")                                \
+  V(MissingSchemeNonRelativeURL, "missing-scheme-non-relative-URL")            \
+  V(InvalidReverseSolidus, "invalid-reverse-solidus")                          \
+  V(InvalidCredentials, "invalid-credentials")                                 \
+  V(HostMissing, "host-missing")                                               \
+  V(PortOutOfRange, "port-out-of-range")                                       \
+  V(PortInvalid, "port-invalid")                                               \
+  V(FileInvalidWindowsDriveLetter, "file-invalid-Windows-drive-letter")        \
+  V(FileInvalidWindowsDriveLetterHost, "file-invalid-Windows-drive-letter-host")
+
+enum ValidationErrorCode : uint8_t {
+#define V(name, _) k##name##Error,
+  VALIDATION_ERRORS(V)
+#undef V
+  kValidationErrorCount,
+};
+
+// The spec's name of `code`, e.g. "invalid-reverse-solidus".
+const char* ValidationErrorName(ValidationErrorCode code);
+
+// Receives every validation error of a parse: its code and the byte offset in
+// the string given to `Parse()` (or to the `URLCore` setter) that caused it.
+// Runs synchronously on the parsing thread.
+typedef void (*ValidationErrorSink)(void* data,
+                                    ValidationErrorCode code,
+                                    size_t offset);
+
+// Process-wide number of validation errors per code, fed by the parses whose
+// `ParserContext` collects counters.
+struct ValidationErrorCounts {
+  uint64_t counts[kValidationErrorCount] = {};
+
+  uint64_t total() const;
+};
+
+ValidationErrorCounts GetValidationErrorCounts();
+void ResetValidationErrorCounts();
+
+// Used by the parser to raise validation errors. It always sets the parse's
+// `validation_error`; the sink and the counters are only touched when the
+// context asks for them, so a parse without either pays nothing more than
+// the flag.
+class ValidationErrorReporter {
+ public:
+  ValidationErrorReporter(bool* validation_error, ParserContext* context);
+
+  ValidationErrorReporter(const ValidationErrorReporter&) = delete;
+  ValidationErrorReporter& operator=(const ValidationErrorReporter&) = delete;
+
+  // The parser works on `input` without its first `leading` code units and
+  // without any ASCII tab or newline (`removed_tab_or_newline`); this lets
+  // `Report()` turn offsets in that string back into offsets in `input`.
+  inline void SetInput(const std::string* input,
+                       size_t leading,
+                       bool removed_tab_or_newline) {
+    _input = input;
+    _leading = leading;
+    _removed_tab_or_newline = removed_tab_or_newline;
+  }
+
+  // Whether reported errors go anywhere but the flag; callers can skip
+  // working out which error they raise when this is false.
+  inline bool enabled() const { return _enabled; }
+
+  // `offset` is in the string the parser works on.
+  inline void Report(ValidationErrorCode code, size_t offset) {
+    *_validation_error = true;
+    if (_enabled) Dispatch(code, MapOffset(offset));
+  }
+
+  // `offset` is already in the input.
+  inline void ReportAtInputOffset(ValidationErrorCode code, size_t offset) {
+    *_validation_error = true;
+    if (_enabled) Dispatch(code, offset);
+  }
+
+ private:
+  size_t MapOffset(size_t offset) const;
+  void Dispatch(ValidationErrorCode code, size_t offset);
+
+  bool* _validation_error;
+  ParserContext* _context;
+  bool _enabled;
+
+  const std::string* _input = nullptr;
+  size_t _leading = 0;
+  bool _removed_tab_or_newline = false;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_VALIDATION_ERROR_H_
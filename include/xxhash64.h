@@ -0,0 +1,45 @@
+#ifndef INCLUDE_XXHASH64_H_
+#define INCLUDE_XXHASH64_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace whatwgurl {
+
+// XXH64 (https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md),
+// fed incrementally, so that a value can be hashed piece by piece without
+// being put together first. Hashing the pieces gives the same digest as
+// hashing them concatenated.
+class XXH64 {
+ public:
+  explicit XXH64(uint64_t seed = 0);
+
+  void Update(const void* data, size_t length);
+  inline void Update(const std::string& data) {
+    Update(data.data(), data.length());
+  }
+  inline void Update(char c) { Update(&c, 1); }
+
+  // The hash of everything passed to `Update()` so far. The state is left as
+  // is, so more data may follow.
+  uint64_t Digest() const;
+
+  static uint64_t Hash(const void* data, size_t length, uint64_t seed = 0);
+  static inline uint64_t Hash(const std::string& data, uint64_t seed = 0) {
+    return Hash(data.data(), data.length(), seed);
+  }
+
+ private:
+  uint64_t _seed;
+  uint64_t _total_length = 0;
+  uint64_t _accumulators[4];
+
+  // Input that does not fill a 32-byte stripe yet.
+  unsigned char _buffer[32];
+  size_t _buffered = 0;
+};
+
+}  // namespace whatwgurl
+
+#endif  // INCLUDE_XXHASH64_H_
@@ -1,35 +1,33 @@
 'use strict';
 
-const puny = require('punycode');
 const { inspect, toUSVString: _toUSVString } = require('util');
 
 const {
   NativeURL,
   NativeURLSearchParams,
+  getAllocationStats,
+  getParserProfile: nativeGetParserProfile,
   init,
+  parseBatch: nativeParseBatch,
+  parseBatchAsync: nativeParseBatchAsync,
+  parseBatchColumns: nativeParseBatchColumns,
+  resetAllocationStats,
+  resetParserProfile,
+  urlComponentFields,
 } = require('../build/Release/binding.node');
 
-init({
-  toASCII(domain) {
-    // Workaround
-    if (domain === 'xn--') {
-      return '';
-    }
-
-    try {
-      return puny.toASCII(domain);
-    } catch (e) {
-      return '';
-    }
-  },
-});
+// "domain to ASCII" is done natively, which keeps the parser free of
+// JavaScript callbacks so that `parseBatchAsync()` can run it off the main
+// thread.
+init({});
 
 const customInspectSymbol = Symbol.for('nodejs.util.inspect.custom');
+const CACHE = Symbol('URL#cache');
 const CORE = Symbol('URL#core');
+const GET = Symbol('URL#get');
 const INIT = Symbol('URL#init');
 const ON_PASSIVELY_UPDATE = Symbol('URL#onPassivelyUpdate');
 const SEARCH_PARAMS = Symbol('URL#searchParams');
-const STRUCTED = Symbol('URL#structed');
 
 function requiredArguments(name, length, required) {
   if (length < required) {
@@ -197,8 +195,20 @@ Object.defineProperties(URLSearchParams.prototype, {
 });
 
 class URL {
-  [ON_PASSIVELY_UPDATE](structed) {
-    this[STRUCTED] = structed;
+  // Called by the native side whenever the underlying URL changes, including
+  // changes made through `searchParams`. Property values are read from the
+  // native side on demand and cached until then.
+  [ON_PASSIVELY_UPDATE]() {
+    this[CACHE] = {};
+  }
+
+  [GET](key, getter) {
+    const cache = this[CACHE];
+    let value = cache[key];
+    if (value === undefined) {
+      value = cache[key] = this[CORE][getter]();
+    }
+    return value;
   }
 
   constructor(url) {
@@ -212,11 +222,21 @@ class URL {
       throw new TypeError(e.message);
     }
 
-    this[STRUCTED] = this[CORE].toStructed();
+    this[CACHE] = {};
     this[CORE].setOnPassivelyUpdateFunction(
       this[ON_PASSIVELY_UPDATE].bind(this));
   }
 
+  // Whether `new URL(url, base)` would succeed, without building the URL.
+  static canParse(url, base) {
+    url = toUSVString(`${url}`);
+    if (base instanceof URL) return NativeURL.canParse(url, base[CORE]);
+    if (base !== undefined) {
+      return NativeURL.canParse(url, toUSVString(`${base}`));
+    }
+    return NativeURL.canParse(url);
+  }
+
   [INIT](url, base) {
     url = toUSVString(`${url}`);
 
@@ -232,7 +252,7 @@ class URL {
   }
 
   get href() {
-    return this[STRUCTED].href;
+    return this[GET]('href', 'getHref');
   }
 
   set href(value) {
@@ -240,11 +260,11 @@ class URL {
   }
 
   get origin() {
-    return this[STRUCTED].origin;
+    return this[GET]('origin', 'getOrigin');
   }
 
   get protocol() {
-    return this[STRUCTED].protocol;
+    return this[GET]('protocol', 'getProtocol');
   }
 
   set protocol(value) {
@@ -252,7 +272,7 @@ class URL {
   }
 
   get username() {
-    return this[STRUCTED].username;
+    return this[GET]('username', 'getUsername');
   }
 
   set username(value) {
@@ -260,7 +280,7 @@ class URL {
   }
 
   get password() {
-    return this[STRUCTED].password;
+    return this[GET]('password', 'getPassword');
   }
 
   set password(value) {
@@ -268,7 +288,7 @@ class URL {
   }
 
   get host() {
-    return this[STRUCTED].host;
+    return this[GET]('host', 'getHost');
   }
 
   set host(value) {
@@ -276,7 +296,7 @@ class URL {
   }
 
   get hostname() {
-    return this[STRUCTED].hostname;
+    return this[GET]('hostname', 'getHostname');
   }
 
   set hostname(value) {
@@ -284,7 +304,7 @@ class URL {
   }
 
   get port() {
-    return this[STRUCTED].port;
+    return this[GET]('port', 'getPort');
   }
 
   set port(value) {
@@ -292,7 +312,7 @@ class URL {
   }
 
   get pathname() {
-    return this[STRUCTED].pathname;
+    return this[GET]('pathname', 'getPathname');
   }
 
   set pathname(value) {
@@ -300,7 +320,7 @@ class URL {
   }
 
   get search() {
-    return this[STRUCTED].search;
+    return this[GET]('search', 'getSearch');
   }
 
   set search(value) {
@@ -315,7 +335,7 @@ class URL {
   }
 
   get hash() {
-    return this[STRUCTED].hash;
+    return this[GET]('hash', 'getHash');
   }
 
   set hash(value) {
@@ -323,11 +343,11 @@ class URL {
   }
 
   toString() {
-    return this[STRUCTED].href;
+    return this[GET]('href', 'getHref');
   }
 
   toJSON() {
-    return this[STRUCTED].href;
+    return this[GET]('href', 'getHref');
   }
 
   get [Symbol.toStringTag]() {
@@ -406,7 +426,123 @@ for (const key of urlSearchParamsPrototypes) {
   Object.defineProperty(URLSearchParams.prototype, key, d);
 }
 
+// Parses every element of `inputs`, against `base` if it is given, in a
+// single native call. Returns `{ hrefs, components }`: `hrefs[i]` is the
+// serialized URL or null when `inputs[i]` is not a valid URL, and
+// `components` is a Uint32Array holding `URL_COMPONENT_FIELDS.length` offsets
+// into `hrefs[i]` per input (see `URLComponents` in include/url_core.h).
+function parseBatch(inputs, base) {
+  inputs = Array.from(inputs, (input) => `${input}`);
+
+  try {
+    return nativeParseBatch(inputs, toNativeBase(base));
+  } catch (e) {
+    throw new TypeError(e.message);
+  }
+}
+
+// Same as `parseBatch()`, but the parsing runs on the libuv threadpool. Returns
+// a Promise of `{ hrefs, components }`.
+function parseBatchAsync(inputs, base) {
+  return new Promise((resolve, reject) => {
+    inputs = Array.from(inputs, (input) => `${input}`);
+
+    try {
+      nativeParseBatchAsync(inputs, toNativeBase(base), (err, result) => {
+        if (err) {
+          reject(err);
+        } else {
+          resolve(result);
+        }
+      });
+    } catch (e) {
+      reject(new TypeError(e.message));
+    }
+  });
+}
+
+// The names of the `schemeIds` and `hostTypes` codes of `parseBatchColumns()`
+// (see `BatchSchemeId` in include/parse_batch.h and `HostType` in
+// include/host/host_item.h); a host type of 255 means a null host.
+const BATCH_SCHEME_IDS = Object.freeze([
+  null, 'ftp', 'file', 'http', 'https', 'ws', 'wss',
+]);
+const BATCH_HOST_TYPES = Object.freeze([
+  'domain', 'ipv4', 'ipv6', 'opaque', 'empty',
+]);
+
+const BATCH_RANGES = [ 'href', 'scheme', 'host', 'path', 'query', 'fragment' ];
+
+function typedView(Type, buffer) {
+  return new Type(buffer.buffer, buffer.byteOffset,
+                  buffer.byteLength / Type.BYTES_PER_ELEMENT);
+}
+
+// Same as `parseBatch()`, with the results as columns instead of one string
+// and one row of components per input. Returns `{ count, failures, arena,
+// failed, schemeIds, hostTypes, ports, <range>Offsets, <range>Lengths }`,
+// where `arena` is a Buffer holding every href back to back, `failed` a
+// bitmap (bit `i % 64` of `failed[i / 64]`), and the other fields typed
+// arrays indexed like `inputs`. Ranges are `href`, `scheme`, `host`, `path`,
+// `query` and `fragment`; a null one has an offset of 0xffffffff. The arrays
+// are views of the native columns, not copies.
+function parseBatchColumns(inputs, base) {
+  inputs = Array.from(inputs, (input) => `${input}`);
+
+  let columns;
+  try {
+    columns = nativeParseBatchColumns(inputs, toNativeBase(base));
+  } catch (e) {
+    throw new TypeError(e.message);
+  }
+
+  const ret = {
+    count: columns.count,
+    failures: columns.failures,
+    arena: columns.arena,
+    failed: typedView(BigUint64Array, columns.failed),
+    schemeIds: typedView(Uint8Array, columns.schemeIds),
+    hostTypes: typedView(Uint8Array, columns.hostTypes),
+    ports: typedView(Uint32Array, columns.ports),
+  };
+  for (const range of BATCH_RANGES) {
+    ret[`${range}Offsets`] = typedView(Uint32Array, columns[`${range}Offsets`]);
+    ret[`${range}Lengths`] = typedView(Uint32Array, columns[`${range}Lengths`]);
+  }
+
+  return ret;
+}
+
+// Time, code points and transitions per state of the URL parser, as
+// `{ parses, states, transitions }`; see include/parser_profile.h. Only
+// populated when the addon is built with `whatwgurl_parser_profile=1`.
+function getParserProfile() {
+  return JSON.parse(nativeGetParserProfile('json'));
+}
+
+// The same profile as a text table.
+function formatParserProfile() {
+  return nativeGetParserProfile('table');
+}
+
+function toNativeBase(base) {
+  if (base instanceof URL) return base[CORE];
+  if (base !== undefined) return `${base}`;
+  return undefined;
+}
+
 module.exports = {
   URL,
   URLSearchParams,
+  URL_COMPONENT_FIELDS: Object.freeze([ ...urlComponentFields ]),
+  parseBatch,
+  parseBatchAsync,
+  parseBatchColumns,
+  BATCH_SCHEME_IDS,
+  BATCH_HOST_TYPES,
+  getAllocationStats,
+  resetAllocationStats,
+  getParserProfile,
+  formatParserProfile,
+  resetParserProfile,
 };
@@ -1,4 +1,10 @@
 {
+  "variables": {
+    # Build with allocation counting (see include/allocation_stats.h).
+    "whatwgurl_allocation_stats%": 0,
+    # Build with per-state parser profiling (see include/parser_profile.h).
+    "whatwgurl_parser_profile%": 0,
+  },
   "target_defaults": {
     "default_configuration": "Release",
     "configurations": {
@@ -18,16 +24,29 @@
       "src/host/host.cc",
       "src/host/ip_util.cc",
       "src/utils/assert.cc",
+      "src/allocation_stats.cc",
+      "src/base_resolver.cc",
+      "src/cache_key.cc",
       "src/code_points.cc",
+      "src/corpus_aggregator.cc",
       "src/idna.cc",
+      "src/origin_interner.cc",
+      "src/origin_matcher.cc",
       "src/parse.cc",
+      "src/parse_batch.cc",
+      "src/parsed_url.cc",
+      "src/parser_context.cc",
+      "src/parser_profile.cc",
       "src/path.cc",
       "src/percent_encode-data.cc",
       "src/percent_encode.cc",
-      "src/scheme.cc",
+      "src/public_suffix-data.cc",
+      "src/public_suffix.cc",
       "src/temp_string_buffer.cc",
       "src/url_core.cc",
       "src/url_search_params.cc",
+      "src/validation_error.cc",
+      "src/xxhash64.cc",
     ],
     "include_dirs": [
       "include"
@@ -36,6 +55,64 @@
       "include_dirs": [
         "include"
       ]
-    }
+    },
+    "conditions": [
+      ["whatwgurl_allocation_stats==1", {
+        "defines": [ "WHATWGURL_ALLOCATION_STATS" ],
+        "direct_dependent_settings": {
+          "defines": [ "WHATWGURL_ALLOCATION_STATS" ]
+        }
+      }],
+      ["whatwgurl_parser_profile==1", {
+        "defines": [ "WHATWGURL_PARSER_PROFILE" ],
+        "direct_dependent_settings": {
+          "defines": [ "WHATWGURL_PARSER_PROFILE" ]
+        }
+      }]
+    ]
+  }, {
+    # Microbenchmarks, built on Google Benchmark (libbenchmark-dev).
+    "target_name": "bench",
+    "type": "executable",
+    "dependencies": [
+      "libwhatwgurl",
+    ],
+    "sources": [
+      "bench/parse_bench.cc",
+      "bench/percent_encode_bench.cc",
+      "bench/url_core_bench.cc",
+      "bench/url_search_params_bench.cc",
+    ],
+    "libraries": [
+      "-lbenchmark_main",
+      "-lbenchmark",
+      "-lpthread",
+    ]
+  }, {
+    # Throughput over the URL corpora in bench/corpus.
+    "target_name": "corpus_bench",
+    "type": "executable",
+    "dependencies": [
+      "libwhatwgurl",
+    ],
+    "sources": [
+      "bench/corpus_bench.cc",
+    ],
+    "libraries": [
+      "-lpthread",
+    ]
+  }, {
+    # Normalizes newline-delimited URLs; see tools/urlnorm.cc.
+    "target_name": "urlnorm",
+    "type": "executable",
+    "dependencies": [
+      "libwhatwgurl",
+    ],
+    "sources": [
+      "tools/urlnorm.cc",
+    ],
+    "libraries": [
+      "-lpthread",
+    ]
   }]
 }
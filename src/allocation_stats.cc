@@ -0,0 +1,81 @@
+#include "allocation_stats.h"
+#include "thread_counters-inl.h"
+
+namespace whatwgurl {
+
+AllocationSiteStats AllocationStats::total() const {
+  AllocationSiteStats ret;
+#define V(name, _)                                                             \
+  ret.allocations += name.allocations;                                         \
+  ret.bytes += name.bytes;                                                     \
+  ret.regrowths += name.regrowths;
+  ALLOCATION_SITES(V)
+#undef V
+  return ret;
+}
+
+namespace {
+
+// Counter layout: the parse count, then allocations, bytes and regrowths of
+// every site.
+constexpr size_t kParsesCounter = 0;
+constexpr size_t kAllocationsCounter = 0;
+constexpr size_t kBytesCounter = 1;
+constexpr size_t kRegrowthsCounter = 2;
+constexpr size_t kCountersPerSite = 3;
+constexpr size_t kAllocationCounterCount =
+    1 + kAllocationSiteCount * kCountersPerSite;
+
+struct AllocationCountersTag {};
+typedef ThreadCounters<AllocationCountersTag, kAllocationCounterCount>
+    AllocationCounters;
+
+inline size_t SiteCounter(AllocationSite site, size_t field) {
+  return 1 + site * kCountersPerSite + field;
+}
+
+}  // namespace
+
+AllocationStats GetAllocationStats() {
+  uint64_t counters[kAllocationCounterCount];
+  AllocationCounters::Sum(counters);
+
+  AllocationStats ret;
+  ret.parses = counters[kParsesCounter];
+#define V(name, camel_name)                                                    \
+  ret.name.allocations =                                                       \
+      counters[SiteCounter(k##camel_name##Allocation, kAllocationsCounter)];   \
+  ret.name.bytes =                                                             \
+      counters[SiteCounter(k##camel_name##Allocation, kBytesCounter)];         \
+  ret.name.regrowths =                                                         \
+      counters[SiteCounter(k##camel_name##Allocation, kRegrowthsCounter)];
+  ALLOCATION_SITES(V)
+#undef V
+  return ret;
+}
+
+void ResetAllocationStats() {
+  AllocationCounters::Reset();
+}
+
+namespace allocation_stats {
+
+void Record(AllocationSite site, size_t bytes, bool regrowth) {
+  AllocationCounters::Add(SiteCounter(site, kAllocationsCounter), 1);
+  AllocationCounters::Add(SiteCounter(site, kBytesCounter), bytes);
+  if (regrowth) {
+    AllocationCounters::Add(SiteCounter(site, kRegrowthsCounter), 1);
+  }
+}
+
+void RecordRegrowth(AllocationSite site) {
+  AllocationCounters::Add(SiteCounter(site, kRegrowthsCounter), 1);
+}
+
+void RecordParse() {
+  AllocationCounters::Add(kParsesCounter, 1);
+}
+
+}  // namespace allocation_stats
+
+}  // namespace whatwgurl
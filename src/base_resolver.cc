@@ -0,0 +1,242 @@
+#include "base_resolver.h"
+#include <string.h>
+#include "allocation_stats.h"
+#include "code_points.h"
+#include "parse.h"
+#include "path.h"
+#include "percent_encode.h"
+
+namespace whatwgurl {
+
+using std::string;
+using std::unique_ptr;
+
+namespace {
+
+// Printable ASCII, the only code points the fast paths take. Everything else
+// is either percent-encoded, removed or trimmed by the parser.
+inline bool IsPrintableASCII(unsigned char c) {
+  return c > 0x20 && c < 0x7f;
+}
+
+// Whether the scheme state would find a scheme at the start of `url`, i.e.
+// whether it matches /^[A-Za-z][A-Za-z0-9+\-.]*:/.
+bool StartsWithScheme(const unsigned char* ptr, const unsigned char* end) {
+  if (ptr == end || !IsASCIIAlpha(*ptr)) return false;
+  for (++ptr; ptr < end; ++ptr) {
+    unsigned char c = *ptr;
+    if (c == ':') return true;
+    if (!IsASCIIAlphanumeric(c) && c != '+' && c != '-' && c != '.') {
+      return false;
+    }
+  }
+
+  return false;
+}
+
+// Whether `[ptr, end)` would be appended as is by a state that
+// percent-encodes with `percent_encode_set`, without validation errors.
+bool IsVerbatim(const unsigned char* ptr,
+                const unsigned char* end,
+                const uint8_t* percent_encode_set) {
+  for (; ptr < end; ++ptr) {
+    unsigned char c = *ptr;
+    if (!IsPrintableASCII(c) || BitAt(percent_encode_set, c)) return false;
+
+    // U+0025 (%) not followed by two ASCII hex digits is an invalid-URL-unit
+    // validation error.
+    if (c == '%' &&
+        (end - ptr < 3 || !IsASCIIHexDigit(ptr[1]) ||
+         !IsASCIIHexDigit(ptr[2]))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Removes the last "/segment" of the serialized path that starts at
+// `path_start` of `href`, like shortening a URL's path that is not a "file"
+// URL's.
+inline void ShortenPath(string* href, size_t path_start) {
+  size_t slash = href->rfind('/');
+  if (slash != string::npos && slash >= path_start) href->resize(slash);
+}
+
+// The URL `Resolve()` parses into when no fast path applies.
+thread_local ParsedURL resolve_scratch;
+
+}  // namespace
+
+BaseResolver::BaseResolver(const string& base, ParserContext* context)
+    : _context(context == nullptr ? ParserContext::Default() : context),
+      _base(new URLCore(base, context)) {
+  Init();
+}
+
+BaseResolver::BaseResolver(const URLCore& base, ParserContext* context)
+    : _context(context == nullptr ? ParserContext::Default() : context) {
+  // A copy, so that the setters of `base` do not reach the resolver.
+  std::shared_ptr<ParsedURL> parsed_url;
+  if (!base.failed()) {
+    parsed_url = std::make_shared<ParsedURL>();
+    *parsed_url = *base._parsed_url;
+  }
+  _base.reset(new URLCore(parsed_url, context));
+  Init();
+}
+
+void BaseResolver::Init() {
+  _failed = _base->failed();
+  if (_failed) return;
+
+  const ParsedURL& base = *_base->_parsed_url;
+  _href = _base->Serialize(true, &_components);
+  if (!base.host.is_null()) _host_type = base.host->type;
+  _opaque_path = base.HasOpaquePath();
+  _resolves_paths =
+      !_opaque_path && !base.host.is_null() && base.scheme != "file";
+  _query_percent_encode_set =
+      base.IsSpecial() ? percent_encode::kSpecialQueryPercentEncodeSet
+                       : percent_encode::kQueryPercentEncodeSet;
+}
+
+bool BaseResolver::Resolve(const string& url,
+                           string* href,
+                           URLComponents* components,
+                           HostType* host_type) const {
+  if (_failed) return false;
+
+  URLComponents unused;
+  if (components == nullptr) components = &unused;
+
+  if (ResolveFast(url, href, components)) {
+    if (host_type != nullptr) *host_type = _host_type;
+
+    // The fast paths raise no validation error.
+    _context->CountParse(true, false);
+    RecordParse();
+    return true;
+  }
+
+  // The parser, into a URL kept per thread so that its buffers are reused.
+  bool validation_error;
+  if (!ParseInto(url,
+                 _base->_parsed_url.get(),
+                 &resolve_scratch,
+                 &validation_error,
+                 _context)) {
+    return false;
+  }
+
+  URLCore::SerializeInto(resolve_scratch, href, components);
+  if (host_type != nullptr) {
+    *host_type = resolve_scratch.host.is_null() ? kNotInitialized
+                                                : resolve_scratch.host->type;
+  }
+  return true;
+}
+
+unique_ptr<URLCore> BaseResolver::ResolveURL(const string& url) const {
+  return unique_ptr<URLCore>(new URLCore(url, *_base, _context));
+}
+
+bool BaseResolver::ResolveFast(const string& url,
+                               string* href,
+                               URLComponents* components) const {
+  const unsigned char* ptr = reinterpret_cast<const unsigned char*>(url.data());
+  const unsigned char* end = ptr + url.length();
+
+  // Where the query and the fragment of `url` start, or `end`.
+  const unsigned char* fragment =
+      static_cast<const unsigned char*>(memchr(ptr, '#', end - ptr));
+  if (fragment == nullptr) fragment = end;
+  const unsigned char* query =
+      static_cast<const unsigned char*>(memchr(ptr, '?', fragment - ptr));
+  if (query == nullptr) query = fragment;
+
+  const uint8_t* fragment_percent_encode_set =
+      percent_encode::kFragmentPercentEncodeSet;
+  if (fragment < end &&
+      !IsVerbatim(fragment + 1, end, fragment_percent_encode_set)) {
+    return false;
+  }
+
+  // "" and "#fragment": the base's path and query, then the fragment. Only
+  // the latter resolves against an opaque path.
+  if (ptr == fragment && (fragment < end || !_opaque_path)) {
+    *components = _components;
+    *href = _href;
+    components->hash_start = href->length();
+    href->append(url);
+    return true;
+  }
+
+  // Nothing else does; leave the failure to the parser.
+  if (_opaque_path) return false;
+
+  if (query < fragment &&
+      !IsVerbatim(query + 1, fragment, _query_percent_encode_set)) {
+    return false;
+  }
+
+  // "?query": the base's path, then the query and the fragment.
+  if (ptr == query) {
+    *components = _components;
+    href->assign(_href, 0, _components.search_start);
+    href->append(url);
+    components->hash_start = _components.search_start + (fragment - ptr);
+    return true;
+  }
+
+  // A backslash is a path separator with a validation error in special URLs,
+  // and "//" starts a host.
+  if (!_resolves_paths || StartsWithScheme(ptr, query) ||
+      !IsVerbatim(ptr, query, percent_encode::kPathPercentEncodeSet) ||
+      memchr(ptr, '\\', query - ptr) != nullptr ||
+      (ptr[0] == '/' && query - ptr >= 2 && ptr[1] == '/')) {
+    return false;
+  }
+
+  *components = _components;
+  size_t path_start = _components.pathname_start;
+  if (ptr[0] == '/') {
+    // "/path" starts from an empty path.
+    href->assign(_href, 0, path_start);
+    ++ptr;
+  } else {
+    // "path" starts from the base's path, shortened.
+    href->assign(_href, 0, _components.search_start);
+    ShortenPath(href, path_start);
+  }
+
+  // The path state, for segments that need no percent-encoding.
+  while (true) {
+    const unsigned char* segment_end =
+        static_cast<const unsigned char*>(memchr(ptr, '/', query - ptr));
+    bool last = segment_end == nullptr;
+    if (last) segment_end = query;
+
+    const char* segment = reinterpret_cast<const char*>(ptr);
+    size_t length = segment_end - ptr;
+    if (Path::IsDoubleDotPathSegment(segment, length)) {
+      ShortenPath(href, path_start);
+      if (last) href->push_back('/');
+    } else if (Path::IsSingleDotPathSegment(segment, length)) {
+      if (last) href->push_back('/');
+    } else {
+      href->push_back('/');
+      href->append(segment, length);
+    }
+
+    if (last) break;
+    ptr = segment_end + 1;
+  }
+
+  components->search_start = href->length();
+  href->append(reinterpret_cast<const char*>(query), end - query);
+  components->hash_start = components->search_start + (fragment - query);
+  return true;
+}
+
+}  // namespace whatwgurl
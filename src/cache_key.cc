@@ -0,0 +1,225 @@
+#include "cache_key.h"
+#include <string.h>
+#include <algorithm>
+#include "code_points.h"
+#include "href_writer.h"
+#include "percent_encode.h"
+#include "utils/assert.h"
+
+namespace whatwgurl {
+
+using std::string;
+using std::vector;
+
+namespace {
+
+// A name-value pair of the query, as sliced out of it.
+struct QueryParameter {
+  const char* name;
+  size_t name_length;
+  const char* value;
+  size_t value_length;
+
+  // The name, decoded, for comparisons. Points into the query when decoding
+  // would not change it.
+  const char* decoded_name;
+  size_t decoded_name_length;
+};
+
+// What `Write()` needs per call, kept per thread so that steady-state calls
+// do not allocate.
+struct Scratch {
+  vector<QueryParameter> parameters;
+  string decoded_names;
+};
+
+thread_local Scratch scratch;
+
+// Whether the application/x-www-form-urlencoded parser and serializer would
+// give `[data, data + length)` back as is: neither "+" nor "%" to decode,
+// nothing to encode.
+inline bool IsFormVerbatim(const char* data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    unsigned char c = data[i];
+    if (InApplicationXFormUrlEncodedPercentEncodeSet(c)) return false;
+  }
+  return true;
+}
+
+// The application/x-www-form-urlencoded parser's decoding of a name or
+// value: "+" is a space, then percent-decode.
+void AppendFormDecoded(const char* data, size_t length, string* out) {
+  const unsigned char* ptr = reinterpret_cast<const unsigned char*>(data);
+  const unsigned char* end = ptr + length;
+  for (; ptr < end; ptr++) {
+    unsigned char c = *ptr;
+    if (c == '+') {
+      out->push_back(' ');
+      continue;
+    }
+
+    if (c == '%' && end - ptr > 2) {
+      unsigned char c1 = percent_encode::hexval[ptr[1]];
+      unsigned char c2 = percent_encode::hexval[ptr[2]];
+      if (c1 != 0xff && c2 != 0xff) {
+        out->push_back(static_cast<char>(c1 << 4 | c2));
+        ptr += 2;
+        continue;
+      }
+    }
+
+    out->push_back(c);
+  }
+}
+
+// Writes a name or value of the query as the application/x-www-form-urlencoded
+// serializer would after parsing it.
+template <typename Writer>
+void WriteFormReencoded(const char* data, size_t length, Writer* writer) {
+  if (IsFormVerbatim(data, length)) {
+    writer->Append(data, length);
+    return;
+  }
+
+  string& decoded = scratch.decoded_names;
+  size_t start = decoded.length();
+  AppendFormDecoded(data, length, &decoded);
+  for (size_t i = start; i < decoded.length(); i++) {
+    unsigned char c = decoded[i];
+    if (c == ' ') {
+      writer->Append('+');
+    } else if (!InApplicationXFormUrlEncodedPercentEncodeSet(c)) {
+      writer->Append(static_cast<char>(c));
+    } else {
+      writer->Append(percent_encode::hex + c * 4, PER_PERCENT_HEX_LENGTH);
+    }
+  }
+  decoded.resize(start);
+}
+
+}  // namespace
+
+CacheKey::CacheKey(const Options& options) : _sort_query(options.sort_query) {
+  for (const string& name : options.removed_parameters) {
+    if (!name.empty() && name.back() == '*') {
+      _removed_prefixes.push_back(name.substr(0, name.length() - 1));
+    } else {
+      _removed_names.push_back(name);
+    }
+  }
+}
+
+void CacheKey::Key(const URLCore& url, string* key) const {
+  key->clear();
+  StringWriter writer(key);
+  Write(url, &writer);
+}
+
+uint64_t CacheKey::Hash(const URLCore& url, uint64_t seed) const {
+  HashWriter writer(seed);
+  Write(url, &writer);
+  return writer.Digest();
+}
+
+bool CacheKey::IsRemoved(const char* name, size_t length) const {
+  for (const string& removed : _removed_names) {
+    if (removed.length() == length &&
+        memcmp(removed.data(), name, length) == 0) {
+      return true;
+    }
+  }
+
+  for (const string& prefix : _removed_prefixes) {
+    if (prefix.length() <= length &&
+        memcmp(prefix.data(), name, prefix.length()) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+template <typename Writer>
+void CacheKey::Write(const URLCore& url, Writer* writer) const {
+  CHECK(!url.failed());
+
+  // Everything up to the query stays as it is.
+  url.Write(writer, kHashAllParts & ~(kHashSearch | kHashFragment));
+  const MaybeNull<string>& search = url._parsed_url->query;
+  if (search.is_null()) return;
+
+  const char* query = search->data();
+  const char* end = query + search->length();
+  if (!_sort_query && _removed_names.empty() && _removed_prefixes.empty()) {
+    writer->Append('?');
+    writer->Append(query, end - query);
+    return;
+  }
+
+  // Slice the query like the application/x-www-form-urlencoded parser:
+  // sequences split on "&", empty ones skipped, the name up to the first "=".
+  vector<QueryParameter>& parameters = scratch.parameters;
+  string& decoded_names = scratch.decoded_names;
+  parameters.clear();
+  decoded_names.clear();
+
+  // Decoding never makes a name longer, so the names fit in the query's
+  // length and the pointers into `decoded_names` stay valid.
+  decoded_names.reserve(end - query);
+  for (const char* ptr = query; ptr <= end;) {
+    const char* sequence_end =
+        static_cast<const char*>(memchr(ptr, '&', end - ptr));
+    if (sequence_end == nullptr) sequence_end = end;
+    if (sequence_end == ptr) {
+      ptr++;
+      continue;
+    }
+
+    const char* equals =
+        static_cast<const char*>(memchr(ptr, '=', sequence_end - ptr));
+    QueryParameter parameter;
+    parameter.name = ptr;
+    parameter.name_length = (equals == nullptr ? sequence_end : equals) - ptr;
+    parameter.value = equals == nullptr ? sequence_end : equals + 1;
+    parameter.value_length = sequence_end - parameter.value;
+
+    if (IsFormVerbatim(parameter.name, parameter.name_length)) {
+      parameter.decoded_name = parameter.name;
+      parameter.decoded_name_length = parameter.name_length;
+    } else {
+      size_t start = decoded_names.length();
+      AppendFormDecoded(parameter.name, parameter.name_length, &decoded_names);
+      parameter.decoded_name = decoded_names.data() + start;
+      parameter.decoded_name_length = decoded_names.length() - start;
+    }
+
+    if (!IsRemoved(parameter.decoded_name, parameter.decoded_name_length)) {
+      parameters.push_back(parameter);
+    }
+    ptr = sequence_end + 1;
+  }
+
+  if (_sort_query) {
+    std::stable_sort(
+        parameters.begin(),
+        parameters.end(),
+        [](const QueryParameter& a, const QueryParameter& b) {
+          return CompareByCodeUnits(a.decoded_name,
+                                    a.decoded_name_length,
+                                    b.decoded_name,
+                                    b.decoded_name_length) < 0;
+        });
+  }
+
+  // The serialization of the remaining list; an empty one makes the query
+  // null, so no "?" either.
+  for (size_t i = 0; i < parameters.size(); i++) {
+    const QueryParameter& parameter = parameters[i];
+    writer->Append(i == 0 ? '?' : '&');
+    WriteFormReencoded(parameter.name, parameter.name_length, writer);
+    writer->Append('=');
+    WriteFormReencoded(parameter.value, parameter.value_length, writer);
+  }
+}
+
+}  // namespace whatwgurl
@@ -0,0 +1,478 @@
+#include "corpus_aggregator.h"
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "parse.h"
+#include "utils/assert.h"
+#include "xxhash64.h"
+
+namespace whatwgurl {
+
+using std::string;
+using std::vector;
+
+constexpr unsigned HyperLogLog::kMinPrecision;
+constexpr unsigned HyperLogLog::kMaxPrecision;
+constexpr uint32_t SpaceSaving::kEmptySlot;
+constexpr size_t CorpusAggregator::kHistogramBuckets;
+constexpr size_t CorpusAggregator::kNullHostTypeIndex;
+
+namespace {
+
+const char* const kSchemeNames[] = {
+    "other", "ftp", "file", "http", "https", "ws", "wss"};
+
+const char* const kHostTypeNames[] = {
+    "domain", "ipv4", "ipv6", "opaque", "empty", "null"};
+
+void AppendFormat(string* out, const char* format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+
+  CHECK(length >= 0 && static_cast<size_t>(length) < sizeof(buf));
+  out->append(buf, length);
+}
+
+// Appends `value` as the contents of a JSON string. Hosts are ASCII, but an
+// opaque host may hold a quote.
+void AppendJSONString(const string& value, string* out) {
+  for (unsigned char c : value) {
+    if (c == '"' || c == '\\') {
+      out->push_back('\\');
+      out->push_back(c);
+    } else if (c < 0x20) {
+      AppendFormat(out, "\\u%04x", c);
+    } else {
+      out->push_back(c);
+    }
+  }
+}
+
+void AppendHistogram(const uint64_t* buckets, size_t count, string* out) {
+  out->push_back('[');
+  for (size_t i = 0; i < count; i++) {
+    AppendFormat(out, "%s%" PRIu64, i == 0 ? "" : ",", buckets[i]);
+  }
+  out->push_back(']');
+}
+
+inline size_t Bucket(size_t value) {
+  return std::min(value, CorpusAggregator::kHistogramBuckets - 1);
+}
+
+// The number of name-value pairs the application/x-www-form-urlencoded
+// parser would find in `query`, i.e. its non-empty sequences between "&"s.
+size_t CountQueryParameters(const string& query) {
+  size_t count = 0;
+  size_t start = 0;
+  while (start <= query.length()) {
+    size_t end = query.find('&', start);
+    if (end == string::npos) end = query.length();
+    if (end > start) count++;
+    start = end + 1;
+  }
+  return count;
+}
+
+}  // namespace
+
+HyperLogLog::HyperLogLog(unsigned precision)
+    : _precision(precision), _registers(size_t{1} << precision) {
+  CHECK(precision >= kMinPrecision && precision <= kMaxPrecision);
+}
+
+void HyperLogLog::Merge(const HyperLogLog& other) {
+  CHECK_EQ(_precision, other._precision);
+  for (size_t i = 0; i < _registers.size(); i++) {
+    _registers[i] = std::max(_registers[i], other._registers[i]);
+  }
+}
+
+double HyperLogLog::Estimate() const {
+  double m = static_cast<double>(_registers.size());
+  double sum = 0;
+  size_t zeros = 0;
+  for (uint8_t rank : _registers) {
+    sum += ldexp(1.0, -rank);
+    if (rank == 0) zeros++;
+  }
+
+  double alpha;
+  switch (_precision) {
+    case 4:
+      alpha = 0.673;
+      break;
+    case 5:
+      alpha = 0.697;
+      break;
+    case 6:
+      alpha = 0.709;
+      break;
+    default:
+      alpha = 0.7213 / (1 + 1.079 / m);
+      break;
+  }
+
+  // Small cardinalities are better estimated by linear counting. With 64-bit
+  // hashes, large ones need no correction.
+  double estimate = alpha * m * m / sum;
+  if (estimate <= 2.5 * m && zeros > 0) estimate = m * log(m / zeros);
+  return estimate;
+}
+
+SpaceSaving::SpaceSaving(size_t capacity) : _capacity(capacity) {
+  CHECK(capacity > 0 && capacity < kEmptySlot / 2);
+
+  // At most half full, so that probes stay short.
+  size_t slots = 1;
+  while (slots < capacity * 2) slots *= 2;
+  _slots.assign(slots, kEmptySlot);
+  _entries.reserve(capacity);
+  _heap.reserve(capacity);
+  _heap_positions.reserve(capacity);
+}
+
+void SpaceSaving::Add(uint64_t hash,
+                      const char* key,
+                      size_t length,
+                      uint64_t count) {
+  uint32_t* slot = &_slots[FindSlot(hash)];
+  if (*slot != kEmptySlot) {
+    _entries[*slot].count += count;
+    SiftDown(_heap_positions[*slot]);
+    return;
+  }
+
+  if (_entries.size() < _capacity) {
+    uint32_t index = static_cast<uint32_t>(_entries.size());
+    _entries.push_back({string(key, length), hash, count, 0});
+    *slot = index;
+    _heap.push_back(index);
+    _heap_positions.push_back(static_cast<uint32_t>(_heap.size() - 1));
+    SiftUp(_heap.size() - 1);
+    return;
+  }
+
+  // The least frequent key makes way, and its count bounds the new key's.
+  uint32_t index = _heap[0];
+  Entry* entry = &_entries[index];
+  EraseSlot(FindSlot(entry->hash));
+  entry->key.assign(key, length);
+  entry->hash = hash;
+  entry->error = entry->count;
+  entry->count += count;
+  _slots[FindSlot(hash)] = index;
+  SiftDown(0);
+}
+
+void SpaceSaving::Merge(const SpaceSaving& other) {
+  CHECK_EQ(_capacity, other._capacity);
+
+  // A key one summary does not monitor may have had up to that summary's
+  // smallest count in its stream.
+  uint64_t missing = MissingCount();
+  uint64_t other_missing = other.MissingCount();
+
+  vector<Entry> merged;
+  merged.reserve(_entries.size() + other._entries.size());
+  for (const Entry& entry : _entries) {
+    merged.push_back(entry);
+    Entry* back = &merged.back();
+    uint32_t index = other._slots[other.FindSlot(entry.hash)];
+    if (index == kEmptySlot) {
+      back->count += other_missing;
+      back->error += other_missing;
+    } else {
+      back->count += other._entries[index].count;
+      back->error += other._entries[index].error;
+    }
+  }
+
+  for (const Entry& entry : other._entries) {
+    if (_slots[FindSlot(entry.hash)] != kEmptySlot) continue;
+    merged.push_back(entry);
+    merged.back().count += missing;
+    merged.back().error += missing;
+  }
+
+  Rebuild(&merged);
+}
+
+vector<SpaceSaving::Entry> SpaceSaving::Top(size_t k) const {
+  vector<Entry> ret = _entries;
+  k = std::min(k, ret.size());
+  std::partial_sort(
+      ret.begin(), ret.begin() + k, ret.end(), [](const Entry& a,
+                                                  const Entry& b) {
+        return a.count != b.count ? a.count > b.count : a.key < b.key;
+      });
+  ret.resize(k);
+  return ret;
+}
+
+// The slot of `hash`, or the empty slot it would go in.
+size_t SpaceSaving::FindSlot(uint64_t hash) const {
+  size_t mask = _slots.size() - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    uint32_t index = _slots[i];
+    if (index == kEmptySlot || _entries[index].hash == hash) return i;
+  }
+}
+
+// Backward-shift deletion: moves the following entries of the probe run into
+// the hole, unless that would put them before their home slot.
+void SpaceSaving::EraseSlot(size_t slot) {
+  size_t mask = _slots.size() - 1;
+  size_t hole = slot;
+  for (size_t i = (hole + 1) & mask; _slots[i] != kEmptySlot;
+       i = (i + 1) & mask) {
+    size_t home = _entries[_slots[i]].hash & mask;
+    bool movable = hole < i ? (home <= hole || home > i)
+                            : (home <= hole && home > i);
+    if (movable) {
+      _slots[hole] = _slots[i];
+      hole = i;
+    }
+  }
+  _slots[hole] = kEmptySlot;
+}
+
+void SpaceSaving::SiftDown(size_t position) {
+  size_t size = _heap.size();
+  while (true) {
+    size_t smallest = position;
+    size_t left = position * 2 + 1;
+    size_t right = left + 1;
+    if (left < size &&
+        _entries[_heap[left]].count < _entries[_heap[smallest]].count) {
+      smallest = left;
+    }
+    if (right < size &&
+        _entries[_heap[right]].count < _entries[_heap[smallest]].count) {
+      smallest = right;
+    }
+    if (smallest == position) return;
+
+    std::swap(_heap[position], _heap[smallest]);
+    _heap_positions[_heap[position]] = static_cast<uint32_t>(position);
+    _heap_positions[_heap[smallest]] = static_cast<uint32_t>(smallest);
+    position = smallest;
+  }
+}
+
+void SpaceSaving::SiftUp(size_t position) {
+  while (position > 0) {
+    size_t parent = (position - 1) / 2;
+    if (_entries[_heap[parent]].count <= _entries[_heap[position]].count) {
+      return;
+    }
+
+    std::swap(_heap[position], _heap[parent]);
+    _heap_positions[_heap[position]] = static_cast<uint32_t>(position);
+    _heap_positions[_heap[parent]] = static_cast<uint32_t>(parent);
+    position = parent;
+  }
+}
+
+// Keeps the `_capacity` highest counts of `entries`.
+void SpaceSaving::Rebuild(vector<Entry>* entries) {
+  std::sort(entries->begin(), entries->end(), [](const Entry& a,
+                                                 const Entry& b) {
+    return a.count > b.count;
+  });
+  if (entries->size() > _capacity) entries->resize(_capacity);
+
+  // Ascending counts are a valid min-heap as they are.
+  std::reverse(entries->begin(), entries->end());
+  _entries.swap(*entries);
+  _heap.resize(_entries.size());
+  _heap_positions.resize(_entries.size());
+  std::fill(_slots.begin(), _slots.end(), kEmptySlot);
+  for (uint32_t i = 0; i < _entries.size(); i++) {
+    _heap[i] = i;
+    _heap_positions[i] = i;
+    _slots[FindSlot(_entries[i].hash)] = i;
+  }
+}
+
+CorpusAggregator::CorpusAggregator(const Options& options)
+    : _context(options.context == nullptr ? ParserContext::Default()
+                                          : options.context),
+      _top_hosts(options.top_hosts),
+      _distinct_hosts(options.distinct_precision),
+      _distinct_paths(options.distinct_precision) {}
+
+bool CorpusAggregator::Add(const string& url, const ParsedURL* base) {
+  bool validation_error;
+  if (!ParseInto(url, base, &_scratch, &validation_error, _context)) {
+    _urls++;
+    _failures++;
+    return false;
+  }
+
+  Add(_scratch);
+  return true;
+}
+
+void CorpusAggregator::Add(const ParsedURL& url) {
+  _urls++;
+
+  _scheme_counts[GetBatchSchemeId(url.scheme.data(), url.scheme.length())]++;
+
+  // The host's key is its type, then its raw value.
+  if (url.host.is_null()) {
+    _host_type_counts[kNullHostTypeIndex]++;
+  } else {
+    const HostItem& host = *url.host;
+    _host_type_counts[host.type]++;
+
+    _key.assign(1, static_cast<char>(host.type));
+    switch (host.type) {
+      case kDomain:
+        _key.append(host.host.domain);
+        break;
+      case kOpaqueHost:
+        _key.append(host.host.opaque_host);
+        break;
+      case kIPv4Address:
+        _key.append(reinterpret_cast<const char*>(&host.host.ipv4_address),
+                    sizeof(host.host.ipv4_address));
+        break;
+      case kIPv6Address:
+        _key.append(reinterpret_cast<const char*>(host.host.ipv6_address),
+                    sizeof(host.host.ipv6_address));
+        break;
+      default:
+        break;
+    }
+
+    uint64_t hash = XXH64::Hash(_key);
+    _distinct_hosts.Add(hash);
+    _top_hosts.Add(hash, _key.data(), _key.length());
+  }
+
+  // The pathname as the URL path serializer would write it.
+  XXH64 path_hash;
+  if (url.HasOpaquePath()) {
+    path_hash.Update(url.path.ASCIIString());
+    _path_depths[0]++;
+  } else {
+    for (size_t i = 0; i < url.path.size(); i++) {
+      path_hash.Update('/');
+      path_hash.Update(url.path[i]);
+    }
+    _path_depths[Bucket(url.path.size())]++;
+  }
+  _distinct_paths.Add(path_hash.Digest());
+
+  size_t parameters =
+      url.query.is_null() ? 0 : CountQueryParameters(url.query.value());
+  _query_parameter_counts[Bucket(parameters)]++;
+}
+
+void CorpusAggregator::Merge(const CorpusAggregator& other) {
+  _urls += other._urls;
+  _failures += other._failures;
+  for (size_t i = 0; i <= kWssSchemeId; i++) {
+    _scheme_counts[i] += other._scheme_counts[i];
+  }
+  for (size_t i = 0; i <= kNullHostTypeIndex; i++) {
+    _host_type_counts[i] += other._host_type_counts[i];
+  }
+  for (size_t i = 0; i < kHistogramBuckets; i++) {
+    _path_depths[i] += other._path_depths[i];
+    _query_parameter_counts[i] += other._query_parameter_counts[i];
+  }
+
+  _top_hosts.Merge(other._top_hosts);
+  _distinct_hosts.Merge(other._distinct_hosts);
+  _distinct_paths.Merge(other._distinct_paths);
+}
+
+vector<CorpusAggregator::HostCount> CorpusAggregator::TopHosts(
+    size_t k) const {
+  vector<HostCount> ret;
+  for (const SpaceSaving::Entry& entry : _top_hosts.Top(k)) {
+    const string& key = entry.key;
+    HostItem host;
+    switch (static_cast<HostType>(key[0])) {
+      case kIPv4Address: {
+        uint32_t address;
+        memcpy(&address, key.data() + 1, sizeof(address));
+        host.SetIPv4Address(address);
+        break;
+      }
+      case kIPv6Address: {
+        uint16_t address[8];
+        memcpy(address, key.data() + 1, sizeof(address));
+        host.SetIPv6Address(address);
+        break;
+      }
+      default:
+        // A domain and an opaque host serialize as themselves.
+        host.SetOpaqueHost(key.substr(1));
+        break;
+    }
+
+    ret.push_back({host.Serialize(), entry.count, entry.error});
+  }
+
+  return ret;
+}
+
+string CorpusAggregator::ToJSON(size_t top_hosts) const {
+  string ret;
+  AppendFormat(&ret,
+               "{\"urls\":%" PRIu64 ",\"failures\":%" PRIu64 ",\"schemes\":{",
+               _urls,
+               _failures);
+  for (size_t i = 0; i <= kWssSchemeId; i++) {
+    AppendFormat(&ret,
+                 "%s\"%s\":%" PRIu64,
+                 i == 0 ? "" : ",",
+                 kSchemeNames[i],
+                 _scheme_counts[i]);
+  }
+
+  ret.append("},\"host_types\":{");
+  for (size_t i = 0; i <= kNullHostTypeIndex; i++) {
+    AppendFormat(&ret,
+                 "%s\"%s\":%" PRIu64,
+                 i == 0 ? "" : ",",
+                 kHostTypeNames[i],
+                 _host_type_counts[i]);
+  }
+
+  AppendFormat(&ret,
+               "},\"distinct_hosts\":%.0f,\"distinct_paths\":%.0f",
+               DistinctHosts(),
+               DistinctPaths());
+
+  ret.append(",\"path_depths\":");
+  AppendHistogram(_path_depths, kHistogramBuckets, &ret);
+  ret.append(",\"query_parameter_counts\":");
+  AppendHistogram(_query_parameter_counts, kHistogramBuckets, &ret);
+
+  ret.append(",\"top_hosts\":[");
+  bool first = true;
+  for (const HostCount& host : TopHosts(top_hosts)) {
+    ret.append(first ? "{\"host\":\"" : ",{\"host\":\"");
+    AppendJSONString(host.host, &ret);
+    AppendFormat(&ret,
+                 "\",\"count\":%" PRIu64 ",\"error\":%" PRIu64 "}",
+                 host.count,
+                 host.error);
+    first = false;
+  }
+
+  ret.append("]}");
+  return ret;
+}
+
+}  // namespace whatwgurl
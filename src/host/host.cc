@@ -1,4 +1,5 @@
 #include "host/host.h"
+#include <string.h>
 #include "code_points.h"
 #include "idna.h"
 #include "ip_util-inl.h"
@@ -18,37 +19,238 @@ enum ParseIPv4Result : int8_t {
   kParseIPv4Invalid = -2,
 };
 
+// `FormatIPv6()` only tells whether `input` is an IPv6 address. When it is
+// not, this runs the IPv6 parser of the spec to find out which validation
+// error makes it fail, and where.
+// https://url.spec.whatwg.org/#concept-ipv6-parser
+static ValidationErrorCode IPv6ParseError(const char* input,
+                                          size_t input_size,
+                                          size_t* at) {
+  const char* ptr = input;
+  const char* end = input + input_size;
+  int piece_index = 0;
+  bool compress = false;
+
+#define IPV6_ERROR(code)                                                       \
+  do {                                                                         \
+    *at = ptr - input;                                                         \
+    return code;                                                               \
+  } while (0)
+
+  if (ptr < end && *ptr == ':') {
+    if (ptr + 1 >= end || ptr[1] != ':') {
+      IPV6_ERROR(kIPv6InvalidCompressionError);
+    }
+    ptr += 2;
+    compress = true;
+    piece_index++;
+  }
+
+  while (ptr < end) {
+    if (piece_index == 8) IPV6_ERROR(kIPv6TooManyPiecesError);
+
+    if (*ptr == ':') {
+      if (compress) IPV6_ERROR(kIPv6MultipleCompressionError);
+      ptr++;
+      piece_index++;
+      compress = true;
+      continue;
+    }
+
+    int length = 0;
+    while (length < 4 && ptr < end && IsASCIIHexDigit(*ptr)) {
+      ptr++;
+      length++;
+    }
+
+    if (ptr < end && *ptr == '.') {
+      if (length == 0) IPV6_ERROR(kIPv4InIPv6InvalidCodePointError);
+      ptr -= length;
+      if (piece_index > 6) IPV6_ERROR(kIPv4InIPv6TooManyPiecesError);
+
+      int numbers_seen = 0;
+      while (ptr < end) {
+        int ipv4_piece = -1;
+        if (numbers_seen > 0) {
+          if (*ptr != '.' || numbers_seen >= 4) {
+            IPV6_ERROR(kIPv4InIPv6InvalidCodePointError);
+          }
+          ptr++;
+        }
+
+        if (ptr >= end || !IsASCIIDigit(*ptr)) {
+          IPV6_ERROR(kIPv4InIPv6InvalidCodePointError);
+        }
+
+        while (ptr < end && IsASCIIDigit(*ptr)) {
+          if (ipv4_piece == 0) IPV6_ERROR(kIPv4InIPv6InvalidCodePointError);
+          ipv4_piece = (ipv4_piece == -1 ? 0 : ipv4_piece * 10) + (*ptr - '0');
+          if (ipv4_piece > 255) IPV6_ERROR(kIPv4InIPv6OutOfRangePartError);
+          ptr++;
+        }
+
+        numbers_seen++;
+        if (numbers_seen == 2 || numbers_seen == 4) piece_index++;
+      }
+
+      if (numbers_seen != 4) IPV6_ERROR(kIPv4InIPv6TooFewPartsError);
+      break;
+    } else if (ptr < end && *ptr == ':') {
+      ptr++;
+      if (ptr >= end) IPV6_ERROR(kIPv6InvalidCodePointError);
+    } else if (ptr < end) {
+      IPV6_ERROR(kIPv6InvalidCodePointError);
+    }
+
+    piece_index++;
+  }
+
+  if (!compress && piece_index != 8) IPV6_ERROR(kIPv6TooFewPiecesError);
+
+#undef IPV6_ERROR
+
+  // The spec accepts what `inet_pton()` rejected; blame the whole address.
+  *at = 0;
+  return kIPv6InvalidCodePointError;
+}
+
 static inline bool ParseIPv6(const char* input,
                              size_t input_size,
                              Host* host,
-                             bool* validation_error) {
+                             ValidationErrorReporter* errors,
+                             size_t offset) {
   uint16_t ip[8];
   IPv6FormatResult ipv6_format_ret = FormatIPv6(input, input_size, ip);
   switch (ipv6_format_ret) {
     case IPv6FormatResult::kIPv6FormatOK:
       host->SetIPv6Address(ip);
       return true;
-    case IPv6FormatResult::kIPv6FormatFail:
-      *validation_error = true;
+    case IPv6FormatResult::kIPv6FormatFail: {
+      size_t at = 0;
+      ValidationErrorCode code = kIPv6InvalidCodePointError;
+      if (errors->enabled()) code = IPv6ParseError(input, input_size, &at);
+      errors->Report(code, offset + at);
       return false;
+    }
     default:
       UNREACHABLE();
   }
 }
 
-static inline ParseIPv4Result ParseIPv4(const char* input,
-                                        size_t input_size,
+// `FormatIPv4()` only tells whether `input` is an IPv4 address. This runs the
+// IPv4 parser of the spec over it again for the validation errors it raises,
+// including the ones that do not make it fail, e.g. IPv4-non-decimal-part for
+// "0x7f.1". Returns the number of errors reported.
+// https://url.spec.whatwg.org/#concept-ipv4-parser
+static int ReportIPv4Errors(const string& input,
+                            ValidationErrorReporter* errors,
+                            size_t offset) {
+  int reported = 0;
+  const char* ptr = input.c_str();
+  const char* end = ptr + input.length();
+
+  // If the last item in parts is the empty string, IPv4-empty-part validation
+  // error, and remove it if parts has more than one item.
+  if (end > ptr && end[-1] == '.') {
+    errors->Report(kIPv4EmptyPartError, offset);
+    reported++;
+    if (end - 1 > ptr) end--;
+  }
+
+  size_t parts = 1;
+  for (const char* p = ptr; p < end; p++) {
+    if (*p == '.') parts++;
+  }
+
+  // If parts's size is greater than 4, IPv4-too-many-parts validation error,
+  // return failure.
+  if (parts > 4) {
+    errors->Report(kIPv4TooManyPartsError, offset);
+    return reported + 1;
+  }
+
+  bool non_decimal = false;
+  bool out_of_range = false;
+  for (size_t i = 0; i < parts; i++) {
+    const char* part_end =
+        static_cast<const char*>(memchr(ptr, '.', end - ptr));
+    if (part_end == nullptr) part_end = end;
+
+    // https://url.spec.whatwg.org/#ipv4-number-parser
+    const char* p = ptr;
+    int radix = 10;
+    if (part_end - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+      p += 2;
+      radix = 16;
+    } else if (part_end - p >= 2 && p[0] == '0') {
+      p++;
+      radix = 8;
+    }
+    if (radix != 10) non_decimal = true;
+
+    if (p == ptr && p == part_end) {
+      errors->Report(kIPv4NonNumericPartError, offset);
+      return reported + 1;
+    }
+
+    uint64_t number = 0;
+    for (; p < part_end; p++) {
+      int digit;
+      if (IsASCIIDigit(*p)) {
+        digit = *p - '0';
+      } else if (IsASCIIHexDigit(*p)) {
+        digit = (*p | 0x20) - 'a' + 10;
+      } else {
+        digit = radix;
+      }
+
+      if (digit >= radix) {
+        errors->Report(kIPv4NonNumericPartError, offset);
+        return reported + 1;
+      }
+
+      // Saturate; anything past 2^32 is out of range all the same.
+      if (number <= 0xffffffff) number = number * radix + digit;
+    }
+
+    if (number > 255) out_of_range = true;
+    ptr = part_end + 1;
+  }
+
+  if (non_decimal) {
+    errors->Report(kIPv4NonDecimalPartError, offset);
+    reported++;
+  }
+  if (out_of_range) {
+    errors->Report(kIPv4OutOfRangePartError, offset);
+    reported++;
+  }
+
+  return reported;
+}
+
+static inline ParseIPv4Result ParseIPv4(const string& input,
                                         Host* host,
-                                        bool* validation_error) {
+                                        ValidationErrorReporter* errors,
+                                        size_t offset) {
   uint32_t ip;
-  IPv4FormatResult ipv4_format_ret = FormatIPv4(input, input_size, &ip);
+  bool validation_error;
+  IPv4FormatResult ipv4_format_ret =
+      FormatIPv4(input.c_str(), input.length(), &ip, &validation_error);
   switch (ipv4_format_ret) {
     case kIPv4FormatFail:
-      *validation_error = true;
+      if (!errors->enabled() || ReportIPv4Errors(input, errors, offset) == 0) {
+        errors->Report(kIPv4OutOfRangePartError, offset);
+      }
       return kParseIPv4Invalid;
 
     case kIPv4FormatOK:
-      // TODO(XadillaX): validation_error like 0x?? segments.
+      // Which errors they are only matters to an enabled reporter.
+      if (errors->enabled()) {
+        ReportIPv4Errors(input, errors, offset);
+      } else if (validation_error) {
+        errors->Report(kIPv4NonDecimalPartError, offset);
+      }
       host->SetIPv4Address(ip);
       return kParseIPv4OK;
 
@@ -62,18 +264,20 @@ static inline ParseIPv4Result ParseIPv4(const char* input,
 
 static inline bool ParseOpaqueHost(const TempStringBuffer& input,
                                    Host* host,
-                                   bool* validation_error) {
+                                   ValidationErrorReporter* errors,
+                                   size_t offset) {
   // The max length should be `input_size * 3`. But `output`'s length is
   // dynamic. So we use a smaller length to reduce the initialization cost.
   TempStringBuffer output(input.length() * 2);
 
-  const unsigned char* ptr = input.unsigned_string();
+  const unsigned char* begin = input.unsigned_string();
+  const unsigned char* ptr = begin;
   const unsigned char* end = ptr + input.length();
   for (; ptr < end; ++ptr) {
-    // If input contains a forbidden host code point, validation error, return
-    // failure.
+    // If input contains a forbidden host code point, host-invalid-code-point
+    // validation error, return failure.
     if (IsForbiddenHostCodePoint(*ptr)) {
-      *validation_error = true;
+      errors->Report(kHostInvalidCodePointError, offset + (ptr - begin));
       return false;
     }
 
@@ -82,12 +286,12 @@ static inline bool ParseOpaqueHost(const TempStringBuffer& input,
     // TODO(XadillaX): Validation error of not-a-URL-code-point and not U+0025.
 
     // If input contains a U+0025 (%) and the two code points following it are
-    // not ASCII hex digits, validation error.
+    // not ASCII hex digits, invalid-URL-unit validation error.
     unsigned char c = *ptr;
     if (c == '%') {
       if (ptr + 2 >= end || !IsASCIIHexDigit(*(ptr + 1)) ||
           !IsASCIIHexDigit(*(ptr + 2))) {
-        *validation_error = true;
+        errors->Report(kInvalidURLUnitError, offset + (ptr - begin));
       }
     }
 
@@ -104,15 +308,18 @@ static inline bool ParseOpaqueHost(const TempStringBuffer& input,
 
 bool Host::Parse(const TempStringBuffer& input,
                  Host* host,
-                 bool* validation_error,
-                 bool is_not_special) {
+                 ValidationErrorReporter* errors,
+                 size_t offset,
+                 bool is_not_special,
+                 ParserContext* context) {
   const unsigned char* data = input.unsigned_string();
 
   // If input starts with U+005B ([), then:
   if (*data == '[') {
-    // If input does not end with U+005D (]), validation error, return failure.
+    // If input does not end with U+005D (]), IPv6-unclosed validation error,
+    // return failure.
     if (*(data + input.length() - 1) != ']') {
-      *validation_error = true;
+      errors->Report(kIPv6UnclosedError, offset);
       return false;
     }
 
@@ -121,13 +328,14 @@ bool Host::Parse(const TempStringBuffer& input,
     return ParseIPv6(reinterpret_cast<const char*>(data + 1),
                      input.length() - 2,
                      host,
-                     validation_error);
+                     errors,
+                     offset + 1);
   }
 
   // If isNotSpecial is true, then return the result of opaque-host parsing
   // input.
   if (is_not_special) {
-    return ParseOpaqueHost(input, host, validation_error);
+    return ParseOpaqueHost(input, host, errors, offset);
   }
 
   // Assert: input is not the empty string.
@@ -144,31 +352,32 @@ bool Host::Parse(const TempStringBuffer& input,
 
   // Let asciiDomain be the result of running domain to ASCII on domain.
   string ascii_domain;
-  CHECK_NOT_NULL(kIDNAToASCII);
-  int32_t ascii_domain_len = kIDNAToASCII(
-      &ascii_domain, domain.string(), domain.length(), kIDNADefault);
+  if (context == nullptr) context = ParserContext::Default();
+  int32_t ascii_domain_len = context->DomainToASCII(
+      &ascii_domain, domain.string(), domain.length());
 
   // If asciiDomain is failure, validation error, return failure:
 
-  // If result is a failure value, validation error, return failure. If result
-  // is the empty string, validation error, return failure.
+  // If result is a failure value, domain-to-ASCII validation error, return
+  // failure. If result is the empty string, domain-to-ASCII validation error,
+  // return failure.
   if (ascii_domain_len == -1 || ascii_domain_len == 0) {
-    *validation_error = true;
+    errors->Report(kDomainToASCIIError, offset);
     return false;
   }
 
-  // If asciiDomain contains a forbidden domain code point, validation error,
-  // return failure.
+  // If asciiDomain contains a forbidden domain code point,
+  // domain-invalid-code-point validation error, return failure.
   if (string_utils::Contains(
           ascii_domain, CodePointMacroToLambda(IsForbiddenDomainCodePoint))) {
-    *validation_error = true;
+    errors->Report(kDomainInvalidCodePointError, offset);
     return false;
   }
 
   // If asciiDomain ends in a number, then return the result of IPv4 parsing
   // asciiDomain.
-  ParseIPv4Result parse_ipv4_result = ParseIPv4(
-      ascii_domain.c_str(), ascii_domain.length(), host, validation_error);
+  ParseIPv4Result parse_ipv4_result =
+      ParseIPv4(ascii_domain, host, errors, offset);
   switch (parse_ipv4_result) {
     case kParseIPv4OK:
       return true;
@@ -34,11 +34,16 @@ IPv6FormatResult FormatIPv6(const char* in, int in_len, uint16_t* out) {
   return kIPv6FormatOK;
 }
 
-IPv4FormatResult FormatIPv4(const char* in, int in_len, uint32_t* out) {
+IPv4FormatResult FormatIPv4(const char* in,
+                            int in_len,
+                            uint32_t* out,
+                            bool* validation_error) {
   // `inet_aton` only transform IPv4 without validation. The input may be an
   // invalid IP. So here we transform IPv4 via logic that implements by myself.
+  bool has_error = false;
   if (*(in + in_len - 1) == '.') {
     in_len--;
+    has_error = true;
   }
 
   if (!in_len || *in == '.' || *(in + in_len - 1) == '.') {
@@ -125,6 +130,11 @@ IPv4FormatResult FormatIPv4(const char* in, int in_len, uint32_t* out) {
         if (i == segs_count - 1 && maybe_result != kIPv4FormatOK) {
           return kIPv4FormatFail;
         }
+
+        // "0x..." and "0..." parts are hexadecimal and octal.
+        if ((p[0] == '0' && p[1] != 0) || ip_segments[i] > 255) {
+          has_error = true;
+        }
         break;
     }
   }
@@ -168,6 +178,7 @@ IPv4FormatResult FormatIPv4(const char* in, int in_len, uint32_t* out) {
   }
 
   *out = (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+  if (validation_error != nullptr) *validation_error = has_error;
   return kIPv4FormatOK;
 }
 
@@ -1,7 +1,214 @@
 #include "idna.h"
+#include <atomic>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <vector>
+#include "code_points.h"
 
 namespace whatwgurl {
 
-IDNAToASCIIFunction kIDNAToASCII;
+static const IDNAEnvironment kDefaultIDNAEnvironment = {PunycodeToASCII};
+static std::atomic<const IDNAEnvironment*> current_idna_environment(
+    &kDefaultIDNAEnvironment);
 
+const IDNAEnvironment* GetIDNAEnvironment() {
+  return current_idna_environment.load(std::memory_order_acquire);
 }
+
+void SetIDNAToASCIIFunction(IDNAToASCIIFunction function) {
+  const IDNAEnvironment* environment = &kDefaultIDNAEnvironment;
+
+  // A replaced environment is never freed before exit: other threads may
+  // still be parsing with it, and there is no way to know when they are
+  // done. There is one per provider, reused whenever it is installed again,
+  // so setting the same provider over and over does not grow memory.
+  if (function != nullptr && function != kDefaultIDNAEnvironment.to_ascii) {
+    static std::mutex mutex;
+    static std::vector<std::unique_ptr<IDNAEnvironment>> environments;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    environment = nullptr;
+    for (const auto& existing : environments) {
+      if (existing->to_ascii == function) environment = existing.get();
+    }
+
+    if (environment == nullptr) {
+      environments.emplace_back(new IDNAEnvironment{function});
+      environment = environments.back().get();
+    }
+  }
+
+  current_idna_environment.store(environment, std::memory_order_release);
+}
+
+// Bootstring parameters for Punycode.
+// Refs: https://datatracker.ietf.org/doc/html/rfc3492#section-5
+constexpr uint32_t kPunycodeBase = 36;
+constexpr uint32_t kPunycodeTMin = 1;
+constexpr uint32_t kPunycodeTMax = 26;
+constexpr uint32_t kPunycodeSkew = 38;
+constexpr uint32_t kPunycodeDamp = 700;
+constexpr uint32_t kPunycodeInitialBias = 72;
+constexpr uint32_t kPunycodeInitialN = 128;
+constexpr uint32_t kPunycodeMaxInt = 0x7fffffff;
+
+static inline char PunycodeDigit(uint32_t digit) {
+  // 0..25 map to ASCII a..z, 26..35 map to ASCII 0..9.
+  return static_cast<char>(digit < 26 ? digit + 'a' : digit - 26 + '0');
+}
+
+// Refs: https://datatracker.ietf.org/doc/html/rfc3492#section-6.1
+static uint32_t PunycodeAdapt(uint32_t delta,
+                              uint32_t num_points,
+                              bool first_time) {
+  delta = first_time ? delta / kPunycodeDamp : delta / 2;
+  delta += delta / num_points;
+
+  uint32_t k = 0;
+  while (delta > ((kPunycodeBase - kPunycodeTMin) * kPunycodeTMax) / 2) {
+    delta /= kPunycodeBase - kPunycodeTMin;
+    k += kPunycodeBase;
+  }
+
+  return k + (((kPunycodeBase - kPunycodeTMin + 1) * delta) /
+              (delta + kPunycodeSkew));
+}
+
+// Appends the Punycode encoding of `label` to `output`.
+//
+// Refs: https://datatracker.ietf.org/doc/html/rfc3492#section-6.3
+static bool PunycodeEncode(const std::u32string& label, std::string* output) {
+  uint32_t n = kPunycodeInitialN;
+  uint32_t delta = 0;
+  uint32_t bias = kPunycodeInitialBias;
+
+  // Handle the basic code points.
+  uint32_t basic_length = 0;
+  for (char32_t c : label) {
+    if (c >= 0x80) continue;
+    output->push_back(static_cast<char>(c));
+    ++basic_length;
+  }
+
+  uint32_t handled = basic_length;
+  if (basic_length > 0) output->push_back('-');
+
+  // Main encoding loop.
+  while (handled < label.length()) {
+    // All non-basic code points < n have been handled already. Find the next
+    // larger one.
+    uint32_t m = kPunycodeMaxInt;
+    for (char32_t c : label) {
+      if (c >= n && c < m) m = c;
+    }
+
+    // Increase delta enough to advance the decoder's <n,i> state to <m,0>,
+    // but guard against overflow.
+    if (m - n > (kPunycodeMaxInt - delta) / (handled + 1)) return false;
+    delta += (m - n) * (handled + 1);
+    n = m;
+
+    for (char32_t c : label) {
+      if (c < n && ++delta > kPunycodeMaxInt) return false;
+      if (c != n) continue;
+
+      // Represent delta as a generalized variable-length integer.
+      uint32_t q = delta;
+      for (uint32_t k = kPunycodeBase;; k += kPunycodeBase) {
+        uint32_t t = k <= bias ? kPunycodeTMin
+                               : (k >= bias + kPunycodeTMax ? kPunycodeTMax
+                                                            : k - bias);
+        if (q < t) break;
+        output->push_back(PunycodeDigit(t + (q - t) % (kPunycodeBase - t)));
+        q = (q - t) / (kPunycodeBase - t);
+      }
+
+      output->push_back(PunycodeDigit(q));
+      bias = PunycodeAdapt(delta, handled + 1, handled == basic_length);
+      delta = 0;
+      ++handled;
+    }
+
+    ++delta;
+    ++n;
+  }
+
+  return true;
+}
+
+static inline bool IsLabelSeparator(uint32_t c) {
+  return c == 0x2E || c == 0x3002 || c == 0xFF0E || c == 0xFF61;
+}
+
+// The checks `beStrict` adds to "domain to ASCII", on its ASCII result:
+// UseSTD3ASCIIRules, i.e. labels made of ASCII lower alphas, digits and
+// U+002D (-) only, and VerifyDnsLength, i.e. labels of 1 to 63 bytes and a
+// domain of at most 253, both not counting a trailing root label.
+//
+// Refs: https://www.unicode.org/reports/tr46/#ToASCII
+static bool VerifyStrictDomain(const std::string& domain) {
+  size_t length = domain.length();
+  if (length > 0 && domain[length - 1] == '.') length--;
+  if (length == 0 || length > 253) return false;
+
+  size_t label_length = 0;
+  for (size_t i = 0; i <= length; i++) {
+    if (i == length || domain[i] == '.') {
+      if (label_length == 0 || label_length > 63) return false;
+      label_length = 0;
+      continue;
+    }
+
+    char c = domain[i];
+    if (!IsASCIILowerAlpha(c) && !IsASCIIDigit(c) && c != '-') return false;
+    label_length++;
+  }
+
+  return true;
+}
+
+int32_t PunycodeToASCII(std::string* buf,
+                        const char* input,
+                        size_t length,
+                        IDNAMode mode) {
+  buf->clear();
+  buf->reserve(length);
+
+  std::u32string label;
+  bool is_ascii = true;
+  const char* it = input;
+  const char* end = input + length;
+  while (true) {
+    bool at_end = it == end;
+    uint32_t c = 0;
+    if (!at_end && !ReadCodePoint(it, end, c)) return -1;
+
+    if (!at_end && !IsLabelSeparator(c)) {
+      if (IsASCIIUpperAlpha(c)) c += 0x20;
+      if (c >= 0x80) is_ascii = false;
+      label.push_back(c);
+      continue;
+    }
+
+    if (is_ascii) {
+      // "xn--" alone is an ACE prefix without any encoded data, which can
+      // never decode to a valid label.
+      if (label == U"xn--") return -1;
+      for (char32_t ch : label) buf->push_back(static_cast<char>(ch));
+    } else {
+      buf->append("xn--");
+      if (!PunycodeEncode(label, buf)) return -1;
+    }
+
+    if (at_end) break;
+
+    buf->push_back('.');
+    label.clear();
+    is_ascii = true;
+  }
+
+  if (mode == kIDNAStrict && !VerifyStrictDomain(*buf)) return -1;
+  return static_cast<int32_t>(buf->length());
+}
+
+}  // namespace whatwgurl
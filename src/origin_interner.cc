@@ -0,0 +1,182 @@
+#include "origin_interner.h"
+#include "href_writer.h"
+#include "utils/assert.h"
+#include "xxhash64.h"
+
+namespace whatwgurl {
+
+using std::string;
+
+constexpr size_t OriginInterner::kFirstChunkBits;
+constexpr size_t OriginInterner::kMaxChunks;
+
+namespace {
+
+constexpr size_t kInitialCapacity = 64;
+
+// The origin of the URL being looked up and its serialization, kept per
+// thread so that their buffers are reused.
+struct Scratch {
+  TupleOrigin origin;
+  string serialization;
+};
+
+thread_local Scratch scratch;
+
+}  // namespace
+
+OriginInterner::Table::Table(size_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<OriginId>[capacity]) {
+  for (size_t i = 0; i < capacity; i++) {
+    slots[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+OriginInterner::OriginInterner() : _size(0) {
+  for (size_t i = 0; i < kMaxChunks; i++) {
+    _chunks[i].store(nullptr, std::memory_order_relaxed);
+  }
+
+  _tables.emplace_back(new Table(kInitialCapacity));
+  _table.store(_tables.back().get(), std::memory_order_release);
+}
+
+OriginInterner::~OriginInterner() {
+  for (size_t i = 0; i < kMaxChunks; i++) {
+    delete[] _chunks[i].load(std::memory_order_relaxed);
+  }
+}
+
+OriginId OriginInterner::Intern(const URLCore& url) {
+  CHECK(!url.failed());
+  url.GetOriginObject(&scratch.origin);
+  return Intern(scratch.origin);
+}
+
+OriginId OriginInterner::Intern(const TupleOrigin& origin) {
+  if (origin.is_null()) return kOpaqueOriginId;
+
+  string& serialization = scratch.serialization;
+  serialization.clear();
+  StringWriter writer(&serialization);
+  origin.Write(&writer);
+  uint64_t hash = XXH64::Hash(serialization);
+
+  OriginId id =
+      Lookup(_table.load(std::memory_order_acquire), hash, serialization);
+  if (id != kOpaqueOriginId) return id;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  return Insert(hash, serialization);
+}
+
+bool OriginInterner::Find(const URLCore& url, OriginId* id) const {
+  CHECK(!url.failed());
+  url.GetOriginObject(&scratch.origin);
+  return Find(scratch.origin, id);
+}
+
+// An origin interned before this is called is always in the table loaded
+// here: a table is only replaced by one holding everything it held.
+bool OriginInterner::Find(const TupleOrigin& origin, OriginId* id) const {
+  if (origin.is_null()) return false;
+
+  string& serialization = scratch.serialization;
+  serialization.clear();
+  StringWriter writer(&serialization);
+  origin.Write(&writer);
+
+  OriginId found = Lookup(_table.load(std::memory_order_acquire),
+                          XXH64::Hash(serialization),
+                          serialization);
+  if (found == kOpaqueOriginId) return false;
+
+  *id = found;
+  return true;
+}
+
+const string& OriginInterner::Serialize(OriginId id) const {
+  static const string opaque = "null";
+  if (id == kOpaqueOriginId) return opaque;
+
+  CHECK_LE(id, size());
+  return EntryAt(id).serialization;
+}
+
+const OriginInterner::Entry& OriginInterner::EntryAt(OriginId id) const {
+  size_t index = id - 1;
+  size_t chunk = ChunkOf(index);
+  const Entry* entries = _chunks[chunk].load(std::memory_order_acquire);
+  return entries[index - ChunkStart(chunk)];
+}
+
+OriginId OriginInterner::Lookup(const Table* table,
+                                uint64_t hash,
+                                const string& serialization) const {
+  for (size_t i = hash & table->mask;; i = (i + 1) & table->mask) {
+    OriginId id = table->slots[i].load(std::memory_order_acquire);
+    if (id == kOpaqueOriginId) return kOpaqueOriginId;
+
+    const Entry& entry = EntryAt(id);
+    if (entry.hash == hash && entry.serialization == serialization) {
+      return id;
+    }
+  }
+}
+
+// Runs under `_mutex`.
+OriginId OriginInterner::Insert(uint64_t hash, const string& serialization) {
+  Table* table = _table.load(std::memory_order_relaxed);
+  OriginId id = Lookup(table, hash, serialization);
+  if (id != kOpaqueOriginId) return id;
+
+  size_t index = _size.load(std::memory_order_relaxed);
+  size_t chunk = ChunkOf(index);
+  CHECK_LT(chunk, kMaxChunks);
+  Entry* entries = _chunks[chunk].load(std::memory_order_relaxed);
+  if (entries == nullptr) {
+    entries = new Entry[size_t{1} << (chunk + kFirstChunkBits)];
+    _chunks[chunk].store(entries, std::memory_order_release);
+  }
+
+  Entry& entry = entries[index - ChunkStart(chunk)];
+  entry.hash = hash;
+  entry.serialization = serialization;
+  id = static_cast<OriginId>(index + 1);
+  _size.store(index + 1, std::memory_order_release);
+
+  // Keep the table at most half full, so that probes stay short.
+  if ((index + 1) * 2 > table->mask + 1) {
+    Grow();
+    return id;
+  }
+
+  size_t i = hash & table->mask;
+  while (table->slots[i].load(std::memory_order_relaxed) != kOpaqueOriginId) {
+    i = (i + 1) & table->mask;
+  }
+  table->slots[i].store(id, std::memory_order_release);
+  return id;
+}
+
+// Runs under `_mutex`. Puts every interned origin into a table twice the size
+// and publishes it; the old one stays alive for the readers still in it.
+void OriginInterner::Grow() {
+  const Table* old_table = _table.load(std::memory_order_relaxed);
+  Table* table = new Table((old_table->mask + 1) * 2);
+  _tables.emplace_back(table);
+
+  size_t size = _size.load(std::memory_order_relaxed);
+  for (size_t index = 0; index < size; index++) {
+    OriginId id = static_cast<OriginId>(index + 1);
+    size_t i = EntryAt(id).hash & table->mask;
+    while (table->slots[i].load(std::memory_order_relaxed) != kOpaqueOriginId) {
+      i = (i + 1) & table->mask;
+    }
+    table->slots[i].store(id, std::memory_order_relaxed);
+  }
+
+  _table.store(table, std::memory_order_release);
+}
+
+}  // namespace whatwgurl
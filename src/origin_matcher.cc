@@ -0,0 +1,252 @@
+#include "origin_matcher.h"
+#include <string.h>
+#include <algorithm>
+#include "parse.h"
+
+namespace whatwgurl {
+
+using std::string;
+using std::vector;
+
+namespace {
+
+// No node has the root of the unused `kOtherSchemeId` as a child.
+constexpr uint32_t kNoNode = kOtherSchemeId;
+
+inline int CompareLabel(const string& a, const char* b, size_t length) {
+  int result = memcmp(a.data(), b, std::min(a.length(), length));
+  if (result != 0) return result;
+  return (a.length() > length) - (a.length() < length);
+}
+
+// Collects a serialized IP address, which is short, without allocating.
+class AddressWriter {
+ public:
+  inline void Append(const char* data, size_t length) {
+    CHECK_LE(_length + length, sizeof(_data));
+    memcpy(_data + _length, data, length);
+    _length += length;
+  }
+  inline void Append(char c) { Append(&c, 1); }
+  inline size_t length() const { return _length; }
+  inline const char* data() const { return _data; }
+
+ private:
+  char _data[kMaxFormattedHostIPv6Len + 2];
+  size_t _length = 0;
+};
+
+// The URL a blob URL wraps, kept per thread to reuse its buffers.
+thread_local ParsedURL blob_scratch;
+
+}  // namespace
+
+void OriginMatcher::PortSet::Add(const Port& port, bool any_port) {
+  if (any_port) {
+    any = true;
+  } else if (port.is_null()) {
+    null = true;
+  } else {
+    auto it = std::lower_bound(ports.begin(), ports.end(), port.value());
+    if (it == ports.end() || *it != port.value()) {
+      ports.insert(it, port.value());
+    }
+  }
+}
+
+bool OriginMatcher::PortSet::Contains(const Port& port) const {
+  if (any) return true;
+  if (port.is_null()) return null;
+  return std::binary_search(ports.begin(), ports.end(), port.value());
+}
+
+OriginMatcher::OriginMatcher() : _nodes(kWssSchemeId + 1) {}
+
+bool OriginMatcher::Add(const string& pattern) {
+  // scheme "://" ["*."] host [":" (port | "*")]
+  size_t separator = pattern.find("://");
+  if (separator == string::npos) return false;
+  size_t host_start = separator + 3;
+  bool below = pattern.compare(host_start, 2, "*.") == 0;
+  if (below) host_start += 2;
+
+  size_t host_end = pattern.length();
+  bool any_port = pattern.length() - host_start >= 2 &&
+                  pattern.compare(pattern.length() - 2, 2, ":*") == 0;
+  if (any_port) host_end -= 2;
+
+  // Nothing but the scheme, host and port, which the parser puts in shape.
+  if (pattern.find_first_of("/?#@\\", host_start) < host_end) return false;
+  string origin = pattern.substr(0, separator + 3);
+  origin.append(pattern, host_start, host_end - host_start);
+
+  ParsedURL url;
+  bool validation_error;
+  if (!ParseInto(origin, nullptr, &url, &validation_error)) return false;
+  BatchSchemeId scheme =
+      GetBatchSchemeId(url.scheme.data(), url.scheme.length());
+  if (scheme == kOtherSchemeId || scheme == kFileSchemeId) return false;
+  if (any_port && !url.port.is_null()) return false;
+
+  const HostItem& host = url.host.value();
+  if (host.type == kIPv4Address || host.type == kIPv6Address) {
+    if (below) return false;
+
+    AddressWriter writer;
+    host.Write(&writer);
+    vector<Address>& addresses = _addresses[scheme];
+    auto it = std::lower_bound(
+        addresses.begin(),
+        addresses.end(),
+        writer,
+        [](const Address& address, const AddressWriter& value) {
+          return CompareLabel(address.host, value.data(), value.length()) < 0;
+        });
+    if (it == addresses.end() ||
+        CompareLabel(it->host, writer.data(), writer.length()) != 0) {
+      it = addresses.insert(it, Address());
+      it->host.assign(writer.data(), writer.length());
+    }
+    it->ports.Add(url.port, any_port);
+    _size++;
+    return true;
+  }
+
+  if (host.type != kDomain) return false;
+
+  // Down the trie, one label at a time from the right.
+  const string& domain = host.host.domain;
+  uint32_t node = scheme;
+  size_t label_end = domain.length();
+  while (true) {
+    size_t label_start = label_end;
+    while (label_start > 0 && domain[label_start - 1] != '.') label_start--;
+
+    node = AddChild(node, domain.data() + label_start, label_end - label_start);
+    if (label_start == 0) break;
+    label_end = label_start - 1;
+  }
+
+  Node& added = _nodes[node];
+  (below ? added.below : added.exact).Add(url.port, any_port);
+  _size++;
+  return true;
+}
+
+bool OriginMatcher::Matches(const URLCore& url) const {
+  CHECK(!url.failed());
+  return Matches(*url._parsed_url);
+}
+
+// The origin of a URL is that of the URL a "blob" one wraps, a tuple origin
+// (scheme, host, port) for the other special schemes but "file", and an
+// opaque one otherwise.
+bool OriginMatcher::Matches(const ParsedURL& url) const {
+  const ParsedURL* origin_url = &url;
+  if (url.scheme == "blob") {
+    if (!url.HasOpaquePath()) return false;
+    bool validation_error;
+    const string& path = url.path.ASCIIString();
+    if (!ParseInto(path, nullptr, &blob_scratch, &validation_error)) {
+      return false;
+    }
+
+    // A blob URL wrapping another one is left opaque.
+    if (blob_scratch.scheme == "blob") return false;
+    origin_url = &blob_scratch;
+  }
+
+  BatchSchemeId scheme =
+      GetBatchSchemeId(origin_url->scheme.data(), origin_url->scheme.length());
+  if (scheme == kOtherSchemeId || scheme == kFileSchemeId) return false;
+  if (origin_url->host.is_null()) return false;
+
+  const HostItem& host = origin_url->host.value();
+  switch (host.type) {
+    case kDomain:
+      return MatchesDomain(scheme, host.host.domain, origin_url->port);
+    case kIPv4Address:
+    case kIPv6Address:
+      return MatchesAddress(scheme, host, origin_url->port);
+    default:
+      return false;
+  }
+}
+
+bool OriginMatcher::MatchesDomain(BatchSchemeId scheme,
+                                  const string& domain,
+                                  const Port& port) const {
+  const char* begin = domain.data();
+  const char* label_end = begin + domain.length();
+  uint32_t node = scheme;
+  while (true) {
+    const char* label_start = label_end;
+    while (label_start > begin && label_start[-1] != '.') label_start--;
+
+    node = FindChild(node, label_start, label_end - label_start);
+    if (node == kNoNode) return false;
+
+    // Every label is consumed: the domain is the node's. Otherwise it is
+    // below the node's.
+    if (label_start == begin) return _nodes[node].exact.Contains(port);
+    if (_nodes[node].below.Contains(port)) return true;
+    label_end = label_start - 1;
+  }
+}
+
+bool OriginMatcher::MatchesAddress(BatchSchemeId scheme,
+                                   const HostItem& host,
+                                   const Port& port) const {
+  AddressWriter writer;
+  host.Write(&writer);
+  const vector<Address>& addresses = _addresses[scheme];
+  auto it = std::lower_bound(
+      addresses.begin(),
+      addresses.end(),
+      writer,
+      [](const Address& address, const AddressWriter& value) {
+        return CompareLabel(address.host, value.data(), value.length()) < 0;
+      });
+  return it != addresses.end() &&
+         CompareLabel(it->host, writer.data(), writer.length()) == 0 &&
+         it->ports.Contains(port);
+}
+
+uint32_t OriginMatcher::FindChild(uint32_t node,
+                                  const char* label,
+                                  size_t length) const {
+  const vector<Node::Child>& children = _nodes[node].children;
+  size_t low = 0;
+  size_t high = children.size();
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+    int result = CompareLabel(children[middle].label, label, length);
+    if (result == 0) return children[middle].node;
+    if (result < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return kNoNode;
+}
+
+uint32_t OriginMatcher::AddChild(uint32_t node,
+                                 const char* label,
+                                 size_t length) {
+  uint32_t child = FindChild(node, label, length);
+  if (child != kNoNode) return child;
+
+  child = static_cast<uint32_t>(_nodes.size());
+  _nodes.emplace_back();
+  vector<Node::Child>& children = _nodes[node].children;
+  auto it = std::lower_bound(
+      children.begin(),
+      children.end(),
+      string(label, length),
+      [](const Node::Child& a, const string& b) { return a.label < b; });
+  children.insert(it, Node::Child{string(label, length), child});
+  return child;
+}
+
+}  // namespace whatwgurl
@@ -1,11 +1,14 @@
 #include "parse.h"
+#include "allocation_stats.h"
 #include "code_points.h"
+#include "parser_profile.h"
 #include "percent_encode.h"
 #include "scheme.h"
 #include "string_utils.h"
 #include "temp_string_buffer.h"
 #include "utils/assert.h"
 #include "utils/resizable_buffer.h"
+#include "validation_error.h"
 
 namespace whatwgurl {
 
@@ -15,34 +18,110 @@ using std::string;
 
 constexpr char kEOF = -1;
 
-bool Parse(const string& input,
-           const ParsedURL* base,
-           shared_ptr<ParsedURL>* url,
-           bool* validation_error,
-           ParseState state_override) {
-  // If `url` is not given, set `url` to a new `ParsedURL`
-  shared_ptr<ParsedURL>& out = *url;
+// Counts `str` as an allocation of `site` if it does not fit in the small
+// string buffer.
+static inline void RecordStringAllocation(AllocationSite site,
+                                          const string& str) {
+#ifdef WHATWGURL_ALLOCATION_STATS
+  static const size_t small_string_capacity = string().capacity();
+  if (str.capacity() > small_string_capacity) {
+    RecordAllocation(site, str.capacity() + 1);
+  }
+#endif
+}
+
+// Counts the strings owned by a freshly parsed `url`.
+static void RecordParsedURLAllocations(const ParsedURL& url) {
+#ifdef WHATWGURL_ALLOCATION_STATS
+  RecordStringAllocation(kSchemeAllocation, url.scheme);
+  RecordStringAllocation(kUsernameAllocation, url.username);
+  RecordStringAllocation(kPasswordAllocation, url.password);
+
+  if (!url.host.is_null()) {
+    switch (url.host->type) {
+      case kDomain:
+        RecordStringAllocation(kHostAllocation, url.host->host.domain);
+        break;
+      case kOpaqueHost:
+        RecordStringAllocation(kHostAllocation, url.host->host.opaque_host);
+        break;
+      default:
+        break;
+    }
+  }
 
+  if (url.path.IsOpaquePath()) {
+    RecordStringAllocation(kPathAllocation, url.path.ASCIIString());
+  } else {
+    if (url.path.capacity()) {
+      RecordAllocation(kPathAllocation, url.path.capacity() * sizeof(string));
+    }
+    for (size_t i = 0; i < url.path.size(); i++) {
+      RecordStringAllocation(kPathAllocation, url.path[i]);
+    }
+  }
+
+  if (!url.query.is_null()) {
+    RecordStringAllocation(kQueryAllocation, *url.query);
+  }
+  if (!url.fragment.is_null()) {
+    RecordStringAllocation(kFragmentAllocation, *url.fragment);
+  }
+#endif
+}
+
+// Lengths of what a validate-only run of the parser appends to the username,
+// password, query and fragment instead of building them. Those components are
+// only ever appended to, so their final length is the length of what the URL
+// was given up front (e.g. copied from the base) plus these.
+struct SkippedLengths {
+  size_t username = 0;
+  size_t password = 0;
+  size_t query = 0;
+  size_t fragment = 0;
+};
+
+// `url_is_given` is false when `out` is a fresh URL rather than one given to
+// the parser, i.e. when `Parse()` was called with an empty `url`. With
+// `skipped`, the appends described by `SkippedLengths` are only counted.
+static bool BasicURLParse(const string& input,
+                          const ParsedURL* base,
+                          ParsedURL* out,
+                          bool url_is_given,
+                          bool* validation_error,
+                          ParseState state_override,
+                          ParserContext* context,
+                          SkippedLengths* skipped) {
   *validation_error = false;
+  ValidationErrorReporter errors(validation_error, context);
   string trimed_url = input;
+  RecordStringAllocation(kInputAllocation, trimed_url);
+  size_t leading = 0;
 
-  if (!out.get()) {
-    out = make_shared<ParsedURL>();
-
+  if (!url_is_given) {
     // If `input` contains any leading or trailing C0 control or space,
-    // validation error.
+    // invalid-URL-unit validation error.
     //
     // And then Remove any leading and trailing C0 control or space from input.
-    if (string_utils::Trim(&trimed_url, IsC0ControlOrSpaceFunction)) {
-      *validation_error = true;
+    if (string_utils::TrimLeft(&trimed_url, IsC0ControlOrSpaceFunction)) {
+      leading = input.length() - trimed_url.length();
+      errors.ReportAtInputOffset(kInvalidURLUnitError, 0);
+    }
+    if (string_utils::TrimRight(&trimed_url, IsC0ControlOrSpaceFunction)) {
+      errors.ReportAtInputOffset(kInvalidURLUnitError,
+                                 leading + trimed_url.length());
     }
   }
 
-  // If input contains any ASCII tab or newline, validation error. Then remove
-  // all ASCII tab or newline from input.
-  if (string_utils::Remove(&trimed_url, IsASCIITabOrNewlineFunction)) {
-    *validation_error = true;
+  // If input contains any ASCII tab or newline, invalid-URL-unit validation
+  // error. Then remove all ASCII tab or newline from input.
+  bool removed_tab_or_newline =
+      string_utils::Remove(&trimed_url, IsASCIITabOrNewlineFunction);
+  if (removed_tab_or_newline) {
+    errors.ReportAtInputOffset(kInvalidURLUnitError,
+                               input.find_first_of("\t\n\r", leading));
   }
+  errors.SetInput(&input, leading, removed_tab_or_newline);
 
   // Let state be state override if given, or scheme start state otherwise.
   bool state_override_is_given = state_override != kNotGiven;
@@ -61,15 +140,19 @@ bool Parse(const string& input,
   TempStringBuffer buffer(trimed_url.length());
 
   // Let pointer be a pointer for input.
-  const unsigned char* ptr =
+  const unsigned char* begin =
       reinterpret_cast<const unsigned char*>(trimed_url.c_str());
+  const unsigned char* ptr = begin;
   const unsigned char* end = ptr + trimed_url.length();
 
+  ParseStateProfiler profiler(state);
+
   // Keep running the following state machine by switching on state. If after a
   // run pointer points to the EOF code point, go to the next step. Otherwise,
   // increase pointer by 1 and continue with the state machine.
   while (ptr <= end) {
     unsigned char c = (ptr == end ? kEOF : *ptr);
+    profiler.Step(state, ptr == end);
 
     // printf("pos: %zu, %c, state: %d\n",
     //        reinterpret_cast<const char*>(ptr) - trimed_url.c_str(),
@@ -93,9 +176,8 @@ bool Parse(const string& input,
           --ptr;
           break;
 
-          // Otherwise, validation error, return failure.
+          // Otherwise, return failure.
         } else {
-          *validation_error = true;
           return false;
         }
 
@@ -168,9 +250,11 @@ bool Parse(const string& input,
 
           // If url’s scheme is "file", then:
           if (out->scheme == "file") {
-            // If remaining does not start with "//", validation error.
+            // If remaining does not start with "//",
+            // special-scheme-missing-following-solidus validation error.
             if (ptr + 2 >= end || ptr[1] != '/' || ptr[2] != '/') {
-              *validation_error = true;
+              errors.Report(kSpecialSchemeMissingFollowingSolidusError,
+                            ptr - begin + 1);
             }
 
             // Set state to file state.
@@ -222,9 +306,8 @@ bool Parse(const string& input,
 
           break;
 
-          // Otherwise, validation error, return failure.
+          // Otherwise, return failure.
         } else {
-          *validation_error = true;
           return false;
         }
 
@@ -234,9 +317,9 @@ bool Parse(const string& input,
       // https://url.spec.whatwg.org/#no-scheme-state
       case kNoSchemeState: {
         // If base is null, or base has an opaque path and c is not U+0023 (#),
-        // validation error, return failure.
+        // missing-scheme-non-relative-URL validation error, return failure.
         if (base == nullptr || (base->path.IsOpaquePath() && c != '#')) {
-          *validation_error = true;
+          errors.Report(kMissingSchemeNonRelativeURLError, ptr - begin);
           return false;
         }
 
@@ -278,11 +361,11 @@ bool Parse(const string& input,
           break;
         }
 
-        // Otherwise, validation error, set state to relative state and
-        // decrease pointer by 1.
+        // Otherwise, special-scheme-missing-following-solidus validation error,
+        // set state to relative state and decrease pointer by 1.
+        errors.Report(kSpecialSchemeMissingFollowingSolidusError, ptr - begin);
         state = kRelativeState;
         --ptr;
-        *validation_error = true;
 
         break;
       }
@@ -315,11 +398,12 @@ bool Parse(const string& input,
           state = kRelativeSlashState;
           break;
 
-          // Otherwise, if url is special and c is U+005C (\), validation error,
-          // set state to relative slash state.
+          // Otherwise, if url is special and c is U+005C (\),
+          // invalid-reverse-solidus validation error, set state to relative
+          // slash state.
         } else if (out->IsSpecial() && c == '\\') {
           state = kRelativeSlashState;
-          *validation_error = true;
+          errors.Report(kInvalidReverseSolidusError, ptr - begin);
           break;
         }
 
@@ -375,9 +459,9 @@ bool Parse(const string& input,
       case kRelativeSlashState: {
         // If url is special and c is U+002F (/) or U+005C (\), then:
         if (out->IsSpecial() && (c == '/' || c == '\\')) {
-          // If c is U+005C (\), validation error.
+          // If c is U+005C (\), invalid-reverse-solidus validation error.
           if (c == '\\') {
-            *validation_error = true;
+            errors.Report(kInvalidReverseSolidusError, ptr - begin);
           }
 
           // Set state to special authority ignore slashes state.
@@ -412,11 +496,13 @@ bool Parse(const string& input,
         if (c == '/' && ptr + 1 < end && ptr[1] == '/') {
           ++ptr;
 
-          // Otherwise, validation error, set state to special authority ignore
-          // slashes state and decrease pointer by 1.
+          // Otherwise, special-scheme-missing-following-solidus validation
+          // error, set state to special authority ignore slashes state and
+          // decrease pointer by 1.
         } else {
+          errors.Report(kSpecialSchemeMissingFollowingSolidusError,
+                        ptr - begin);
           --ptr;
-          *validation_error = true;
         }
 
         break;
@@ -432,8 +518,9 @@ bool Parse(const string& input,
           break;
         }
 
-        // Otherwise, validation error.
-        *validation_error = true;
+        // Otherwise, special-scheme-missing-following-solidus validation
+        // error.
+        errors.Report(kSpecialSchemeMissingFollowingSolidusError, ptr - begin);
 
         break;
       }
@@ -443,8 +530,8 @@ bool Parse(const string& input,
         switch (static_cast<char>(c)) {
           // If c is U+0040 (@), then:
           case '@': {
-            // Validation error.
-            *validation_error = true;
+            // Invalid-credentials validation error.
+            errors.Report(kInvalidCredentialsError, ptr - begin);
 
             // If atSignSeen is true, then prepend "%40" to buffer.
             if (at_sign_seen) {
@@ -479,9 +566,15 @@ bool Parse(const string& input,
               // If passwordTokenSeen is true, then append encodedCodePoints to
               // url’s password.
               if (password_token_seen) {
-                out->password += code_point_buffer.string();
+                if (skipped != nullptr) {
+                  skipped->password += code_point_buffer.length();
+                } else {
+                  out->password += code_point_buffer.string();
+                }
 
                 // Otherwise, append encodedCodePoints to url’s username.
+              } else if (skipped != nullptr) {
+                skipped->username += code_point_buffer.length();
               } else {
                 out->username += code_point_buffer.string();
               }
@@ -507,9 +600,9 @@ bool Parse(const string& input,
               // then:
 
               // If atSignSeen is true and buffer is the empty string,
-              // validation error, return failure.
+              // host-missing validation error, return failure.
               if (at_sign_seen && !buffer.length()) {
-                *validation_error = true;
+                errors.Report(kHostMissingError, ptr - begin);
                 return false;
               }
 
@@ -541,12 +634,16 @@ bool Parse(const string& input,
       case kHostNameState: {
         bool is_special = out->IsSpecial();
 
-#define HANDLE_HOST_STATE_HOST_NAME_STATE_3_4_5(next_state)                    \
+#define HANDLE_HOST_STATE_HOST_NAME_STATE_3_4_5(next_state, host_end)          \
   /* 3. Let host be the result of host parsing buffer with url is not */       \
   /* special. */                                                               \
   Host host;                                                                   \
-  bool parsed =                                                                \
-      Host::Parse(buffer, &host, validation_error, !out->IsSpecial());         \
+  bool parsed = Host::Parse(buffer,                                            \
+                            &host,                                             \
+                            &errors,                                           \
+                            (host_end) - begin - buffer.length(),              \
+                            !is_special,                                       \
+                            context);                                          \
                                                                                \
   /* 4. If host is failure, then return failure. */                            \
   if (!parsed) {                                                               \
@@ -568,9 +665,10 @@ bool Parse(const string& input,
 
           // Otherwise, if c is U+003A (:) and insideBrackets is false, then:
         } else if (c == ':' && !inside_brackets) {
-          // If buffer is the empty string, validation error, return failure.
+          // If buffer is the empty string, host-missing validation error,
+          // return failure.
           if (!buffer.length()) {
-            *validation_error = true;
+            errors.Report(kHostMissingError, ptr - begin);
             return false;
           }
 
@@ -580,7 +678,7 @@ bool Parse(const string& input,
             return true;
           }
 
-          HANDLE_HOST_STATE_HOST_NAME_STATE_3_4_5(kPortState);
+          HANDLE_HOST_STATE_HOST_NAME_STATE_3_4_5(kPortState, ptr);
 
           break;
 
@@ -593,10 +691,10 @@ bool Parse(const string& input,
           // then decrease pointer by 1, and then:
           --ptr;
 
-          // If url is special and buffer is the empty string, validation error,
-          // return failure.
+          // If url is special and buffer is the empty string, host-missing
+          // validation error, return failure.
           if (is_special && !buffer.length()) {
-            *validation_error = true;
+            errors.Report(kHostMissingError, ptr - begin + 1);
             return false;
 
             // Otherwise, if state override is given, buffer is the empty
@@ -607,7 +705,7 @@ bool Parse(const string& input,
             return true;
           }
 
-          HANDLE_HOST_STATE_HOST_NAME_STATE_3_4_5(kPathStartState);
+          HANDLE_HOST_STATE_HOST_NAME_STATE_3_4_5(kPathStartState, ptr + 1);
 
           // If state override is given, then return.
           if (state_override_is_given) {
@@ -670,9 +768,9 @@ bool Parse(const string& input,
             break;
         }
 
-        // Otherwise, validation error, return failure.
+        // Otherwise, port-invalid validation error, return failure.
         if (!hit) {
-          *validation_error = true;
+          errors.Report(kPortInvalidError, ptr - begin);
           return false;
         }
 
@@ -683,9 +781,11 @@ bool Parse(const string& input,
           // through 9.
           uint32_t port = buffer.ToInteger();
 
-          // If port is greater than 2^16 − 1, validation error, return failure.
+          // If port is greater than 2^16 − 1, port-out-of-range validation
+          // error, return failure.
           if (port > 0xffff) {
-            *validation_error = true;
+            errors.Report(kPortOutOfRangeError,
+                          ptr - begin - buffer.length());
             return false;
           }
 
@@ -724,9 +824,9 @@ bool Parse(const string& input,
 
         // If c is U+002F (/) or U+005C (\), then:
         if (c == '/' || c == '\\') {
-          // If c is U+005C (\), validation error.
+          // If c is U+005C (\), invalid-reverse-solidus validation error.
           if (c == '\\') {
-            *validation_error = true;
+            errors.Report(kInvalidReverseSolidusError, ptr - begin);
           }
 
           // Set state to file slash state.
@@ -774,8 +874,8 @@ bool Parse(const string& input,
                 // Otherwise:
                 // This is a (platform-independent) Windows drive letter quirk.
               } else {
-                // Validation error.
-                *validation_error = true;
+                // File-invalid-Windows-drive-letter validation error.
+                errors.Report(kFileInvalidWindowsDriveLetterError, ptr - begin);
 
                 // Set url’s path to an empty list.
                 out->path.Reset(false);
@@ -804,9 +904,9 @@ bool Parse(const string& input,
           // If c is U+002F (/) or U+005C (\), then:
           case '/':
           case '\\':
-            // If c is U+005C (\), validation error.
+            // If c is U+005C (\), invalid-reverse-solidus validation error.
             if (c == '\\') {
-              *validation_error = true;
+              errors.Report(kInvalidReverseSolidusError, ptr - begin);
             }
 
             // Set state to file host state.
@@ -859,12 +959,14 @@ bool Parse(const string& input,
             --ptr;
 
             // If state override is not given and buffer is a Windows drive
-            // letter, validation error, set state to path state.
+            // letter, file-invalid-Windows-drive-letter-host validation error,
+            // set state to path state.
             if (!state_override_is_given &&
                 Path::IsWindowsDriveLetter(buffer.string())) {
               // This is a (platform-independent) Windows drive letter quirk.
               // buffer is not reset here and instead used in the path state.
-              *validation_error = true;
+              errors.Report(kFileInvalidWindowsDriveLetterHostError,
+                            ptr + 1 - begin - buffer.length());
               state = kPathState;
               break;
 
@@ -887,8 +989,12 @@ bool Parse(const string& input,
               // Let host be the result of host parsing buffer with url is not
               // special.
               Host host;
-              bool parsed = Host::Parse(
-                  buffer, &host, validation_error, !out->IsSpecial());
+              bool parsed = Host::Parse(buffer,
+                                        &host,
+                                        &errors,
+                                        ptr + 1 - begin - buffer.length(),
+                                        !out->IsSpecial(),
+                                        context);
 
               // If host is failure, then return failure.
               if (!parsed) {
@@ -946,9 +1052,9 @@ bool Parse(const string& input,
 
         // If url is special, then:
         if (is_special) {
-          // If c is U+005C (\), validation error.
+          // If c is U+005C (\), invalid-reverse-solidus validation error.
           if (c == '\\') {
-            *validation_error = true;
+            errors.Report(kInvalidReverseSolidusError, ptr - begin);
           }
 
           // Set state to path state.
@@ -1027,9 +1133,10 @@ bool Parse(const string& input,
         if (static_cast<char>(c) == kEOF || c == '/' ||
             (is_special && c == '\\') ||
             (!state_override_is_given && (c == '?' || c == '#'))) {
-          // If url is special and c is U+005C (\), validation error.
+          // If url is special and c is U+005C (\), invalid-reverse-solidus
+          // validation error.
           if (is_special && c == '\\') {
-            *validation_error = true;
+            errors.Report(kInvalidReverseSolidusError, ptr - begin);
           }
 
           // If buffer is a double-dot path segment, then:
@@ -1102,10 +1209,10 @@ bool Parse(const string& input,
           // validation error.
 
           // If c is U+0025 (%) and remaining does not start with two ASCII
-          // hex digits, validation error.
+          // hex digits, invalid-URL-unit validation error.
           if (c == '%' && (ptr + 2 >= end || !(IsASCIIHexDigit(ptr[1]) &&
                                                IsASCIIHexDigit(ptr[2])))) {
-            *validation_error = true;
+            errors.Report(kInvalidURLUnitError, ptr - begin);
           }
 
           // UTF-8 percent-encode c using the path percent-encode set and
@@ -1143,10 +1250,10 @@ bool Parse(const string& input,
             // point, and not U+0025 (%), validation error.
 
             // If c is U+0025 (%) and remaining does not start with two ASCII
-            // hex digits, validation error.
+            // hex digits, invalid-URL-unit validation error.
             if (c == '%' && (ptr + 2 >= end || !(IsASCIIHexDigit(ptr[1]) &&
                                                  IsASCIIHexDigit(ptr[2])))) {
-              *validation_error = true;
+              errors.Report(kInvalidURLUnitError, ptr - begin);
             }
 
             // If c is not the EOF code point, UTF-8 percent-encode c using
@@ -1200,7 +1307,10 @@ bool Parse(const string& input,
                                  buffer.length(),
                                  query_percent_encode_set,
                                  &temp);
-          if (out->query.is_null()) {
+          if (skipped != nullptr) {
+            if (out->query.is_null()) out->query = "";
+            skipped->query += temp.length();
+          } else if (out->query.is_null()) {
             out->query = string(temp.string(), temp.length());
           } else {
             out->query->append(string(temp.string(), temp.length()));
@@ -1224,10 +1334,10 @@ bool Parse(const string& input,
           // validation error.
 
           // If c is U+0025 (%) and remaining does not start with two ASCII
-          // hex digits, validation error.
+          // hex digits, invalid-URL-unit validation error.
           if (c == '%' && (ptr + 2 >= end || !(IsASCIIHexDigit(ptr[1]) &&
                                                IsASCIIHexDigit(ptr[2])))) {
-            *validation_error = true;
+            errors.Report(kInvalidURLUnitError, ptr - begin);
           }
 
           // Append c to buffer.
@@ -1246,17 +1356,20 @@ bool Parse(const string& input,
           // validation error.
 
           // If c is U+0025 (%) and remaining does not start with two ASCII
-          // hex digits, validation error.
+          // hex digits, invalid-URL-unit validation error.
           if (c == '%' && (ptr + 2 >= end || !(IsASCIIHexDigit(ptr[1]) &&
                                                IsASCIIHexDigit(ptr[2])))) {
-            *validation_error = true;
+            errors.Report(kInvalidURLUnitError, ptr - begin);
           }
 
           // UTF-8 percent-encode c using the fragment percent-encode set and
           // append the result to url’s fragment.
           TempStringBuffer temp(3);
           percent_encode::EncodeByFragmentPercentEncodeSet(ptr, 1, &temp);
-          if (out->fragment.is_null()) {
+          if (skipped != nullptr) {
+            if (out->fragment.is_null()) out->fragment = "";
+            skipped->fragment += temp.length();
+          } else if (out->fragment.is_null()) {
             out->fragment = string(temp.string(), temp.length());
           } else {
             out->fragment->append(string(temp.string(), temp.length()));
@@ -1279,4 +1392,129 @@ bool Parse(const string& input,
   return true;
 }  // NOLINT(readability/fn_size)
 
+bool Parse(const string& input,
+           const ParsedURL* base,
+           shared_ptr<ParsedURL>* url,
+           bool* validation_error,
+           ParseState state_override,
+           ParserContext* context) {
+  if (context == nullptr) context = ParserContext::Default();
+
+  // If `url` is not given, set `url` to a new `ParsedURL`
+  bool url_is_given = url->get() != nullptr;
+  if (!url_is_given) {
+    *url = make_shared<ParsedURL>();
+    RecordAllocation(kParsedURLAllocation, sizeof(ParsedURL));
+  }
+
+  bool succeeded = BasicURLParse(input,
+                                 base,
+                                 url->get(),
+                                 url_is_given,
+                                 validation_error,
+                                 state_override,
+                                 context,
+                                 nullptr);
+  if (state_override != kNotGiven) return succeeded;
+
+  if (*validation_error && context->fail_on_validation_error()) {
+    succeeded = false;
+  }
+
+  context->CountParse(succeeded, *validation_error);
+  RecordParse();
+  if (succeeded) RecordParsedURLAllocations(**url);
+  return succeeded;
+}
+
+// The length of `URLCore::Serialize()` of `url`, whose skipped components are
+// `skipped` long.
+static size_t HrefLength(const ParsedURL& url, const SkippedLengths& skipped) {
+  size_t length = url.scheme.length() + 1;
+
+  size_t username_length = url.username.length() + skipped.username;
+  size_t password_length = url.password.length() + skipped.password;
+  if (!url.host.is_null()) {
+    length += 2;
+    if (username_length || password_length) {
+      length += username_length + 1;
+      if (password_length) length += 1 + password_length;
+    }
+
+    length += url.host->SerializedLength();
+    if (!url.port.is_null()) length += 1 + url.port.Serialize().length();
+  }
+
+  if (url.HasOpaquePath()) {
+    length += url.path.ASCIIString().length();
+  } else {
+    size_t size = url.path.size();
+    if (url.host.is_null() && size > 1 && url.path[0].empty()) length += 2;
+    for (size_t i = 0; i < size; i++) length += 1 + url.path[i].length();
+  }
+
+  if (!url.query.is_null()) length += 1 + url.query->length() + skipped.query;
+  if (!url.fragment.is_null()) {
+    length += 1 + url.fragment->length() + skipped.fragment;
+  }
+
+  return length;
+}
+
+bool ParseInto(const string& input,
+               const ParsedURL* base,
+               ParsedURL* url,
+               bool* validation_error,
+               ParserContext* context) {
+  if (context == nullptr) context = ParserContext::Default();
+
+  url->Clear();
+  bool succeeded = BasicURLParse(input,
+                                 base,
+                                 url,
+                                 false,
+                                 validation_error,
+                                 kNotGiven,
+                                 context,
+                                 nullptr);
+
+  if (*validation_error && context->fail_on_validation_error()) {
+    succeeded = false;
+  }
+
+  context->CountParse(succeeded, *validation_error);
+  RecordParse();
+  return succeeded;
+}
+
+bool Validate(const string& input,
+              const ParsedURL* base,
+              size_t* href_length,
+              bool* validation_error,
+              ParserContext* context) {
+  if (context == nullptr) context = ParserContext::Default();
+
+  ParsedURL url;
+  SkippedLengths skipped;
+  bool succeeded = BasicURLParse(input,
+                                 base,
+                                 &url,
+                                 false,
+                                 validation_error,
+                                 kNotGiven,
+                                 context,
+                                 &skipped);
+
+  if (*validation_error && context->fail_on_validation_error()) {
+    succeeded = false;
+  }
+
+  context->CountParse(succeeded, *validation_error);
+  RecordParse();
+  if (succeeded && href_length != nullptr) {
+    *href_length = HrefLength(url, skipped);
+  }
+  return succeeded;
+}
+
 }  // namespace whatwgurl
@@ -0,0 +1,421 @@
+#include "parse_batch.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <thread>  // NOLINT(build/c++11)
+#include "base_resolver.h"
+#include "host/host_item.h"
+#include "parse.h"
+#include "utils/assert.h"
+
+namespace whatwgurl {
+
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+constexpr uint8_t BatchColumns::kNullHostType;
+
+namespace {
+
+// The inputs a thread still has to parse, `[begin, end)`. The owner takes
+// chunks from the front; thieves take the back half. A thread only steals
+// once its own share is empty, and never holds two shares' locks.
+struct BatchShare {
+  std::mutex mutex;
+  size_t begin = 0;
+  size_t end = 0;
+
+  // Keeps two threads' shares off one cache line. (`alignas` would need
+  // C++17's aligned `new[]`.)
+  char padding[64];
+
+  // Claims the next `chunk_size` inputs of the share into `[*from, *to)`.
+  bool Take(size_t chunk_size, size_t* from, size_t* to) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (begin == end) return false;
+    *from = begin;
+    *to = begin = std::min(end, begin + chunk_size);
+    return true;
+  }
+
+  // Removes the back half of the share, at least one input, into
+  // `[*from, *to)`.
+  bool Steal(size_t* from, size_t* to) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (begin == end) return false;
+    *to = end;
+    *from = end = end - std::max<size_t>((end - begin) / 2, 1);
+    return true;
+  }
+
+  void Reset(size_t from, size_t to) {
+    std::lock_guard<std::mutex> lock(mutex);
+    begin = from;
+    end = to;
+  }
+
+  size_t Left() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return end - begin;
+  }
+};
+
+// The URL every thread parses its inputs into, so that its buffers are
+// reused from one input to the next.
+thread_local ParsedURL batch_scratch;
+
+// Parses the inputs of a batch on `threads` threads. Where the results go is
+// up to `Writer`, which hands out the href and components to parse an input
+// into and is told once it is done:
+//
+//   void Begin(unsigned thread, size_t i, string** href,
+//              URLComponents** components);
+//   void End(unsigned thread, size_t i, bool succeeded, HostType host_type);
+//
+// `host_type` is that of the URL's host, `kNotInitialized` if it is null.
+//
+// A writer is called from every thread, but never twice for one input.
+template <typename Writer>
+class Batch {
+ public:
+  Batch(const string* inputs,
+        size_t count,
+        const BaseResolver* base,
+        Writer* writer,
+        const ParseBatchOptions& options,
+        unsigned threads)
+      : _inputs(inputs),
+        _base(base),
+        _writer(writer),
+        _context(options.context),
+        _chunk_size(std::max<size_t>(options.chunk_size, 1)),
+        _shares(new BatchShare[threads]),
+        _failures(threads),
+        _threads(threads) {
+    size_t share = count / threads;
+    for (unsigned i = 0; i < threads; i++) {
+      _shares[i].begin = i * share;
+      _shares[i].end = i == threads - 1 ? count : (i + 1) * share;
+    }
+  }
+
+  // Returns the number of inputs that failed.
+  size_t Run() {
+    vector<std::thread> workers;
+    workers.reserve(_threads - 1);
+    for (unsigned i = 1; i < _threads; i++) {
+      workers.emplace_back(&Batch::Work, this, i);
+    }
+
+    Work(0);
+    for (std::thread& worker : workers) worker.join();
+
+    size_t total = 0;
+    for (size_t failures : _failures) total += failures;
+    return total;
+  }
+
+ private:
+  void Work(unsigned index) {
+    BatchShare* share = &_shares[index];
+    size_t failures = 0;
+    size_t from;
+    size_t to;
+
+    while (true) {
+      while (share->Take(_chunk_size, &from, &to)) {
+        for (size_t i = from; i < to; i++) {
+          if (!ParseOne(index, i)) failures++;
+        }
+      }
+
+      if (!StealInto(share)) break;
+    }
+
+    _failures[index] = failures;
+  }
+
+  // Refills the (empty) `share` from the share with the most inputs left.
+  // Returns false once every share is empty.
+  bool StealInto(BatchShare* share) {
+    while (true) {
+      BatchShare* victim = nullptr;
+      size_t most = 0;
+      for (unsigned i = 0; i < _threads; i++) {
+        size_t left = _shares[i].Left();
+        if (left > most) {
+          most = left;
+          victim = &_shares[i];
+        }
+      }
+
+      if (victim == nullptr) return false;
+
+      // The victim may have run out since; look again if so.
+      size_t from;
+      size_t to;
+      if (victim->Steal(&from, &to)) {
+        share->Reset(from, to);
+        return true;
+      }
+    }
+  }
+
+  bool ParseOne(unsigned index, size_t i) {
+    const string& input = _inputs[i];
+    string* href;
+    URLComponents* components;
+    _writer->Begin(index, i, &href, &components);
+
+    bool succeeded;
+    HostType host_type = kNotInitialized;
+    if (_base != nullptr) {
+      succeeded = _base->Resolve(input, href, components, &host_type);
+    } else {
+      bool validation_error;
+      succeeded = ParseInto(
+          input, nullptr, &batch_scratch, &validation_error, _context);
+      if (succeeded) {
+        URLCore::SerializeInto(batch_scratch, href, components);
+        if (!batch_scratch.host.is_null()) {
+          host_type = batch_scratch.host->type;
+        }
+      }
+    }
+
+    if (!succeeded) {
+      href->clear();
+#define V(name) components->name = URLComponents::kOmittedComponent;
+      URL_COMPONENTS_FIELDS(V)
+#undef V
+    }
+
+    _writer->End(index, i, succeeded, host_type);
+    return succeeded;
+  }
+
+  const string* _inputs;
+  const BaseResolver* _base;
+  Writer* _writer;
+  ParserContext* _context;
+  size_t _chunk_size;
+
+  unique_ptr<BatchShare[]> _shares;
+  vector<size_t> _failures;
+  unsigned _threads;
+};
+
+// Parses straight into the rows of a `ParseBatchOutput`.
+class RowWriter {
+ public:
+  explicit RowWriter(ParseBatchOutput* output) : _output(output) {}
+
+  void Begin(unsigned thread,
+             size_t i,
+             string** href,
+             URLComponents** components) {
+    *href = &_output->hrefs[i];
+    *components = &_output->components[i];
+  }
+
+  void End(unsigned thread, size_t i, bool succeeded, HostType host_type) {
+    _output->succeeded[i] = succeeded;
+  }
+
+ private:
+  ParseBatchOutput* _output;
+};
+
+// Parses into a scratch href per thread, then appends it to the thread's
+// arena and fills the columns in. `Finish()` joins the arenas and moves the
+// offsets from the threads' arenas to the joined one.
+class ColumnWriter {
+ public:
+  ColumnWriter(BatchColumns* output, unsigned threads)
+      : _output(output), _threads(threads), _owners(output->count) {}
+
+  void Begin(unsigned thread,
+             size_t i,
+             string** href,
+             URLComponents** components) {
+    *href = &_threads[thread].href;
+    *components = &_threads[thread].components;
+  }
+
+  void End(unsigned thread, size_t i, bool succeeded, HostType host_type) {
+    ThreadArena& arena = _threads[thread];
+    _owners[i] = static_cast<uint16_t>(thread);
+    if (!succeeded) return;
+
+    const string& href = arena.href;
+    const URLComponents& c = arena.components;
+    size_t base = arena.arena.length();
+    arena.arena.append(href);
+
+    uint8_t scheme_id = GetBatchSchemeId(href.data(), c.protocol_end - 1);
+    uint32_t query_end = c.hash_start;
+
+    _output->scheme_ids[i] = scheme_id;
+    _output->ports[i] = c.port;
+    Set(&_output->href_offsets, &_output->href_lengths, i, base, 0,
+        href.length());
+    Set(&_output->scheme_offsets, &_output->scheme_lengths, i, base, 0,
+        c.protocol_end - 1);
+    if (host_type != kNotInitialized) {
+      _output->host_types[i] = static_cast<uint8_t>(host_type);
+      Set(&_output->host_offsets, &_output->host_lengths, i, base,
+          c.host_start, c.host_end);
+    }
+    Set(&_output->path_offsets, &_output->path_lengths, i, base,
+        c.pathname_start, c.search_start);
+    if (c.search_start < query_end) {
+      Set(&_output->query_offsets, &_output->query_lengths, i, base,
+          c.search_start + 1, query_end);
+    }
+    if (c.hash_start < href.length()) {
+      Set(&_output->fragment_offsets, &_output->fragment_lengths, i, base,
+          c.hash_start + 1, href.length());
+    }
+  }
+
+  // Joins the threads' arenas into `output->arena`, and sets the failure
+  // bits. Must run once the batch is done.
+  void Finish() {
+    vector<uint32_t> bases(_threads.size());
+    size_t total = 0;
+    for (size_t t = 0; t < _threads.size(); t++) {
+      bases[t] = static_cast<uint32_t>(total);
+      total += _threads[t].arena.length();
+    }
+    CHECK_LE(total, static_cast<size_t>(URLComponents::kOmittedComponent));
+
+    string* arena = &_output->arena;
+    arena->reserve(total);
+    for (ThreadArena& thread : _threads) {
+      arena->append(thread.arena);
+      string().swap(thread.arena);
+    }
+
+    for (size_t i = 0; i < _output->count; i++) {
+      uint32_t base = bases[_owners[i]];
+      if (_output->href_offsets[i] == URLComponents::kOmittedComponent) {
+        _output->failed[i / 64] |= uint64_t{1} << (i % 64);
+        continue;
+      }
+
+      if (base == 0) continue;
+#define V(name)                                                                \
+  if (_output->name##_offsets[i] != URLComponents::kOmittedComponent) {        \
+    _output->name##_offsets[i] += base;                                        \
+  }
+      BATCH_COLUMNS(V)
+#undef V
+    }
+  }
+
+ private:
+  struct ThreadArena {
+    string href;
+    URLComponents components;
+    string arena;
+
+    // Keeps two threads' scratch off one cache line.
+    char padding[64];
+  };
+
+  // Sets the range `[from, to)` of an href appended to an arena at `base`.
+  static inline void Set(vector<uint32_t>* offsets,
+                         vector<uint32_t>* lengths,
+                         size_t i,
+                         size_t base,
+                         size_t from,
+                         size_t to) {
+    (*offsets)[i] = static_cast<uint32_t>(base + from);
+    (*lengths)[i] = static_cast<uint32_t>(to - from);
+  }
+
+  BatchColumns* _output;
+  vector<ThreadArena> _threads;
+
+  // The thread that parsed every input, i.e. whose arena its href is in.
+  vector<uint16_t> _owners;
+};
+
+// How many threads to parse `count` inputs on.
+unsigned BatchThreads(size_t count, const ParseBatchOptions& options) {
+  unsigned threads = options.threads;
+  if (threads == 0) threads = std::thread::hardware_concurrency();
+  if (threads == 0) threads = 1;
+
+  // Every thread should get at least a chunk to start with.
+  size_t chunk_size = std::max<size_t>(options.chunk_size, 1);
+  size_t chunks = (count + chunk_size - 1) / chunk_size;
+  if (threads > chunks) threads = static_cast<unsigned>(chunks);
+  return threads;
+}
+
+}  // namespace
+
+bool ParseBatch(const string* inputs,
+                size_t count,
+                const string* base,
+                ParseBatchOutput* output,
+                const ParseBatchOptions& options) {
+  unique_ptr<BaseResolver> resolver;
+  if (base != nullptr) {
+    resolver.reset(new BaseResolver(*base, options.context));
+    if (resolver->failed()) return false;
+  }
+
+  output->hrefs.clear();
+  output->hrefs.resize(count);
+  output->components.assign(count, URLComponents());
+  output->succeeded.assign(count, 0);
+  output->failures = 0;
+  if (count == 0) return true;
+
+  unsigned threads = BatchThreads(count, options);
+  RowWriter writer(output);
+  Batch<RowWriter> batch(
+      inputs, count, resolver.get(), &writer, options, threads);
+  output->failures = batch.Run();
+  return true;
+}
+
+bool ParseBatchColumns(const string* inputs,
+                       size_t count,
+                       const string* base,
+                       BatchColumns* output,
+                       const ParseBatchOptions& options) {
+  unique_ptr<BaseResolver> resolver;
+  if (base != nullptr) {
+    resolver.reset(new BaseResolver(*base, options.context));
+    if (resolver->failed()) return false;
+  }
+
+  output->count = count;
+  output->failures = 0;
+  output->arena.clear();
+  output->failed.assign((count + 63) / 64, 0);
+  output->scheme_ids.assign(count, kOtherSchemeId);
+  output->host_types.assign(count, BatchColumns::kNullHostType);
+  output->ports.assign(count, URLComponents::kOmittedComponent);
+#define V(name)                                                                \
+  output->name##_offsets.assign(count, URLComponents::kOmittedComponent);      \
+  output->name##_lengths.assign(count, 0);
+  BATCH_COLUMNS(V)
+#undef V
+  if (count == 0) return true;
+
+  // The writer keeps the thread of every input in 16 bits.
+  unsigned threads = std::min(BatchThreads(count, options), 65535u);
+  ColumnWriter writer(output, threads);
+  Batch<ColumnWriter> batch(
+      inputs, count, resolver.get(), &writer, options, threads);
+  output->failures = batch.Run();
+  writer.Finish();
+  return true;
+}
+
+}  // namespace whatwgurl
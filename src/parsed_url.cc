@@ -0,0 +1,192 @@
+#include "parsed_url.h"
+#include <string.h>
+#include <algorithm>
+
+namespace whatwgurl {
+
+using std::string;
+
+namespace {
+
+inline int CompareStrings(const string& a, const string& b) {
+  int result = a.compare(b);
+  return (result > 0) - (result < 0);
+}
+
+template <typename T>
+inline int CompareValues(const T& a, const T& b) {
+  return (a > b) - (a < b);
+}
+
+// Null sorts first.
+inline int CompareMaybeStrings(const MaybeNull<string>& a,
+                               const MaybeNull<string>& b) {
+  if (a.is_null() || b.is_null()) return b.is_null() - a.is_null();
+  return CompareStrings(*a, *b);
+}
+
+// Domains, opaque hosts and empty hosts serialize as the string they hold, so
+// two of them are equal when the strings are, whatever their types. Within a
+// scheme none of them ever spells out an IP address (special schemes parse
+// those as IPv4 and IPv6 addresses, and opaque hosts cannot hold the IPv6
+// brackets), so addresses are a kind of their own.
+enum HostKind { kStringHost, kIPv4Host, kIPv6Host };
+
+inline HostKind KindOf(const HostItem& host) {
+  switch (host.type) {
+    case kIPv4Address:
+      return kIPv4Host;
+    case kIPv6Address:
+      return kIPv6Host;
+    default:
+      return kStringHost;
+  }
+}
+
+inline const string& StringOf(const HostItem& host) {
+  static const string empty;
+  switch (host.type) {
+    case kDomain:
+      return host.host.domain;
+    case kOpaqueHost:
+      return host.host.opaque_host;
+    default:
+      return empty;
+  }
+}
+
+int CompareHosts(const Host& a, const Host& b) {
+  if (a.is_null() || b.is_null()) return b.is_null() - a.is_null();
+
+  HostKind kind = KindOf(*a);
+  if (kind != KindOf(*b)) return CompareValues(kind, KindOf(*b));
+
+  switch (kind) {
+    case kIPv4Host:
+      return CompareValues(a->host.ipv4_address, b->host.ipv4_address);
+    case kIPv6Host:
+      for (size_t i = 0; i < 8; i++) {
+        int result =
+            CompareValues(a->host.ipv6_address[i], b->host.ipv6_address[i]);
+        if (result != 0) return result;
+      }
+      return 0;
+    default:
+      return CompareStrings(StringOf(*a), StringOf(*b));
+  }
+}
+
+bool HostsEqual(const Host& a, const Host& b) {
+  if (a.is_null() || b.is_null()) return a.is_null() == b.is_null();
+
+  HostKind kind = KindOf(*a);
+  if (kind != KindOf(*b)) return false;
+
+  switch (kind) {
+    case kIPv4Host:
+      return a->host.ipv4_address == b->host.ipv4_address;
+    case kIPv6Host:
+      return memcmp(a->host.ipv6_address,
+                    b->host.ipv6_address,
+                    sizeof(a->host.ipv6_address)) == 0;
+    default:
+      return StringOf(*a) == StringOf(*b);
+  }
+}
+
+inline int ComparePorts(const Port& a, const Port& b) {
+  if (a.is_null() || b.is_null()) return b.is_null() - a.is_null();
+  return CompareValues(a.value(), b.value());
+}
+
+// An empty opaque path and an empty list of segments both serialize as the
+// empty string, so they are one kind, sorting first. Otherwise an opaque path
+// never starts with "/" and a list always does.
+enum PathKind { kEmptyPath, kOpaquePath, kListPath };
+
+inline PathKind KindOf(const Path& path) {
+  if (path.IsOpaquePath()) {
+    return path.ASCIIString().empty() ? kEmptyPath : kOpaquePath;
+  }
+  return path.size() == 0 ? kEmptyPath : kListPath;
+}
+
+// Segments never hold "/", so lists of segments serialize the same exactly
+// when they have the same segments.
+int ComparePaths(const Path& a, const Path& b) {
+  PathKind kind = KindOf(a);
+  if (kind != KindOf(b)) return CompareValues(kind, KindOf(b));
+
+  switch (kind) {
+    case kOpaquePath:
+      return CompareStrings(a.ASCIIString(), b.ASCIIString());
+    case kListPath: {
+      size_t size = std::min(a.size(), b.size());
+      for (size_t i = 0; i < size; i++) {
+        int result = CompareStrings(a[i], b[i]);
+        if (result != 0) return result;
+      }
+      return CompareValues(a.size(), b.size());
+    }
+    default:
+      return 0;
+  }
+}
+
+bool PathsEqual(const Path& a, const Path& b) {
+  PathKind kind = KindOf(a);
+  if (kind != KindOf(b)) return false;
+
+  switch (kind) {
+    case kOpaquePath:
+      return a.ASCIIString() == b.ASCIIString();
+    case kListPath: {
+      size_t size = a.size();
+      if (size != b.size()) return false;
+      for (size_t i = 0; i < size; i++) {
+        if (a[i] != b[i]) return false;
+      }
+      return true;
+    }
+    default:
+      return true;
+  }
+}
+
+inline bool MaybeStringsEqual(const MaybeNull<string>& a,
+                              const MaybeNull<string>& b) {
+  if (a.is_null() || b.is_null()) return a.is_null() == b.is_null();
+  return *a == *b;
+}
+
+}  // namespace
+
+// The URL equivalence: A and B are equal if their serializations are. Every
+// component of a URL serializes with delimiters that its neighbours cannot
+// contain, so comparing the components one by one is the same as comparing
+// the serializations, and stops at the first that differs.
+bool ParsedURL::Equals(const ParsedURL& other, bool exclude_fragment) const {
+  // The components most likely to tell two URLs of a corpus apart come first.
+  return PathsEqual(path, other.path) &&
+         MaybeStringsEqual(query, other.query) &&
+         HostsEqual(host, other.host) && scheme == other.scheme &&
+         port.is_null() == other.port.is_null() &&
+         (port.is_null() || port.value() == other.port.value()) &&
+         username == other.username && password == other.password &&
+         (exclude_fragment || MaybeStringsEqual(fragment, other.fragment));
+}
+
+int ParsedURL::Compare(const ParsedURL& other, bool exclude_fragment) const {
+  int result;
+  if ((result = CompareStrings(scheme, other.scheme)) != 0) return result;
+  if ((result = CompareStrings(username, other.username)) != 0) return result;
+  if ((result = CompareStrings(password, other.password)) != 0) return result;
+  if ((result = CompareHosts(host, other.host)) != 0) return result;
+  if ((result = ComparePorts(port, other.port)) != 0) return result;
+  if ((result = ComparePaths(path, other.path)) != 0) return result;
+  if ((result = CompareMaybeStrings(query, other.query)) != 0) return result;
+  if (exclude_fragment) return 0;
+  return CompareMaybeStrings(fragment, other.fragment);
+}
+
+}  // namespace whatwgurl
@@ -0,0 +1,125 @@
+#include "parser_context.h"
+#include <utility>
+
+namespace whatwgurl {
+
+using std::lock_guard;
+using std::mutex;
+using std::string;
+
+// Rough per-entry overhead of the IDNA cache (list node, hash node and the two
+// string headers), counted against the budget together with the strings.
+constexpr size_t kIDNACacheEntryOverhead = 128;
+
+ParserContext::ParserContext()
+    : _idna_to_ascii(nullptr), _idna_mode(kIDNADefault) {}
+
+ParserContext::ParserContext(IDNAToASCIIFunction to_ascii, IDNAMode idna_mode)
+    : _idna_to_ascii(to_ascii), _idna_mode(idna_mode) {}
+
+ParserContext* ParserContext::Default() {
+  static ParserContext default_context;
+  return &default_context;
+}
+
+void ParserContext::set_idna_mode(IDNAMode mode) {
+  lock_guard<mutex> lock(_idna_cache_mutex);
+  _idna_mode = mode;
+
+  // Cached results were computed in the previous mode.
+  _idna_cache.clear();
+  _idna_cache_list.clear();
+  _idna_cache_size = 0;
+}
+
+void ParserContext::set_idna_cache_budget(size_t bytes) {
+  lock_guard<mutex> lock(_idna_cache_mutex);
+  _idna_cache_budget = bytes;
+  EvictIDNACache();
+}
+
+ParserCounters ParserContext::counters() const {
+  ParserCounters ret;
+#define V(name) ret.name = _##name.load(std::memory_order_relaxed);
+  PARSER_COUNTERS(V)
+#undef V
+  return ret;
+}
+
+void ParserContext::ResetCounters() {
+#define V(name) _##name.store(0, std::memory_order_relaxed);
+  PARSER_COUNTERS(V)
+#undef V
+}
+
+IDNAToASCIIFunction ParserContext::GetToASCII() const {
+  if (_idna_to_ascii != nullptr) return _idna_to_ascii;
+  return GetIDNAEnvironment()->to_ascii;
+}
+
+int32_t ParserContext::DomainToASCII(string* buf,
+                                     const char* input,
+                                     size_t length) {
+  IDNAToASCIIFunction to_ascii = GetToASCII();
+  if (_collect_counters) _idna_calls.fetch_add(1, std::memory_order_relaxed);
+
+  if (_idna_cache_budget == 0) {
+    return to_ascii(buf, input, length, _idna_mode);
+  }
+
+  string key(input, length);
+  {
+    lock_guard<mutex> lock(_idna_cache_mutex);
+
+    // A context that follows the global environment may see the provider
+    // change; results of the previous one must not be served.
+    if (_idna_cache_owner != to_ascii) {
+      _idna_cache.clear();
+      _idna_cache_list.clear();
+      _idna_cache_size = 0;
+      _idna_cache_owner = to_ascii;
+    }
+
+    auto it = _idna_cache.find(key);
+    if (it != _idna_cache.end()) {
+      // Move the entry to the front of the LRU list.
+      _idna_cache_list.splice(
+          _idna_cache_list.begin(), _idna_cache_list, it->second);
+      *buf = it->second->value;
+      if (_collect_counters) {
+        _idna_cache_hits.fetch_add(1, std::memory_order_relaxed);
+      }
+      return it->second->result;
+    }
+  }
+
+  // The provider may be slow (or call into JavaScript), so it runs unlocked.
+  // Two threads missing the same key at once both compute it, and the second
+  // insertion is dropped.
+  int32_t result = to_ascii(buf, input, length, _idna_mode);
+
+  lock_guard<mutex> lock(_idna_cache_mutex);
+  if (_idna_cache_owner != to_ascii || _idna_cache.count(key) > 0) {
+    return result;
+  }
+
+  _idna_cache_size += key.length() + buf->length() + kIDNACacheEntryOverhead;
+  _idna_cache_list.push_front({key, *buf, result});
+  _idna_cache.emplace(std::move(key), _idna_cache_list.begin());
+  EvictIDNACache();
+
+  return result;
+}
+
+// Must be called with `_idna_cache_mutex` held.
+void ParserContext::EvictIDNACache() {
+  while (_idna_cache_size > _idna_cache_budget && !_idna_cache_list.empty()) {
+    const IDNACacheEntry& entry = _idna_cache_list.back();
+    _idna_cache_size -=
+        entry.key.length() + entry.value.length() + kIDNACacheEntryOverhead;
+    _idna_cache.erase(entry.key);
+    _idna_cache_list.pop_back();
+  }
+}
+
+}  // namespace whatwgurl
@@ -0,0 +1,248 @@
+#include "parser_profile.h"
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+#include "thread_counters-inl.h"
+#include "utils/assert.h"
+
+namespace whatwgurl {
+
+using std::string;
+using std::vector;
+
+const char* ParseStateName(ParseState state) {
+  static const char* const names[kParseStateCount] = {
+      "scheme start",
+      "scheme",
+      "no scheme",
+      "special relative or authority",
+      "path or authority",
+      "relative",
+      "relative slash",
+      "special authority slashes",
+      "special authority ignore slashes",
+      "authority",
+      "host",
+      "hostname",
+      "port",
+      "file",
+      "file slash",
+      "file host",
+      "path start",
+      "path",
+      "opaque path",
+      "query",
+      "fragment",
+  };
+
+  CHECK(state >= 0 && state < kParseStateCount);
+  return names[state];
+}
+
+namespace {
+
+// Counter layout: the parse count, then entries, bytes and nanoseconds of
+// every state, then the transition matrix.
+constexpr size_t kParsesCounter = 0;
+constexpr size_t kEntriesCounter = 0;
+constexpr size_t kBytesCounter = 1;
+constexpr size_t kNanosecondsCounter = 2;
+constexpr size_t kCountersPerState = 3;
+constexpr size_t kTransitionCounters =
+    1 + kParseStateCount * kCountersPerState;
+constexpr size_t kProfileCounterCount =
+    kTransitionCounters + kParseStateCount * kParseStateCount;
+
+struct ProfileCountersTag {};
+typedef ThreadCounters<ProfileCountersTag, kProfileCounterCount>
+    ProfileCounters;
+
+inline size_t StateCounter(int state, size_t field) {
+  return 1 + state * kCountersPerState + field;
+}
+
+inline size_t TransitionCounter(int from, int to) {
+  return kTransitionCounters + from * kParseStateCount + to;
+}
+
+struct StateTransition {
+  int from;
+  int to;
+  uint64_t count;
+};
+
+// Transitions that happened, most frequent first.
+vector<StateTransition> SortedTransitions(const ParserProfile& profile) {
+  vector<StateTransition> ret;
+  for (int from = 0; from < kParseStateCount; from++) {
+    for (int to = 0; to < kParseStateCount; to++) {
+      uint64_t count = profile.transitions[from][to];
+      if (count) ret.push_back({from, to, count});
+    }
+  }
+
+  std::stable_sort(ret.begin(),
+                   ret.end(),
+                   [](const StateTransition& a, const StateTransition& b) {
+                     return a.count > b.count;
+                   });
+  return ret;
+}
+
+void AppendFormat(string* out, const char* format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+
+  CHECK(length >= 0 && static_cast<size_t>(length) < sizeof(buf));
+  out->append(buf, length);
+}
+
+}  // namespace
+
+string ParserProfile::ToTable() const {
+  uint64_t total_nanoseconds = 0;
+  for (const ParseStateProfile& state : states) {
+    total_nanoseconds += state.nanoseconds;
+  }
+
+  string ret;
+  AppendFormat(&ret, "parses: %" PRIu64 "\n\n", parses);
+  AppendFormat(&ret,
+               "%-32s %12s %12s %14s %7s %8s\n",
+               "state",
+               "entries",
+               "bytes",
+               "nanoseconds",
+               "time",
+               "ns/byte");
+
+  for (int i = 0; i < kParseStateCount; i++) {
+    const ParseStateProfile& state = states[i];
+    if (!state.entries) continue;
+
+    AppendFormat(&ret,
+                 "%-32s %12" PRIu64 " %12" PRIu64 " %14" PRIu64
+                 " %6.2f%% %8.2f\n",
+                 ParseStateName(static_cast<ParseState>(i)),
+                 state.entries,
+                 state.bytes,
+                 state.nanoseconds,
+                 total_nanoseconds
+                     ? 100.0 * state.nanoseconds / total_nanoseconds
+                     : 0.0,
+                 state.bytes ? static_cast<double>(state.nanoseconds) /
+                                   state.bytes
+                             : 0.0);
+  }
+
+  AppendFormat(&ret, "\n%-32s %-32s %12s\n", "from", "to", "count");
+  for (const StateTransition& transition : SortedTransitions(*this)) {
+    AppendFormat(&ret,
+                 "%-32s %-32s %12" PRIu64 "\n",
+                 ParseStateName(static_cast<ParseState>(transition.from)),
+                 ParseStateName(static_cast<ParseState>(transition.to)),
+                 transition.count);
+  }
+
+  return ret;
+}
+
+string ParserProfile::ToJSON() const {
+  string ret;
+  AppendFormat(&ret, "{\"parses\":%" PRIu64 ",\"states\":{", parses);
+
+  bool first = true;
+  for (int i = 0; i < kParseStateCount; i++) {
+    const ParseStateProfile& state = states[i];
+    if (!state.entries) continue;
+
+    AppendFormat(&ret,
+                 "%s\"%s\":{\"entries\":%" PRIu64 ",\"bytes\":%" PRIu64
+                 ",\"nanoseconds\":%" PRIu64 "}",
+                 first ? "" : ",",
+                 ParseStateName(static_cast<ParseState>(i)),
+                 state.entries,
+                 state.bytes,
+                 state.nanoseconds);
+    first = false;
+  }
+
+  ret.append("},\"transitions\":[");
+
+  first = true;
+  for (const StateTransition& transition : SortedTransitions(*this)) {
+    AppendFormat(&ret,
+                 "%s{\"from\":\"%s\",\"to\":\"%s\",\"count\":%" PRIu64 "}",
+                 first ? "" : ",",
+                 ParseStateName(static_cast<ParseState>(transition.from)),
+                 ParseStateName(static_cast<ParseState>(transition.to)),
+                 transition.count);
+    first = false;
+  }
+
+  ret.append("]}");
+  return ret;
+}
+
+ParserProfile GetParserProfile() {
+  uint64_t counters[kProfileCounterCount];
+  ProfileCounters::Sum(counters);
+
+  ParserProfile ret;
+  ret.parses = counters[kParsesCounter];
+  for (int i = 0; i < kParseStateCount; i++) {
+    ret.states[i].entries = counters[StateCounter(i, kEntriesCounter)];
+    ret.states[i].bytes = counters[StateCounter(i, kBytesCounter)];
+    ret.states[i].nanoseconds =
+        counters[StateCounter(i, kNanosecondsCounter)];
+    for (int j = 0; j < kParseStateCount; j++) {
+      ret.transitions[i][j] = counters[TransitionCounter(i, j)];
+    }
+  }
+
+  return ret;
+}
+
+void ResetParserProfile() {
+  ProfileCounters::Reset();
+}
+
+#ifdef WHATWGURL_PARSER_PROFILE
+
+ParseStateProfiler::ParseStateProfiler(ParseState state)
+    : _state(state), _entered(Clock::now()) {
+  ProfileCounters::Add(kParsesCounter, 1);
+  ProfileCounters::Add(StateCounter(_state, kEntriesCounter), 1);
+}
+
+ParseStateProfiler::~ParseStateProfiler() {
+  Flush(Clock::now());
+}
+
+void ParseStateProfiler::Transition(ParseState state) {
+  Clock::time_point now = Clock::now();
+  Flush(now);
+
+  ProfileCounters::Add(TransitionCounter(_state, state), 1);
+  ProfileCounters::Add(StateCounter(state, kEntriesCounter), 1);
+  _state = state;
+  _entered = now;
+}
+
+void ParseStateProfiler::Flush(Clock::time_point now) {
+  uint64_t nanoseconds =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now - _entered)
+          .count();
+  ProfileCounters::Add(StateCounter(_state, kBytesCounter), _bytes);
+  ProfileCounters::Add(StateCounter(_state, kNanosecondsCounter), nanoseconds);
+  _bytes = 0;
+}
+
+#endif  // WHATWGURL_PARSER_PROFILE
+
+}  // namespace whatwgurl
@@ -0,0 +1,3957 @@
+// Generated by tools/gen_public_suffix_data.py; do not edit.
+//
+// The data comes from the Public Suffix List
+// (https://publicsuffix.org/list/), which is subject to the terms of the
+// Mozilla Public License, v. 2.0 (https://mozilla.org/MPL/2.0/).
+
+#include "public_suffix.h"
+
+namespace whatwgurl {
+namespace public_suffix {
+
+const char kLabels[] =
+    "aaaaarpabarthabbabbottabbvieabcableabogadoabudhabiacacademyaccenture"
+    "accountantaccountantsacoactoradadsadultaeaegaeroaetnaafaflafricaag"
+    "agakhanagencyaiaigairbusairforceairtelakdnalalfaromeoalibabaalipay"
+    "allfinanzallstateallyalsacealstomamamazonamericanexpressamericanfamily"
+    "amexamfamamicaamsterdamanalyticsandroidanquananzaoaolapartmentsappapple"
+    "aqaquarelleararabaramcoarchiarmyarpaartarteasasdaasiaassociatesatathleta"
+    "attorneyauauctionaudiaudibleaudioauspostauthorautoautosaviancaawawsaxaxa"
+    "azazurebababybaidubanamexbananarepublicbandbankbarbarcelonabarclaycard"
+    "barclaysbarefootbargainsbaseballbasketballbauhausbayernbbbbcbbtbbvabcg"
+    "bcnbdbebeatsbeautybeerbentleyberlinbestbestbuybetbfbgbhbhartibibiblebid"
+    "bikebingbingobiobizbjblackblackfridayblockbusterblogbloombergbluebmbms"
+    "bmwbnbnpparibasboboatsboehringerbofabombondboobookbookingboschbostik"
+    "bostonbotboutiqueboxbrbradescobridgestonebroadwaybrokerbrotherbrusselsbs"
+    "btbuildbuildersbusinessbuybuzzbvbwbybzbzhcacabcafecalcallcalvinkleincam"
+    "cameracampcanoncapetowncapitalcapitalonecarcaravancardscarecareercareers"
+    "carscasacasecashcasinocatcateringcatholiccbacbncbrecbscccdcenterceocern"
+    "cfcfacfdcgchchanelchannelcharitychasechatcheapchintaichristmaschrome"
+    "churchciciprianicircleciscocitadelciticiticcitycityeatsckclclaims"
+    "cleaningclickcliniccliniqueclothingcloudclubclubmedcmcncocoachcodes"
+    "coffeecollegecolognecomcomcastcommbankcommunitycompanycomparecomputer"
+    "comseccondosconstructionconsultingcontactcontractorscooking"
+    "cookingchannelcoolcoopcorsicacountrycouponcouponscoursescpacrcredit"
+    "creditcardcreditunioncricketcrowncrscruisecruisescucuisinellacvcwcxcy"
+    "cymrucyouczdaburdaddancedatadatedatingdatsundaydclkddsdedealdealerdeals"
+    "degreedeliverydelldeloittedeltademocratdentaldentistdesidesigndevdhl"
+    "diamondsdietdigitaldirectdirectorydiscountdiscoverdishdiydjdkdmdnpdodocs"
+    "doctordogdomainsdotdownloaddrivedtvdubaidunlopdupontdurbandvagdvrdzearth"
+    "eatececoedekaedueducationeeegemailemerckenergyengineerengineering"
+    "enterprisesepsonequipmenterericssonerniesesqestateetetisalateueurovision"
+    "euseventsexchangeexpertexposedexpressextraspacefagefailfairwindsfaith"
+    "familyfanfansfarmfarmersfashionfastfedexfeedbackferrariferrerofifiat"
+    "fidelityfidofilmfinalfinancefinancialfirefirestonefirmdalefishfishingfit"
+    "fitnessfjfkflickrflightsflirfloristflowersflyfmfofoofoodfoodnetwork"
+    "footballfordforexforsaleforumfoundationfoxfrfreefreseniusfrlfrogans"
+    "frontdoorfrontierftrfujitsufunfundfurniturefutbolfyigagalgallerygallo"
+    "gallupgamegamesgapgardengaygbgbizgdgdngegeagentgentinggeorgegfggggeeghgi"
+    "giftgiftsgivesgivingglglassgleglobalglobogmgmailgmbhgmogmxgngodaddygold"
+    "goldpointgolfgoogoodyeargooggooglegopgotgovgpgqgrgraingergraphicsgratis"
+    "greengripegrocerygroupgsgtguguardianguccigugeguideguitarsgurugwgyhair"
+    "hamburghangouthaushbohdfchdfcbankhealthhealthcarehelphelsinkiherehermes"
+    "hgtvhiphophisamitsuhitachihivhkhkthmhnhockeyholdingsholidayhomedepot"
+    "homegoodshomeshomesensehondahorsehospitalhosthostinghothoteleshotels"
+    "hotmailhousehowhrhsbchthuhugheshyatthyundaiibmicbciceicuidieieeeifmikano"
+    "ilimimamatimdbimmoimmobilieninincindustriesinfinitiinfoinginkinstitute"
+    "insuranceinsureintinternationalintuitinvestmentsioipirangaiqiririshis"
+    "ismailiististanbulititauitvjaguarjavajcbjejeepjetztjewelryjiojlljmjmpjnj"
+    "jojobsjoburgjotjoyjpjpmorganjprsjuegosjuniperkaufenkddikekerryhotels"
+    "kerrylogisticskerrypropertieskfhkgkhkikiakidskimkinderkindlekitchenkiwi"
+    "kmknkoelnkomatsukosherkpkpmgkpnkrkrdkredkuokgroupkwkykyotokzlalacaixa"
+    "lamborghinilamerlancasterlancialandlandroverlanxesslasallelatlatino"
+    "latrobelawlawyerlblcldsleaseleclerclefraklegallegolexuslgbtlilidllife"
+    "lifeinsurancelifestylelightinglikelillylimitedlimolincolnlindelinklipsy"
+    "livelivinglkllcllploanloanslockerlocuslollondonlottelottolovelpl"
+    "lplfinanciallrlsltltdltdalulundbeckluxeluxurylvlymamacysmadridmaifmaison"
+    "makeupmanmanagementmangomapmarketmarketingmarketsmarriottmarshalls"
+    "maseratimattelmbamcmckinseymdmemedmediameetmelbournememememorialmenmenu"
+    "merckmsdmgmhmiamimicrosoftmilminimintmitmitsubishimkmlmlbmlsmmmmamnmo"
+    "mobimobilemodamoemoimommonashmoneymonstermormonmortgagemoscowmoto"
+    "motorcyclesmovmoviempmqmrmsmsdmtmtnmtrmumuseummusicmutualmvmwmxmymznanab"
+    "nagoyanamenaturanavynbancnenecnetnetbanknetflixnetworkneustarnewnewsnext"
+    "nextdirectnexusnfnflngngonhkniniconikenikonninjanissannissaynlnonokia"
+    "northwesternmutualnortonnownowruznowtvnpnrnranrwnttnunycnzobiobserver"
+    "officeokinawaolayanolayangroupoldnavyolloomomegaoneongoniononlonlineooo"
+    "openoracleorangeorgorganicoriginsosakaotsukaottovhpapagepanasonicparis"
+    "parspartnerspartspartypassagenspaypccwpepetpfpfizerpgphpharmacyphd"
+    "philipsphonephotophotographyphotosphysiopicspictetpicturespidpinpingpink"
+    "pioneerpizzapkplplaceplayplaystationplumbingpluspmpnpncpohlpokerpolitie"
+    "pornpostprpramericapraxipressprimeproprodproductionsprofprogressivepromo"
+    "propertiespropertyprotectionpruprudentialpsptpubpwpwcpyqaqponquebecquest"
+    "racingradiorereadrealestaterealtorrealtyrecipesredredstoneredumbrella"
+    "rehabreisereisenreitreliancerenrentrentalsrepairreportrepublicanrest"
+    "restaurantreviewreviewsrexrothrichrichardliricohrilrioriprorocherrocks"
+    "rodeorogersroomrsrsvprurugbyruhrrunrwrweryukyusasaarlandsafesafetysakura"
+    "salesalonsamsclubsamsungsandviksandvikcoromantsanofisapsarlsassavesaxosb"
+    "sbisbsscscascbschaefflerschmidtscholarshipsschoolschuleschwarzscience"
+    "scotsdsesearchseatsecuresecurityseekselectsenerservicessevensewsexsexy"
+    "sfrsgshshangrilasharpshawshellshiashikshashoesshopshoppingshoujishow"
+    "showtimesisilksinasinglessitesjskskiskinskyskypeslslingsmsmartsmilesn"
+    "sncfsosoccersocialsoftbanksoftwaresohusolarsolutionssongsonysoyspaspace"
+    "sportspotsrsrlssststadastaplesstarstatebankstatefarmstcstcgroupstockholm"
+    "storagestorestreamstudiostudystylesusuckssuppliessupplysupportsurf"
+    "surgerysuzukisvswatchswisssxsysydneysystemssztabtaipeitalktaobaotarget"
+    "tatamotorstatartattootaxtaxitctcitdtdkteamtechtechnologyteltemasektennis"
+    "tevatftgththdtheatertheatretiaaticketstiendatiffanytipstirestiroltj"
+    "tjmaxxtjxtktkmaxxtltmtmalltntotodaytokyotoolstoptoraytoshibatotaltours"
+    "towntoyotatoystrtradetradingtrainingtraveltravelchanneltravelers"
+    "travelersinsurancetrusttrvtttubetuitunestushutvtvstwtzuaubankubsuguk"
+    "unicomuniversityunouolupsusuyuzvavacationsvanavanguardvcvevegasventures"
+    "verisignversicherungvetvgviviajesvideovigvikingvillasvinvipvirginvisa"
+    "visionvivavivovlaanderenvnvodkavolkswagenvolvovotevotingvotovoyagevu"
+    "vueloswaleswalmartwalterwangwanggouwatchwatchesweatherweatherchannel"
+    "webcamweberwebsiteweddingweiboweirwfwhoswhowienwikiwilliamhillwinwindows"
+    "winewinnerswmewolterskluwerwoodsideworkworksworldwowwswtcwtfxboxxerox"
+    "xfinityxihuanxinxn--11b4c3dxn--1ck2e1bxn--1qqw23axn--2scrj9cxn--30rr7y"
+    "xn--3bst00mxn--3ds443gxn--3e0b707exn--3hcrj9cxn--3pxu8kxn--42c2d9a"
+    "xn--45br5cylxn--45brj9cxn--45q11cxn--4dbrk0cexn--4gbrimxn--54b7fta0cc"
+    "xn--55qw42gxn--55qx5dxn--5su34j936bgsgxn--5tzm5gxn--6frz82g"
+    "xn--6qq986b3xlxn--80adxhksxn--80ao21axn--80aqecdr1axn--80asehdb"
+    "xn--80aswgxn--8y0a063axn--90a3acxn--90aexn--90aisxn--9dbq2axn--9et52u"
+    "xn--9krt00axn--b4w605ferdxn--bck1b9a5dre4cxn--c1avgxn--c2br7gxn--cck2b3b"
+    "xn--cckwcxetdxn--cg4bkixn--clchc0ea0b2g2a9gcdxn--czr694bxn--czrs0t"
+    "xn--czru2dxn--d1acj3bxn--d1alfxn--e1a4cxn--eckvdtc9dxn--efvy88h"
+    "xn--fct429kxn--fhbeixn--fiq228c5hsxn--fiq64bxn--fiqs8sxn--fiqz9s"
+    "xn--fjq720axn--flw351exn--fpcrj9c3dxn--fzc2c9e2cxn--fzys8d69uvgm"
+    "xn--g2xx48cxn--gckr3f0fxn--gecrj9cxn--gk3at1exn--h2breg3evexn--h2brj9c"
+    "xn--h2brj9c8cxn--hxt814exn--i1b6b1a6a2exn--imr513nxn--io0a7ixn--j1aef"
+    "xn--j1amhxn--j6w193gxn--jlq480n2rgxn--jvr189mxn--kcrx77d1x4axn--kprw13d"
+    "xn--kpry57dxn--kput3ixn--l1accxn--lgbbat1ad8jxn--mgb2ddesxn--mgb9awbf"
+    "xn--mgba3a3ejtxn--mgba3a4f16axn--mgba3a4fraxn--mgba7c0bbn0a"
+    "xn--mgbaakc7dvfxn--mgbaam7a8hxn--mgbab2bdxn--mgbah1a3hjkrd"
+    "xn--mgbai9a5eva00bxn--mgbai9azgqp6jxn--mgbayh7gpaxn--mgbbh1a"
+    "xn--mgbbh1a71exn--mgbc0a9azcgxn--mgbca7dzdoxn--mgbcpq6gpa1a"
+    "xn--mgberp4a5d4a87gxn--mgberp4a5d4arxn--mgbgu82axn--mgbi4ecexp"
+    "xn--mgbpl2fhxn--mgbqly7c0a67fbcxn--mgbqly7cvafrxn--mgbt3dhdxn--mgbtf8fl"
+    "xn--mgbtx2bxn--mgbx4cd0abxn--mix082fxn--mix891fxn--mk1bu44cxn--mxtq1m"
+    "xn--ngbc5azdxn--ngbe9e0axn--ngbrxxn--nnx388axn--nodexn--nqv7f"
+    "xn--nqv7fs00emaxn--nyqy26axn--o3cw4hxn--ogbpf8flxn--otu796dxn--p1acf"
+    "xn--p1aixn--pgbs0dhxn--pssy2uxn--q7ce6axn--q9jyb4cxn--qcka1pmcxn--qxa6a"
+    "xn--qxamxn--rhqv96gxn--rovu88bxn--rvc1e0am3exn--s9brj9cxn--ses554g"
+    "xn--t60b56axn--tckwexn--tiq49xqyjxn--unup4yxn--vermgensberater-ctb"
+    "xn--vermgensberatung-pwbxn--vhquvxn--vuq861bxn--w4r85el8fhu5dnra"
+    "xn--w4rs40lxn--wgbh1cxn--wgbl6axn--xhq521bxn--xkc2al3hye2a"
+    "xn--xkc2dl3a5ee0hxn--y9a3aqxn--yfro4i67oxn--ygbi2ammxxn--zfr164bxxxxyz"
+    "yachtsyahooyamaxunyandexyeyodobashiyogayokohamayouyoutubeytyunzazappos"
+    "zarazerozipzmzonezuerichzwdrrofficialnomblogspotsch"
+    "accident-investigationaccident-preventionaerobaticaeroclubaerodrome"
+    "agentsair-surveillanceair-traffic-controlaircraftairlineairport"
+    "airtrafficambulanceamusementassociationballooningcaacargocertification"
+    "championshipchartercivilaviationconferenceconsultantcontrolcouncilcrew"
+    "dgcaeducatoremergencyengineentertainmentfederationflightfuelgliding"
+    "governmentgroundhandlinghangglidinghomebuiltjournaljournalistleasing"
+    "logisticsmagazinemaintenancemicrolightmodellingnavigationparachuting"
+    "paraglidingpassenger-associationpilotproductionrecreationrepbodyres"
+    "researchrotorcraftscientistskydivingstudenttradertrainerunion"
+    "workinggroupoffuwucommunenekonyaaedgvogpbbegetbookonlineclerkclerkstage"
+    "detadevelopereasypaneledgecomputeencrfirewebframerhasuraloginline"
+    "messerlinetlifynoopnorthflankondigitaloceanonflashdriveplatform0"
+    "snowflakestreamlittelebittypedreamvercelwebwnextgobmusicasenasature164"
+    "in-addrip6irisuriurncloudns123webseite12hp2ix4limafunkfeuerfuturecms"
+    "futurehostingfuturemailinglima-citymyspreadshoporortsinfoprivactasnconf"
+    "nswntozqldtasvicwaxyppaus123websiteinterhostsolutionskuleuventransurl"
+    "webhosting0123456789abbarsycdefghijklmnopqrstuvwxyzactivetraildscloud"
+    "dyndnsfor-betterfor-morefor-somefor-thejozimmafanmyftpno-iporxselfip"
+    "webhopagroarchitectesassuravocatseconoloisirsoterestotourismunivacademia"
+    "boliviacienciacooperativademocraciadeporteecologiaeconomiaempresa"
+    "indigenaindustriamedicinamovimientonaturalnombrenoticiaspatria"
+    "plurinacionalpoliticaprofesionalpueblorevistasaludtecnologiatksat"
+    "transporte9guacuadmadvagrajuananiaparecidaarqatobarueribelembhzbibbmd"
+    "boavistabsbcampinagrandecampinascaxiascimcngcntcontagemcozcricuiaba"
+    "curitibadefdesdetecnempenfengespetcetifarfeiraflogfloripafndfortalfotfoz"
+    "fstg12geoggfgoianiagruimbindinfjabjampajdfjoinvillejorjusleglellog"
+    "londrinamacapamaceiomanausmaringamatmorenamusnatalniteroinotntrodoosasco"
+    "palmaspoappgpscpsipvhqslrecreciferepribeiraoriobrancoriopretosalvador"
+    "sampasantamariasantoandresaobernardosaogoncasegsjcslgslzsorocabasrvtec"
+    "teothetmptrdudivixvlogzlgwecloudsitemediatechmycloudofgsjabawdevbcgcmbnb"
+    "nsonqcyknabucsxfantasyleagueftpaccessgame-servermyphotosscrappingspawn"
+    "twmaildnskingfirenetflowgotdnslinkyard-cloudsquare7assofingogouvpresse"
+    "xn--aroport-byawwwaxarnetbanzaidiademelementorencowayjelasticjele"
+    "jenv-arubajotelulukeliweblinkyardmagentositeon-rancheroxaperspecta"
+    "primetelravendbreclaimscwsensiositestaticstrafficplextrendhostingurown"
+    "vaporvoorloperahcanva-appscqgxgzhahbhehihlinstantcloudjljsjxlnnmnxqh"
+    "quickconnectxjxn--od0algxzynzjartscarrdcrdfirewalledreplitfirmleadpages"
+    "lpagesmypin4totapreplsupabaseowo001www0emm1kapp3utilities4uadobeaemcloud"
+    "airkitappsairkitapps-auaivencloudalpha-myqnapcloudamazonawsamscompute"
+    "appchiziapplinziappspacehostedappspaceusercontentappspotauthgear-staging"
+    "authgearappsawsglobalacceleratorawsmpplbalena-devicesbarsycenter"
+    "barsyonlinebetainaboxblogdnsblogsytebloxcmsbounty-fullboutirbplaced"
+    "builtwithdarkcafjscechirecf-ipfsciscofreakclicketcloudcloudcontrolapp"
+    "cloudcontrolledcloudflare-ipfscodecodespotcustomer-ocidamnserver"
+    "datadetectdattolocaldattorelaydattowebddns5ddnsfreeddnsgeekddnsking"
+    "ddnslivedev-myqnapclouddevcdnaccessodigitaloceanspacesdiscordsays"
+    "discordsezditchyouripdnsaliasdnsdojodnsiskinkydoesntexistdontexist"
+    "doomdnsdopaasdrayddnsdreamhostersdsmynasdyn-o-saurdynaliasdyndns-at-home"
+    "dyndns-at-workdyndns-blogdyndns-freedyndns-homedyndns-ipdyndns-mail"
+    "dyndns-officedyndns-picsdyndns-remotedyndns-serverdyndns-webdyndns-wiki"
+    "dyndns-workdynnselasticbeanstalkencoreapiest-a-la-maisonest-a-la-masion"
+    "est-le-patronest-mon-blogueurevennodefamilydsfastly-edgefastly-terrarium"
+    "fastvps-serverfbsbxfirebaseappfirewall-gatewayfldrvforgeblocks"
+    "framercanvasfreebox-osfreeboxosfreemyipfrom-akfrom-alfrom-arfrom-ca"
+    "from-ctfrom-dcfrom-defrom-flfrom-gafrom-hifrom-iafrom-idfrom-ilfrom-in"
+    "from-ksfrom-kyfrom-mafrom-mdfrom-mifrom-mnfrom-mofrom-msfrom-mtfrom-nc"
+    "from-ndfrom-nefrom-nhfrom-njfrom-nmfrom-nvfrom-ohfrom-okfrom-orfrom-pa"
+    "from-prfrom-rifrom-scfrom-sdfrom-tnfrom-txfrom-utfrom-vafrom-vtfrom-wa"
+    "from-wifrom-wvfrom-wygeekgalaxygentappsgentlentapisgetmyipgiize"
+    "githubusercontentgleezegoogleapisgooglecodegotpantheonhealth-carereform"
+    "herokuappherokusslhidorahobby-sitehomelinuxhomesecuritymachomesecuritypc"
+    "homeunixhosted-by-previderhostedpihosteurhotelwithflightiamallama"
+    "ik-serverimpertriximpertrixcdnis-a-anarchistis-a-bloggeris-a-bookkeeper"
+    "is-a-bulls-fanis-a-catereris-a-chefis-a-conservativeis-a-cpa"
+    "is-a-cubicle-slaveis-a-democratis-a-designeris-a-doctor"
+    "is-a-financialadvisoris-a-geekis-a-greenis-a-guruis-a-hard-worker"
+    "is-a-hunteris-a-landscaperis-a-lawyeris-a-liberalis-a-libertarian"
+    "is-a-llamais-a-musicianis-a-nascarfanis-a-nurseis-a-painter"
+    "is-a-personaltraineris-a-photographeris-a-playeris-a-republican"
+    "is-a-rockstaris-a-socialistis-a-studentis-a-teacheris-a-techie"
+    "is-a-therapistis-an-accountantis-an-actoris-an-actressis-an-anarchist"
+    "is-an-artistis-an-engineeris-an-entertaineris-certifiedis-gone"
+    "is-into-animeis-into-carsis-into-cartoonsis-into-gamesis-leet"
+    "is-not-certifiedis-slickis-uberleetis-with-thebandisa-geekisa-hockeynut"
+    "issmarterthanyoujdevcloudjoyentjpnkasserverkilatironkozowktistory"
+    "likes-pielikescandylinodelinodeobjectslinodeusercontentlmpmlogoip"
+    "loseyouriplpusercontentmassivegridmazeplaymesswithdnsmeteorappmex"
+    "miniservermyactivedirectorymyasustormydattomydobissmydrobomyiphost"
+    "myqnapcloudmysecuritycameramyshopblocksmyshopifymytabitmythic-beasts"
+    "mytuleapmyvncneat-urlnet-freaksnfshostnospamproxyobservableusercontent"
+    "on-aptibleonfabricaonrenderonthewifiooguyoperauniteorsites"
+    "outsystemscloudownproviderpagefrontapppagespeedmobilizerpagexlpaywhirl"
+    "pgfogpixolinoplatter-appplaystation-cloudplesknspoint2thispostman-echo"
+    "prgmrpublishproxypythonanywhereqa2qbuserqualifioappquicksytes"
+    "quipelementsrackmazeremotewdrenderreservdreserve-onlinerhcloud"
+    "saves-the-whalesscrysecsecuritytacticssells-for-lesssells-for-uservebbs"
+    "servebeerservecounterstrikeserveexchangeserveftpservegameservehalflife"
+    "servehttpservehumourserveircservemp3servep2pservepicsservequake"
+    "servesarcasmshopitsitesiiitessimple-urlsimplesitesinaappskygearapp"
+    "smushcdnspace-to-rentstackhero-networkstdlibstreamlitappstufftoread"
+    "tb-hostingteaches-yogatemp-dnstheworkpcthingdustdatatownnews-staging"
+    "try-snowplowtrycloudflaretuleap-partnerstypeformunusualpersonvipsinaapp"
+    "vultrobjectswafaicloudwafflecellwiardwebwithgooglewithyoutubewixsite"
+    "woltlab-demoworkisboringwpdevcloudwpenginepoweredwphostedmailwpmucdn"
+    "writesthisblogxnbayyolasitemyforumnognomeatheklogese4metacentrummuni"
+    "realmcommunity-procosidnsdd-dnsddnssdiskussionsbereichdnshomednsupdater"
+    "dray-dnsdraydnsdyn-berlindyn-ip24dyn-vpndynamisches-dnsdyndns1dynvpn"
+    "fruskyfuettertdasnetzgit-reposgoiphome-webserverhs-heilbronnin-berlin"
+    "in-brbin-butterin-dslin-vpninternet-dnsiservschuleisteingeekistmein"
+    "keymachinel-o-g-i-nlcube-serverlebtimnetzleitungsenmein-iservmein-vigor"
+    "my-gatewaymy-routermy-vigormy-wanmyhome-serverschulplattformschulserver"
+    "spdnsspeedpartnersvn-repossyno-dssynology-diskstationsynology-ds"
+    "taifun-dnstest-iservtraeumtgeradeuberspacevirtual-uservirtualuser"
+    "xn--gnstigbestellen-zvbxn--gnstigliefern-wobbssautocodecurvdeno"
+    "deno-staginggatewaygithubpreviewiservlcllclstagelocalcertpagesr2"
+    "shiftcryptostgstgstagewebhareworkerscloudapps123hjemmesideregsldpolsoc"
+    "dappsbasek12ritaipfielibpririikeunsci123miwebcomputediskstationdogado"
+    "mycdwellbeingzonekoobinybostorj123kotisivualandcloudplatformdatacenterdy"
+    "ikikapsixn--hkkinen-5wauser123sitewebaeroportavocatavouesccichambagri"
+    "chirurgiens-dentisteschirurgiens-dentistes-en-francedediboxen-root"
+    "experts-comptablesfbx-osfbxosgeometre-expertgoupilegretahuissier-justice"
+    "medecinnotaireson-webpharmacienportprdveterinaireynhcnpypvtcyakaaspanel"
+    "modxxtranslateusercontentdiscourseguamhraidvsecaasxn--ciqpnxn--gmq050i"
+    "xn--gmqw5axn--lcvr32dxn--mk0axixn--od0aq3bxn--tn0agxn--uc0atvxn--uc0ay4a"
+    "xn--wcvs22dxn--zf0avxcloudaccessfastvpsfreesitehalfmircloudmyfastpcloud"
+    "tempurlwpmudevopencraftfromizpersorel2000agrarbolteroticaerotikahotel"
+    "ingatlanjogaszkonyvelolakasreklamsuliszextozsdeutazasdesaflapforteponpes"
+    "idf5g6gbiharcsdelhidrgengujaratinternetnicupbarrel-of-knowledge"
+    "barrell-of-knowledgednsupdatedvrcamdynamic-dnsfor-ourforumzgroks-the"
+    "groks-thishere-for-moreilovecollegeknowsitallmayfirstnsupdatev-info2038"
+    "apigeeazurecontainerb-databackplaneappbanzaicloudbasicserverbeagleboard"
+    "beebytebeebyteappbigvbitbucketbluebiteboxfusebrowsersafetymarkcleverapps"
+    "dappnodededyndefinimadruddyn53editorxedugitfh-muensterforgerockghost"
+    "githubgitlabhasura-apphostyhostinghzclairlolipopmo-siemensmoonscale"
+    "musicianngroknidnodearton-acornon-k3son-riopantheonsiteprotonetpstmnqcx"
+    "qotoreadthedocsresindeviceresinstagings5ysandcatsshifteditshwspacekit"
+    "stolosthingdustunispaceupliutwentevaporcloudvbrplsbxvirtualserver"
+    "webthingswedeploycupcake123homepage16-b32-b64-babrabruzzoagrigento"
+    "alessandriaalto-adigealtoadigeananconaandria-barletta-trani"
+    "andria-trani-barlettaandriabarlettatraniandriatranibarlettaaosta"
+    "aosta-valleyaostavalleyaosteapaquilaarezzoascoli-picenoascolipicenoasti"
+    "avavellinobalsanbalsan-sudtirolbalsan-suedtirolbaribarletta-trani-andria"
+    "barlettatraniandriabasbasilicatabellunobeneventobergamobiellablbologna"
+    "bolzanobolzano-altoadigebozenbozen-sudtirolbozen-suedtirolbrescia"
+    "brindisibulsanbulsan-sudtirolbulsan-suedtirolcagliaricalabria"
+    "caltanissettacampaniacampidano-mediocampidanomediocampobasso"
+    "carbonia-iglesiascarboniaiglesiascarrara-massacarraramassacasertacatania"
+    "catanzarocbcecesena-forlicesenaforlichieticomocosenzacremonacrotonect"
+    "cuneodell-ogliastradellogliastraemilia-romagnaemiliaromagnaemrenennafcfe"
+    "fermoferrarafgfirenzeflorencefoggiaforli-cesenaforlicesena"
+    "friuli-v-giuliafriuli-ve-giuliafriuli-vegiuliafriuli-venezia-giulia"
+    "friuli-veneziagiuliafriuli-vgiuliafriuliv-giuliafriulive-giulia"
+    "friulivegiuliafriulivenezia-giuliafriuliveneziagiuliafriulivgiulia"
+    "frosinonefvggenoagenovagoriziagrossetoibxosiglesias-carbonia"
+    "iglesiascarboniailiadboxosimperiaiserniala-spezialaquilalaspezialatina"
+    "lazlaziolelecceleccoligligurialivornololodilomlombardialombardylucania"
+    "luccamaceratamantovamarmarchemassa-carraramassacarraramatera"
+    "medio-campidanomediocampidanomessinamimilanmilanomodenamolmolisemonza"
+    "monza-brianzamonza-e-della-brianzamonzabrianzamonzaebrianza"
+    "monzaedellabrianzanaplesnapolineennovaranuoroogliastraolbia-tempio"
+    "olbiatempiooristanootpadovapaduapalermoparmapaviapcpdperugia"
+    "pesaro-urbinopesarourbinopescarapipiacenzapiedmontpiemontepisapistoiapmn"
+    "popordenonepotenzapratopupugpugliapvpzraragusaravennarcreggio-calabria"
+    "reggio-emiliareggiocalabriareggioemiliargririetiriminirmrnromaromerovigo"
+    "salernosarsardegnasardiniasassarisavonasicsiciliasicilysienasiracusa"
+    "sondriospsuedtirolsyncloudtataatarantotetempio-olbiatempioolbiateramo"
+    "ternitimtorinotostoscanatptrani-andria-barlettatrani-barletta-andria"
+    "traniandriabarlettatranibarlettaandriatrapanitrentin-sud-tirol"
+    "trentin-sudtiroltrentin-sued-tiroltrentin-suedtiroltrentino"
+    "trentino-a-adigetrentino-aadigetrentino-alto-adigetrentino-altoadige"
+    "trentino-s-tiroltrentino-stiroltrentino-sud-tiroltrentino-sudtirol"
+    "trentino-sued-tiroltrentino-suedtiroltrentinoa-adigetrentinoaadige"
+    "trentinoalto-adigetrentinoaltoadigetrentinos-tiroltrentinostirol"
+    "trentinosud-tiroltrentinosudtiroltrentinosued-tiroltrentinosuedtirol"
+    "trentinsud-tiroltrentinsudtiroltrentinsued-tiroltrentinsuedtiroltrento"
+    "trevisotriestetsturintuscanyududineumbumbriaurbino-pesarourbinopesaro"
+    "val-d-aostaval-daostavald-aostavaldaostavalle-aostavalle-d-aosta"
+    "valle-daostavalleaostavalled-aostavalledaostavallee-aostevallee-d-aoste"
+    "valleeaostevalleedaostevaovaresevbvdavenvenetoveneziaveniceverbania"
+    "vercelliveronavibo-valentiavibovalentiavicenzaviterbovrvsvtvv"
+    "xn--balsan-sdtirol-nsbxn--bozen-sdtirol-2obxn--bulsan-sdtirol-nsb"
+    "xn--cesena-forl-mcbxn--cesenaforl-i8axn--forl-cesena-fcb"
+    "xn--forlcesena-c8axn--sdtirol-n2axn--trentin-sd-tirol-rzb"
+    "xn--trentin-sdtirol-7vbxn--trentino-sd-tirol-c3bxn--trentino-sdtirol-szb"
+    "xn--trentinosd-tirol-rzbxn--trentinosdtirol-7vbxn--trentinsd-tirol-6vb"
+    "xn--trentinsdtirol-nsbxn--valle-aoste-ebbxn--valle-d-aoste-ehb"
+    "xn--valleaoste-e7axn--valledaoste-ebbaichiakitaangryaomoribabyblue"
+    "babymilkbackdropbambinabitterblushboyboyfriendbutbuyshopcandypopcapoo"
+    "catfoodchibachicappachilloutchipschowderchuciaococottecoolblogcranky"
+    "cutegirldaadecadecidigickegoismehimefakefurfashionstorefemflierfloppy"
+    "foolfrenchkissfukuifukuokafukushimagifugirlfriendgirlygloomygonnagreater"
+    "gunmahaccahandcraftedheavyherhihohippyhiroshimahokkaidoholyhungryhyogo"
+    "ibarakiicurusishikawaitigoiwatejellybeankagawakagoshimakanagawa"
+    "kawaiishopkawasakikikirarakillkilokitakyushukobekochikumamotokuronlg"
+    "littlestarlolipopmclolitapunklomolovepoplovesickmainmiemiyagimiyazaki"
+    "modsmondmongolianmoonaganonagasakinamastenaraniigatanikitanobushinoor"
+    "oitaokayamaoopsparallelparasitepecoripeeweepennepepperpermapigboatpinoko"
+    "punyupupupussycatpyaraindropreadymadesadistsagasaitamasapporoschoolbus"
+    "secretsendaishigashimaneshizuokastabastrippersubsunnydaysupersaletheshop"
+    "thicktochigitokushimatonkotsutottoritoyamaunderuppervelvetverseversus"
+    "vivianwakayamawatsonweblikewhitesnowxn--0trq7p7nnxn--1ctwoxn--1lqs03n"
+    "xn--1lqs71dxn--2m4a15exn--32vp30hxn--4it168dxn--4it797kxn--4pvxs"
+    "xn--5js045dxn--5rtp49cxn--5rtq34kxn--6btw5axn--6orx2rxn--7t0a264c"
+    "xn--8ltr62kxn--8pvr4uxn--c3s14mxn--d5qv7z876cxn--djrs72d6uyxn--djty4k"
+    "xn--efvn9sxn--ehqz56nxn--elqq16hxn--f6qx53axn--k7yn95exn--kbrq7o"
+    "xn--klt787dxn--kltp7dxn--kltx9axn--klty5xxn--mkru45ixn--nit225k"
+    "xn--ntso0iqx3axn--ntsq17gxn--pssu33lxn--qqqt11mxn--rht27zxn--rht3d"
+    "xn--rht61exn--rny31hxn--tor131oxn--uist22hxn--uisz3gxn--uuwu58a"
+    "xn--vgu402cxn--zbx025dyamagatayamaguchiyamanashizombieasspharmacienstra"
+    "busanchungbukchungnamdaegudaejeongangwongwangjugyeongbukgyeonggi"
+    "gyeongnamhsincheonjejujeonbukjeonnamseoululsanembjcloudkazteleportbnrper"
+    "staticoycyondwebmypephlxassngrpomgplcrouterbrasiliac66daplieddnsdnsfor"
+    "edgestackfilegearfilegear-aufilegear-defilegear-gbfilegear-iefilegear-jp"
+    "filegear-sgglitchhoptoi234itslogintolohmusmcdirmcpemydsnohostnoip"
+    "soundcastsynologytcp4transipvp4yombojulabminisiteagricultureairairguard"
+    "alabamaalaskaamberamericanamericanaamericanantiquesamericanartand"
+    "annefrankanthroanthropologyantiquesaquariumarboretumarchaeological"
+    "archaeologyarchitectureartanddesignartcenterartdecoarteducation"
+    "artgalleryartsandcraftsasmatartassassinationassisiastronomyatlantaaustin"
+    "australiaautomotiveaviationaxisbadajozbaghdadbahnbalebaltimorebaselbaths"
+    "bauernbeauxartsbeeldengeluidbellevuebergbauberkeleybernbilbaobillbirdart"
+    "birthplacebonnbotanicalbotanicalgardenbotanicgardenbotany"
+    "brandywinevalleybrasilbristolbritishbritishcolumbiabroadcastbrunel"
+    "brusselbruxellesbuildingburghofbusbusheycadaquescaliforniacambridgecan"
+    "canadacapebretoncarriercartoonartcasadelamonedacastlecastresceltic"
+    "chattanoogacheltenhamchesapeakebaychicagochildrenchildrens"
+    "childrensgardenchiropracticchocolatechristiansburgcincinnaticinemacircus"
+    "civilisationcivilizationcivilwarclintonclockcoalcoastaldefencecody"
+    "coldwarcollectioncolonialwilliamsburgcoloradoplateaucolumbiacolumbus"
+    "communicationcommunicationscomputerhistorycontemporarycontemporaryart"
+    "conventcopenhagencorporationcorvettecostumecountryestatecountycrafts"
+    "cranbrookcreationculturalculturalcenterculturecyberdalidallasdatabaseddr"
+    "decorativeartsdelawaredelmenhorstdenmarkdepotdetroitdinosaurdiscovery"
+    "dollsdonostiadurhameastafricaeastcoasteducationalegyptianeisenbahnelburg"
+    "elvendrellembroideryencyclopedicenglandentomologyenvironment"
+    "environmentalconservationepilepsyessexethnologyexeterexhibition"
+    "farmequipmentfarmsteadfieldfigueresfilateliafineartfineartsfinland"
+    "flandersfloridaforcefortmissoulafortworthfrancaisefrankfurtfranziskaner"
+    "freemasonryfreiburgfribourgfrogfundaciogeelvinckgemologicalgeology"
+    "georgiagiessenglasgorgegrandrapidsgrazguernseyhalloffamehandson"
+    "harvestcelebrationhawaiiheimatunduhrenhellashembygdsforbundheritage"
+    "histoirehistoricalhistoricalsocietyhistorichouseshistorischhistorisches"
+    "historyhistoryofsciencehorologyhumanitiesillustrationimageandsoundindian"
+    "indianaindianapolisindianmarketintelligenceinteractiveiraqironisleofman"
+    "jamisonjeffersonjerusalemjewishjewishartjfkjournalismjudaicajudygarland"
+    "juedischesjuifkaratekarikaturkoebenhavnkunstkunstsammlungkunstunddesign"
+    "laborlabourlajollalancashirelandeslanslarssonlewismillerlinz"
+    "livinghistorylocalhistorylosangeleslouvreloyalistlucerneluxembourgluzern"
+    "madmallorcamanchestermansionmansionsmanxmarburgmaritimemaritimomaryland"
+    "marylhurstmedicalmedizinhistorischesmeeresmesaverdemichiganmidatlantic"
+    "militarymillminersminingminnesotamissilemissoulamodernmomamonmouth"
+    "monticellomontrealmotorcyclemuenchenmuenstermulhousemunciemuseet"
+    "museumcentermuseumverenigingnationalnationalfirearmsnationalheritage"
+    "nativeamericannaturalhistorynaturalhistorymuseumnaturalsciencesnature"
+    "naturhistorischesnatuurwetenschappennaumburgnavalnebraskaneues"
+    "newhampshirenewjerseynewmexiconewportnewspapernewyorkniepcenorfolknorth"
+    "nynyoceanographicoceanographiqueomahaontarioopenairoregonoregontrail"
+    "otagooxfordpacificpaderbornpalacepaleopalmspringspanamapasadena"
+    "philadelphiaphiladelphiaareaphilatelyphoenixpilotspittsburghplanetarium"
+    "plantationplantsplazaportalportlandportlligat"
+    "posts-and-telecommunicationspreservationpresidioprojectpublicpubol"
+    "railroadrailwayresistanceriodejaneirorochesterrockartrussiasaintlouis"
+    "salemsalvadordalisalzburgsandiegosanfranciscosantabarbarasantacruz"
+    "santafesaskatchewansatxsavannahgaschlesischesschoenbrunnschokoladen"
+    "schweizscience-fictionscienceandhistoryscienceandindustrysciencecenter"
+    "sciencecenterssciencehistorysciencessciencesnaturellesscotlandseaport"
+    "settlementsettlerssherbrookesibenikskolesocietysolognesoundandvision"
+    "southcarolinasouthwestspysquarestadtstalbansstarnbergstate"
+    "stateofdelawarestationsteamsteiermarkstjohnstpetersburgstuttgartsuisse"
+    "surgeonshallsurreysvizzeraswedentanktcmtelekommunikationtelevisiontexas"
+    "textiletimetimekeepingtopologytouchtransporttreetrolleytrusteeuhrenulm"
+    "underseausausantiquesusartsuscountryestateuscultureusdecorativearts"
+    "usgardenushistoryushuaiauslivinghistoryutahuvicvalleyvantaaversailles"
+    "villagevirginiavirtualvirtuelvolkenkundewalloniewarwashingtondc"
+    "watch-and-clockwatchandclockwesternwestfalenwhalingwildlifewilliamsburg"
+    "windmillworkshopxn--9dbhblg6dixn--comunicaes-v6a2o"
+    "xn--correios-e-telecomunicaes-ghc29axn--h1aeghxn--lns-qlayorkyorkshire"
+    "yosemiteyouthzoologicalzoologyhisadobeio-staticadobeioruntimeakadns"
+    "akamaiakamai-stagingakamaiedgeakamaiedge-stagingakamaihdakamaihd-staging"
+    "akamaioriginakamaiorigin-stagingakamaizedakamaized-stagingalwaysdata"
+    "appudoat-band-campatlassian-devazure-mobileazurestaticappsazurewebsites"
+    "bar0bar1bar2bitbridgeblackbaudcdnboomlabouncemebroke-itbuyshousescasacam"
+    "cdn-edgescdn77cdn77-sslchannelsdvrclickrisingcloudappcloudfront"
+    "cloudfunctionscloudjiffycloudyclustercryptonomicdebiandnsupdoes-it"
+    "dynathomedynudynv6eating-organicedgeappedgekeyedgekey-stagingedgesuite"
+    "edgesuite-stagingelastxendofinternetfastlyfastlylbfaststacksfeste-ip"
+    "flynnhostingfrom-azfrom-cofrom-lafrom-nygets-itham-radio-ophetemlhicam"
+    "homeftphomeipin-the-bandiobbipifonykicks-asskinghostknx-serverkrellian"
+    "meinforummemsetmyamazemydissentmyeffectmyfritzmymediapcmypsxnhlfan"
+    "now-dnsoffice-on-theonavstackownippgafanpodzoneprivatizehealthinsurance"
+    "redirectmesaveincloudscaleforceschokokeksscrapper-siteseidatsells-it"
+    "senseeringserveblogserveminecraftshopselectsiteleafsrcfstatic-access"
+    "sytest3l3p0rttailscalethruheretorprojecttsukaeruuni5vpndnsvps-host"
+    "yandexcloudalcesarvoazimuthtlonnoticeableothercolcistrondemon"
+    "hosting-clusterkhplayaaaarborteaejrieafjordagdenesakershusaknoluokta"
+    "akrehamnalaheadjualesundalgardalstahaugaltaalvdalamliamotandasuoloandebu"
+    "andoyardalaremarkarendalarnaaseralaskeraskimaskoyaskvollasnesaudnedaln"
+    "aukraaureaurlandaurskog-holandaustevollaustrheimaveroybadaddja"
+    "bahcavuotnabahccavuotnabaidarbajddarbalatbalestrandballangenbalsfjord"
+    "bamblebardubarumbatsfjordbearalvahkibeardubeiarnbergbergenberlevagbievat"
+    "bindalbirkenesbjarkoybjerkreimbjugnbodoboknbomlobremangerbronnoy"
+    "bronnoysundbrumunddalbrynebubudejjubuskerudbyglandbyklecahcesuolo"
+    "davvenjargadavvesiidadeatnudepdielddanuorridivtasvuodnadivttasvuotna"
+    "donnadovredrammendrangedaldrobakdyroyegersundeideidfjordeidsbergeidskog"
+    "eidsvolleigersundelverumenebakkengerdaletneetnedalevenassievenes"
+    "evje-og-hornnesfarsundfauskefedjefetfetsundfhsfinnoyfitjarfjalerfjellfla"
+    "flakstadflatangerflekkefjordflesbergfloraflorofolkebiblfolldalforde"
+    "forsandfosnesfranafredrikstadfreifrognfrolandfrostafroyafuoiskufuossko"
+    "fusafylkesbiblfyresdalgaivuotnagalsagamvikgangaviikagaulargausdal"
+    "giehtavuoatnagildeskalgiskegjemnesgjerdrumgjerstadgjesdalgjovikgloppen"
+    "golgrangranegranvingratangengrimstadgronggruegulenguovdageaidnuhabmer"
+    "hadselhagebostadhaldenhalsahamarhamaroyhammarfeastahammerfesthapmirharam"
+    "hareidharstadhasvikhattfjelldalhaugesundhedmarkhemnehemneshemsedalherad"
+    "hitrahjartdalhjelmelandhobolhofhokksundholholeholmestrandholtalen"
+    "honefosshordalandhornindalhortenhoyangerhoylandethurdalhurumhvaler"
+    "hyllestadibestadidrettinderoyivelandivgujan-mayenjessheimjevnakerjolster"
+    "jondaljorpelandkafjordkarasjohkakarasjokkarlsoykarmoykautokeinokirkenes"
+    "klabukleppkommunekongsbergkongsvingerkopervikkraanghkekragero"
+    "kristiansandkristiansundkrodsheradkrokstadelvakvafjordkvalsundkvam"
+    "kvanangenkvinesdalkvinnheradkviteseidkvitsoylaakesvuemielahppilangevag"
+    "lardallarviklavagislavangenleangaviikalebesbyleikangerleirfjordleirvik"
+    "lekaleksviklenviklerdallesjalevangerlierliernelillehammerlillesandlindas"
+    "lindesnesloabatlodingenloppalorenskoglotenlundlunnerluroylusterlyngdal"
+    "lyngenmalatvuopmimalselvmalvikmandalmarkermarnardalmasfjordenmasoy"
+    "matta-varjjatmelandmeldalmelhusmeloymerakermidsundmidtre-gauldal"
+    "mjondalenmo-i-ranamoarekemodalenmodummoldemore-og-romsdalmosjoenmoskenes"
+    "mossmosvikmuosatnaamesjevuemienamdalseidnamsosnamsskogannannestadnaroy"
+    "narviikanarviknaustdalnavuotnanedre-eikernesnanesoddennesoddtangen"
+    "nessebynessetnissedalnittedalnord-aurdalnord-fronnord-odalnorddal"
+    "nordkappnordlandnordre-landnordreisanore-og-uvdalnotoddennotteroyodda"
+    "oksnesolomasvuotnaoppdaloppegardorkangerorkdalorlandorskogorstaosenoslo"
+    "osoyroosteroyostfoldostre-totenoverhallaovre-eikeroyeroygarden"
+    "oystre-slidreporsangerporsanguporsgrunnraderadoyrahkkeravjuraholtraisa"
+    "rakkestadralingenranarandabergraumarendalenrenneburennesoyrindalringebu"
+    "ringerikeringsakerrisorrissarlroanrodoyrollagromsaromskogrorosrostroyken"
+    "royrvikruovatryggesalangensalatsaltdalsamnangersandefjordsandnes"
+    "sandnessjoensandoysarpsborgsaudasauheradselselbuseljeseljordsfsiellak"
+    "sigdalsiljansirdalskanitskanlandskaunskedsmoskedsmokorsetskienskierva"
+    "skiptvetskjakskjervoyskodjeslattumsmolasnaasesnasasnillfjordsnoasa"
+    "sogndalsognesokndalsolasolundsomnasondre-landsongdalensor-aurdalsor-fron"
+    "sor-odalsor-varangersorfoldsorreisasortlandsorumspjelkavikspydeberg"
+    "stangestatstathellestavangerstavernsteigensteinkjerstjordal"
+    "stjordalshalsenstokkestor-elvdalstordstordalstorfjordstrandstrandastryn"
+    "sulasuldalsundsunndalsurnadalsvalbardsveiosvelviksykkylventanatananger"
+    "telemarktingvolltinntjeldsundtjometokketolgatonsbergtorskentranatranby"
+    "tranoytroandintrogstadtromsatromsotrondheimtrysiltvedestrandtydaltynset"
+    "tysfjordtysnestysvarullensakerullensvangulvikunjargautsiravaapstevadso"
+    "vagavaganvagsoyvaksdalvallevangvanylvenvardovarggatvaroyvefsnvega"
+    "vegarsheivenneslaverdalverranvestbyvestfoldvestnesvestre-slidre"
+    "vestre-totenvestvagoyvevelstadvfvgsvikviknavindafjordvoagatvoldavoss"
+    "vossevangenxn--andy-iraxn--asky-iraxn--aurskog-hland-jnbxn--avery-yua"
+    "xn--bdddj-mrabdxn--bearalvhki-y4axn--berlevg-jxaxn--bhcavuotna-s4a"
+    "xn--bhccavuotna-k7axn--bidr-5nacxn--bievt-0qaxn--bjarky-fya"
+    "xn--bjddar-ptaxn--blt-elabxn--bmlo-graxn--bod-2naxn--brnny-wuac"
+    "xn--brnnysund-m8acxn--brum-voaxn--btsfjord-9zaxn--davvenjrga-y4a"
+    "xn--dnna-graxn--drbak-wuaxn--dyry-iraxn--eveni-0qa01gaxn--finny-yua"
+    "xn--fjord-lraxn--fl-ziaxn--flor-jraxn--frde-graxn--frna-woaxn--frya-hra"
+    "xn--ggaviika-8ya47hxn--gildeskl-g0axn--givuotna-8yaxn--gjvik-wua"
+    "xn--gls-elacxn--h-2faxn--hbmer-xqaxn--hcesuolo-7ya35bxn--hgebostad-g3a"
+    "xn--hmmrfeasta-s4acxn--hnefoss-q1axn--hobl-iraxn--holtlen-hxa"
+    "xn--hpmir-xqaxn--hyanger-q1axn--hylandet-54axn--indery-fyaxn--jlster-bya"
+    "xn--jrpeland-54axn--karmy-yuaxn--kfjord-iuaxn--klbu-woa"
+    "xn--koluokta-7ya57hxn--krager-gyaxn--kranghke-b0axn--krdsherad-m8a"
+    "xn--krehamn-dxaxn--krjohka-hwab49jxn--ksnes-uuaxn--kvfjord-nxa"
+    "xn--kvitsy-fyaxn--kvnangen-k0axn--l-1faxn--laheadju-7yaxn--langevg-jxa"
+    "xn--ldingen-q1axn--leagaviika-52bxn--lesund-huaxn--lgrd-poac"
+    "xn--lhppi-xqaxn--linds-praxn--loabt-0qaxn--lrdal-sraxn--lrenskog-54a"
+    "xn--lt-liacxn--lten-graxn--lury-iraxn--mely-iraxn--merker-kua"
+    "xn--mjndalen-64axn--mlatvuopmi-s4axn--mli-tlaxn--mlselv-iua"
+    "xn--moreke-juaxn--mosjen-eyaxn--mot-tlaxn--mre-og-romsdal-qqb"
+    "xn--msy-ula0hxn--mtta-vrjjat-k7afxn--muost-0qaxn--nmesjevuemie-tcba"
+    "xn--nry-yla5gxn--nttery-byaexn--nvuotna-hwaxn--oppegrd-ixaxn--ostery-fya"
+    "xn--osyro-wuaxn--porsgu-sta26fxn--rady-iraxn--rdal-poaxn--rde-ula"
+    "xn--rdy-0nabxn--rennesy-v1axn--rhkkervju-01afxn--rholt-mraxn--risa-5na"
+    "xn--risr-iraxn--rland-uuaxn--rlingen-mxaxn--rmskog-byaxn--rros-gra"
+    "xn--rskog-uuaxn--rst-0naxn--rsta-fraxn--ryken-vuaxn--ryrvik-byaxn--s-1fa"
+    "xn--sandnessjen-ogbxn--sandy-yuaxn--seral-lraxn--sgne-graxn--skierv-uta"
+    "xn--skjervy-v1axn--skjk-soaxn--sknit-yqaxn--sknland-fxaxn--slat-5na"
+    "xn--slt-elabxn--smla-hraxn--smna-graxn--snase-nraxn--sndre-land-0cb"
+    "xn--snes-poaxn--snsa-roaxn--sr-aurdal-l8axn--sr-fron-q1axn--sr-odal-q1a"
+    "xn--sr-varanger-ggbxn--srfold-byaxn--srreisa-q1axn--srum-gra"
+    "xn--stfold-9xaxn--stjrdal-s1axn--stjrdalshalsen-sqbxn--stre-toten-zcb"
+    "xn--tjme-hraxn--tnsberg-q1axn--trany-yuaxn--trgstad-r1axn--trna-woa"
+    "xn--troms-zuaxn--tysvr-vraxn--unjrga-rtaxn--vads-jraxn--vard-jra"
+    "xn--vegrshei-c0axn--vestvgy-ixa6oxn--vg-yiabxn--vgan-qoaxn--vgsy-qoa0j"
+    "xn--vre-eiker-k8axn--vrggt-xqadxn--vry-yla5gxn--yer-znaxn--ygarden-p1a"
+    "xn--ystre-slidre-ujbenterprisecloudmerseinemineshacknetgeekgovtiwimaori"
+    "parliamentxn--mori-qsahomelinkonredserviceeeroeero-stageaccesscam"
+    "altervistaamuneblogsitebmoattachmentsboldlygoingnowherecable-modemcamdvr"
+    "cdn77-securecertmgrcollegefancouchpotatofriesduckdnsdvrdnsdynserv"
+    "endoftheinternetfedorainfracloudfedorapeoplefedoraprojectfreeddns"
+    "freedesktopfrom-megame-hosthepforgehomednshttpbinis-a-bruinsfan"
+    "is-a-candidateis-a-celticsfanis-a-knightis-a-linux-useris-a-patsfan"
+    "is-a-soxfanis-foundis-lostis-savedis-very-badis-very-evilis-very-good"
+    "is-very-niceis-very-sweetmisconfusedmlbfanmozilla-iotmy-firewall"
+    "myfirewallmywirenflfanpimientapoivronpotagerpubtlsread-booksreadmyblog"
+    "sellsyourhomesmall-webstuff-4-salesweetpepperteckidstoolforgetunk"
+    "tuxfamilyufcfanwebredirectwmcloudwmflabszaptonerdpolabocodeberghlx3"
+    "magnetpdnspleskprvcyrockytranslated1337famgokgongosaidatmaugustow"
+    "babia-gorabedzinbeepbeskidybialowiezabialystokbielawabieszczady"
+    "boleslawiecbydgoszczbytomcieszynczeladzczestdlugolekaecommerce-shop"
+    "elblagelkgdagdanskgdyniagliwiceglogowgminagnieznogorlicegrajewogsm"
+    "homesklepilawajaworznojelenia-gorajgorakaliszkarpaczkartuzykaszuby"
+    "katowicekazimierz-dolnykepnoketrzynklodzkokobierzycekolobrzegkonin"
+    "konskowolakrakowkrasnikkutnolapyleborklecznalegnicalezajsklimanowalomza"
+    "lowiczlubartowlubinlublinlukowmailmalborkmalopolskamazowszemazurymiasta"
+    "mielecmielnomragowonaklonieruchomoscinowarudanysaolawaoleckoolkusz"
+    "olsztynopocznoopoleostrodaostrolekaostrowiecostrowwlkppilapiszpodhale"
+    "podlasiepolkowicepomorskiepomorzeponiatowapowiatpoznanprochowicepruszkow"
+    "przeworskpulawyradomrawa-mazrybnikrzeszowsanoksdscloudsejnyshoparena"
+    "sklepskoczowslaskslupsksopotsossosnowiecstalowa-wolastarachowicestargard"
+    "suwalkiswidnicaswidnikswiebodzinswinoujscieszczecinszczytnoszkolatargi"
+    "tarnobrzegtgoryturekturystykatychyunicloudustkawalbrzychwarmiawarszawa"
+    "wawwegrowwielunwloclwloclawekwodzislawwolominwrocwroclawzachpomorzagan"
+    "zakopanezarowzgorazgorzelecownindieestislaacaacctdnstracejurrechtplosec"
+    "123paginawebpublbelaux443clanmyddnswebspacebrendlyox123saitadygeya"
+    "bashkiriabircbgcldmaildagestaneurodirgroznykalmykiakustanailk3marine"
+    "mcpremordoviamskmyjinomytisna4unalchiknovpyatigorskrasregruhostingspb"
+    "testvladikavkazvladimirdevelopmentmigrationonporterservers123minsida"
+    "brandfhfhskfhviopsysitcouldbeworkomforbkommunalforbundkomvuxlanbib"
+    "naturbruksgymnpabapartienscaledbiphashbangplatformvxlhoplixgitappgitpage"
+    "byenclouderafnwkfolionetworkleluxminterenovecoreomniweopensocial"
+    "platformshsrhttstdiheruberxs4allconsuladoembaixadanohoprincipesaotome"
+    "sellfyshopwarestorebaseabkhaziaaktyubinskarkhangelskarmeniaashgabad"
+    "azerbaijanbalashovbryanskbukharachimkenteast-kazakhstanexnetivanovo"
+    "jambylkalugakaracolkaragandakareliakhakassiakrasnodarkurganlenug"
+    "mangyshlakmurmansknavoinorth-kazakhstanobninskpenzapokrovsksochitashkent"
+    "termeztogliattitroitsktselinogradtulatuvavologdaknightpointensintlmincom"
+    "natorangecloud611nyanoyardvvpnplusprequalifymentdllbbsbelkeptsk"
+    "better-thanon-the-webworse-thanebizurlxn--czrw28bxn--zf0ao64acherkassy"
+    "cherkasychernigovchernihivchernivtsichernovtsycrimeadndnepropetrovsk"
+    "dnipropetrovskdonetskdpifivano-frankivskkharkivkharkovkherson"
+    "khmelnitskiykhmelnytskyikievkirovogradkrymkskvkyivlugansklutsklviv"
+    "mykolaivnikolaevododesaodessapoltavarivnerovnorvsebastopolsevastopolsumy"
+    "ternopiluzhgorodvinnicavinnytsiavolynyaltazaporizhzhezaporizhzhia"
+    "zhitomirzhytomyrzpztconncoprohospindependent-commission"
+    "independent-inquestindependent-inquiryindependent-panel"
+    "independent-reviewnhspolicepublic-inquirypymntroyal-commissionakdcdnifed"
+    "flgolffangraphoxiais-byisaland-4-salendnhnjnsnnvnyohokplatterppointtotx"
+    "utwiwvwygub0ee12raradvisorcloud66mypetsxn--4dbgdty6cxn--5dbhl8d"
+    "xn--8dbq2axn--hebda8bxn--80auxn--90azhxn--d1atxn--o1acxn--o1ach"
+    "xn--12c1fe0brxn--12cfi8ixb8lxn--12co0c3b4evaxn--h3cuzk1dixn--m3ch0j3a"
+    "xn--o3cyx2axn--41axn--80aaa0cvacxn--90a1afxn--90amcxn--h1ahnxn--h1aliz"
+    "xn--j1adpxn--j1ael8bcraftinglocalzoneagricaltgrondarnislimatriton"
+    "privatelinksthexkundencloudletsezproxyvirtualclouddfrjrruiinstancessvc"
+    "appenginees-1arubait1baremetalfr-park8snl-amspl-wawscalebook"
+    "smartlabelingaf-south-1ap-east-1ap-northeast-1ap-northeast-2"
+    "ap-northeast-3ap-south-1ap-southeast-1ap-southeast-2ca-central-1"
+    "compute-1elbeu-central-1eu-north-1eu-south-1eu-west-1eu-west-2eu-west-3"
+    "me-south-1s3s3-ap-northeast-1s3-ap-northeast-2s3-ap-south-1"
+    "s3-ap-southeast-1s3-ap-southeast-2s3-ca-central-1s3-eu-central-1"
+    "s3-eu-west-1s3-eu-west-2s3-eu-west-3s3-external-1s3-fips-us-gov-west-1"
+    "s3-sa-east-1s3-us-east-2s3-us-gov-west-1s3-us-west-1s3-us-west-2"
+    "s3-website-ap-northeast-1s3-website-ap-southeast-1"
+    "s3-website-ap-southeast-2s3-website-eu-west-1s3-website-sa-east-1"
+    "s3-website-us-east-1s3-website-us-west-1s3-website-us-west-2sa-east-1"
+    "us-east-1us-east-2us-west-1us-west-2alphabetabuilderdev-builder"
+    "stg-builderociocpocsdemoinstanceus-gov-west-1eu-1eu-2eu-3eu-4us-1us-2"
+    "us-3us-4appspaasrag-cloudrag-cloud-chjcloud-ver-jpccnsmembers"
+    "nodebalanceripcaracalcustomerfentigerlynxocelotoncillaonzasphinxyalixen"
+    "apijedlonrydu2u2-localcustomdynbzzgit-pagesdaemonrssravpagetabitorder"
+    "backyardssekd1uk0stagemocksysdevicesdisrectestingcloud-fr1jcaisaiamaanjo"
+    "asukechiryuchitafusogamagorihandahazuhekinanhigashiuraichinomiyainazawa"
+    "inuyamaisshikiiwakurakaniekariyakasugaikirakiyosukomakikonankotamihama"
+    "miyoshinishionisshinobuoguchioharuokazakiowariasahisetoshikatsushinshiro"
+    "shitarataharatakahamatobishimatoeitogotokaitokonametoyoaketoyohashi"
+    "toyokawatoyonetsushimayatomidaisenfujisatogojomehachirogatahappou"
+    "higashinarusehonjohonjyoikawakamikoanikamiokakatagamikazunokitaakita"
+    "kosakakyowamisatomitanemoriyoshinikahonoshiroodateogaogatasembokuyokote"
+    "yurihonjogonohehachinohehashikamihiranaihirosakiitayanagikuroishimisawa"
+    "mutsunakadomarinohejioiraseowanirokunohesannoheshichinoheshingotakko"
+    "towadatsugarutsurutaabikoasahichonanchoseichoshichuofunabashifuttsu"
+    "hanamigawaichiharaichikawainzaiisumikamagayakamogawakashiwakatori"
+    "katsuurakimitsukisarazukozakikujukurikyonanmatsudomidoriminamibosomobara"
+    "mutsuzawanagaranagareyamanarashinonaritanodaoamishirasatoomigawaonjuku"
+    "otakisakaeshimofusashirakoshiroishisuisodegaurasosatakotateyamatogane"
+    "tohnoshotomisatourayasuyachimatayachiyoyokaichibayokoshibahikari"
+    "yotsukaidoainanhonaiikataimabariiyokamijimakihokukumakogenmasakimatsuno"
+    "matsuyamanamikataniihamaozusaijoseiyoshikokuchuotobetoonuchikouwajima"
+    "yawatahamaechizeneiheijiikedakatsuyamaminamiechizenobamaohionosabaesakai"
+    "tsurugawakasaashiyabuzenchikugochikuhochikujochikushinochikuzendazaifu"
+    "fukuchihakatahigashihirokawahisayamaiizukainatsukikahokasugakasuyakawara"
+    "keisenkogakuratekurogikurumeminamimiyakomiyamamiyawakamizumakimunakata"
+    "nakagawanakamanishinogataogoriokagakiokawaokiomutaongaonojootosaigawa"
+    "sasagurishingushinyoshitomishonaisoedasuetachiaraitagawatakatatoho"
+    "toyotsutsuikiukihaumiusuiyamadayameyanagawayukuhashiaizubangeaizumisato"
+    "aizuwakamatsuasakawabandaifurudonofutabahanawahiratahironoiitate"
+    "inawashiroiwakiizumizakikagamiishikaneyamakawamatakitakatakitashiobara"
+    "koorikoriyamakunimimiharumishimanamienangonishiaizunishigookumaomotego"
+    "otamasamegawashimogoshirakawashowasomasukagawataishintamakawatanagura"
+    "teneiyabukiyamatoyamatsuriyanaizuyugawaanpachienaginangodogujohashima"
+    "hichisohidahigashishirakawaibigawakakamigaharakanikasaharakasamatsu"
+    "kawauekitagataminominokamomitakemizunamimotosunakatsugawaogakisakahogi"
+    "sekisekigaharatajimitakayamataruitokitomikawanouchiyaotsuyoroannaka"
+    "chiyodafujiokahigashiagatsumaisesakiitakurakannakanrakatashinakawaba"
+    "kiryukusatsumaebashimeiwaminakaminaganoharanakanojonanmokunumataoizumi"
+    "oraotashibukawashimonitashintotakasakitamamuratatebayashitomioka"
+    "tsukiyonotsumagoiuenoyoshiokaasaminamidaiwaetajimafuchufukuyama"
+    "hatsukaichihigashihiroshimahongojinsekikogenkaitakuikumanokuremiharanaka"
+    "onomichiosakikamijimaotakesakaseraseranishishinichishobaratakehara"
+    "abashiriabiraaibetsuakabiraakkeshiasahikawaashibetsuashoroassabuatsuma"
+    "bibaibieibifukabihorobiratorichippubetsuchitoseebetsuembetsueniwaerimo"
+    "esanesashifukagawafuranofurubirahaborohakodatehamatonbetsuhidaka"
+    "higashikagurahigashikawahiroohokuryuhokutohonbetsuhorokanaihoronobe"
+    "imakaneishikariiwamizawaiwanaikamifuranokamikawakamishihorokamisunagawa"
+    "kamoenaikayabekembuchikikonaikimobetsukitahiroshimakitamikiyosato"
+    "koshimizukunneppukuriyamakuromatsunaikushirokutchanmashikematsumaemikasa"
+    "minamifuranomombetsumoseushimukawamurorannaienakasatsunainakatombetsu"
+    "nanaenanporonayoronemuroniikappunikinishiokoppenoboribetsuobihiroobira"
+    "oketookoppeotaruotobeotofukeotoineppuoumuozorapippurankoshirebun"
+    "rikubetsurishiririshirifujisaromasarufutsushakotansharishibechashibetsu"
+    "shikabeshikaoishimamakishimizushimokawashinshinotsushintokushiranuka"
+    "shiraoishiriuchisobetsusunagawataikitakasutakikawatakinoueteshikaga"
+    "tobetsutohmatomakomaitomaritoyatoyakotoyotomitoyouratsubetsutsukigata"
+    "urakawaurausuuryuutashinaiwakkanaiwassamuyakumoyoichiaioiakashiako"
+    "amagasakiaogakiasagoawajifukusakigoshikiharimahimejiinagawaitamikakogawa"
+    "kamigorikasaikawanishimikiminamiawajinishinomiyanishiwakisandasannan"
+    "sasayamasayoshinonsenshisosumototaishitakatakarazukatakasagotakinotamba"
+    "tatsunotoyookayabuyashiroyokayokawaamibandochikuseidaigofujishiro"
+    "hitachinakahitachiomiyahitachiotainainashikiitakoiwamajosokamisukasama"
+    "kashimakasumigauramihomitomoriyanamegataoaraiogawaomitamaryugasaki"
+    "sakuragawashimodateshimotsumashirosatosowasuifutakahagitamatsukuritomobe"
+    "tonetoridetsuchiuratsukubauchiharaushikuyawarayukianamizuhakuihakusan"
+    "kagakahokukanazawakawakitanakanotonanaonominonoichinotoshikasuzutsubata"
+    "tsurugiuchinadawajimafudaifujisawahanamakihiraizumiichinoheichinoseki"
+    "iwaizumijobojikamaishikanegasakikarumaikawaikitakamikujikunohekuzumaki"
+    "mizusawamoriokaninoheofunatooshuotsuchirikuzentakatashiwashizukuishi"
+    "sumitatanohatatonoyahabaayagawahigashikagawakanonjikotohiramannomarugame"
+    "mitoyonaoshimasanukitadotsutakamatsutonoshouchinomiutazuzentsujiakune"
+    "amamihiokiisenizumikanoyakawanabekinkokouyamamakurazakimatsumoto"
+    "minamitanenakatanenishinoomotesatsumasendaisootarumizuyusuiaikawaatsugi"
+    "ayasechigasakiebinahadanohakonehiratsukaiseharakaiseikamakurakiyokawa"
+    "matsudaminamiashigaramiuranakaininomiyaodawaraoioisosagamiharasamukawa"
+    "tsukuiyamakitayokosukayugawarazamazushiakigeiseihigashitsunoinokagami"
+    "kamikitagawamotoyamamurotonaharinakamuranankokunishitosaniyodogawaochi"
+    "otoyootsukisakawasukumosusakitosatosashimizutoyotsunoumajiyasudayusuhara"
+    "amakusaaraoasochoyogyokutokamiamakusakikuchimashikimifuneminamata"
+    "minamioguninagasunishiharaogunitakamoriukiutoyamagayatsushiroayabe"
+    "fukuchiyamahigashiyamaideinejoyokameokakamokitakizukumiyamakyotamba"
+    "kyotanabekyotangomaizuruminamiyamashiromiyazumukonagaokakyonakagyonantan"
+    "oyamazakisakyoseikatanabeujiujitawarawazukayamashinayawatainabeise"
+    "kameyamakawagoekihokisosakikiwakomonokuwanamatsusakaminamiisemisugi"
+    "nabarishimasuzukatadotakitamakitobatsuudonoureshinowataraiyokkaichi"
+    "furukawahigashimatsushimaishinomakiiwanumakakudamarumorimatsushima"
+    "minamisanrikumuratanatoriogawaraohiraonagawaosakirifusemineshibata"
+    "shichikashukushikamashiogamashiroishitagajotaiwatometomiyawakuyawatari"
+    "yamamotozaoayaebinogokasehyugakadogawakawaminamikijokitaurakobayashi"
+    "kunitomikushimamimatamiyakonojomorotsukanichinannishimeranobeokasaito"
+    "shiibashintomitakaharutakanabetakazakiachiagematsuananaokiazumino"
+    "chikuhokuchikumachinofujimihakubaharahirayaiidaiijimaiiyamaiizunaikusaka"
+    "karuizawakawakamikisokisofukushimakitaaikikomaganekomoromatsukawamiasa"
+    "minamiaikiminamimakiminamiminowaminowamiyadamiyotamochizukinagawanagiso"
+    "nakanonozawaonsenobuseokayaomachiomiookuwaooshikaotarisakakisakusakuho"
+    "shimosuwashinanomachishiojirisuwasuzakatakagitateshinatogakushitogura"
+    "tomiuedawadayamanouchiyasakayasuokachijiwafutsugotohasamihiradoisahaya"
+    "kawatanakuchinotsumatsuuraomuraosetosaikaisaseboseihishimabara"
+    "shinkamigototogitsuunzenandogosehegurihigashiyoshinoikarugaikoma"
+    "kamikitayamakanmakikashibakashiharakatsuragikoryokurotakimitsuemiyake"
+    "nosegawaojioudaoyodosakuraisangoshimoichishimokitayamashinjosonitakatori"
+    "tawaramototenkawatenriudayamatokoriyamayamatotakadayamazoeyoshinoaseinet"
+    "gehirnagaaganogosenitoigawaizumozakijoetsukariwakashiwazakiminamiuonuma"
+    "mitsukemuikamurakamimyokonagaokaojiyasadosanjoseiroseirousekikawatagami"
+    "tainaitochiotokamachitsubametsunanuonumayahikoyoitayuzawabeppubungoono"
+    "bungotakadahasamahijihimeshimahitakamitsuekokonoekujukunisakikususaiki"
+    "taketatsukumiusukiyufuakaiwaasakuchibizenhayashimaibarakagaminokasaoka"
+    "kibichuokumenankurashikimaniwamisakinaginiiminishiawakurasatoshosetouchi"
+    "shoosojatakahashitamanotsuyamawakeyakageaguniginowanginozagushikami"
+    "haebaruhiraraiheyaishigakiitomanizenakadenakinkitadaitokitanakagusuku"
+    "kumejimakunigamiminamidaitomotobunagonahanakagusukunakijinnanjoogimionna"
+    "shimojitaketomitaramatokashikitomigusukutonakiurasoeurumayaeseyomitan"
+    "yonabaruyonagunizamamiabenochihayaakasakadaitofujiiderahabikinohannan"
+    "higashiosakahigashisumiyoshihigashiyodogawahirakataizumiotsuizumisano"
+    "kadomakaizukakanankashiwarakatanokawachinaganokishiwadakumatorimatsubara"
+    "minatominohmoriguchineyagawanoseosakasayamasayamasennansettsushijonawate"
+    "shimamotosuitatadaokatajiritakaishitakatsukitondabayashitoyonakatoyono"
+    "yaoariakearitafukudomigenkaihamatamahizenimarikamiminekanzakikaratsu"
+    "kitahatakiyamakouhokukyuraginishiaritaogiouchitakutaratosuyoshinogari"
+    "arakawaasakachichibufujiminofukayahannohanyuhasudahatogayahatoyama"
+    "higashichichibuhigashimatsuyamairumaiwatsukikamiizumikamisatokasukabe"
+    "kawaguchikawajimakazokitamotokoshigayakounosukukikumagayamatsubushi"
+    "minanomiyashiromoroyamanagatoronamegawaniizaoganoogoseokegawaomiyaranzan"
+    "ryokamisakadosatteshikishiraokasokasugitotodatokigawatokorozawa"
+    "tsurugashimaurawawarabiyashioyokozeyonoyoriiyoshidayoshikawayoshimiaisho"
+    "gamohigashiomihikonekokakoseikotomaibaramoriyamanagahamanishiazai"
+    "notogawaomihachimanotsurittoryuohtakashimatorahimetoyosatoyasuakagigotsu"
+    "hamadahigashiizumohikawahikimiizumokakinokimasudamatsuenishinoshimaohda"
+    "okinoshimaokuizumotamayutsuwanounnanyasugiyatsukaaraiatamifujifujieda"
+    "fujikawafujinomiyafukuroigotembahaibarahamamatsuhigashiizuitoiwataizu"
+    "izunokunikakegawakannamikawanehonkawazukikugawakosaimakinoharamatsuzaki"
+    "minamiizumorimachinishiizunumazuomaezakishimadashimodasusonoyaizu"
+    "ashikagabatohagaichikaiiwafunekaminokawakanumakarasuyamakuroisomashiko"
+    "mibumokamoteginasunasushiobaranikkonishikatanogiohtawaraoyamasano"
+    "shimotsukeshioyatakanezawatsugaujiieutsunomiyayaitaaizumiichibaitano"
+    "kainankomatsushimamatsushigemimamuginarutosanagochishishikuiwajikiadachi"
+    "akirunoakishimaaogashimabunkyochofuedogawafussahachijohachiojihamura"
+    "higashikurumehigashimurayamahigashiyamatohinohinodehinoharainagiitabashi"
+    "katsushikakiyosekodairakoganeikokubunjikomaekouzushimakunitachimachida"
+    "meguromitakamizuhomusashimurayamamusashinonerimaogasawaraokutamaome"
+    "oshimasetagayashibuyashinagawashinjukusuginamisumidatachikawataitotama"
+    "toshimachizukawaharakogekotouramisasananbusakaiminatoyazuyonagofukumitsu"
+    "funahashihimiimizuinamijohanakamiichikurobenakaniikawanamerikawananto"
+    "nyuzenoyabetairatakaokatogatonamiunazukiuozuaridaaridagawagobohashimoto"
+    "hirogawaiwadekamitondakiminokinokawakitayamakoyakozakozagawakudoyama"
+    "kushimotonachikatsuurashirahamataijiyuasayurafunagatahigashineiide"
+    "kaminoyamamamurogawamikawamurayamanagainakayamananyonishikawaobanazawaoe"
+    "ohkuraoishidasagaesakatasakegawashiratakatakahatatendotozawatsuruoka"
+    "yamanobeyonezawayuzaabuhagihikarihofuiwakunikudamatsumitounagato"
+    "shimonosekishunantabusetokuyamaubeyuudoshifuefukifujikawaguchiko"
+    "fujiyoshidahayakawaichikawamisatokaikofukoshukosugeminami-alpsminobu"
+    "nakamichinarusawanirasakinishikatsuraoshinotabayamatsuruuenohara"
+    "yamanakakoupaassiteslocalhostforgotcentraluseastasiaeastus2westeurope"
+    "westus2fra1-dewest1-usjls-sto1jls-sto2jls-sto3freetlssslwebpaas"
+    "nordeste-idcnesosvalerxn--vler-qoaheroysandexn--b-5gaxn--hery-irastaging"
+    "telerscoriginhomeq-agriwickmpspkonsulatkppspkwpkwpspmupoirmoumpinbpiwpsp"
+    "pssepuprzgwsdnskostarostwougimumumigupowuppouwuzswifwiihwinbwioswitdwiw"
+    "wsawskrwuozwzmiuwbcivpslandingspectrumentmymaileradimobytemarklayershift"
+    "nh-servretrosnubcampaignhomeofficeaffinitylotteryglugluglugsraffleentry"
+    "weeklylotteryphxann-arborcogdsteatonwashtenawmelschoolsscalealp1eur"
+    "fr-par-1fr-par-2nl-ams-1fncs3-websitewhmcn-north-1ebcloud9dualstackflt"
+    "usrcustcdnfr-1lon-1lon-2ny-1ny-2sg-1atlnjsricdhvmchtrparochusers"
+    "functionsnodescn-northwest-1vfswebview-assets";
+
+const Node kNodes[] = {
+  {0, 0, 0, 1490, 1}, {0, 3, 1, 0, 0}, {3, 4, 1, 0, 0}, {7, 6, 1, 0, 0},
+  {13, 3, 1, 0, 0}, {16, 6, 1, 0, 0}, {22, 6, 1, 0, 0}, {28, 3, 1, 0, 0},
+  {31, 4, 1, 0, 0}, {35, 7, 1, 0, 0}, {42, 8, 1, 0, 0}, {50, 2, 1, 7, 1491},
+  {52, 7, 1, 1, 1498}, {59, 9, 1, 0, 0}, {68, 10, 1, 0, 0}, {78, 11, 1, 0, 0},
+  {89, 3, 1, 0, 0}, {92, 5, 1, 0, 0}, {97, 2, 1, 1, 1499}, {99, 3, 1, 0, 0},
+  {102, 5, 1, 0, 0}, {107, 2, 1, 8, 1500}, {109, 3, 1, 0, 0},
+  {112, 4, 1, 86, 1508}, {116, 5, 1, 0, 0}, {121, 2, 1, 5, 1594},
+  {123, 3, 1, 0, 0}, {126, 6, 1, 0, 0}, {132, 2, 1, 5, 1599}, {134, 7, 1, 0, 0},
+  {141, 6, 1, 0, 0}, {147, 2, 1, 5, 1604}, {149, 3, 1, 0, 0}, {152, 6, 1, 0, 0},
+  {158, 8, 1, 0, 0}, {166, 6, 1, 0, 0}, {172, 4, 1, 0, 0}, {176, 2, 1, 7, 1609},
+  {178, 9, 1, 0, 0}, {187, 7, 1, 0, 0}, {194, 6, 1, 0, 0}, {200, 9, 1, 0, 0},
+  {209, 8, 1, 0, 0}, {217, 4, 1, 0, 0}, {221, 6, 1, 0, 0}, {227, 6, 1, 0, 0},
+  {233, 2, 1, 9, 1616}, {235, 6, 1, 0, 0}, {241, 15, 1, 0, 0},
+  {256, 14, 1, 0, 0}, {270, 4, 1, 0, 0}, {274, 5, 1, 0, 0}, {279, 5, 1, 0, 0},
+  {284, 9, 1, 0, 0}, {293, 9, 1, 0, 0}, {302, 7, 1, 0, 0}, {309, 6, 1, 0, 0},
+  {315, 3, 1, 0, 0}, {318, 2, 1, 6, 1625}, {320, 3, 1, 0, 0},
+  {323, 10, 1, 0, 0}, {333, 3, 1, 28, 1631}, {336, 5, 1, 0, 0},
+  {341, 2, 1, 0, 0}, {343, 9, 1, 0, 0}, {352, 2, 1, 14, 1659},
+  {354, 4, 1, 0, 0}, {358, 6, 1, 0, 0}, {364, 5, 1, 0, 0}, {369, 4, 1, 0, 0},
+  {373, 4, 1, 6, 1673}, {377, 3, 1, 0, 0}, {380, 4, 1, 0, 0},
+  {384, 2, 1, 1, 1679}, {386, 4, 1, 0, 0}, {390, 4, 1, 1, 1680},
+  {394, 10, 1, 0, 0}, {404, 2, 1, 18, 1681}, {406, 7, 1, 0, 0},
+  {413, 8, 1, 0, 0}, {421, 2, 1, 18, 1699}, {423, 7, 1, 0, 0},
+  {430, 4, 1, 0, 0}, {434, 7, 1, 0, 0}, {441, 5, 1, 0, 0}, {446, 7, 1, 0, 0},
+  {453, 6, 1, 0, 0}, {459, 4, 1, 0, 0}, {463, 5, 1, 0, 0}, {468, 7, 1, 0, 0},
+  {475, 2, 1, 1, 1717}, {477, 3, 1, 0, 0}, {480, 2, 1, 8, 1718},
+  {482, 3, 1, 0, 0}, {485, 2, 1, 12, 1726}, {487, 5, 1, 0, 0},
+  {492, 2, 1, 8, 1738}, {494, 4, 1, 0, 0}, {498, 5, 1, 0, 0}, {503, 7, 1, 0, 0},
+  {510, 14, 1, 0, 0}, {524, 4, 1, 0, 0}, {528, 4, 1, 0, 0}, {532, 3, 1, 0, 0},
+  {535, 9, 1, 0, 0}, {544, 11, 1, 0, 0}, {555, 8, 1, 0, 0}, {563, 8, 1, 0, 0},
+  {571, 8, 1, 0, 0}, {579, 8, 1, 0, 0}, {587, 10, 1, 2, 1746},
+  {597, 7, 1, 0, 0}, {604, 6, 1, 0, 0}, {610, 2, 1, 10, 1748},
+  {612, 3, 1, 0, 0}, {615, 3, 1, 0, 0}, {618, 4, 1, 0, 0}, {622, 3, 1, 0, 0},
+  {625, 3, 1, 0, 0}, {628, 2, 2, 0, 0}, {630, 2, 1, 8, 1758}, {632, 5, 1, 0, 0},
+  {637, 6, 1, 0, 0}, {643, 4, 1, 0, 0}, {647, 7, 1, 0, 0}, {654, 6, 1, 0, 0},
+  {660, 4, 1, 0, 0}, {664, 7, 1, 0, 0}, {671, 3, 1, 0, 0}, {674, 2, 1, 1, 1766},
+  {676, 2, 1, 38, 1767}, {678, 2, 1, 5, 1805}, {680, 6, 1, 0, 0},
+  {686, 2, 1, 5, 1810}, {688, 5, 1, 0, 0}, {693, 3, 1, 0, 0}, {696, 4, 1, 0, 0},
+  {700, 4, 1, 0, 0}, {704, 5, 1, 0, 0}, {709, 3, 1, 0, 0},
+  {712, 3, 1, 15, 1815}, {715, 2, 1, 21, 1830}, {717, 5, 1, 0, 0},
+  {722, 11, 1, 0, 0}, {733, 11, 1, 0, 0}, {744, 4, 1, 0, 0}, {748, 9, 1, 0, 0},
+  {757, 4, 1, 0, 0}, {761, 2, 1, 5, 1851}, {763, 3, 1, 0, 0}, {766, 3, 1, 0, 0},
+  {769, 2, 1, 6, 1856}, {771, 10, 1, 0, 0}, {781, 2, 1, 41, 1862},
+  {783, 5, 1, 0, 0}, {788, 10, 1, 0, 0}, {798, 4, 1, 0, 0}, {802, 3, 1, 0, 0},
+  {805, 4, 1, 0, 0}, {809, 3, 1, 0, 0}, {812, 4, 1, 0, 0}, {816, 7, 1, 0, 0},
+  {823, 5, 1, 0, 0}, {828, 6, 1, 0, 0}, {834, 6, 1, 0, 0}, {840, 3, 1, 0, 0},
+  {843, 8, 1, 0, 0}, {851, 3, 1, 0, 0}, {854, 2, 1, 141, 1903},
+  {856, 8, 1, 0, 0}, {864, 11, 1, 0, 0}, {875, 8, 1, 0, 0}, {883, 6, 1, 0, 0},
+  {889, 7, 1, 0, 0}, {896, 8, 1, 0, 0}, {904, 2, 1, 6, 2044},
+  {906, 2, 1, 5, 2050}, {908, 5, 1, 0, 0}, {913, 8, 1, 1, 2055},
+  {921, 8, 1, 1, 2056}, {929, 3, 1, 0, 0}, {932, 4, 1, 0, 0}, {936, 2, 1, 0, 0},
+  {938, 2, 1, 2, 2057}, {940, 2, 1, 6, 2059}, {942, 2, 1, 7, 2065},
+  {944, 3, 1, 0, 0}, {947, 2, 1, 21, 2072}, {949, 3, 1, 0, 0},
+  {952, 4, 1, 0, 0}, {956, 3, 1, 0, 0}, {959, 4, 1, 0, 0}, {963, 11, 1, 0, 0},
+  {974, 3, 1, 0, 0}, {977, 6, 1, 0, 0}, {983, 4, 1, 0, 0}, {987, 5, 1, 0, 0},
+  {992, 8, 1, 0, 0}, {1000, 7, 1, 0, 0}, {1007, 10, 1, 0, 0},
+  {1017, 3, 1, 0, 0}, {1020, 7, 1, 0, 0}, {1027, 5, 1, 0, 0},
+  {1032, 4, 1, 0, 0}, {1036, 6, 1, 0, 0}, {1042, 7, 1, 0, 0},
+  {1049, 4, 1, 0, 0}, {1053, 4, 1, 1, 2093}, {1057, 4, 1, 0, 0},
+  {1061, 4, 1, 0, 0}, {1065, 6, 1, 0, 0}, {1071, 3, 1, 0, 0},
+  {1074, 8, 1, 0, 0}, {1082, 8, 1, 0, 0}, {1090, 3, 1, 0, 0},
+  {1093, 3, 1, 0, 0}, {1096, 4, 1, 0, 0}, {1100, 3, 1, 0, 0},
+  {1103, 2, 1, 9, 2094}, {1105, 2, 1, 1, 2103}, {1107, 6, 1, 0, 0},
+  {1113, 3, 1, 0, 0}, {1116, 4, 1, 0, 0}, {1120, 2, 1, 1, 2104},
+  {1122, 3, 1, 0, 0}, {1125, 3, 1, 0, 0}, {1128, 2, 1, 0, 0},
+  {1130, 2, 1, 13, 2105}, {1132, 6, 1, 0, 0}, {1138, 7, 1, 0, 0},
+  {1145, 7, 1, 0, 0}, {1152, 5, 1, 0, 0}, {1157, 4, 1, 0, 0},
+  {1161, 5, 1, 0, 0}, {1166, 7, 1, 0, 0}, {1173, 9, 1, 0, 0},
+  {1182, 6, 1, 0, 0}, {1188, 6, 1, 0, 0}, {1194, 2, 1, 17, 2118},
+  {1196, 8, 1, 0, 0}, {1204, 6, 1, 0, 0}, {1210, 5, 1, 0, 0},
+  {1215, 7, 1, 0, 0}, {1222, 4, 1, 0, 0}, {1226, 5, 1, 0, 0},
+  {1231, 4, 1, 0, 0}, {1235, 8, 1, 0, 0}, {1243, 2, 2, 1, 2135},
+  {1245, 2, 1, 5, 2136}, {1247, 6, 1, 0, 0}, {1253, 8, 1, 0, 0},
+  {1261, 5, 1, 0, 0}, {1266, 6, 1, 0, 0}, {1272, 8, 1, 0, 0},
+  {1280, 8, 1, 0, 0}, {1288, 5, 1, 27, 2141}, {1293, 4, 1, 3, 2168},
+  {1297, 7, 1, 0, 0}, {1304, 2, 1, 4, 2171}, {1306, 2, 1, 47, 2175},
+  {1308, 2, 1, 23, 2222}, {1310, 5, 1, 0, 0}, {1315, 5, 1, 1, 2245},
+  {1320, 6, 1, 0, 0}, {1326, 7, 1, 0, 0}, {1333, 7, 1, 0, 0},
+  {1340, 3, 1, 399, 2246}, {1343, 7, 1, 0, 0}, {1350, 8, 1, 0, 0},
+  {1358, 9, 1, 3, 2645}, {1367, 7, 1, 0, 0}, {1374, 7, 1, 0, 0},
+  {1381, 8, 1, 0, 0}, {1389, 6, 1, 0, 0}, {1395, 6, 1, 0, 0},
+  {1401, 12, 1, 0, 0}, {1413, 10, 1, 0, 0}, {1423, 7, 1, 0, 0},
+  {1430, 11, 1, 0, 0}, {1441, 7, 1, 0, 0}, {1448, 14, 1, 0, 0},
+  {1462, 4, 1, 2, 2648}, {1466, 4, 1, 0, 0}, {1470, 7, 1, 0, 0},
+  {1477, 7, 1, 0, 0}, {1484, 6, 1, 0, 0}, {1490, 7, 1, 0, 0},
+  {1497, 7, 1, 0, 0}, {1504, 3, 1, 0, 0}, {1507, 2, 1, 7, 2650},
+  {1509, 6, 1, 0, 0}, {1515, 10, 1, 0, 0}, {1525, 11, 1, 0, 0},
+  {1536, 7, 1, 0, 0}, {1543, 5, 1, 0, 0}, {1548, 3, 1, 0, 0},
+  {1551, 6, 1, 0, 0}, {1557, 7, 1, 0, 0}, {1564, 2, 1, 6, 2657},
+  {1566, 10, 1, 0, 0}, {1576, 2, 1, 6, 2663}, {1578, 2, 1, 4, 2669},
+  {1580, 2, 1, 3, 2673}, {1582, 2, 1, 12, 2676}, {1584, 5, 1, 0, 0},
+  {1589, 4, 1, 0, 0}, {1593, 2, 1, 6, 2688}, {1595, 5, 1, 0, 0},
+  {1600, 3, 1, 0, 0}, {1603, 5, 1, 0, 0}, {1608, 4, 1, 0, 0},
+  {1612, 4, 1, 0, 0}, {1616, 6, 1, 0, 0}, {1622, 6, 1, 0, 0},
+  {1628, 3, 1, 0, 0}, {1631, 4, 1, 0, 0}, {1635, 3, 1, 0, 0},
+  {1638, 2, 1, 71, 2694}, {1640, 4, 1, 0, 0}, {1644, 6, 1, 0, 0},
+  {1650, 5, 1, 0, 0}, {1655, 6, 1, 0, 0}, {1661, 8, 1, 0, 0},
+  {1669, 4, 1, 0, 0}, {1673, 8, 1, 0, 0}, {1681, 5, 1, 0, 0},
+  {1686, 8, 1, 0, 0}, {1694, 6, 1, 0, 0}, {1700, 7, 1, 0, 0},
+  {1707, 4, 1, 0, 0}, {1711, 6, 1, 1, 2765}, {1717, 3, 1, 23, 2766},
+  {1720, 3, 1, 0, 0}, {1723, 8, 1, 0, 0}, {1731, 4, 1, 0, 0},
+  {1735, 7, 1, 1, 2789}, {1742, 6, 1, 0, 0}, {1748, 9, 1, 0, 0},
+  {1757, 8, 1, 0, 0}, {1765, 8, 1, 0, 0}, {1773, 4, 1, 0, 0},
+  {1777, 3, 1, 0, 0}, {1780, 2, 1, 0, 0}, {1782, 2, 1, 8, 2790},
+  {1784, 2, 1, 5, 2798}, {1786, 3, 1, 0, 0}, {1789, 2, 1, 10, 2803},
+  {1791, 4, 1, 0, 0}, {1795, 6, 1, 0, 0}, {1801, 3, 1, 0, 0},
+  {1804, 7, 1, 0, 0}, {1811, 3, 1, 0, 0}, {1814, 8, 1, 0, 0},
+  {1822, 5, 1, 0, 0}, {1827, 3, 1, 0, 0}, {1830, 5, 1, 0, 0},
+  {1835, 6, 1, 0, 0}, {1841, 6, 1, 0, 0}, {1847, 6, 1, 0, 0},
+  {1853, 4, 1, 0, 0}, {1857, 3, 1, 0, 0}, {1860, 2, 1, 10, 2813},
+  {1862, 5, 1, 1, 2823}, {1867, 3, 1, 0, 0}, {1870, 2, 1, 14, 2824},
+  {1872, 3, 1, 0, 0}, {1875, 5, 1, 0, 0}, {1880, 3, 1, 1, 2838},
+  {1883, 9, 1, 1, 2839}, {1892, 2, 1, 10, 2840}, {1894, 2, 1, 9, 2850},
+  {1896, 5, 1, 0, 0}, {1901, 6, 1, 0, 0}, {1907, 6, 1, 0, 0},
+  {1913, 8, 1, 0, 0}, {1921, 11, 1, 0, 0}, {1932, 11, 1, 0, 0},
+  {1943, 5, 1, 0, 0}, {1948, 9, 1, 0, 0}, {1957, 2, 2, 0, 0},
+  {1959, 8, 1, 0, 0}, {1967, 4, 1, 0, 0}, {1971, 2, 1, 7, 2859},
+  {1973, 3, 1, 0, 0}, {1976, 6, 1, 1, 2866}, {1982, 2, 1, 8, 2867},
+  {1984, 8, 1, 0, 0}, {1992, 2, 1, 9, 2875}, {1994, 10, 1, 0, 0},
+  {2004, 3, 1, 1, 2884}, {2007, 6, 1, 2, 2885}, {2013, 8, 1, 0, 0},
+  {2021, 6, 1, 0, 0}, {2027, 7, 1, 0, 0}, {2034, 7, 1, 0, 0},
+  {2041, 10, 1, 0, 0}, {2051, 4, 1, 0, 0}, {2055, 4, 1, 0, 0},
+  {2059, 9, 1, 0, 0}, {2068, 5, 1, 1, 2887}, {2073, 6, 1, 0, 0},
+  {2079, 3, 1, 0, 0}, {2082, 4, 1, 0, 0}, {2086, 4, 1, 1, 2888},
+  {2090, 7, 1, 0, 0}, {2097, 7, 1, 0, 0}, {2104, 4, 1, 0, 0},
+  {2108, 5, 1, 0, 0}, {2113, 8, 1, 0, 0}, {2121, 7, 1, 0, 0},
+  {2128, 7, 1, 0, 0}, {2135, 2, 1, 10, 2889}, {2137, 4, 1, 0, 0},
+  {2141, 8, 1, 0, 0}, {2149, 4, 1, 0, 0}, {2153, 4, 1, 0, 0},
+  {2157, 5, 1, 0, 0}, {2162, 7, 1, 0, 0}, {2169, 9, 1, 1, 2899},
+  {2178, 4, 1, 0, 0}, {2182, 9, 1, 0, 0}, {2191, 8, 1, 0, 0},
+  {2199, 4, 1, 0, 0}, {2203, 7, 1, 0, 0}, {2210, 3, 1, 0, 0},
+  {2213, 7, 1, 0, 0}, {2220, 2, 1, 10, 2900}, {2222, 2, 2, 0, 0},
+  {2224, 6, 1, 0, 0}, {2230, 7, 1, 0, 0}, {2237, 4, 1, 0, 0},
+  {2241, 7, 1, 0, 0}, {2248, 7, 1, 0, 0}, {2255, 3, 1, 0, 0},
+  {2258, 2, 1, 6, 2910}, {2260, 2, 1, 0, 0}, {2262, 3, 1, 0, 0},
+  {2265, 4, 1, 0, 0}, {2269, 11, 1, 0, 0}, {2280, 8, 1, 0, 0},
+  {2288, 4, 1, 0, 0}, {2292, 5, 1, 0, 0}, {2297, 7, 1, 0, 0},
+  {2304, 5, 1, 0, 0}, {2309, 10, 1, 0, 0}, {2319, 3, 1, 0, 0},
+  {2322, 2, 1, 34, 2916}, {2324, 4, 1, 0, 0}, {2328, 9, 1, 0, 0},
+  {2337, 3, 1, 0, 0}, {2340, 7, 1, 0, 0}, {2347, 9, 1, 0, 0},
+  {2356, 8, 1, 0, 0}, {2364, 3, 1, 0, 0}, {2367, 7, 1, 0, 0},
+  {2374, 3, 1, 0, 0}, {2377, 4, 1, 0, 0}, {2381, 9, 1, 0, 0},
+  {2390, 6, 1, 0, 0}, {2396, 3, 1, 0, 0}, {2399, 2, 1, 0, 0},
+  {2401, 3, 1, 0, 0}, {2404, 7, 1, 0, 0}, {2411, 5, 1, 0, 0},
+  {2416, 6, 1, 0, 0}, {2422, 4, 1, 0, 0}, {2426, 5, 1, 0, 0},
+  {2431, 3, 1, 0, 0}, {2434, 6, 1, 0, 0}, {2440, 3, 1, 0, 0},
+  {2443, 2, 1, 0, 0}, {2445, 4, 1, 0, 0}, {2449, 2, 1, 2, 2950},
+  {2451, 3, 1, 1, 2952}, {2454, 2, 1, 7, 2953}, {2456, 3, 1, 0, 0},
+  {2459, 4, 1, 0, 0}, {2463, 7, 1, 0, 0}, {2470, 6, 1, 0, 0},
+  {2476, 2, 1, 0, 0}, {2478, 2, 1, 6, 2960}, {2480, 4, 1, 0, 0},
+  {2484, 2, 1, 5, 2966}, {2486, 2, 1, 6, 2971}, {2488, 4, 1, 0, 0},
+  {2492, 5, 1, 0, 0}, {2497, 5, 1, 0, 0}, {2502, 6, 1, 0, 0},
+  {2508, 2, 1, 7, 2977}, {2510, 5, 1, 0, 0}, {2515, 3, 1, 0, 0},
+  {2518, 6, 1, 0, 0}, {2524, 5, 1, 0, 0}, {2529, 2, 1, 0, 0},
+  {2531, 5, 1, 0, 0}, {2536, 4, 1, 0, 0}, {2540, 3, 1, 0, 0},
+  {2543, 3, 1, 0, 0}, {2546, 2, 1, 6, 2984}, {2548, 7, 1, 0, 0},
+  {2555, 4, 1, 0, 0}, {2559, 9, 1, 0, 0}, {2568, 4, 1, 0, 0},
+  {2572, 3, 1, 0, 0}, {2575, 8, 1, 0, 0}, {2583, 4, 1, 3, 2990},
+  {2587, 6, 1, 0, 0}, {2593, 3, 1, 0, 0}, {2596, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {2602, 2, 1, 7, 2993}, {2604, 2, 1, 0, 0},
+  {2606, 2, 1, 7, 3000}, {2608, 8, 1, 0, 0}, {2616, 8, 1, 0, 0},
+  {2624, 6, 1, 0, 0}, {2630, 5, 1, 0, 0}, {2635, 5, 1, 0, 0},
+  {2640, 7, 1, 0, 0}, {2647, 5, 1, 1, 3007}, {2652, 2, 1, 0, 0},
+  {2654, 2, 1, 10, 3008}, {2656, 2, 1, 8, 3018}, {2658, 8, 1, 0, 0},
+  {2666, 5, 1, 0, 0}, {2671, 4, 1, 0, 0}, {2675, 5, 1, 0, 0},
+  {2680, 7, 1, 0, 0}, {2687, 4, 1, 0, 0}, {2691, 2, 1, 0, 0},
+  {2693, 2, 1, 7, 3026}, {2695, 4, 1, 0, 0}, {2699, 7, 1, 0, 0},
+  {2706, 7, 1, 0, 0}, {2713, 4, 1, 0, 0}, {2717, 3, 1, 0, 0},
+  {2720, 4, 1, 0, 0}, {2724, 8, 1, 0, 0}, {2732, 6, 1, 1, 3033},
+  {2738, 10, 1, 0, 0}, {2748, 4, 1, 0, 0}, {2752, 8, 1, 0, 0},
+  {2760, 4, 1, 0, 0}, {2764, 6, 1, 0, 0}, {2770, 4, 1, 0, 0},
+  {2774, 6, 1, 0, 0}, {2780, 9, 1, 0, 0}, {2789, 7, 1, 0, 0},
+  {2796, 3, 1, 0, 0}, {2799, 2, 1, 25, 3034}, {2801, 3, 1, 0, 0},
+  {2804, 2, 1, 0, 0}, {2806, 2, 1, 7, 3059}, {2808, 6, 1, 0, 0},
+  {2814, 8, 1, 0, 0}, {2822, 7, 1, 0, 0}, {2829, 9, 1, 0, 0},
+  {2838, 9, 1, 0, 0}, {2847, 5, 1, 0, 0}, {2852, 9, 1, 0, 0},
+  {2861, 5, 1, 0, 0}, {2866, 5, 1, 0, 0}, {2871, 8, 1, 0, 0},
+  {2879, 4, 1, 11, 3066}, {2883, 7, 1, 1, 3077}, {2890, 3, 1, 0, 0},
+  {2893, 7, 1, 0, 0}, {2900, 6, 1, 0, 0}, {2906, 7, 1, 0, 0},
+  {2913, 5, 1, 0, 0}, {2918, 3, 1, 0, 0}, {2921, 2, 1, 6, 3078},
+  {2923, 4, 1, 0, 0}, {2927, 2, 1, 17, 3084}, {2929, 2, 1, 32, 3101},
+  {2931, 6, 1, 0, 0}, {2937, 5, 1, 0, 0}, {2942, 7, 1, 0, 0},
+  {2949, 3, 1, 0, 0}, {2952, 4, 1, 0, 0}, {2956, 3, 1, 0, 0},
+  {2959, 3, 1, 0, 0}, {2962, 2, 1, 14, 3133}, {2964, 2, 1, 3, 3147},
+  {2966, 4, 1, 0, 0}, {2970, 3, 1, 0, 0}, {2973, 5, 1, 0, 0},
+  {2978, 2, 1, 8, 3150}, {2980, 2, 1, 8, 3158}, {2982, 6, 1, 0, 0},
+  {2988, 4, 1, 0, 0}, {2992, 4, 1, 0, 0}, {2996, 10, 1, 0, 0},
+  {3006, 2, 1, 46, 3166}, {3008, 3, 1, 0, 0}, {3011, 10, 1, 0, 0},
+  {3021, 8, 1, 0, 0}, {3029, 4, 1, 21, 3212}, {3033, 3, 1, 0, 0},
+  {3036, 3, 1, 0, 0}, {3039, 9, 1, 0, 0}, {3048, 9, 1, 0, 0},
+  {3057, 6, 1, 0, 0}, {3063, 3, 1, 1, 3233}, {3066, 13, 1, 0, 0},
+  {3079, 6, 1, 0, 0}, {3085, 11, 1, 0, 0}, {3096, 2, 1, 72, 3234},
+  {3098, 8, 1, 0, 0}, {3106, 2, 1, 6, 3306}, {3108, 2, 1, 9, 3312},
+  {3110, 5, 1, 0, 0}, {3115, 2, 1, 8, 3321}, {3117, 7, 1, 0, 0},
+  {3124, 3, 1, 0, 0}, {3127, 8, 1, 0, 0}, {3135, 2, 1, 417, 3329},
+  {3137, 4, 1, 0, 0}, {3141, 3, 1, 0, 0}, {3144, 6, 1, 0, 0},
+  {3150, 4, 1, 0, 0}, {3154, 3, 1, 0, 0}, {3157, 2, 1, 4, 3746},
+  {3159, 4, 1, 0, 0}, {3163, 5, 1, 0, 0}, {3168, 7, 1, 0, 0},
+  {3175, 3, 1, 0, 0}, {3178, 3, 1, 0, 0}, {3181, 2, 2, 0, 0},
+  {3183, 3, 1, 0, 0}, {3186, 3, 1, 0, 0}, {3189, 2, 1, 8, 3750},
+  {3191, 4, 1, 0, 0}, {3195, 6, 1, 0, 0}, {3201, 3, 1, 0, 0},
+  {3204, 3, 1, 0, 0}, {3207, 2, 1, 223, 3758}, {3209, 8, 1, 0, 0},
+  {3217, 4, 1, 0, 0}, {3221, 6, 1, 0, 0}, {3227, 7, 1, 0, 0},
+  {3234, 6, 1, 0, 0}, {3240, 4, 1, 0, 0}, {3244, 2, 1, 9, 3981},
+  {3246, 11, 1, 0, 0}, {3257, 14, 1, 0, 0}, {3271, 15, 1, 0, 0},
+  {3286, 3, 1, 0, 0}, {3289, 2, 1, 12, 3990}, {3291, 2, 2, 0, 0},
+  {3293, 2, 1, 7, 4002}, {3295, 3, 1, 0, 0}, {3298, 4, 1, 0, 0},
+  {3302, 3, 1, 0, 0}, {3305, 6, 1, 0, 0}, {3311, 6, 1, 0, 0},
+  {3317, 7, 1, 0, 0}, {3324, 4, 1, 0, 0}, {3328, 2, 1, 17, 4009},
+  {3330, 2, 1, 4, 4026}, {3332, 5, 1, 0, 0}, {3337, 7, 1, 0, 0},
+  {3344, 6, 1, 0, 0}, {3350, 2, 1, 6, 4030}, {3352, 4, 1, 0, 0},
+  {3356, 3, 1, 0, 0}, {3359, 2, 1, 30, 4036}, {3361, 3, 1, 2, 4066},
+  {3364, 4, 1, 0, 0}, {3368, 9, 1, 0, 0}, {3377, 2, 1, 7, 4068},
+  {3379, 2, 1, 4, 4075}, {3381, 5, 1, 0, 0}, {3386, 2, 1, 8, 4079},
+  {3388, 2, 1, 10, 4087}, {3390, 7, 1, 0, 0}, {3397, 11, 1, 0, 0},
+  {3408, 5, 1, 0, 0}, {3413, 9, 1, 0, 0}, {3422, 6, 1, 0, 0},
+  {3428, 4, 1, 1, 4097}, {3432, 9, 1, 0, 0}, {3441, 7, 1, 0, 0},
+  {3448, 7, 1, 0, 0}, {3455, 3, 1, 0, 0}, {3458, 6, 1, 0, 0},
+  {3464, 7, 1, 0, 0}, {3471, 3, 1, 0, 0}, {3474, 6, 1, 0, 0},
+  {3480, 2, 1, 5, 4098}, {3482, 2, 1, 7, 4103}, {3484, 3, 1, 0, 0},
+  {3487, 5, 1, 0, 0}, {3492, 7, 1, 0, 0}, {3499, 6, 1, 0, 0},
+  {3505, 5, 1, 0, 0}, {3510, 4, 1, 0, 0}, {3514, 5, 1, 0, 0},
+  {3519, 4, 1, 0, 0}, {3523, 2, 1, 2, 4110}, {3525, 4, 1, 0, 0},
+  {3529, 4, 1, 0, 0}, {3533, 13, 1, 0, 0}, {3546, 9, 1, 0, 0},
+  {3555, 8, 1, 0, 0}, {3563, 4, 1, 0, 0}, {3567, 5, 1, 0, 0},
+  {3572, 7, 1, 0, 0}, {3579, 4, 1, 0, 0}, {3583, 7, 1, 0, 0},
+  {3590, 5, 1, 0, 0}, {3595, 4, 1, 3, 4112}, {3599, 5, 1, 0, 0},
+  {3604, 4, 1, 1, 4115}, {3608, 6, 1, 0, 0}, {3614, 2, 1, 15, 4116},
+  {3616, 3, 1, 0, 0}, {3619, 3, 1, 0, 0}, {3622, 4, 1, 0, 0},
+  {3626, 5, 1, 0, 0}, {3631, 6, 1, 0, 0}, {3637, 5, 1, 0, 0},
+  {3642, 3, 1, 1, 4131}, {3645, 6, 1, 0, 0}, {3651, 5, 1, 0, 0},
+  {3656, 5, 1, 0, 0}, {3661, 4, 1, 0, 0}, {3665, 3, 1, 0, 0},
+  {3668, 12, 1, 0, 0}, {3680, 2, 1, 5, 4132}, {3682, 2, 1, 10, 4137},
+  {3684, 2, 1, 2, 4147}, {3686, 3, 1, 0, 0}, {3689, 4, 1, 0, 0},
+  {3693, 2, 1, 2, 4149}, {3695, 8, 1, 0, 0}, {3703, 4, 1, 0, 0},
+  {3707, 6, 1, 0, 0}, {3713, 2, 1, 9, 4151}, {3715, 2, 1, 9, 4160},
+  {3717, 2, 1, 6, 4169}, {3719, 5, 1, 0, 0}, {3724, 6, 1, 0, 0},
+  {3730, 4, 1, 0, 0}, {3734, 6, 1, 0, 0}, {3740, 6, 1, 0, 0},
+  {3746, 3, 1, 0, 0}, {3749, 10, 1, 1, 4175}, {3759, 5, 1, 0, 0},
+  {3764, 3, 1, 0, 0}, {3767, 6, 1, 0, 0}, {3773, 9, 1, 0, 0},
+  {3782, 7, 1, 0, 0}, {3789, 8, 1, 0, 0}, {3797, 9, 1, 0, 0},
+  {3806, 8, 1, 0, 0}, {3814, 6, 1, 0, 0}, {3820, 3, 1, 0, 0},
+  {3823, 2, 1, 2, 4176}, {3825, 8, 1, 0, 0}, {3833, 2, 1, 5, 4178},
+  {3835, 2, 1, 43, 4183}, {3837, 3, 1, 0, 0}, {3840, 5, 1, 1, 4226},
+  {3845, 4, 1, 0, 0}, {3849, 9, 1, 0, 0}, {3858, 4, 1, 0, 0},
+  {3862, 8, 1, 0, 0}, {3870, 3, 1, 0, 0}, {3873, 4, 1, 1, 4227},
+  {3877, 8, 1, 0, 0}, {3885, 2, 1, 9, 4228}, {3887, 2, 1, 0, 0},
+  {3889, 5, 1, 0, 0}, {3894, 9, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {3906, 4, 1, 0, 0}, {3910, 4, 1, 0, 0}, {3914, 3, 1, 0, 0},
+  {3917, 10, 1, 0, 0}, {3927, 2, 1, 8, 4237}, {3929, 2, 1, 7, 4245},
+  {3931, 3, 1, 0, 0}, {3934, 3, 1, 0, 0}, {3937, 2, 2, 0, 0},
+  {3939, 3, 1, 0, 0}, {3942, 2, 1, 4, 4252}, {3944, 2, 1, 5, 4256},
+  {3946, 4, 1, 2, 4261}, {3950, 6, 1, 0, 0}, {3956, 4, 1, 0, 0},
+  {3960, 3, 1, 0, 0}, {3963, 3, 1, 0, 0}, {3966, 3, 1, 0, 0},
+  {3969, 6, 1, 0, 0}, {3975, 5, 1, 0, 0}, {3980, 7, 1, 0, 0},
+  {3987, 6, 1, 0, 0}, {3993, 8, 1, 0, 0}, {4001, 6, 1, 0, 0},
+  {4007, 4, 1, 0, 0}, {4011, 11, 1, 0, 0}, {4022, 3, 1, 0, 0},
+  {4025, 5, 1, 0, 0}, {4030, 2, 1, 1, 4263}, {4032, 2, 1, 0, 0},
+  {4034, 2, 1, 2, 4264}, {4036, 2, 1, 7, 4266}, {4038, 3, 1, 0, 0},
+  {4041, 2, 1, 4, 4273}, {4043, 3, 1, 0, 0}, {4046, 3, 1, 0, 0},
+  {4049, 2, 1, 7, 4277}, {4051, 6, 1, 546, 4284}, {4057, 5, 1, 0, 0},
+  {4062, 6, 1, 0, 0}, {4068, 2, 1, 14, 4830}, {4070, 2, 1, 11, 4844},
+  {4072, 2, 1, 6, 4855}, {4074, 2, 1, 9, 4861}, {4076, 2, 1, 8, 4870},
+  {4078, 2, 1, 17, 4878}, {4080, 3, 1, 0, 0}, {4083, 6, 1, 0, 0},
+  {4089, 4, 1, 2, 4895}, {4093, 6, 1, 0, 0}, {4099, 4, 1, 0, 0},
+  {4103, 3, 1, 0, 0}, {4106, 2, 1, 2, 4897}, {4108, 2, 1, 0, 0},
+  {4110, 3, 1, 0, 0}, {4113, 3, 1, 165, 4899}, {4116, 7, 1, 0, 0},
+  {4123, 7, 1, 0, 0}, {4130, 7, 1, 5, 5064}, {4137, 7, 1, 0, 0},
+  {4144, 3, 1, 0, 0}, {4147, 4, 1, 1, 5069}, {4151, 4, 1, 0, 0},
+  {4155, 10, 1, 0, 0}, {4165, 5, 1, 0, 0}, {4170, 2, 1, 10, 5070},
+  {4172, 3, 1, 0, 0}, {4175, 2, 1, 15, 5080}, {4177, 3, 1, 0, 0},
+  {4180, 3, 1, 0, 0}, {4183, 2, 1, 14, 5095}, {4185, 4, 1, 0, 0},
+  {4189, 4, 1, 0, 0}, {4193, 5, 1, 0, 0}, {4198, 5, 1, 0, 0},
+  {4203, 6, 1, 0, 0}, {4209, 6, 1, 0, 0}, {4215, 2, 1, 10, 5109},
+  {4217, 2, 1, 728, 5119}, {4219, 5, 1, 0, 0}, {4224, 18, 1, 0, 0},
+  {4242, 6, 1, 0, 0}, {4248, 3, 1, 0, 0}, {4251, 6, 1, 0, 0},
+  {4257, 5, 1, 0, 0}, {4262, 2, 2, 0, 0}, {4264, 2, 1, 7, 5847},
+  {4266, 3, 1, 0, 0}, {4269, 3, 1, 0, 0}, {4272, 3, 1, 0, 0},
+  {4275, 2, 1, 4, 5854}, {4277, 3, 1, 0, 0}, {4280, 2, 1, 16, 5858},
+  {4282, 3, 1, 0, 0}, {4285, 8, 1, 0, 0}, {4293, 6, 1, 0, 0},
+  {4299, 7, 1, 0, 0}, {4306, 6, 1, 0, 0}, {4312, 11, 1, 0, 0},
+  {4323, 7, 1, 0, 0}, {4330, 4, 1, 0, 0}, {4334, 2, 1, 9, 5874},
+  {4336, 5, 1, 0, 0}, {4341, 3, 1, 3, 5883}, {4344, 3, 1, 0, 0},
+  {4347, 5, 1, 0, 0}, {4352, 3, 1, 0, 0}, {4355, 6, 1, 3, 5886},
+  {4361, 3, 1, 0, 0}, {4364, 4, 1, 0, 0}, {4368, 6, 1, 0, 0},
+  {4374, 6, 1, 1, 5889}, {4380, 3, 1, 114, 5890}, {4383, 7, 1, 0, 0},
+  {4390, 7, 1, 0, 0}, {4397, 5, 1, 0, 0}, {4402, 6, 1, 0, 0},
+  {4408, 3, 1, 0, 0}, {4411, 3, 1, 1, 6004}, {4414, 2, 1, 11, 6005},
+  {4416, 4, 1, 9, 6016}, {4420, 9, 1, 0, 0}, {4429, 5, 1, 0, 0},
+  {4434, 4, 1, 0, 0}, {4438, 8, 1, 0, 0}, {4446, 5, 1, 0, 0},
+  {4451, 5, 1, 1, 6025}, {4456, 9, 1, 0, 0}, {4465, 3, 1, 0, 0},
+  {4468, 4, 1, 0, 0}, {4472, 2, 1, 8, 6026}, {4474, 3, 1, 0, 0},
+  {4477, 2, 1, 3, 6034}, {4479, 6, 1, 0, 0}, {4485, 2, 2, 0, 0},
+  {4487, 2, 1, 8, 6037}, {4489, 8, 1, 0, 0}, {4497, 3, 1, 0, 0},
+  {4500, 7, 1, 0, 0}, {4507, 5, 1, 0, 0}, {4512, 5, 1, 0, 0},
+  {4517, 11, 1, 0, 0}, {4528, 6, 1, 1, 6045}, {4534, 6, 1, 0, 0},
+  {4540, 4, 1, 0, 0}, {4544, 6, 1, 0, 0}, {4550, 8, 1, 1, 6046},
+  {4558, 3, 1, 0, 0}, {4561, 3, 1, 0, 0}, {4564, 4, 1, 0, 0},
+  {4568, 4, 1, 0, 0}, {4572, 7, 1, 0, 0}, {4579, 5, 1, 0, 0},
+  {4584, 2, 1, 14, 6047}, {4586, 2, 1, 179, 6061}, {4588, 5, 1, 1, 6240},
+  {4593, 4, 1, 0, 0}, {4597, 11, 1, 0, 0}, {4608, 8, 1, 0, 0},
+  {4616, 4, 1, 0, 0}, {4620, 2, 1, 2, 6241}, {4622, 2, 1, 5, 6243},
+  {4624, 3, 1, 0, 0}, {4627, 4, 1, 0, 0}, {4631, 5, 1, 0, 0},
+  {4636, 7, 1, 0, 0}, {4643, 4, 1, 1, 6248}, {4647, 4, 1, 0, 0},
+  {4651, 2, 1, 13, 6249}, {4653, 9, 1, 0, 0}, {4662, 5, 1, 0, 0},
+  {4667, 5, 1, 0, 0}, {4672, 5, 1, 0, 0}, {4677, 3, 1, 14, 6262},
+  {4680, 4, 1, 0, 0}, {4684, 11, 1, 0, 0}, {4695, 4, 1, 0, 0},
+  {4699, 11, 1, 0, 0}, {4710, 5, 1, 0, 0}, {4715, 10, 1, 0, 0},
+  {4725, 8, 1, 0, 0}, {4733, 10, 1, 0, 0}, {4743, 3, 1, 0, 0},
+  {4746, 10, 1, 0, 0}, {4756, 2, 1, 7, 6276}, {4758, 2, 1, 10, 6283},
+  {4760, 3, 1, 1, 6293}, {4763, 2, 1, 8, 6294}, {4765, 3, 1, 0, 0},
+  {4768, 2, 1, 7, 6302}, {4770, 2, 1, 9, 6309}, {4772, 4, 1, 0, 0},
+  {4776, 6, 1, 0, 0}, {4782, 5, 1, 0, 0}, {4787, 6, 1, 0, 0},
+  {4793, 5, 1, 0, 0}, {4798, 2, 1, 4, 6318}, {4800, 4, 1, 0, 0},
+  {4804, 10, 1, 0, 0}, {4814, 7, 1, 0, 0}, {4821, 6, 1, 0, 0},
+  {4827, 7, 1, 0, 0}, {4834, 3, 1, 0, 0}, {4837, 8, 1, 0, 0},
+  {4845, 11, 1, 0, 0}, {4856, 5, 1, 0, 0}, {4861, 5, 1, 0, 0},
+  {4866, 6, 1, 0, 0}, {4872, 4, 1, 0, 0}, {4876, 8, 1, 0, 0},
+  {4884, 3, 1, 0, 0}, {4887, 4, 1, 0, 0}, {4891, 7, 1, 0, 0},
+  {4898, 6, 1, 0, 0}, {4904, 6, 1, 0, 0}, {4910, 10, 1, 0, 0},
+  {4920, 4, 1, 0, 0}, {4924, 10, 1, 0, 0}, {4934, 6, 1, 1, 6322},
+  {4940, 7, 1, 0, 0}, {4947, 7, 1, 0, 0}, {4954, 4, 1, 0, 0},
+  {4958, 9, 1, 0, 0}, {4967, 5, 1, 0, 0}, {4972, 3, 1, 0, 0},
+  {4975, 3, 1, 0, 0}, {4978, 3, 1, 1, 6323}, {4981, 2, 1, 15, 6324},
+  {4983, 6, 1, 0, 0}, {4989, 5, 1, 3, 6339}, {4994, 5, 1, 0, 0},
+  {4999, 6, 1, 0, 0}, {5005, 4, 1, 0, 0}, {5009, 2, 1, 10, 6342},
+  {5011, 4, 1, 0, 0}, {5015, 2, 1, 40, 6352}, {5017, 5, 1, 0, 0},
+  {5022, 4, 1, 0, 0}, {5026, 3, 1, 10, 6392}, {5029, 2, 1, 7, 6402},
+  {5031, 3, 1, 0, 0}, {5034, 6, 1, 0, 0}, {5040, 2, 1, 8, 6409},
+  {5042, 8, 1, 0, 0}, {5050, 4, 1, 0, 0}, {5054, 6, 1, 0, 0},
+  {5060, 6, 1, 0, 0}, {5066, 4, 1, 0, 0}, {5070, 5, 1, 0, 0},
+  {5075, 8, 1, 0, 0}, {5083, 7, 1, 0, 0}, {5090, 7, 1, 0, 0},
+  {5097, 15, 1, 0, 0}, {5112, 6, 1, 0, 0}, {5118, 3, 1, 0, 0},
+  {5121, 4, 1, 0, 0}, {5125, 3, 1, 0, 0}, {5128, 4, 1, 0, 0},
+  {5132, 4, 1, 0, 0}, {5136, 2, 1, 5, 6417}, {5138, 3, 1, 0, 0},
+  {5141, 3, 1, 0, 0}, {5144, 2, 1, 5, 6422}, {5146, 3, 1, 0, 0},
+  {5149, 3, 1, 0, 0}, {5152, 10, 1, 0, 0}, {5162, 7, 1, 0, 0},
+  {5169, 12, 1, 0, 0}, {5181, 6, 1, 0, 0}, {5187, 6, 1, 0, 0},
+  {5193, 7, 1, 0, 0}, {5200, 7, 1, 1, 6427}, {5207, 4, 1, 2, 6428},
+  {5211, 2, 1, 8, 6430}, {5213, 2, 1, 47, 6438}, {5215, 6, 1, 0, 0},
+  {5221, 4, 1, 0, 0}, {5225, 6, 1, 0, 0}, {5231, 8, 1, 0, 0},
+  {5239, 4, 1, 0, 0}, {5243, 6, 1, 0, 0}, {5249, 5, 1, 0, 0},
+  {5254, 8, 1, 1, 6485}, {5262, 5, 1, 0, 0}, {5267, 3, 1, 0, 0},
+  {5270, 3, 1, 0, 0}, {5273, 4, 1, 0, 0}, {5277, 3, 1, 0, 0},
+  {5280, 2, 1, 8, 6486}, {5282, 2, 1, 11, 6494}, {5284, 9, 1, 0, 0},
+  {5293, 5, 1, 0, 0}, {5298, 4, 1, 0, 0}, {5302, 5, 1, 0, 0},
+  {5307, 4, 1, 0, 0}, {5311, 7, 1, 0, 0}, {5318, 5, 1, 0, 0},
+  {5323, 4, 1, 3, 6505}, {5327, 8, 1, 0, 0}, {5335, 6, 1, 0, 0},
+  {5341, 4, 1, 0, 0}, {5345, 8, 1, 0, 0}, {5353, 2, 1, 3, 6508},
+  {5355, 4, 1, 0, 0}, {5359, 4, 1, 0, 0}, {5363, 7, 1, 0, 0},
+  {5370, 4, 1, 17, 6511}, {5374, 2, 1, 0, 0}, {5376, 2, 1, 1, 6528},
+  {5378, 3, 1, 0, 0}, {5381, 4, 1, 0, 0}, {5385, 3, 1, 0, 0},
+  {5388, 5, 1, 0, 0}, {5393, 2, 1, 5, 6529}, {5395, 5, 1, 0, 0},
+  {5400, 2, 1, 0, 0}, {5402, 5, 1, 0, 0}, {5407, 5, 1, 0, 0},
+  {5412, 2, 1, 8, 6534}, {5414, 4, 1, 0, 0}, {5418, 2, 1, 7, 6542},
+  {5420, 6, 1, 0, 0}, {5426, 6, 1, 0, 0}, {5432, 8, 1, 0, 0},
+  {5440, 8, 1, 0, 0}, {5448, 4, 1, 0, 0}, {5452, 5, 1, 0, 0},
+  {5457, 9, 1, 1, 6549}, {5466, 4, 1, 0, 0}, {5470, 4, 1, 0, 0},
+  {5474, 3, 1, 0, 0}, {5477, 3, 1, 0, 0}, {5480, 5, 1, 3, 6550},
+  {5485, 5, 1, 0, 0}, {5490, 4, 1, 0, 0}, {5494, 2, 1, 0, 0},
+  {5496, 3, 1, 0, 0}, {5499, 2, 1, 8, 6553}, {5501, 2, 1, 12, 6561},
+  {5503, 5, 1, 0, 0}, {5508, 7, 1, 0, 0}, {5515, 4, 1, 0, 0},
+  {5519, 9, 1, 0, 0}, {5528, 9, 1, 0, 0}, {5537, 3, 1, 0, 0},
+  {5540, 8, 1, 0, 0}, {5548, 9, 1, 0, 0}, {5557, 7, 1, 0, 0},
+  {5564, 5, 1, 3, 6573}, {5569, 6, 1, 0, 0}, {5575, 6, 1, 0, 0},
+  {5581, 5, 1, 0, 0}, {5586, 5, 1, 0, 0}, {5591, 2, 1, 52, 6576},
+  {5593, 5, 1, 0, 0}, {5598, 8, 1, 0, 0}, {5606, 6, 1, 0, 0},
+  {5612, 7, 1, 1, 6628}, {5619, 4, 1, 0, 0}, {5623, 7, 1, 0, 0},
+  {5630, 6, 1, 0, 0}, {5636, 2, 1, 5, 6629}, {5638, 6, 1, 0, 0},
+  {5644, 5, 1, 0, 0}, {5649, 2, 1, 1, 6634}, {5651, 2, 1, 6, 6635},
+  {5653, 6, 1, 0, 0}, {5659, 7, 1, 1, 6641}, {5666, 2, 1, 3, 6642},
+  {5668, 3, 1, 0, 0}, {5671, 6, 1, 0, 0}, {5677, 4, 1, 0, 0},
+  {5681, 6, 1, 0, 0}, {5687, 6, 1, 0, 0}, {5693, 10, 1, 0, 0},
+  {5703, 5, 1, 0, 0}, {5708, 6, 1, 0, 0}, {5714, 3, 1, 0, 0},
+  {5717, 4, 1, 0, 0}, {5721, 2, 1, 3, 6645}, {5723, 3, 1, 0, 0},
+  {5726, 2, 1, 1, 6648}, {5728, 3, 1, 0, 0}, {5731, 4, 1, 2, 6649},
+  {5735, 4, 1, 0, 0}, {5739, 10, 1, 1, 6651}, {5749, 3, 1, 0, 0},
+  {5752, 7, 1, 0, 0}, {5759, 6, 1, 0, 0}, {5765, 4, 1, 0, 0},
+  {5769, 2, 1, 1, 6652}, {5771, 2, 1, 0, 0}, {5773, 2, 1, 9, 6653},
+  {5775, 3, 1, 0, 0}, {5778, 7, 1, 0, 0}, {5785, 7, 1, 0, 0},
+  {5792, 4, 1, 0, 0}, {5796, 7, 1, 0, 0}, {5803, 6, 1, 0, 0},
+  {5809, 7, 1, 0, 0}, {5816, 4, 1, 0, 0}, {5820, 5, 1, 0, 0},
+  {5825, 5, 1, 0, 0}, {5830, 2, 1, 15, 6662}, {5832, 6, 1, 0, 0},
+  {5838, 3, 1, 0, 0}, {5841, 2, 1, 0, 0}, {5843, 6, 1, 0, 0},
+  {5849, 2, 1, 1, 6677}, {5851, 2, 1, 8, 6678}, {5853, 5, 1, 0, 0},
+  {5858, 2, 1, 14, 6686}, {5860, 2, 1, 12, 6700}, {5862, 5, 1, 1, 6712},
+  {5867, 5, 1, 0, 0}, {5872, 5, 1, 0, 0}, {5877, 3, 1, 2, 6713},
+  {5880, 5, 1, 0, 0}, {5885, 7, 1, 0, 0}, {5892, 5, 1, 0, 0},
+  {5897, 5, 1, 0, 0}, {5902, 4, 1, 0, 0}, {5906, 6, 1, 0, 0},
+  {5912, 4, 1, 0, 0}, {5916, 2, 1, 22, 6715}, {5918, 5, 1, 1, 6737},
+  {5923, 7, 1, 0, 0}, {5930, 8, 1, 0, 0}, {5938, 6, 1, 0, 0},
+  {5944, 13, 1, 0, 0}, {5957, 9, 1, 0, 0}, {5966, 18, 1, 0, 0},
+  {5984, 5, 1, 0, 0}, {5989, 3, 1, 0, 0}, {5992, 2, 1, 17, 6738},
+  {5994, 4, 1, 0, 0}, {5998, 3, 1, 0, 0}, {6001, 5, 1, 0, 0},
+  {6006, 5, 1, 0, 0}, {6011, 2, 1, 4, 6755}, {6013, 3, 1, 0, 0},
+  {6016, 2, 1, 15, 6759}, {6018, 2, 1, 12, 6774}, {6020, 2, 1, 83, 6786},
+  {6022, 5, 1, 0, 0}, {6027, 3, 1, 0, 0}, {6030, 2, 1, 9, 6869},
+  {6032, 2, 1, 23, 6878}, {6034, 6, 1, 0, 0}, {6040, 10, 1, 0, 0},
+  {6050, 3, 1, 0, 0}, {6053, 3, 1, 0, 0}, {6056, 3, 1, 0, 0},
+  {6059, 2, 1, 73, 6901}, {6061, 2, 1, 6, 6974}, {6063, 2, 1, 4, 6980},
+  {6065, 2, 1, 0, 0}, {6067, 9, 1, 0, 0}, {6076, 4, 1, 0, 0},
+  {6080, 8, 1, 0, 0}, {6088, 2, 1, 8, 6984}, {6090, 2, 1, 20, 6992},
+  {6092, 5, 1, 0, 0}, {6097, 8, 1, 0, 0}, {6105, 8, 1, 0, 0},
+  {6113, 12, 1, 0, 0}, {6125, 3, 1, 0, 0}, {6128, 2, 1, 1, 7012},
+  {6130, 2, 1, 5, 7013}, {6132, 6, 1, 0, 0}, {6138, 5, 1, 0, 0},
+  {6143, 3, 1, 0, 0}, {6146, 6, 1, 0, 0}, {6152, 6, 1, 0, 0},
+  {6158, 3, 1, 0, 0}, {6161, 3, 1, 0, 0}, {6164, 6, 1, 0, 0},
+  {6170, 4, 1, 0, 0}, {6174, 6, 1, 0, 0}, {6180, 4, 1, 0, 0},
+  {6184, 4, 1, 0, 0}, {6188, 10, 1, 0, 0}, {6198, 2, 1, 13, 7018},
+  {6200, 5, 1, 0, 0}, {6205, 10, 1, 0, 0}, {6215, 5, 1, 0, 0},
+  {6220, 4, 1, 0, 0}, {6224, 6, 1, 0, 0}, {6230, 4, 1, 0, 0},
+  {6234, 6, 1, 0, 0}, {6240, 2, 1, 8, 7031}, {6242, 6, 1, 0, 0},
+  {6248, 5, 1, 0, 0}, {6253, 7, 1, 0, 0}, {6260, 6, 1, 0, 0},
+  {6266, 4, 1, 0, 0}, {6270, 7, 1, 0, 0}, {6277, 5, 1, 0, 0},
+  {6282, 7, 1, 0, 0}, {6289, 7, 1, 0, 0}, {6296, 14, 1, 0, 0},
+  {6310, 6, 1, 0, 0}, {6316, 5, 1, 0, 0}, {6321, 7, 1, 1, 7039},
+  {6328, 7, 1, 0, 0}, {6335, 5, 1, 0, 0}, {6340, 4, 1, 0, 0},
+  {6344, 2, 1, 2, 7040}, {6346, 7, 1, 0, 0}, {6353, 4, 1, 0, 0},
+  {6357, 4, 1, 1, 7042}, {6361, 11, 1, 0, 0}, {6372, 3, 1, 0, 0},
+  {6375, 7, 1, 0, 0}, {6382, 4, 1, 0, 0}, {6386, 7, 1, 0, 0},
+  {6393, 3, 1, 0, 0}, {6396, 13, 1, 0, 0}, {6409, 8, 1, 0, 0},
+  {6417, 4, 1, 0, 0}, {6421, 5, 1, 0, 0}, {6426, 5, 1, 0, 0},
+  {6431, 3, 1, 0, 0}, {6434, 2, 1, 9, 7043}, {6436, 3, 1, 0, 0},
+  {6439, 3, 1, 0, 0}, {6442, 4, 1, 0, 0}, {6446, 5, 1, 0, 0},
+  {6451, 7, 1, 0, 0}, {6458, 6, 1, 0, 0}, {6464, 3, 1, 0, 0},
+  {6467, 11, 1, 0, 0}, {6478, 11, 1, 0, 0}, {6489, 11, 1, 0, 0},
+  {6500, 11, 1, 0, 0}, {6511, 10, 1, 0, 0}, {6521, 11, 1, 0, 0},
+  {6532, 11, 1, 0, 0}, {6543, 12, 1, 0, 0}, {6555, 11, 1, 0, 0},
+  {6566, 10, 1, 0, 0}, {6576, 11, 1, 0, 0}, {6587, 12, 1, 0, 0},
+  {6599, 11, 1, 0, 0}, {6610, 10, 1, 0, 0}, {6620, 12, 1, 4, 7052},
+  {6632, 10, 1, 0, 0}, {6642, 14, 1, 0, 0}, {6656, 11, 1, 0, 0},
+  {6667, 10, 1, 0, 0}, {6677, 17, 1, 0, 0}, {6694, 10, 1, 0, 0},
+  {6704, 11, 1, 0, 0}, {6715, 14, 1, 0, 0}, {6729, 12, 1, 0, 0},
+  {6741, 11, 1, 0, 0}, {6752, 14, 1, 0, 0}, {6766, 12, 1, 0, 0},
+  {6778, 10, 1, 0, 0}, {6788, 12, 1, 0, 0}, {6800, 10, 1, 6, 7056},
+  {6810, 8, 1, 0, 0}, {6818, 9, 1, 0, 0}, {6827, 10, 1, 0, 0},
+  {6837, 10, 1, 0, 0}, {6847, 11, 1, 0, 0}, {6858, 14, 1, 0, 0},
+  {6872, 17, 1, 0, 0}, {6889, 9, 1, 0, 0}, {6898, 10, 1, 0, 0},
+  {6908, 11, 1, 0, 0}, {6919, 13, 1, 0, 0}, {6932, 10, 1, 0, 0},
+  {6942, 22, 1, 0, 0}, {6964, 11, 1, 0, 0}, {6975, 10, 1, 0, 0},
+  {6985, 10, 1, 0, 0}, {6995, 11, 1, 0, 0}, {7006, 9, 1, 0, 0},
+  {7015, 9, 1, 0, 0}, {7024, 13, 1, 0, 0}, {7037, 11, 1, 0, 0},
+  {7048, 11, 1, 0, 0}, {7059, 9, 1, 0, 0}, {7068, 14, 1, 0, 0},
+  {7082, 10, 1, 0, 0}, {7092, 10, 1, 0, 0}, {7102, 10, 1, 0, 0},
+  {7112, 11, 1, 0, 0}, {7123, 11, 1, 0, 0}, {7134, 13, 1, 0, 0},
+  {7147, 13, 1, 0, 0}, {7160, 16, 1, 0, 0}, {7176, 11, 1, 0, 0},
+  {7187, 12, 1, 0, 0}, {7199, 11, 1, 0, 0}, {7210, 11, 1, 0, 0},
+  {7221, 14, 1, 0, 0}, {7235, 11, 1, 0, 0}, {7246, 13, 1, 0, 0},
+  {7259, 11, 1, 0, 0}, {7270, 15, 1, 0, 0}, {7285, 11, 1, 0, 0},
+  {7296, 10, 1, 0, 0}, {7306, 9, 1, 0, 0}, {7315, 9, 1, 0, 0},
+  {7324, 11, 1, 6, 7062}, {7335, 14, 1, 0, 0}, {7349, 11, 1, 0, 0},
+  {7360, 15, 1, 0, 0}, {7375, 11, 1, 0, 0}, {7386, 11, 1, 0, 0},
+  {7397, 10, 1, 0, 0}, {7407, 9, 1, 0, 0}, {7416, 15, 1, 0, 0},
+  {7431, 12, 1, 0, 0}, {7443, 12, 1, 0, 0}, {7455, 14, 1, 0, 0},
+  {7469, 15, 1, 0, 0}, {7484, 14, 1, 0, 0}, {7498, 16, 1, 0, 0},
+  {7514, 15, 1, 0, 0}, {7529, 14, 1, 0, 0}, {7543, 12, 1, 0, 0},
+  {7555, 17, 1, 0, 0}, {7572, 18, 1, 0, 0}, {7590, 17, 1, 0, 0},
+  {7607, 14, 1, 0, 0}, {7621, 11, 1, 0, 0}, {7632, 14, 1, 0, 0},
+  {7646, 15, 1, 0, 0}, {7661, 14, 1, 0, 0}, {7675, 16, 1, 0, 0},
+  {7691, 19, 1, 0, 0}, {7710, 17, 1, 0, 0}, {7727, 12, 1, 0, 0},
+  {7739, 14, 1, 0, 0}, {7753, 12, 1, 0, 0}, {7765, 19, 1, 0, 0},
+  {7784, 16, 1, 0, 0}, {7800, 12, 1, 0, 0}, {7812, 12, 1, 0, 0},
+  {7824, 11, 1, 0, 0}, {7835, 14, 1, 0, 0}, {7849, 11, 1, 0, 0},
+  {7860, 11, 1, 0, 0}, {7871, 12, 1, 0, 0}, {7883, 10, 1, 0, 0},
+  {7893, 12, 1, 0, 0}, {7905, 12, 1, 0, 0}, {7917, 9, 1, 0, 0},
+  {7926, 11, 1, 0, 0}, {7937, 8, 1, 0, 0}, {7945, 9, 1, 0, 0},
+  {7954, 15, 1, 0, 0}, {7969, 11, 1, 0, 0}, {7980, 10, 1, 6, 7068},
+  {7990, 12, 1, 0, 0}, {8002, 11, 1, 0, 0}, {8013, 9, 1, 10, 7074},
+  {8022, 8, 1, 0, 0}, {8030, 11, 1, 0, 0}, {8041, 10, 1, 0, 0},
+  {8051, 10, 1, 0, 0}, {8061, 11, 1, 0, 0}, {8072, 12, 1, 0, 0},
+  {8084, 9, 1, 0, 0}, {8093, 8, 1, 0, 0}, {8101, 11, 1, 0, 0},
+  {8112, 11, 1, 0, 0}, {8123, 14, 1, 0, 0}, {8137, 11, 1, 0, 0},
+  {8148, 11, 1, 0, 0}, {8159, 11, 1, 0, 0}, {8170, 9, 1, 0, 0},
+  {8179, 13, 1, 0, 0}, {8192, 10, 1, 0, 0}, {8202, 23, 1, 0, 0},
+  {8225, 24, 1, 0, 0}, {8249, 9, 1, 0, 0}, {8258, 11, 1, 0, 0},
+  {8269, 20, 1, 0, 0}, {8289, 11, 1, 0, 0}, {8300, 10, 1, 0, 0},
+  {8310, 10, 1, 0, 0}, {8320, 11, 1, 0, 0}, {8331, 16, 1, 0, 0},
+  {8347, 17, 1, 0, 0}, {8364, 10, 1, 0, 0}, {8374, 13, 1, 0, 0},
+  {8387, 13, 1, 0, 0}, {8400, 11, 1, 0, 0}, {8411, 3, 1, 0, 0},
+  {8414, 3, 1, 5, 7084}, {8417, 6, 1, 0, 0}, {8423, 5, 1, 0, 0},
+  {8428, 7, 1, 0, 0}, {8435, 6, 1, 0, 0}, {8441, 2, 1, 6, 7089},
+  {8443, 9, 1, 0, 0}, {8452, 4, 1, 0, 0}, {8456, 8, 1, 0, 0},
+  {8464, 3, 1, 0, 0}, {8467, 7, 1, 0, 0}, {8474, 2, 1, 1, 7095},
+  {8476, 3, 1, 0, 0}, {8479, 2, 0, 18, 7096}, {8481, 6, 1, 0, 0},
+  {8487, 4, 1, 0, 0}, {8491, 4, 1, 0, 0}, {8495, 3, 1, 0, 0},
+  {8498, 2, 1, 11, 7114}, {8500, 4, 1, 4, 7125}, {8504, 7, 1, 0, 0},
+  {8511, 2, 1, 5, 7129}, {1340, 3, 1, 0, 0}, {8513, 3, 9, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {8516, 8, 9, 0, 0},
+  {8524, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1308, 2, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {8538, 22, 1, 0, 0},
+  {8560, 19, 1, 0, 0}, {8579, 9, 1, 0, 0}, {8588, 8, 1, 0, 0},
+  {8596, 9, 1, 0, 0}, {8605, 6, 1, 0, 0}, {8611, 16, 1, 0, 0},
+  {8627, 19, 1, 0, 0}, {8646, 8, 1, 0, 0}, {8654, 7, 1, 0, 0},
+  {8661, 7, 1, 0, 0}, {8668, 10, 1, 0, 0}, {8678, 9, 1, 0, 0},
+  {8687, 9, 1, 0, 0}, {8696, 11, 1, 0, 0}, {453, 6, 1, 0, 0},
+  {8707, 10, 1, 0, 0}, {883, 6, 1, 0, 0}, {8717, 3, 1, 0, 0},
+  {8720, 5, 1, 0, 0}, {1074, 8, 1, 0, 0}, {8725, 13, 1, 0, 0},
+  {8738, 12, 1, 0, 0}, {8750, 7, 1, 0, 0}, {8757, 13, 1, 0, 0},
+  {1293, 4, 1, 0, 0}, {8770, 10, 1, 0, 0}, {8780, 10, 1, 0, 0},
+  {1413, 10, 1, 0, 0}, {8790, 7, 1, 0, 0}, {8797, 7, 1, 0, 0},
+  {8804, 4, 1, 0, 0}, {1711, 6, 1, 0, 0}, {8808, 4, 1, 0, 0},
+  {8812, 8, 1, 0, 0}, {8820, 9, 1, 0, 0}, {8829, 6, 1, 0, 0},
+  {1913, 8, 1, 0, 0}, {8835, 13, 1, 0, 0}, {1948, 9, 1, 0, 0},
+  {2013, 8, 1, 0, 0}, {2034, 7, 1, 0, 0}, {8848, 10, 1, 0, 0},
+  {8858, 6, 1, 0, 0}, {8864, 4, 1, 0, 0}, {8868, 7, 1, 0, 0},
+  {8875, 10, 1, 0, 0}, {8885, 14, 1, 0, 0}, {2647, 5, 1, 0, 0},
+  {8899, 11, 1, 0, 0}, {8910, 9, 1, 0, 0}, {3048, 9, 1, 0, 0},
+  {8919, 7, 1, 0, 0}, {8926, 10, 1, 0, 0}, {8936, 7, 1, 0, 0},
+  {8943, 9, 1, 0, 0}, {8952, 8, 1, 0, 0}, {8960, 11, 1, 0, 0},
+  {3840, 5, 1, 0, 0}, {8971, 10, 1, 0, 0}, {8981, 9, 1, 0, 0},
+  {8990, 10, 1, 0, 0}, {9000, 11, 1, 0, 0}, {9011, 11, 1, 0, 0},
+  {9022, 21, 1, 0, 0}, {9043, 5, 1, 0, 0}, {4667, 5, 1, 0, 0},
+  {9048, 10, 1, 0, 0}, {9058, 10, 1, 0, 0}, {9068, 7, 1, 0, 0},
+  {9075, 3, 1, 0, 0}, {9078, 8, 1, 0, 0}, {9086, 10, 1, 0, 0},
+  {5054, 6, 1, 0, 0}, {9096, 9, 1, 0, 0}, {5254, 8, 1, 0, 0},
+  {5341, 4, 1, 0, 0}, {9105, 9, 1, 0, 0}, {5440, 8, 1, 0, 0},
+  {9114, 7, 1, 0, 0}, {9121, 6, 1, 0, 0}, {5923, 7, 1, 0, 0},
+  {9127, 7, 1, 0, 0}, {9134, 5, 1, 0, 0}, {9139, 12, 1, 0, 0},
+  {6421, 5, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {8524, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {9151, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {9154, 3, 9, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {9157, 7, 1, 0, 0},
+  {9164, 4, 9, 0, 0}, {4113, 3, 1, 0, 0}, {9168, 4, 9, 0, 0},
+  {4380, 3, 1, 0, 0}, {4793, 5, 9, 0, 0}, {1308, 2, 1, 0, 0},
+  {9172, 2, 1, 0, 0}, {9174, 2, 1, 0, 0}, {3135, 2, 1, 0, 0},
+  {9176, 2, 1, 0, 0}, {9178, 2, 1, 0, 0}, {9180, 5, 18, 0, 0},
+  {9185, 10, 9, 0, 0}, {9195, 5, 9, 0, 0}, {9200, 10, 9, 0, 0},
+  {9210, 4, 9, 0, 0}, {9214, 9, 18, 0, 0}, {9223, 9, 9, 0, 0},
+  {9232, 11, 9, 0, 0}, {9243, 4, 9, 0, 0}, {9247, 7, 9, 0, 0},
+  {9254, 6, 9, 0, 0}, {9260, 6, 9, 0, 0}, {9266, 9, 9, 0, 0},
+  {9275, 8, 9, 0, 0}, {9283, 7, 9, 0, 0}, {9290, 4, 9, 0, 0},
+  {9294, 10, 18, 0, 0}, {9304, 14, 9, 0, 0}, {9318, 12, 9, 0, 0},
+  {9330, 9, 9, 0, 0}, {5026, 3, 9, 1, 7134}, {9339, 9, 9, 1, 7135},
+  {9348, 9, 9, 0, 0}, {9357, 7, 9, 0, 0}, {9364, 9, 9, 0, 0},
+  {9373, 6, 9, 0, 0}, {9379, 3, 9, 0, 0}, {9382, 5, 9, 0, 0}, {671, 3, 1, 0, 0},
+  {1340, 3, 1, 1, 7136}, {1466, 4, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {9387, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {9390, 6, 1, 0, 0}, {4062, 6, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {9396, 6, 1, 0, 0},
+  {9402, 3, 1, 0, 0}, {9405, 4, 1, 0, 0}, {9409, 7, 1, 0, 0},
+  {9416, 3, 1, 0, 0}, {9419, 4, 1, 0, 0}, {9423, 3, 1, 0, 0},
+  {9426, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {9429, 7, 9, 0, 0},
+  {9436, 11, 9, 0, 0}, {9447, 4, 9, 0, 0}, {9451, 3, 9, 0, 0},
+  {9454, 5, 9, 0, 0}, {50, 2, 1, 1, 7137}, {712, 3, 9, 0, 0},
+  {1308, 2, 1, 1, 7138}, {9459, 9, 0, 1, 7139}, {9468, 9, 18, 2, 7140},
+  {9477, 13, 9, 0, 0}, {9490, 13, 9, 0, 0}, {9174, 2, 1, 0, 0},
+  {3029, 4, 9, 0, 0}, {9503, 9, 9, 0, 0}, {9512, 12, 9, 0, 0},
+  {9524, 2, 1, 0, 0}, {9526, 8, 0, 2, 7142}, {9534, 4, 9, 0, 0},
+  {9538, 3, 1, 0, 0}, {9541, 3, 1, 0, 0}, {1340, 3, 1, 3, 7144},
+  {9544, 4, 1, 0, 0}, {1880, 3, 1, 9, 7147}, {2599, 3, 1, 5, 7156},
+  {2962, 2, 1, 0, 0}, {3029, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {9548, 3, 1, 0, 0}, {9551, 2, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {9553, 2, 1, 0, 0}, {9555, 3, 1, 0, 0}, {5040, 2, 1, 0, 0},
+  {9558, 3, 1, 0, 0}, {9561, 3, 1, 0, 0}, {9564, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {630, 2, 9, 0, 0}, {1071, 3, 9, 0, 0}, {1971, 2, 9, 0, 0},
+  {1992, 2, 9, 0, 0}, {2478, 2, 9, 0, 0}, {3823, 2, 9, 0, 0},
+  {6059, 2, 9, 0, 0}, {9566, 2, 9, 0, 0}, {712, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4089, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {9568, 2, 1, 0, 0},
+  {4677, 3, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {5009, 2, 9, 0, 0},
+  {9570, 3, 9, 0, 0}, {4280, 2, 9, 0, 0}, {712, 3, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {5564, 5, 1, 0, 0}, {6011, 2, 1, 0, 0}, {9573, 10, 9, 0, 0}, {50, 2, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {9583, 18, 0, 1, 7161}, {9601, 8, 0, 1, 7162},
+  {9512, 12, 9, 0, 0}, {9609, 8, 18, 0, 0}, {9617, 10, 9, 0, 0},
+  {2599, 3, 1, 0, 0}, {9627, 1, 1, 0, 0}, {9628, 1, 1, 0, 0},
+  {9629, 1, 1, 0, 0}, {9630, 1, 1, 0, 0}, {9631, 1, 1, 0, 0},
+  {9632, 1, 1, 0, 0}, {9633, 1, 1, 0, 0}, {9634, 1, 1, 0, 0},
+  {9635, 1, 1, 0, 0}, {9636, 1, 1, 0, 0}, {9637, 1, 1, 0, 0},
+  {9638, 1, 1, 0, 0}, {9639, 5, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {9644, 1, 1, 0, 0}, {9645, 1, 1, 0, 0}, {9646, 1, 1, 0, 0},
+  {9647, 1, 1, 0, 0}, {9648, 1, 1, 0, 0}, {9649, 1, 1, 0, 0},
+  {9650, 1, 1, 0, 0}, {9651, 1, 1, 0, 0}, {9652, 1, 1, 0, 0},
+  {9653, 1, 1, 0, 0}, {9654, 1, 1, 0, 0}, {9655, 1, 1, 0, 0},
+  {9656, 1, 1, 0, 0}, {9657, 1, 1, 0, 0}, {9658, 1, 1, 0, 0},
+  {9659, 1, 1, 0, 0}, {9660, 1, 1, 0, 0}, {9661, 1, 1, 0, 0},
+  {9662, 1, 1, 0, 0}, {9663, 1, 1, 0, 0}, {9664, 1, 1, 0, 0},
+  {9665, 1, 1, 0, 0}, {9666, 1, 1, 0, 0}, {9667, 1, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {9524, 2, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {9668, 11, 9, 0, 0}, {9429, 7, 9, 0, 0},
+  {9679, 7, 9, 0, 0}, {9686, 6, 9, 0, 0}, {9692, 10, 9, 0, 0},
+  {9702, 8, 9, 0, 0}, {9710, 8, 9, 0, 0}, {9718, 7, 9, 0, 0},
+  {9725, 4, 9, 0, 0}, {9729, 6, 9, 0, 0}, {9735, 5, 9, 0, 0},
+  {9740, 5, 9, 0, 0}, {9745, 3, 9, 0, 0}, {9748, 6, 9, 0, 0},
+  {9754, 6, 9, 0, 0}, {126, 6, 1, 0, 0}, {9760, 4, 1, 0, 0},
+  {9764, 11, 1, 0, 0}, {9775, 5, 1, 0, 0}, {9780, 7, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1872, 3, 1, 0, 0}, {9787, 5, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {9792, 7, 1, 0, 0}, {3975, 5, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {9799, 3, 1, 0, 0},
+  {4924, 10, 1, 0, 0}, {9802, 5, 1, 0, 0}, {9807, 7, 1, 0, 0},
+  {9814, 4, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1308, 2, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {9818, 8, 1, 0, 0}, {9760, 4, 1, 0, 0}, {380, 4, 1, 0, 0}, {744, 4, 1, 0, 0},
+  {9826, 7, 1, 0, 0}, {9833, 7, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {9840, 11, 1, 0, 0}, {9851, 10, 1, 0, 0}, {9861, 7, 1, 0, 0},
+  {9868, 8, 1, 0, 0}, {9876, 8, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {9884, 7, 1, 0, 0}, {9387, 3, 1, 0, 0}, {9891, 8, 1, 0, 0},
+  {9899, 9, 1, 0, 0}, {3029, 4, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {9908, 8, 1, 0, 0}, {3903, 3, 1, 0, 0}, {9916, 10, 1, 0, 0},
+  {9390, 6, 1, 0, 0}, {9926, 7, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {9933, 6, 1, 0, 0}, {9939, 8, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {9947, 6, 1, 0, 0}, {9953, 13, 1, 0, 0}, {9966, 8, 1, 0, 0},
+  {9974, 11, 1, 0, 0}, {9985, 6, 1, 0, 0}, {9991, 7, 1, 0, 0},
+  {9998, 5, 1, 0, 0}, {10003, 10, 1, 0, 0}, {10013, 5, 1, 0, 0},
+  {10018, 10, 1, 0, 0}, {6011, 2, 1, 0, 0}, {9379, 3, 1, 0, 0},
+  {6357, 4, 1, 0, 0}, {10028, 6, 1, 0, 0}, {28, 3, 1, 0, 0},
+  {10034, 3, 1, 0, 0}, {10037, 3, 1, 0, 0}, {10040, 3, 1, 0, 0},
+  {10043, 3, 1, 0, 0}, {233, 2, 1, 0, 0}, {10046, 5, 1, 0, 0},
+  {10051, 9, 1, 0, 0}, {333, 3, 1, 0, 0}, {10060, 3, 1, 0, 0},
+  {377, 3, 1, 0, 0}, {10063, 3, 1, 0, 0}, {9638, 1, 1, 0, 0},
+  {10066, 7, 1, 0, 0}, {10073, 5, 1, 0, 0}, {10078, 3, 1, 0, 0},
+  {10081, 3, 1, 0, 0}, {709, 3, 1, 0, 0}, {744, 4, 1, 0, 0},
+  {10084, 3, 1, 0, 0}, {10087, 8, 1, 0, 0}, {10095, 3, 1, 0, 0},
+  {10098, 13, 1, 0, 0}, {10111, 8, 1, 0, 0}, {10119, 6, 1, 0, 0},
+  {10125, 3, 1, 0, 0}, {10128, 3, 1, 0, 0}, {10131, 3, 1, 0, 0},
+  {1340, 3, 1, 3, 7163}, {10134, 8, 1, 0, 0}, {1466, 4, 1, 0, 0},
+  {10142, 3, 1, 0, 0}, {10145, 3, 1, 0, 0}, {10148, 6, 1, 0, 0},
+  {10154, 8, 1, 0, 0}, {10162, 3, 1, 0, 0}, {10165, 3, 1, 0, 0},
+  {10168, 3, 1, 0, 0}, {1717, 3, 1, 0, 0}, {10171, 3, 1, 0, 0},
+  {1872, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {10174, 3, 1, 0, 0},
+  {10177, 3, 1, 0, 0}, {10180, 3, 1, 0, 0}, {10183, 3, 1, 0, 0},
+  {10186, 3, 1, 0, 0}, {10189, 3, 1, 0, 0}, {10192, 3, 1, 0, 0},
+  {10195, 5, 1, 0, 0}, {10200, 4, 1, 0, 0}, {10204, 7, 1, 0, 0},
+  {2258, 2, 1, 0, 0}, {10211, 3, 1, 0, 0}, {10214, 6, 1, 0, 0},
+  {10220, 3, 1, 0, 0}, {10223, 3, 1, 0, 0}, {10226, 3, 1, 0, 0},
+  {10229, 3, 1, 0, 0}, {10232, 3, 1, 0, 0}, {10235, 3, 1, 0, 0},
+  {10238, 7, 1, 0, 0}, {2599, 3, 1, 27, 7166}, {10245, 3, 1, 0, 0},
+  {10248, 3, 1, 0, 0}, {10251, 3, 1, 0, 0}, {10254, 3, 1, 0, 0},
+  {10257, 3, 1, 0, 0}, {10260, 5, 1, 0, 0}, {10265, 3, 1, 0, 0},
+  {10268, 9, 1, 0, 0}, {10277, 3, 1, 0, 0}, {10280, 3, 1, 0, 0},
+  {10283, 3, 1, 27, 7193}, {10286, 3, 1, 0, 0}, {10289, 3, 1, 0, 0},
+  {10292, 8, 1, 0, 0}, {10300, 6, 1, 0, 0}, {10306, 6, 1, 0, 0},
+  {10312, 6, 1, 0, 0}, {10318, 7, 1, 0, 0}, {10325, 3, 1, 0, 0},
+  {3837, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {10328, 6, 1, 0, 0},
+  {4030, 2, 1, 0, 0}, {10334, 3, 1, 0, 0}, {10337, 5, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {10342, 7, 1, 0, 0}, {8524, 3, 2, 0, 0},
+  {10349, 3, 1, 0, 0}, {10352, 3, 1, 0, 0}, {10355, 3, 1, 0, 0},
+  {4344, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {10358, 6, 1, 0, 0},
+  {10364, 6, 1, 0, 0}, {10370, 3, 1, 0, 0}, {10373, 3, 1, 0, 0},
+  {4677, 3, 1, 0, 0}, {10376, 3, 1, 0, 0}, {10379, 3, 1, 0, 0},
+  {10382, 3, 1, 0, 0}, {10385, 3, 1, 0, 0}, {4793, 5, 1, 0, 0},
+  {10388, 3, 1, 0, 0}, {10391, 6, 1, 0, 0}, {10397, 3, 1, 0, 0},
+  {10400, 8, 1, 0, 0}, {4975, 3, 1, 0, 0}, {10408, 9, 1, 0, 0},
+  {10417, 8, 1, 0, 0}, {10425, 8, 1, 0, 0}, {10433, 5, 1, 0, 0},
+  {10438, 10, 1, 0, 0}, {10448, 10, 1, 0, 0}, {10458, 11, 1, 0, 0},
+  {10469, 8, 1, 0, 0}, {10477, 3, 1, 0, 0}, {10480, 3, 1, 0, 0},
+  {10483, 3, 1, 0, 0}, {10486, 3, 1, 0, 0}, {10489, 8, 1, 0, 0},
+  {10497, 3, 1, 0, 0}, {5717, 4, 1, 0, 0}, {5721, 2, 1, 0, 0},
+  {10500, 3, 1, 0, 0}, {10503, 3, 1, 0, 0}, {10506, 3, 1, 0, 0},
+  {10509, 3, 1, 0, 0}, {10512, 3, 1, 0, 0}, {9402, 3, 1, 0, 0},
+  {6011, 2, 1, 0, 0}, {10515, 3, 1, 0, 0}, {6125, 3, 1, 0, 0},
+  {10518, 3, 1, 0, 0}, {10521, 4, 1, 0, 0}, {6357, 4, 1, 0, 0},
+  {10525, 3, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {10528, 2, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {10530, 9, 9, 0, 0}, {1308, 2, 9, 0, 0}, {1308, 2, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {1340, 3, 1, 1, 7220}, {2599, 3, 1, 0, 0},
+  {10539, 9, 9, 0, 0}, {3903, 3, 1, 0, 0}, {10548, 7, 9, 0, 0},
+  {10555, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {10557, 3, 9, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {8479, 2, 9, 0, 0}, {10560, 2, 1, 0, 0},
+  {10562, 5, 18, 0, 0}, {9639, 5, 9, 0, 0}, {10567, 2, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {1308, 2, 9, 0, 0}, {10569, 2, 1, 0, 0},
+  {10571, 2, 1, 0, 0}, {9512, 12, 9, 0, 0}, {10573, 2, 1, 0, 0},
+  {4170, 2, 1, 0, 0}, {4215, 2, 1, 0, 0}, {9740, 5, 9, 0, 0},
+  {10575, 2, 1, 0, 0}, {9551, 2, 1, 0, 0}, {4275, 2, 1, 0, 0},
+  {10577, 2, 1, 0, 0}, {4472, 2, 1, 0, 0}, {10579, 2, 1, 0, 0},
+  {5376, 2, 1, 0, 0}, {10581, 2, 1, 0, 0}, {10583, 4, 0, 1, 7221},
+  {9429, 7, 9, 0, 0}, {10587, 3, 9, 0, 0}, {10590, 13, 9, 0, 0},
+  {10603, 9, 9, 0, 0}, {10612, 11, 9, 0, 0}, {10623, 8, 9, 0, 0},
+  {10631, 9, 9, 0, 0}, {10640, 5, 0, 1, 7222}, {10645, 6, 9, 0, 0},
+  {2599, 3, 1, 0, 0}, {8527, 8, 9, 0, 0}, {9573, 10, 9, 0, 0},
+  {9447, 4, 9, 0, 0}, {9451, 3, 9, 0, 0}, {9454, 5, 9, 0, 0},
+  {8527, 8, 9, 0, 0}, {10651, 7, 9, 0, 0}, {10658, 7, 18, 1, 7223},
+  {10665, 4, 0, 2, 7224}, {10669, 6, 9, 0, 0}, {9503, 9, 9, 0, 0},
+  {10675, 14, 9, 0, 0}, {9512, 12, 9, 0, 0}, {10689, 7, 9, 0, 0},
+  {50, 2, 1, 0, 0}, {10696, 4, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {9172, 2, 1, 0, 0}, {1880, 3, 1, 0, 0}, {10700, 3, 9, 0, 0},
+  {10703, 2, 1, 0, 0}, {10705, 4, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {3833, 2, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4215, 2, 9, 0, 0},
+  {9524, 2, 1, 0, 0}, {4380, 3, 1, 0, 0}, {10709, 6, 1, 0, 0},
+  {10715, 15, 1, 0, 0}, {10730, 3, 4, 0, 0}, {8527, 8, 9, 0, 0},
+  {1308, 2, 1, 0, 0}, {9387, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {10733, 7, 0, 1, 7226}, {10740, 6, 18, 0, 0},
+  {10746, 6, 9, 0, 0}, {10752, 9, 9, 0, 0}, {10761, 7, 0, 1, 7227},
+  {10768, 8, 0, 1, 7228}, {10776, 4, 9, 0, 0}, {10780, 10, 0, 2, 7229},
+  {10790, 8, 9, 0, 0}, {10798, 7, 9, 1, 7231}, {9601, 8, 9, 0, 0},
+  {10805, 8, 9, 0, 0}, {10813, 11, 18, 0, 0}, {10824, 10, 18, 0, 0},
+  {10834, 3, 9, 2, 7232}, {10837, 9, 9, 0, 0}, {10846, 8, 9, 1, 7234},
+  {10854, 7, 9, 0, 0}, {10861, 7, 0, 3, 7235}, {10868, 3, 0, 8, 7238},
+  {10871, 10, 18, 0, 0}, {10881, 7, 18, 0, 0}, {10888, 11, 9, 0, 0},
+  {10899, 12, 0, 2, 7246}, {10911, 5, 9, 0, 0}, {10916, 5, 9, 0, 0},
+  {10921, 9, 9, 0, 0}, {9639, 5, 9, 0, 0}, {9429, 7, 9, 0, 0},
+  {10776, 4, 9, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {10930, 2, 1, 0, 0},
+  {715, 2, 1, 0, 0}, {10932, 10, 9, 0, 0}, {1340, 3, 1, 1, 7248},
+  {10942, 2, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2220, 2, 1, 0, 0},
+  {2449, 2, 1, 0, 0}, {2599, 3, 1, 0, 0}, {2652, 2, 1, 0, 0},
+  {10944, 2, 1, 0, 0}, {10946, 2, 1, 0, 0}, {10948, 2, 1, 0, 0},
+  {10950, 2, 1, 0, 0}, {10952, 2, 1, 0, 0}, {10954, 2, 1, 0, 0},
+  {2799, 2, 1, 0, 0}, {10956, 2, 1, 0, 0}, {2806, 2, 1, 0, 0},
+  {10958, 12, 9, 0, 0}, {10970, 2, 1, 0, 0}, {10972, 2, 1, 0, 0},
+  {10974, 2, 1, 0, 0}, {10976, 2, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {3944, 2, 1, 0, 0}, {4113, 3, 1, 0, 0}, {10978, 2, 1, 0, 0},
+  {10980, 2, 1, 0, 0}, {4380, 3, 1, 0, 0}, {10982, 2, 1, 0, 0},
+  {10984, 12, 0, 1, 7249}, {5144, 2, 1, 0, 0}, {5211, 2, 1, 0, 0},
+  {5282, 2, 1, 0, 0}, {5412, 2, 1, 0, 0}, {5649, 2, 1, 0, 0},
+  {5830, 2, 1, 0, 0}, {6016, 2, 1, 0, 0}, {10996, 2, 1, 0, 0},
+  {6667, 10, 1, 0, 0}, {7296, 10, 1, 0, 0}, {10998, 10, 1, 0, 0},
+  {11008, 2, 1, 0, 0}, {11010, 2, 1, 0, 0}, {11012, 2, 1, 0, 0},
+  {11014, 4, 1, 0, 0}, {11018, 5, 9, 0, 0}, {1340, 3, 1, 1, 7250},
+  {11023, 3, 9, 0, 0}, {1880, 3, 1, 0, 0}, {11026, 16, 9, 1, 7251},
+  {11042, 4, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {11046, 9, 9, 0, 0}, {11055, 6, 9, 0, 0},
+  {3903, 3, 1, 0, 0}, {11061, 4, 9, 0, 0}, {11065, 3, 9, 0, 0},
+  {4113, 3, 1, 0, 0}, {8524, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {11068, 4, 18, 0, 0}, {10388, 3, 1, 0, 0}, {11072, 4, 9, 1, 7252},
+  {11076, 8, 9, 0, 0}, {9379, 3, 1, 0, 0}, {11084, 3, 18, 0, 0},
+  {11087, 6, 9, 0, 0}, {11093, 4, 18, 0, 0}, {11097, 5, 9, 0, 0},
+  {11102, 10, 9, 0, 0}, {11112, 2, 9, 0, 0}, {11114, 13, 9, 1, 7253},
+  {126, 6, 9, 0, 0}, {11127, 10, 9, 0, 0}, {11137, 13, 9, 0, 0},
+  {11150, 10, 9, 0, 0}, {11160, 17, 9, 0, 0}, {11177, 9, 0, 50, 7254},
+  {11186, 10, 9, 0, 0}, {11196, 8, 9, 0, 0}, {11204, 8, 9, 0, 0},
+  {11212, 14, 9, 0, 0}, {11226, 19, 9, 0, 0}, {11245, 7, 9, 1, 7304},
+  {352, 2, 9, 0, 0}, {11252, 16, 9, 0, 0}, {11268, 12, 9, 0, 0},
+  {11280, 20, 9, 0, 0}, {11300, 7, 9, 0, 0}, {11307, 14, 9, 0, 0},
+  {11321, 11, 9, 0, 0}, {11332, 11, 9, 0, 0}, {11343, 10, 9, 0, 0},
+  {11353, 7, 9, 0, 0}, {8527, 8, 9, 0, 0}, {11360, 8, 9, 0, 0},
+  {11368, 7, 9, 0, 0}, {11375, 11, 9, 2, 7305}, {11386, 6, 9, 0, 0},
+  {11392, 7, 9, 0, 0}, {854, 2, 9, 0, 0}, {11399, 13, 9, 0, 0},
+  {11412, 5, 9, 0, 0}, {10932, 10, 9, 0, 0}, {11417, 7, 9, 0, 0},
+  {11424, 7, 9, 0, 0}, {11431, 10, 9, 0, 0}, {11441, 12, 9, 0, 0},
+  {11453, 15, 9, 0, 0}, {11468, 15, 9, 0, 0}, {11483, 15, 9, 0, 0},
+  {1306, 2, 9, 0, 0}, {1308, 2, 9, 0, 0}, {11498, 4, 0, 3, 7307},
+  {11502, 8, 9, 0, 0}, {11510, 12, 18, 3, 7310}, {11522, 10, 9, 0, 0},
+  {11532, 10, 0, 2, 7313}, {11542, 10, 9, 0, 0}, {11552, 10, 9, 0, 0},
+  {11562, 8, 9, 0, 0}, {11570, 5, 9, 0, 0}, {11575, 8, 9, 0, 0},
+  {11583, 8, 9, 0, 0}, {11591, 8, 9, 0, 0}, {11599, 8, 9, 0, 0},
+  {1638, 2, 9, 0, 0}, {11607, 15, 9, 0, 0}, {11622, 13, 18, 0, 0},
+  {11635, 18, 18, 0, 0}, {11653, 11, 9, 0, 0}, {11664, 10, 9, 0, 0},
+  {11674, 11, 9, 0, 0}, {11685, 8, 9, 0, 0}, {11693, 7, 9, 0, 0},
+  {11700, 10, 9, 0, 0}, {11710, 11, 9, 0, 0}, {11721, 9, 9, 0, 0},
+  {11730, 7, 9, 0, 0}, {11737, 6, 9, 0, 0}, {11743, 8, 9, 0, 0},
+  {11751, 12, 9, 0, 0}, {11763, 7, 9, 0, 0}, {11770, 10, 9, 0, 0},
+  {11780, 8, 9, 0, 0}, {11788, 14, 9, 0, 0}, {11802, 14, 9, 0, 0},
+  {11816, 11, 9, 0, 0}, {11827, 11, 9, 0, 0}, {11838, 11, 9, 0, 0},
+  {11849, 9, 9, 0, 0}, {11858, 11, 9, 0, 0}, {11869, 13, 9, 0, 0},
+  {11882, 11, 9, 0, 0}, {11893, 13, 9, 0, 0}, {11906, 13, 9, 0, 0},
+  {11919, 10, 9, 0, 0}, {11929, 11, 9, 0, 0}, {11940, 11, 9, 0, 0},
+  {11951, 5, 9, 0, 0}, {11956, 16, 9, 17, 7315}, {11972, 9, 9, 0, 0},
+  {11981, 15, 9, 0, 0}, {11996, 15, 9, 0, 0}, {12011, 13, 9, 0, 0},
+  {12024, 16, 9, 0, 0}, {1992, 2, 9, 0, 0}, {12040, 8, 0, 8, 7332},
+  {12048, 8, 9, 0, 0}, {12056, 11, 9, 0, 0}, {12067, 16, 9, 0, 0},
+  {12083, 14, 9, 0, 0}, {12097, 5, 0, 1, 7340}, {12102, 11, 9, 0, 0},
+  {12113, 16, 9, 0, 0}, {12129, 5, 9, 0, 0}, {12134, 11, 9, 0, 0},
+  {12145, 12, 9, 0, 0}, {12157, 10, 9, 0, 0}, {12167, 9, 9, 0, 0},
+  {12176, 8, 9, 0, 0}, {12184, 7, 9, 0, 0}, {12191, 7, 9, 0, 0},
+  {12198, 7, 9, 0, 0}, {12205, 7, 9, 0, 0}, {12212, 7, 9, 0, 0},
+  {12219, 7, 9, 0, 0}, {12226, 7, 9, 0, 0}, {12233, 7, 9, 0, 0},
+  {12240, 7, 9, 0, 0}, {12247, 7, 9, 0, 0}, {12254, 7, 9, 0, 0},
+  {12261, 7, 9, 0, 0}, {12268, 7, 9, 0, 0}, {12275, 7, 9, 0, 0},
+  {12282, 7, 9, 0, 0}, {12289, 7, 9, 0, 0}, {12296, 7, 9, 0, 0},
+  {12303, 7, 9, 0, 0}, {12310, 7, 9, 0, 0}, {12317, 7, 9, 0, 0},
+  {12324, 7, 9, 0, 0}, {12331, 7, 9, 0, 0}, {12338, 7, 9, 0, 0},
+  {12345, 7, 9, 0, 0}, {12352, 7, 9, 0, 0}, {12359, 7, 9, 0, 0},
+  {12366, 7, 9, 0, 0}, {12373, 7, 9, 0, 0}, {12380, 7, 9, 0, 0},
+  {12387, 7, 9, 0, 0}, {12394, 7, 9, 0, 0}, {12401, 7, 9, 0, 0},
+  {12408, 7, 9, 0, 0}, {12415, 7, 9, 0, 0}, {12422, 7, 9, 0, 0},
+  {12429, 7, 9, 0, 0}, {12436, 7, 9, 0, 0}, {12443, 7, 9, 0, 0},
+  {12450, 7, 9, 0, 0}, {12457, 7, 9, 0, 0}, {12464, 7, 9, 0, 0},
+  {12471, 7, 9, 0, 0}, {12478, 7, 9, 0, 0}, {12485, 7, 9, 0, 0},
+  {12492, 7, 9, 0, 0}, {12499, 7, 9, 0, 0}, {12506, 7, 9, 0, 0},
+  {12513, 10, 9, 0, 0}, {12523, 8, 9, 0, 0}, {12531, 12, 9, 0, 0},
+  {12543, 7, 9, 0, 0}, {12550, 5, 9, 0, 0}, {12555, 17, 9, 0, 0},
+  {12572, 6, 9, 0, 0}, {12578, 10, 9, 0, 0}, {12588, 10, 9, 0, 0},
+  {10669, 6, 9, 0, 0}, {12598, 11, 9, 0, 0}, {2606, 2, 9, 0, 0},
+  {12609, 17, 9, 0, 0}, {12626, 9, 9, 0, 0}, {12635, 9, 9, 0, 0},
+  {12644, 6, 9, 0, 0}, {2799, 2, 9, 0, 0}, {12650, 10, 9, 0, 0},
+  {12660, 9, 9, 0, 0}, {12669, 15, 9, 0, 0}, {12684, 14, 9, 0, 0},
+  {12698, 8, 9, 0, 0}, {12706, 18, 0, 1, 7341}, {12724, 8, 9, 0, 0},
+  {12732, 7, 0, 2, 7342}, {12739, 15, 9, 0, 0}, {2929, 2, 9, 0, 0},
+  {12754, 9, 9, 0, 0}, {12763, 9, 0, 2, 7344}, {12772, 9, 9, 0, 0},
+  {12781, 12, 9, 0, 0}, {12793, 14, 9, 0, 0}, {12807, 12, 9, 0, 0},
+  {12819, 15, 9, 0, 0}, {12834, 14, 9, 0, 0}, {12848, 12, 9, 0, 0},
+  {12860, 9, 9, 0, 0}, {12869, 17, 9, 0, 0}, {12886, 8, 9, 0, 0},
+  {12894, 18, 9, 0, 0}, {12912, 13, 9, 0, 0}, {12925, 13, 9, 0, 0},
+  {12938, 11, 9, 0, 0}, {12949, 21, 9, 0, 0}, {12970, 9, 9, 0, 0},
+  {12979, 10, 9, 0, 0}, {12989, 9, 9, 0, 0}, {12998, 16, 9, 0, 0},
+  {13014, 11, 9, 0, 0}, {13025, 15, 9, 0, 0}, {13040, 11, 9, 0, 0},
+  {13051, 12, 9, 0, 0}, {13063, 16, 9, 0, 0}, {13079, 10, 9, 0, 0},
+  {13089, 13, 9, 0, 0}, {13102, 14, 9, 0, 0}, {13116, 10, 9, 0, 0},
+  {13126, 12, 9, 0, 0}, {13138, 20, 9, 0, 0}, {13158, 17, 9, 0, 0},
+  {13175, 11, 9, 0, 0}, {13186, 15, 9, 0, 0}, {13201, 13, 9, 0, 0},
+  {13214, 14, 9, 0, 0}, {13228, 12, 9, 0, 0}, {13240, 12, 9, 0, 0},
+  {13252, 11, 9, 0, 0}, {13263, 14, 9, 0, 0}, {13277, 16, 9, 0, 0},
+  {13293, 11, 9, 0, 0}, {13304, 13, 9, 0, 0}, {13317, 15, 9, 0, 0},
+  {13332, 12, 9, 0, 0}, {13344, 14, 9, 0, 0}, {13358, 17, 9, 0, 0},
+  {13375, 12, 9, 0, 0}, {13387, 7, 9, 0, 0}, {13394, 13, 9, 0, 0},
+  {13407, 12, 9, 0, 0}, {13419, 16, 9, 0, 0}, {13435, 13, 9, 0, 0},
+  {13448, 7, 9, 0, 0}, {13455, 16, 9, 0, 0}, {13471, 8, 9, 0, 0},
+  {13479, 11, 9, 0, 0}, {13490, 15, 9, 0, 0}, {13505, 8, 9, 0, 0},
+  {13513, 13, 9, 0, 0}, {13526, 16, 9, 0, 0}, {3135, 2, 9, 0, 0},
+  {13542, 9, 9, 0, 0}, {10768, 8, 0, 1, 7346}, {13551, 6, 0, 1, 7347},
+  {13557, 3, 9, 0, 0}, {13560, 9, 9, 0, 0}, {13569, 9, 9, 0, 0},
+  {13578, 5, 9, 0, 0}, {3359, 2, 9, 0, 0}, {13583, 8, 9, 0, 0},
+  {13591, 9, 9, 0, 0}, {13600, 10, 9, 0, 0}, {13610, 6, 0, 2, 7348},
+  {13616, 13, 18, 0, 0}, {13629, 17, 0, 1, 7350}, {13646, 4, 0, 1, 7351},
+  {13650, 6, 9, 0, 0}, {13656, 10, 9, 0, 0}, {13666, 13, 9, 0, 0},
+  {13679, 11, 0, 1, 7352}, {13690, 8, 9, 0, 0}, {13698, 11, 9, 0, 0},
+  {13709, 9, 9, 1, 7353}, {13718, 3, 9, 0, 0}, {13721, 10, 9, 0, 0},
+  {13731, 17, 9, 0, 0}, {13748, 9, 9, 0, 0}, {13757, 7, 9, 0, 0},
+  {13764, 8, 9, 0, 0}, {13772, 7, 9, 0, 0}, {13779, 8, 9, 0, 0},
+  {13787, 11, 9, 0, 0}, {13798, 16, 9, 0, 0}, {13814, 12, 9, 0, 0},
+  {13826, 9, 9, 0, 0}, {9512, 12, 9, 0, 0}, {13835, 7, 9, 0, 0},
+  {13842, 13, 0, 11, 7354}, {13855, 8, 9, 0, 0}, {13863, 5, 9, 0, 0},
+  {13868, 8, 9, 0, 0}, {13876, 10, 9, 0, 0}, {13886, 7, 9, 0, 0},
+  {4217, 2, 9, 0, 0}, {13893, 11, 0, 1, 7365}, {13904, 21, 0, 1, 7366},
+  {13925, 10, 9, 0, 0}, {13935, 9, 9, 0, 0}, {13944, 8, 9, 0, 0},
+  {13952, 9, 9, 0, 0}, {13961, 5, 9, 0, 0}, {13966, 10, 9, 0, 0},
+  {13976, 7, 9, 0, 0}, {13983, 15, 9, 0, 0}, {13998, 11, 9, 0, 0},
+  {14009, 12, 9, 0, 0}, {14021, 18, 9, 0, 0}, {14039, 6, 9, 0, 0},
+  {14045, 8, 18, 0, 0}, {14053, 5, 9, 0, 0}, {14058, 8, 9, 0, 0},
+  {14066, 11, 9, 0, 0}, {14077, 17, 9, 0, 0}, {14094, 7, 9, 0, 0},
+  {14101, 10, 9, 0, 0}, {14111, 12, 9, 0, 0}, {14123, 5, 0, 1, 7367},
+  {14128, 12, 9, 0, 0}, {14140, 14, 9, 1, 7368}, {14154, 3, 9, 0, 0},
+  {14157, 6, 9, 0, 0}, {10579, 2, 9, 0, 0}, {14163, 11, 9, 0, 0},
+  {14174, 10, 9, 0, 0}, {14184, 12, 18, 0, 0}, {14196, 8, 9, 0, 0},
+  {14204, 8, 9, 0, 0}, {14212, 6, 0, 1, 7369}, {14218, 7, 9, 0, 0},
+  {14225, 14, 9, 0, 0}, {14239, 7, 9, 0, 0}, {5015, 2, 9, 0, 0},
+  {5040, 2, 9, 0, 0}, {14246, 16, 9, 0, 0}, {14262, 7, 9, 0, 0},
+  {14269, 15, 9, 0, 0}, {9748, 6, 9, 0, 0}, {14284, 14, 9, 0, 0},
+  {14298, 11, 9, 0, 0}, {14309, 8, 9, 0, 0}, {14317, 9, 9, 0, 0},
+  {14326, 18, 9, 0, 0}, {14344, 13, 9, 0, 0}, {14357, 8, 9, 0, 0},
+  {14365, 9, 9, 0, 0}, {14374, 13, 9, 0, 0}, {14387, 9, 9, 0, 0},
+  {14396, 11, 9, 0, 0}, {14407, 8, 9, 0, 0}, {14415, 8, 9, 0, 0},
+  {14423, 8, 9, 0, 0}, {14431, 9, 9, 0, 0}, {14440, 10, 9, 0, 0},
+  {14450, 12, 9, 0, 0}, {14462, 10, 9, 0, 0}, {14472, 7, 9, 0, 0},
+  {14479, 10, 9, 0, 0}, {14489, 10, 9, 0, 0}, {14499, 7, 9, 0, 0},
+  {14506, 10, 9, 0, 0}, {14516, 8, 9, 0, 0}, {14524, 13, 9, 0, 0},
+  {14537, 17, 9, 0, 0}, {14554, 6, 0, 1, 7370}, {14560, 12, 9, 0, 0},
+  {14572, 11, 9, 0, 0}, {14583, 10, 0, 1, 7371}, {14593, 12, 9, 0, 0},
+  {14605, 8, 9, 0, 0}, {14613, 9, 9, 0, 0}, {14622, 13, 9, 0, 0},
+  {14635, 16, 9, 0, 0}, {14651, 12, 9, 0, 0}, {14663, 13, 9, 0, 0},
+  {14676, 15, 9, 0, 0}, {14691, 8, 0, 1, 7372}, {6032, 2, 9, 0, 0},
+  {14699, 13, 9, 0, 0}, {6059, 2, 9, 0, 0}, {6061, 2, 9, 0, 0},
+  {14712, 10, 9, 0, 0}, {14722, 12, 18, 0, 0}, {14734, 10, 0, 3, 7373},
+  {14744, 10, 9, 0, 0}, {14754, 8, 0, 1, 7376}, {14762, 10, 9, 0, 0},
+  {14772, 11, 9, 0, 0}, {14783, 7, 9, 0, 0}, {14790, 12, 9, 0, 0},
+  {14802, 12, 9, 0, 0}, {14814, 10, 9, 0, 0}, {14824, 15, 9, 1, 7377},
+  {14839, 12, 9, 0, 0}, {14851, 7, 9, 0, 0}, {14858, 14, 9, 0, 0},
+  {14872, 5, 9, 2, 7378}, {14877, 8, 9, 0, 0}, {8479, 2, 9, 0, 0},
+  {14885, 7, 9, 0, 0}, {14892, 3, 9, 0, 0}, {10854, 7, 9, 0, 0},
+  {1638, 2, 9, 0, 0}, {10752, 9, 9, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {9172, 2, 1, 0, 0}, {2135, 2, 1, 0, 0}, {10703, 2, 1, 0, 0},
+  {9524, 2, 1, 0, 0}, {5040, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {10254, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {14895, 4, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {14899, 3, 9, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 9, 0, 0}, {50, 2, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {1340, 3, 1, 2, 7380}, {14902, 7, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3686, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {4667, 5, 1, 0, 0},
+  {4677, 3, 1, 0, 0}, {5851, 2, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {1308, 2, 9, 0, 0}, {14909, 2, 9, 0, 0}, {14911, 11, 0, 2, 7382},
+  {14922, 4, 0, 1, 7384}, {14926, 5, 9, 0, 0}, {9436, 11, 9, 0, 0},
+  {9447, 4, 9, 0, 0}, {9451, 3, 9, 0, 0}, {9454, 5, 9, 0, 0},
+  {9639, 5, 9, 0, 0}, {8527, 8, 9, 0, 0}, {11392, 7, 9, 0, 0},
+  {1340, 3, 9, 0, 0}, {14931, 13, 9, 0, 0}, {14944, 7, 0, 1, 7385},
+  {14951, 6, 9, 0, 0}, {14957, 5, 9, 2, 7386}, {14962, 18, 9, 0, 0},
+  {14980, 7, 9, 0, 0}, {14987, 10, 9, 0, 0}, {14997, 8, 9, 0, 0},
+  {15005, 7, 9, 0, 0}, {15012, 10, 9, 0, 0}, {15022, 8, 9, 0, 0},
+  {15030, 7, 9, 0, 0}, {15037, 15, 9, 0, 0}, {15052, 7, 9, 0, 0},
+  {15059, 6, 9, 0, 0}, {12113, 16, 9, 0, 0}, {15065, 6, 18, 0, 0},
+  {15071, 15, 9, 0, 0}, {15086, 9, 9, 0, 0}, {15095, 4, 9, 0, 0},
+  {15099, 14, 9, 1, 7388}, {15113, 12, 0, 1, 7389}, {15125, 9, 9, 0, 0},
+  {15134, 6, 9, 0, 0}, {15140, 9, 9, 0, 0}, {15149, 6, 9, 0, 0},
+  {15155, 6, 9, 0, 0}, {15161, 12, 9, 0, 0}, {15173, 11, 9, 0, 0},
+  {15184, 10, 9, 0, 0}, {15194, 7, 9, 0, 0}, {15201, 10, 9, 0, 0},
+  {15211, 9, 9, 0, 0}, {15220, 12, 9, 0, 0}, {15232, 10, 9, 0, 0},
+  {15242, 10, 9, 0, 0}, {9503, 9, 9, 0, 0}, {13650, 6, 9, 0, 0},
+  {15252, 10, 9, 0, 0}, {15262, 10, 9, 0, 0}, {15272, 10, 9, 0, 0},
+  {15282, 9, 9, 0, 0}, {15291, 8, 9, 0, 0}, {15299, 6, 9, 0, 0},
+  {15305, 13, 9, 0, 0}, {9512, 12, 9, 0, 0}, {15318, 14, 9, 0, 0},
+  {15332, 11, 9, 0, 0}, {15343, 5, 9, 0, 0}, {15348, 12, 0, 1, 7390},
+  {10689, 7, 9, 0, 0}, {15360, 9, 9, 0, 0}, {15369, 7, 9, 0, 0},
+  {15376, 20, 9, 0, 0}, {15396, 11, 9, 0, 0}, {15407, 10, 9, 0, 0},
+  {15417, 10, 9, 0, 0}, {15427, 13, 9, 0, 0}, {15440, 9, 18, 0, 0},
+  {15449, 12, 9, 0, 0}, {15461, 11, 9, 0, 0}, {15472, 23, 9, 0, 0},
+  {15495, 21, 9, 0, 0}, {15516, 3, 9, 0, 0}, {15519, 8, 9, 0, 0},
+  {15527, 4, 9, 0, 0}, {15531, 4, 9, 0, 0}, {15535, 12, 9, 0, 0},
+  {9210, 4, 9, 0, 0}, {2255, 3, 9, 0, 0}, {15547, 7, 18, 0, 0},
+  {15554, 13, 9, 0, 0}, {15567, 5, 9, 0, 0}, {15572, 3, 18, 0, 0},
+  {15575, 8, 18, 0, 0}, {15583, 9, 0, 1, 7391}, {9266, 9, 9, 0, 0},
+  {10539, 9, 9, 0, 0}, {15592, 5, 9, 0, 0}, {14066, 11, 9, 0, 0},
+  {15597, 2, 9, 0, 0}, {15599, 11, 9, 0, 0}, {15610, 3, 18, 0, 0},
+  {15613, 8, 18, 0, 0}, {9373, 6, 9, 0, 0}, {15621, 7, 18, 0, 0},
+  {15628, 7, 9, 0, 0}, {15635, 9, 9, 1, 7392}, {15644, 13, 9, 0, 0},
+  {712, 3, 9, 0, 0}, {8527, 8, 9, 0, 0}, {1308, 2, 9, 0, 0},
+  {11042, 4, 9, 0, 0}, {9512, 12, 9, 0, 0}, {15657, 3, 9, 0, 0},
+  {5564, 5, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {377, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {9387, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {15660, 3, 1, 0, 0}, {9379, 3, 1, 0, 0},
+  {377, 3, 1, 0, 0}, {10696, 4, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {15663, 3, 1, 0, 0}, {15666, 3, 1, 0, 0},
+  {5851, 2, 1, 0, 0}, {15669, 5, 18, 1, 7393}, {15674, 4, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {10700, 3, 1, 0, 0},
+  {9387, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {3837, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {8516, 8, 9, 0, 0}, {4380, 3, 1, 0, 0},
+  {4677, 3, 1, 0, 0}, {15681, 3, 0, 1, 7394}, {1308, 2, 9, 0, 0},
+  {15684, 3, 1, 0, 0}, {1340, 3, 1, 1, 7395}, {1880, 3, 1, 0, 0},
+  {15687, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {3837, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {15693, 3, 1, 0, 0},
+  {15696, 4, 1, 0, 0}, {1340, 3, 1, 1, 7396}, {1880, 3, 1, 0, 0},
+  {15700, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {15703, 3, 1, 0, 0}, {15706, 8, 9, 0, 0}, {1340, 3, 1, 1, 7397},
+  {1880, 3, 1, 0, 0}, {9387, 3, 1, 0, 0}, {9512, 12, 9, 0, 0},
+  {8524, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {15714, 7, 18, 0, 0},
+  {712, 3, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {11127, 10, 9, 0, 0}, {9639, 5, 9, 0, 0},
+  {9429, 7, 9, 0, 0}, {15721, 11, 9, 0, 0}, {15732, 6, 0, 1, 7398},
+  {15738, 4, 9, 0, 0}, {15343, 5, 9, 0, 0}, {9609, 8, 18, 0, 0},
+  {15742, 13, 9, 0, 0}, {4451, 5, 0, 1, 7399}, {1308, 2, 9, 0, 0},
+  {15755, 6, 9, 0, 0}, {15761, 3, 9, 0, 0}, {15764, 5, 9, 0, 0},
+  {15769, 11, 9, 0, 0}, {15780, 5, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {15785, 13, 0, 1, 7400}, {15798, 10, 0, 2, 7401}, {15808, 2, 9, 0, 0},
+  {15810, 3, 9, 0, 0}, {15813, 5, 9, 0, 0}, {9512, 12, 9, 0, 0},
+  {15818, 15, 9, 0, 0}, {1308, 2, 9, 0, 0}, {50, 2, 1, 0, 0}, {712, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {4677, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {4793, 5, 9, 0, 0}, {15833, 4, 18, 0, 0}, {15837, 10, 9, 0, 0},
+  {15847, 8, 1, 0, 0}, {10696, 4, 1, 0, 0}, {15855, 6, 1, 0, 0},
+  {15861, 6, 1, 0, 0}, {8527, 8, 9, 0, 0}, {15867, 3, 1, 0, 0},
+  {15870, 9, 1, 0, 0}, {15879, 21, 1, 0, 0}, {15900, 31, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {15931, 7, 9, 0, 0}, {15938, 7, 9, 0, 0},
+  {15945, 18, 1, 0, 0}, {15963, 6, 9, 0, 0}, {15969, 5, 9, 0, 0},
+  {12157, 10, 9, 0, 0}, {12167, 9, 9, 0, 0}, {15974, 15, 1, 0, 0},
+  {15989, 7, 9, 0, 0}, {10705, 4, 1, 0, 0}, {15996, 5, 1, 0, 0},
+  {16001, 16, 1, 0, 0}, {16017, 7, 1, 0, 0}, {9512, 12, 9, 0, 0},
+  {8524, 3, 1, 0, 0}, {16024, 8, 1, 0, 0}, {16032, 6, 9, 0, 0},
+  {16038, 10, 1, 0, 0}, {16048, 4, 1, 0, 0}, {16052, 3, 1, 0, 0},
+  {5851, 2, 1, 0, 0}, {16055, 11, 1, 0, 0}, {16066, 3, 9, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {16069, 4, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {16073, 3, 1, 0, 0}, {1308, 2, 1, 0, 0}, {16076, 3, 9, 0, 0},
+  {16079, 4, 9, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {16083, 5, 9, 1, 7403}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3686, 3, 1, 0, 0}, {16088, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {712, 3, 9, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {16091, 2, 9, 0, 0}, {50, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1288, 5, 9, 0, 0},
+  {16093, 9, 9, 0, 0}, {16102, 11, 18, 0, 0}, {333, 3, 9, 0, 0},
+  {10696, 4, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {3946, 4, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {14489, 10, 9, 0, 0}, {16113, 9, 9, 0, 0}, {744, 4, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1638, 2, 9, 0, 0}, {1880, 3, 1, 0, 0},
+  {9387, 3, 1, 0, 0}, {10251, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {5860, 2, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {16122, 4, 1, 0, 0}, {3029, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {9379, 3, 1, 0, 0}, {630, 2, 9, 0, 0}, {1308, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {16126, 3, 9, 0, 0},
+  {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {16129, 3, 1, 0, 0}, {3008, 3, 9, 0, 0},
+  {3686, 3, 9, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {16132, 6, 9, 0, 0}, {6667, 10, 1, 0, 0}, {16138, 9, 1, 0, 0},
+  {16147, 11, 1, 0, 0}, {16158, 10, 1, 0, 0}, {7296, 10, 1, 0, 0},
+  {16168, 11, 1, 0, 0}, {16179, 10, 1, 0, 0}, {7883, 10, 1, 0, 0},
+  {10998, 10, 1, 0, 0}, {16189, 11, 1, 0, 0}, {16200, 9, 1, 0, 0},
+  {16209, 10, 1, 0, 0}, {16219, 11, 1, 0, 0}, {16230, 11, 1, 0, 0},
+  {16241, 10, 1, 0, 0}, {1103, 2, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {9387, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {16251, 11, 9, 0, 0},
+  {9223, 9, 9, 0, 0}, {16262, 7, 9, 0, 0}, {16269, 8, 9, 0, 0},
+  {16277, 4, 9, 0, 0}, {10776, 4, 9, 0, 0}, {16281, 8, 9, 0, 0},
+  {16289, 6, 9, 0, 0}, {16295, 6, 9, 0, 0}, {16301, 7, 9, 0, 0},
+  {16308, 7, 9, 0, 0}, {16315, 9, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {2324, 4, 9, 0, 0}, {16324, 4, 1, 0, 0},
+  {16328, 2, 1, 0, 0}, {4089, 4, 1, 0, 0}, {102, 5, 1, 0, 0}, {377, 3, 1, 0, 0},
+  {10696, 4, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1466, 4, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {11042, 4, 1, 0, 0}, {10705, 4, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {3837, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {16330, 5, 1, 0, 0}, {15663, 3, 1, 0, 0},
+  {4677, 3, 1, 0, 0}, {16335, 3, 1, 0, 0}, {5323, 4, 1, 0, 0},
+  {16338, 4, 1, 0, 0}, {16342, 5, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {16347, 4, 1, 0, 0}, {1065, 6, 1, 0, 0}, {1231, 4, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {16351, 7, 1, 0, 0}, {16358, 7, 1, 0, 0},
+  {2153, 4, 1, 0, 0}, {2304, 5, 1, 0, 0}, {2426, 5, 1, 0, 0},
+  {16365, 5, 1, 0, 0}, {3029, 4, 1, 0, 0}, {16370, 8, 1, 0, 0},
+  {16378, 6, 1, 0, 0}, {16384, 8, 1, 0, 0}, {16392, 5, 1, 0, 0},
+  {3840, 5, 1, 0, 0}, {4147, 4, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {9534, 4, 1, 0, 0}, {16397, 6, 1, 0, 0}, {5270, 3, 1, 0, 0},
+  {5323, 4, 1, 0, 0}, {5485, 5, 1, 0, 0}, {16403, 4, 1, 0, 0},
+  {16407, 4, 1, 0, 0}, {5851, 2, 1, 0, 0}, {16411, 6, 1, 0, 0},
+  {16417, 6, 1, 0, 0}, {6138, 5, 1, 0, 0}, {50, 2, 1, 0, 0}, {712, 3, 1, 0, 0},
+  {1308, 2, 1, 1, 7404}, {16423, 4, 1, 0, 0}, {16427, 4, 9, 0, 0},
+  {16431, 5, 9, 0, 0}, {10703, 2, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4074, 2, 1, 1, 7405}, {4113, 3, 1, 0, 0}, {9524, 2, 1, 0, 0},
+  {16436, 6, 1, 0, 0}, {8535, 3, 1, 0, 0}, {9379, 3, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {2599, 3, 1, 0, 0}, {9512, 12, 9, 0, 0}, {50, 2, 1, 0, 0},
+  {1308, 2, 1, 4, 7406}, {2599, 3, 1, 0, 0}, {16442, 3, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {14922, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 2, 7410},
+  {1340, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {4981, 2, 9, 0, 0}, {5992, 2, 1, 0, 0}, {6011, 2, 1, 0, 0},
+  {16445, 2, 1, 0, 0}, {16447, 2, 1, 0, 0}, {50, 2, 1, 0, 0}, {147, 2, 1, 0, 0},
+  {233, 2, 1, 0, 0}, {9639, 5, 9, 0, 0}, {16449, 5, 1, 0, 0}, {712, 3, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {921, 8, 1, 0, 0}, {947, 2, 1, 0, 0}, {9429, 7, 9, 0, 0},
+  {1306, 2, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1466, 4, 1, 0, 0}, {16454, 2, 1, 0, 0}, {16456, 5, 1, 0, 0},
+  {16461, 2, 1, 0, 0}, {1880, 3, 1, 0, 0}, {1957, 2, 1, 0, 0},
+  {11042, 4, 1, 0, 0}, {16463, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {16466, 7, 1, 0, 0}, {10251, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {16473, 8, 1, 0, 0}, {3096, 2, 1, 0, 0},
+  {3835, 2, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {16481, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {4485, 2, 1, 0, 0},
+  {4647, 4, 1, 0, 0}, {4677, 3, 1, 0, 0}, {9075, 3, 1, 0, 0},
+  {11076, 8, 9, 0, 0}, {5938, 6, 1, 0, 0}, {6011, 2, 1, 0, 0},
+  {6032, 2, 1, 0, 0}, {16484, 2, 1, 0, 0}, {6059, 2, 1, 0, 0},
+  {9379, 3, 9, 0, 0}, {16486, 19, 9, 0, 0}, {16505, 20, 9, 0, 0},
+  {9639, 5, 9, 0, 0}, {9429, 7, 9, 0, 0}, {16525, 9, 9, 0, 0},
+  {16534, 6, 9, 0, 0}, {16540, 11, 9, 0, 0}, {9686, 6, 9, 0, 0},
+  {16551, 7, 9, 0, 0}, {16558, 6, 9, 0, 0}, {16564, 9, 9, 0, 0},
+  {16573, 10, 9, 0, 0}, {16583, 13, 9, 0, 0}, {16596, 12, 9, 0, 0},
+  {16608, 10, 9, 0, 0}, {16618, 8, 9, 0, 0}, {9740, 5, 9, 0, 0},
+  {16626, 8, 9, 0, 0}, {9748, 6, 9, 0, 0}, {16634, 6, 9, 0, 0},
+  {9754, 6, 9, 0, 0}, {1992, 2, 1, 0, 0}, {16640, 4, 9, 0, 0},
+  {16644, 6, 9, 0, 0}, {16650, 14, 18, 0, 0}, {16664, 6, 9, 0, 0},
+  {16670, 12, 9, 0, 0}, {16682, 11, 0, 2, 7412}, {9639, 5, 9, 0, 0},
+  {16693, 11, 9, 0, 0}, {16704, 11, 9, 0, 0}, {16715, 7, 0, 1, 7414},
+  {16722, 10, 0, 1, 7415}, {16732, 4, 0, 1, 7416}, {16736, 9, 9, 0, 0},
+  {16745, 8, 9, 0, 0}, {16753, 7, 9, 0, 0}, {16760, 17, 9, 0, 0},
+  {16777, 10, 9, 0, 0}, {1340, 3, 1, 0, 0}, {16787, 8, 0, 1, 7417},
+  {16795, 5, 9, 0, 0}, {16800, 8, 9, 0, 0}, {16808, 4, 9, 0, 0},
+  {16812, 5, 9, 0, 0}, {16817, 7, 9, 0, 0}, {16824, 6, 9, 0, 0},
+  {16830, 11, 9, 0, 0}, {16841, 9, 0, 1, 7418}, {16850, 5, 9, 0, 0},
+  {16855, 6, 9, 0, 0}, {16861, 6, 9, 0, 0}, {16867, 10, 9, 0, 0},
+  {16877, 12, 9, 0, 0}, {16889, 3, 9, 0, 0}, {10776, 4, 9, 0, 0},
+  {16892, 4, 0, 1, 7419}, {9266, 9, 9, 0, 0}, {16896, 7, 9, 0, 0},
+  {16903, 10, 9, 0, 0}, {16913, 9, 18, 0, 0}, {16922, 8, 9, 0, 0},
+  {16930, 5, 9, 0, 0}, {16935, 3, 9, 0, 0}, {16938, 7, 0, 1, 7420},
+  {16945, 8, 18, 0, 0}, {16953, 6, 18, 0, 0}, {16959, 6, 18, 0, 0},
+  {16965, 12, 9, 0, 0}, {16977, 8, 9, 0, 0}, {16985, 5, 9, 1, 7421},
+  {16990, 3, 9, 1, 7422}, {16993, 4, 9, 0, 0}, {16997, 11, 9, 0, 0},
+  {17008, 11, 9, 0, 0}, {17019, 12, 0, 1, 7423}, {17031, 3, 18, 0, 0},
+  {17034, 8, 9, 0, 0}, {15599, 11, 9, 0, 0}, {17042, 9, 9, 0, 0},
+  {17051, 3, 9, 0, 0}, {17054, 8, 9, 0, 0}, {17062, 6, 18, 0, 0},
+  {9357, 7, 9, 0, 0}, {17068, 9, 0, 4, 7424}, {5796, 7, 9, 0, 0},
+  {17077, 8, 0, 1, 7428}, {17085, 4, 9, 0, 0}, {17089, 7, 9, 0, 0},
+  {17096, 10, 9, 0, 0}, {17106, 8, 0, 1, 7429}, {17114, 13, 9, 0, 0},
+  {17127, 9, 9, 0, 0}, {17136, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {2962, 2, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {7469, 15, 1, 0, 0},
+  {7484, 14, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {17144, 7, 9, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {17151, 11, 9, 0, 0}, {17162, 4, 9, 0, 0}, {17166, 4, 9, 0, 0},
+  {17170, 4, 9, 0, 0}, {17174, 3, 1, 0, 0}, {17177, 7, 1, 0, 0},
+  {132, 2, 1, 0, 0}, {17184, 9, 1, 0, 0}, {176, 2, 1, 0, 0},
+  {17193, 11, 1, 0, 0}, {17204, 10, 1, 0, 0}, {17214, 9, 1, 0, 0},
+  {17223, 2, 1, 0, 0}, {17225, 6, 1, 0, 0}, {17231, 21, 1, 0, 0},
+  {17252, 21, 1, 0, 0}, {17273, 19, 1, 0, 0}, {17292, 19, 1, 0, 0},
+  {318, 2, 1, 0, 0}, {17311, 5, 1, 0, 0}, {17316, 12, 1, 0, 0},
+  {17328, 11, 1, 0, 0}, {17339, 5, 1, 0, 0}, {17344, 2, 1, 0, 0},
+  {341, 2, 1, 0, 0}, {17346, 6, 1, 0, 0}, {352, 2, 1, 0, 0},
+  {17352, 6, 1, 0, 0}, {17358, 13, 1, 0, 0}, {17371, 12, 1, 0, 0},
+  {17383, 4, 1, 0, 0}, {404, 2, 1, 0, 0}, {17387, 2, 1, 0, 0},
+  {17389, 8, 1, 0, 0}, {492, 2, 1, 0, 0}, {17397, 6, 1, 0, 0},
+  {17403, 15, 1, 0, 0}, {17418, 16, 1, 0, 0}, {17434, 4, 1, 0, 0},
+  {17438, 21, 1, 0, 0}, {17459, 19, 1, 0, 0}, {17478, 3, 1, 0, 0},
+  {17481, 10, 1, 0, 0}, {17491, 7, 1, 0, 0}, {17498, 9, 1, 0, 0},
+  {17507, 7, 1, 0, 0}, {676, 2, 1, 0, 0}, {686, 2, 1, 0, 0},
+  {17514, 6, 1, 0, 0}, {17520, 2, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {769, 2, 1, 0, 0}, {781, 2, 1, 0, 0}, {17522, 7, 1, 0, 0},
+  {17529, 7, 1, 0, 0}, {17536, 17, 1, 0, 0}, {17553, 5, 1, 0, 0},
+  {17558, 14, 1, 0, 0}, {17572, 15, 1, 0, 0}, {854, 2, 1, 0, 0},
+  {17587, 7, 1, 0, 0}, {17594, 8, 1, 0, 0}, {904, 2, 1, 0, 0},
+  {906, 2, 1, 0, 0}, {17602, 6, 1, 0, 0}, {17608, 15, 1, 0, 0},
+  {17623, 16, 1, 0, 0}, {942, 2, 1, 0, 0}, {947, 2, 1, 0, 0},
+  {17639, 8, 1, 0, 0}, {956, 3, 1, 0, 0}, {17647, 8, 1, 0, 0},
+  {17655, 13, 1, 0, 0}, {974, 3, 1, 0, 0}, {17668, 8, 1, 0, 0},
+  {17676, 15, 1, 0, 0}, {17691, 14, 1, 0, 0}, {17705, 10, 1, 0, 0},
+  {17715, 17, 1, 0, 0}, {17732, 16, 1, 0, 0}, {17748, 13, 1, 0, 0},
+  {17761, 12, 1, 0, 0}, {17773, 7, 1, 0, 0}, {17780, 7, 1, 0, 0},
+  {17787, 9, 1, 0, 0}, {17796, 2, 1, 0, 0}, {17798, 2, 1, 0, 0},
+  {17800, 12, 1, 0, 0}, {17812, 11, 1, 0, 0}, {1130, 2, 1, 0, 0},
+  {17823, 6, 1, 0, 0}, {1194, 2, 1, 0, 0}, {1245, 2, 1, 0, 0},
+  {1306, 2, 1, 0, 0}, {1308, 2, 1, 0, 0}, {17829, 4, 1, 0, 0},
+  {17833, 7, 1, 0, 0}, {1507, 2, 1, 0, 0}, {17840, 7, 1, 0, 0},
+  {17847, 7, 1, 0, 0}, {16454, 2, 1, 0, 0}, {17854, 2, 1, 0, 0},
+  {17856, 5, 1, 0, 0}, {1593, 2, 1, 0, 0}, {17861, 14, 1, 0, 0},
+  {17875, 13, 1, 0, 0}, {1880, 3, 1, 0, 0}, {17888, 14, 1, 0, 0},
+  {17902, 13, 1, 0, 0}, {17915, 3, 1, 0, 0}, {17918, 2, 1, 0, 0},
+  {17920, 4, 1, 0, 0}, {17924, 2, 1, 0, 0}, {17926, 2, 1, 0, 0},
+  {17928, 5, 1, 0, 0}, {17933, 7, 1, 0, 0}, {17940, 2, 1, 0, 0},
+  {2135, 2, 1, 0, 0}, {17942, 7, 1, 0, 0}, {17949, 8, 1, 0, 0},
+  {2258, 2, 1, 0, 0}, {17957, 6, 1, 0, 0}, {17963, 12, 1, 0, 0},
+  {17975, 11, 1, 0, 0}, {2322, 2, 1, 0, 0}, {17986, 15, 1, 0, 0},
+  {18001, 16, 1, 0, 0}, {18017, 15, 1, 0, 0}, {18032, 21, 1, 0, 0},
+  {18053, 20, 1, 0, 0}, {18073, 14, 1, 0, 0}, {18087, 14, 1, 0, 0},
+  {18101, 15, 1, 0, 0}, {18116, 14, 1, 0, 0}, {18130, 20, 1, 0, 0},
+  {18150, 19, 1, 0, 0}, {18169, 13, 1, 0, 0}, {18182, 9, 1, 0, 0},
+  {18191, 3, 1, 0, 0}, {2454, 2, 1, 0, 0}, {18194, 5, 1, 0, 0},
+  {18199, 6, 1, 0, 0}, {10703, 2, 1, 0, 0}, {18205, 7, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {2606, 2, 1, 0, 0}, {18212, 8, 1, 0, 0},
+  {18220, 5, 9, 0, 0}, {18225, 17, 1, 0, 0}, {18242, 16, 1, 0, 0},
+  {18258, 10, 9, 0, 0}, {2980, 2, 1, 0, 0}, {18268, 7, 1, 0, 0},
+  {3115, 2, 1, 0, 0}, {18275, 7, 1, 0, 0}, {3359, 2, 1, 0, 0},
+  {18282, 9, 1, 0, 0}, {18291, 7, 1, 0, 0}, {18298, 8, 1, 0, 0},
+  {18306, 6, 1, 0, 0}, {18312, 3, 1, 0, 0}, {18315, 5, 1, 0, 0},
+  {3482, 2, 1, 0, 0}, {18320, 2, 1, 0, 0}, {18322, 5, 1, 0, 0},
+  {18327, 5, 1, 0, 0}, {3523, 2, 1, 0, 0}, {18332, 3, 1, 0, 0},
+  {18335, 7, 1, 0, 0}, {18342, 7, 1, 0, 0}, {18349, 2, 1, 0, 0},
+  {18351, 4, 1, 0, 0}, {18355, 3, 1, 0, 0}, {18358, 9, 1, 0, 0},
+  {18367, 8, 1, 0, 0}, {3684, 2, 1, 0, 0}, {3693, 2, 1, 0, 0},
+  {18375, 7, 1, 0, 0}, {18382, 5, 1, 0, 0}, {18387, 8, 1, 0, 0},
+  {18395, 7, 1, 0, 0}, {18402, 3, 1, 0, 0}, {18405, 6, 1, 0, 0},
+  {18411, 13, 1, 0, 0}, {18424, 12, 1, 0, 0}, {18436, 6, 1, 0, 0},
+  {10571, 2, 1, 0, 0}, {3823, 2, 1, 0, 0}, {3835, 2, 1, 0, 0},
+  {18442, 15, 1, 0, 0}, {18457, 14, 1, 0, 0}, {18471, 7, 1, 0, 0},
+  {18478, 2, 1, 0, 0}, {18480, 5, 1, 0, 0}, {18485, 6, 1, 0, 0},
+  {3942, 2, 1, 0, 0}, {3944, 2, 1, 0, 0}, {18491, 6, 1, 0, 0},
+  {18497, 3, 1, 0, 0}, {18500, 6, 1, 0, 0}, {18506, 5, 1, 0, 0},
+  {18511, 13, 1, 0, 0}, {18524, 21, 1, 0, 0}, {18545, 12, 1, 0, 0},
+  {18557, 13, 1, 0, 0}, {18570, 18, 1, 0, 0}, {4036, 2, 1, 0, 0},
+  {4041, 2, 1, 0, 0}, {9512, 12, 9, 0, 0}, {4078, 2, 1, 0, 0},
+  {18588, 6, 1, 0, 0}, {18594, 6, 1, 0, 0}, {18600, 4, 0, 1, 7430},
+  {4217, 2, 1, 0, 0}, {18604, 6, 1, 0, 0}, {4275, 2, 1, 0, 0},
+  {18610, 5, 1, 0, 0}, {9176, 2, 1, 0, 0}, {18615, 9, 1, 0, 0},
+  {18624, 12, 1, 0, 0}, {18636, 11, 1, 0, 0}, {9524, 2, 1, 0, 0},
+  {18647, 8, 1, 0, 0}, {18655, 2, 1, 0, 0}, {4414, 2, 1, 0, 0},
+  {18657, 6, 1, 0, 0}, {18663, 5, 1, 0, 0}, {18668, 7, 1, 0, 0},
+  {18675, 5, 1, 0, 0}, {18680, 5, 1, 0, 0}, {18685, 2, 1, 0, 0},
+  {18687, 2, 1, 0, 0}, {4472, 2, 1, 0, 0}, {18689, 7, 1, 0, 0},
+  {18696, 13, 1, 0, 0}, {18709, 12, 1, 0, 0}, {18721, 7, 1, 0, 0},
+  {4485, 2, 1, 0, 0}, {18728, 2, 1, 0, 0}, {18730, 8, 1, 0, 0},
+  {18738, 8, 1, 0, 0}, {18746, 8, 1, 0, 0}, {18754, 4, 1, 0, 0},
+  {18758, 7, 1, 0, 0}, {18765, 3, 1, 0, 0}, {4622, 2, 1, 0, 0},
+  {18768, 2, 1, 0, 0}, {18770, 9, 1, 0, 0}, {18779, 7, 1, 0, 0},
+  {4651, 2, 1, 0, 0}, {18786, 5, 1, 0, 0}, {4758, 2, 1, 0, 0},
+  {18791, 2, 1, 0, 0}, {18793, 3, 1, 0, 0}, {18796, 6, 1, 0, 0},
+  {18802, 2, 1, 0, 0}, {18804, 2, 1, 0, 0}, {18806, 2, 1, 0, 0},
+  {18808, 6, 1, 0, 0}, {18814, 7, 1, 0, 0}, {18821, 2, 1, 0, 0},
+  {4798, 2, 1, 0, 0}, {18823, 15, 1, 0, 0}, {18838, 13, 1, 0, 0},
+  {18851, 14, 1, 0, 0}, {18865, 12, 1, 0, 0}, {18877, 2, 1, 0, 0},
+  {18879, 2, 1, 0, 0}, {18881, 5, 1, 0, 0}, {18886, 6, 1, 0, 0},
+  {18892, 2, 1, 0, 0}, {18894, 2, 1, 0, 0}, {4981, 2, 1, 0, 0},
+  {18896, 4, 1, 0, 0}, {18900, 4, 1, 0, 0}, {18904, 6, 1, 0, 0},
+  {5040, 2, 1, 0, 0}, {18910, 7, 1, 0, 0}, {18917, 3, 1, 0, 0},
+  {18920, 8, 1, 0, 0}, {18928, 8, 1, 0, 0}, {18936, 7, 1, 0, 0},
+  {18943, 6, 1, 0, 0}, {5353, 2, 1, 0, 0}, {18949, 3, 1, 0, 0},
+  {18952, 7, 1, 0, 0}, {18959, 6, 1, 0, 0}, {18965, 5, 1, 0, 0},
+  {18970, 8, 1, 0, 0}, {5418, 2, 1, 0, 0}, {18978, 7, 1, 0, 0},
+  {18985, 2, 1, 0, 0}, {5494, 2, 1, 0, 0}, {5499, 2, 1, 0, 0},
+  {18987, 9, 1, 0, 0}, {5636, 2, 1, 0, 0}, {18996, 8, 9, 0, 0},
+  {19004, 2, 1, 0, 0}, {19006, 3, 1, 0, 0}, {19009, 7, 1, 0, 0},
+  {19016, 2, 1, 0, 0}, {19018, 12, 1, 0, 0}, {19030, 11, 1, 0, 0},
+  {19041, 6, 1, 0, 0}, {19047, 5, 1, 0, 0}, {19052, 3, 0, 1, 7431},
+  {5858, 2, 1, 0, 0}, {5860, 2, 1, 0, 0}, {19055, 6, 1, 0, 0},
+  {19061, 3, 1, 0, 0}, {19064, 7, 1, 0, 0}, {19071, 2, 1, 0, 0},
+  {5916, 2, 1, 0, 0}, {19073, 21, 1, 0, 0}, {19094, 21, 1, 0, 0},
+  {19115, 19, 1, 0, 0}, {19134, 19, 1, 0, 0}, {19153, 7, 1, 0, 0},
+  {19160, 17, 1, 0, 0}, {19177, 16, 1, 0, 0}, {19193, 18, 1, 0, 0},
+  {19211, 17, 1, 0, 0}, {19228, 8, 1, 0, 0}, {19236, 16, 1, 0, 0},
+  {19252, 15, 1, 0, 0}, {19267, 19, 1, 0, 0}, {19286, 18, 1, 0, 0},
+  {19304, 16, 1, 0, 0}, {19320, 15, 1, 0, 0}, {19335, 18, 1, 0, 0},
+  {19353, 17, 1, 0, 0}, {19370, 19, 1, 0, 0}, {19389, 18, 1, 0, 0},
+  {19407, 15, 1, 0, 0}, {19422, 14, 1, 0, 0}, {19436, 18, 1, 0, 0},
+  {19454, 17, 1, 0, 0}, {19471, 15, 1, 0, 0}, {19486, 14, 1, 0, 0},
+  {19500, 17, 1, 0, 0}, {19517, 16, 1, 0, 0}, {19533, 18, 1, 0, 0},
+  {19551, 17, 1, 0, 0}, {19568, 16, 1, 0, 0}, {19584, 15, 1, 0, 0},
+  {19599, 17, 1, 0, 0}, {19616, 16, 1, 0, 0}, {19632, 6, 1, 0, 0},
+  {19638, 7, 1, 0, 0}, {19645, 7, 1, 0, 0}, {19652, 2, 1, 0, 0},
+  {19654, 5, 1, 0, 0}, {19659, 7, 1, 0, 0}, {6011, 2, 1, 0, 0},
+  {19666, 2, 1, 0, 0}, {19668, 5, 1, 0, 0}, {19673, 3, 1, 0, 0},
+  {19676, 6, 1, 0, 0}, {19682, 13, 1, 0, 0}, {19695, 12, 1, 0, 0},
+  {6065, 2, 1, 0, 0}, {19707, 11, 1, 0, 0}, {19718, 10, 1, 0, 0},
+  {19728, 10, 1, 0, 0}, {19738, 9, 1, 0, 0}, {19747, 11, 1, 0, 0},
+  {19758, 13, 1, 0, 0}, {19771, 12, 1, 0, 0}, {19783, 10, 1, 0, 0},
+  {19793, 12, 1, 0, 0}, {19805, 11, 1, 0, 0}, {19816, 12, 1, 0, 0},
+  {19828, 14, 1, 0, 0}, {19842, 11, 1, 0, 0}, {19853, 12, 1, 0, 0},
+  {19865, 3, 1, 0, 0}, {19868, 6, 1, 0, 0}, {19874, 2, 1, 0, 0},
+  {6088, 2, 1, 0, 0}, {19876, 3, 1, 0, 0}, {6090, 2, 1, 0, 0},
+  {19879, 3, 1, 0, 0}, {19882, 6, 1, 0, 0}, {19888, 7, 1, 0, 0},
+  {19895, 6, 1, 0, 0}, {19901, 8, 1, 0, 0}, {19909, 8, 1, 0, 0},
+  {19917, 6, 1, 0, 0}, {6130, 2, 1, 0, 0}, {19923, 13, 1, 0, 0},
+  {19936, 12, 1, 0, 0}, {19948, 7, 1, 0, 0}, {19955, 7, 1, 0, 0},
+  {19962, 2, 1, 0, 0}, {19964, 2, 1, 0, 0}, {19966, 2, 1, 0, 0},
+  {19968, 2, 1, 0, 0}, {19970, 22, 1, 0, 0}, {19992, 21, 1, 0, 0},
+  {20013, 22, 1, 0, 0}, {20035, 19, 1, 0, 0}, {20054, 18, 1, 0, 0},
+  {20072, 19, 1, 0, 0}, {20091, 18, 1, 0, 0}, {20109, 15, 1, 0, 0},
+  {20124, 24, 1, 0, 0}, {20148, 23, 1, 0, 0}, {20171, 25, 1, 0, 0},
+  {20196, 24, 1, 0, 0}, {20220, 24, 1, 0, 0}, {20244, 23, 1, 0, 0},
+  {20267, 23, 1, 0, 0}, {20290, 22, 1, 0, 0}, {20312, 19, 1, 0, 0},
+  {20331, 21, 1, 0, 0}, {20352, 18, 1, 0, 0}, {20370, 19, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {4113, 3, 1, 0, 0}, {10555, 2, 9, 0, 0},
+  {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4089, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {50, 2, 1, 0, 0},
+  {97, 2, 1, 0, 0}, {20389, 5, 1, 52, 7432}, {20394, 5, 1, 28, 7484},
+  {20399, 5, 9, 0, 0}, {20404, 6, 1, 22, 7512}, {20410, 8, 9, 0, 0},
+  {20418, 8, 9, 0, 0}, {20426, 8, 9, 0, 0}, {20434, 7, 9, 0, 0},
+  {20441, 6, 9, 0, 0}, {8527, 8, 9, 0, 0}, {20447, 5, 9, 0, 0},
+  {809, 3, 9, 0, 0}, {20452, 3, 9, 0, 0}, {20455, 9, 9, 0, 0},
+  {20464, 3, 9, 0, 0}, {20467, 7, 9, 0, 0}, {20474, 8, 9, 0, 0},
+  {20482, 5, 9, 0, 0}, {20487, 7, 9, 0, 0}, {1161, 5, 9, 0, 0},
+  {20494, 5, 1, 58, 7534}, {20499, 8, 9, 0, 0}, {20507, 8, 9, 0, 0},
+  {20515, 5, 9, 0, 0}, {20520, 7, 9, 0, 0}, {20527, 3, 9, 0, 0},
+  {20530, 4, 9, 0, 0}, {1308, 2, 1, 0, 0}, {20534, 7, 9, 0, 0},
+  {20541, 8, 9, 0, 0}, {20549, 6, 9, 0, 0}, {20555, 8, 9, 0, 0},
+  {20563, 3, 9, 0, 0}, {20566, 4, 9, 0, 0}, {20570, 4, 9, 0, 0},
+  {20574, 6, 9, 0, 0}, {9172, 2, 1, 0, 0}, {20580, 6, 9, 0, 0},
+  {20586, 5, 1, 22, 7592}, {20591, 7, 9, 0, 0}, {20598, 12, 9, 0, 0},
+  {20610, 3, 9, 0, 0}, {20613, 5, 9, 0, 0}, {20618, 6, 9, 0, 0},
+  {20624, 4, 9, 0, 0}, {20628, 10, 9, 0, 0}, {20638, 5, 1, 15, 7614},
+  {20643, 7, 1, 63, 7629}, {20650, 9, 1, 51, 7692}, {20659, 4, 1, 38, 7743},
+  {20663, 10, 9, 0, 0}, {20673, 5, 9, 0, 0}, {20678, 6, 9, 0, 0},
+  {10703, 2, 1, 0, 0}, {20684, 5, 9, 0, 0}, {2606, 2, 1, 0, 0},
+  {20689, 7, 9, 0, 0}, {20696, 5, 1, 36, 7781}, {20701, 5, 9, 0, 0},
+  {20706, 11, 9, 0, 0}, {20717, 5, 9, 0, 0}, {20722, 3, 9, 0, 0},
+  {20725, 4, 9, 0, 0}, {20729, 5, 9, 0, 0}, {20734, 9, 1, 25, 7817},
+  {20743, 8, 1, 142, 7842}, {20751, 4, 9, 0, 0}, {20755, 6, 9, 0, 0},
+  {20761, 5, 1, 46, 7984}, {20766, 7, 1, 51, 8030}, {20773, 6, 9, 0, 0},
+  {20779, 8, 1, 19, 8081}, {20787, 5, 9, 0, 0}, {20792, 5, 1, 34, 8100},
+  {20797, 9, 9, 0, 0}, {20806, 6, 1, 15, 8134}, {20812, 9, 1, 20, 8149},
+  {20821, 8, 1, 30, 8169}, {20829, 10, 9, 0, 0}, {20839, 8, 2, 1, 8199},
+  {20847, 8, 9, 0, 0}, {20855, 4, 9, 0, 0}, {20859, 4, 9, 0, 0},
+  {20863, 10, 2, 1, 8200}, {20873, 4, 2, 1, 8201}, {20877, 5, 1, 31, 8202},
+  {20882, 8, 1, 23, 8233}, {20890, 5, 9, 0, 0}, {3381, 5, 1, 31, 8256},
+  {20895, 2, 1, 0, 0}, {20897, 10, 9, 0, 0}, {20907, 9, 9, 0, 0},
+  {20916, 10, 9, 0, 0}, {20926, 4, 9, 0, 0}, {20930, 7, 9, 0, 0},
+  {20937, 8, 9, 0, 0}, {20945, 4, 9, 0, 0}, {20949, 3, 1, 30, 8287},
+  {20952, 6, 1, 32, 8317}, {20958, 8, 1, 27, 8349}, {20966, 4, 9, 0, 0},
+  {20970, 4, 9, 0, 0}, {20974, 9, 9, 0, 0}, {20983, 3, 9, 0, 0},
+  {20986, 6, 1, 75, 8376}, {20992, 8, 1, 22, 8451}, {4083, 6, 2, 1, 8473},
+  {21000, 7, 9, 0, 0}, {21007, 4, 1, 38, 8474}, {4108, 2, 1, 2, 8512},
+  {21011, 7, 1, 34, 8514}, {21018, 6, 9, 0, 0}, {21024, 7, 9, 0, 0},
+  {21031, 4, 9, 0, 0}, {21035, 4, 1, 19, 8548}, {21039, 7, 1, 26, 8567},
+  {4299, 7, 1, 42, 8593}, {21046, 4, 9, 0, 0}, {9524, 2, 1, 0, 0},
+  {4397, 5, 1, 50, 8635}, {21050, 8, 9, 0, 0}, {21058, 8, 9, 0, 0},
+  {21066, 6, 9, 0, 0}, {21072, 6, 9, 0, 0}, {21078, 5, 9, 0, 0},
+  {21083, 6, 9, 0, 0}, {21089, 5, 9, 0, 0}, {21094, 7, 9, 0, 0},
+  {21101, 6, 9, 0, 0}, {21107, 5, 9, 0, 0}, {21112, 4, 9, 0, 0},
+  {21116, 8, 9, 0, 0}, {21124, 3, 9, 0, 0}, {21127, 8, 9, 0, 0},
+  {21135, 9, 9, 0, 0}, {21144, 6, 9, 0, 0}, {21150, 4, 1, 26, 8685},
+  {21154, 7, 1, 69, 8711}, {21161, 7, 2, 1, 8780}, {21168, 9, 9, 0, 0},
+  {21177, 6, 9, 0, 0}, {21183, 6, 2, 1, 8781}, {21189, 5, 1, 23, 8782},
+  {21194, 7, 1, 23, 8805}, {21201, 8, 1, 36, 8828}, {21209, 5, 9, 0, 0},
+  {21214, 8, 9, 0, 0}, {21222, 3, 9, 0, 0}, {21225, 8, 9, 0, 0},
+  {21233, 9, 9, 0, 0}, {21242, 7, 9, 0, 0}, {21249, 5, 9, 0, 0},
+  {21254, 7, 1, 31, 8864}, {21261, 9, 1, 17, 8895}, {5867, 5, 1, 57, 8912},
+  {21270, 8, 9, 0, 0}, {21278, 7, 1, 13, 8969}, {21285, 6, 1, 24, 8982},
+  {21291, 5, 9, 0, 0}, {21296, 5, 9, 0, 0}, {16102, 11, 9, 0, 0},
+  {21301, 6, 9, 0, 0}, {21307, 5, 9, 0, 0}, {21312, 6, 9, 0, 0},
+  {21318, 6, 9, 0, 0}, {21324, 8, 1, 29, 9006}, {21332, 6, 9, 0, 0},
+  {21338, 7, 9, 0, 0}, {21345, 9, 9, 0, 0}, {21354, 13, 1, 0, 0},
+  {21367, 9, 1, 0, 0}, {21376, 11, 1, 0, 0}, {21387, 11, 1, 0, 0},
+  {21398, 11, 1, 0, 0}, {21409, 11, 1, 0, 0}, {21420, 11, 1, 0, 0},
+  {21431, 11, 1, 0, 0}, {21442, 9, 1, 0, 0}, {21451, 11, 1, 0, 0},
+  {21462, 11, 1, 0, 0}, {21473, 11, 1, 0, 0}, {21484, 10, 1, 0, 0},
+  {21494, 10, 1, 0, 0}, {21504, 12, 1, 0, 0}, {21516, 11, 1, 0, 0},
+  {21527, 10, 1, 0, 0}, {21537, 10, 1, 0, 0}, {21547, 14, 1, 0, 0},
+  {21561, 14, 1, 0, 0}, {21575, 10, 1, 0, 0}, {21585, 10, 1, 0, 0},
+  {21595, 11, 1, 0, 0}, {21606, 11, 1, 0, 0}, {21617, 11, 1, 0, 0},
+  {21628, 11, 1, 0, 0}, {21639, 10, 1, 0, 0}, {21649, 11, 1, 0, 0},
+  {21660, 10, 1, 0, 0}, {21670, 10, 1, 0, 0}, {21680, 10, 1, 0, 0},
+  {21690, 11, 1, 0, 0}, {21701, 11, 1, 0, 0}, {21712, 14, 1, 0, 0},
+  {21726, 11, 1, 0, 0}, {21737, 11, 1, 0, 0}, {21748, 11, 1, 0, 0},
+  {21759, 10, 1, 0, 0}, {21769, 9, 1, 0, 0}, {21778, 10, 1, 0, 0},
+  {21788, 10, 1, 0, 0}, {21798, 11, 1, 0, 0}, {21809, 11, 1, 0, 0},
+  {21820, 10, 1, 0, 0}, {21830, 11, 1, 0, 0}, {21841, 11, 1, 0, 0},
+  {21852, 11, 1, 0, 0}, {21863, 8, 1, 34, 9035}, {21871, 9, 1, 16, 9069},
+  {21880, 9, 1, 28, 9085}, {8456, 8, 2, 1, 9113}, {21889, 6, 9, 0, 0},
+  {50, 2, 1, 0, 0}, {1308, 2, 1, 1, 9114}, {10703, 2, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {3835, 2, 1, 0, 0}, {3946, 4, 1, 0, 0},
+  {4108, 2, 1, 0, 0}, {9524, 2, 1, 0, 0}, {5144, 2, 1, 0, 0}, {744, 4, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3096, 2, 9, 0, 0}, {3207, 2, 9, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {6011, 2, 9, 0, 0},
+  {6032, 2, 9, 0, 0}, {6059, 2, 9, 0, 0}, {712, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {21895, 3, 1, 0, 0},
+  {10696, 4, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1466, 4, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {10705, 4, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {16017, 7, 1, 0, 0}, {3903, 3, 1, 0, 0}, {8524, 3, 1, 0, 0},
+  {16024, 8, 1, 0, 0}, {4380, 3, 1, 0, 0}, {21898, 11, 1, 0, 0},
+  {16052, 3, 1, 0, 0}, {10709, 6, 1, 0, 0}, {5851, 2, 1, 0, 0},
+  {16055, 11, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {10397, 3, 1, 0, 0}, {21909, 3, 1, 0, 0}, {50, 2, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {21912, 5, 1, 0, 0}, {21917, 8, 1, 0, 0},
+  {21925, 8, 1, 0, 0}, {1308, 2, 1, 0, 0}, {21933, 5, 1, 0, 0},
+  {21938, 7, 1, 0, 0}, {1971, 2, 1, 0, 0}, {21945, 7, 1, 0, 0},
+  {10703, 2, 1, 0, 0}, {21952, 7, 1, 0, 0}, {21959, 9, 1, 0, 0},
+  {21968, 8, 1, 0, 0}, {21976, 9, 1, 0, 0}, {21985, 2, 1, 0, 0},
+  {21987, 7, 1, 0, 0}, {21994, 4, 1, 0, 0}, {21998, 7, 1, 0, 0},
+  {22005, 7, 1, 0, 0}, {3289, 2, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4036, 2, 1, 0, 0}, {4108, 2, 1, 0, 0}, {9524, 2, 1, 0, 0},
+  {4472, 2, 1, 0, 0}, {4798, 2, 1, 0, 0}, {5144, 2, 1, 0, 0},
+  {22012, 5, 1, 0, 0}, {22017, 5, 1, 0, 0}, {1308, 2, 9, 0, 0},
+  {1880, 3, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {22022, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {10251, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {22025, 6, 9, 0, 0}, {22031, 11, 0, 1, 9115}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {22042, 3, 9, 0, 0},
+  {9644, 1, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {22045, 3, 1, 0, 0},
+  {22048, 6, 9, 2, 9116}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {22054, 2, 9, 0, 0}, {8527, 8, 9, 0, 0}, {8717, 3, 9, 0, 0},
+  {22056, 4, 9, 0, 0}, {22060, 4, 18, 0, 0}, {22064, 5, 9, 0, 0},
+  {22069, 3, 9, 0, 0}, {50, 2, 1, 0, 0}, {22072, 4, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {22076, 3, 1, 0, 0}, {16365, 5, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {3686, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4177, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {15666, 3, 1, 0, 0},
+  {9379, 3, 1, 0, 0}, {22079, 3, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {712, 3, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {1638, 2, 9, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {5144, 2, 1, 0, 0}, {8527, 8, 9, 0, 0}, {2599, 3, 1, 0, 0},
+  {9573, 10, 9, 0, 0}, {8527, 8, 9, 0, 0}, {9541, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {9544, 4, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {2962, 2, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {2962, 2, 1, 0, 0},
+  {3837, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {22082, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {4667, 5, 1, 0, 0}, {22085, 6, 9, 0, 0}, {10696, 4, 1, 0, 0},
+  {5851, 2, 1, 0, 0}, {404, 2, 9, 0, 0}, {8527, 8, 9, 0, 0}, {1638, 2, 9, 0, 0},
+  {3207, 2, 9, 0, 0}, {5860, 2, 9, 0, 0}, {50, 2, 1, 0, 0}, {9639, 5, 9, 0, 0},
+  {22091, 8, 9, 0, 0}, {22099, 3, 9, 0, 0}, {1308, 2, 1, 0, 0},
+  {22102, 6, 9, 1, 9118}, {22108, 4, 9, 0, 0}, {15721, 11, 9, 0, 0},
+  {22112, 6, 9, 0, 0}, {9679, 7, 9, 0, 0}, {22118, 9, 9, 0, 0},
+  {1880, 3, 1, 0, 0}, {22127, 8, 9, 0, 0}, {22135, 11, 9, 0, 0},
+  {22146, 11, 9, 0, 0}, {22157, 11, 9, 0, 0}, {22168, 11, 9, 0, 0},
+  {22179, 11, 9, 0, 0}, {22190, 11, 9, 0, 0}, {22201, 6, 9, 0, 0},
+  {2599, 3, 1, 0, 0}, {22207, 5, 9, 0, 0}, {22212, 4, 9, 0, 0},
+  {22216, 3, 1, 0, 0}, {22219, 7, 9, 0, 0}, {22226, 6, 9, 0, 0},
+  {22232, 5, 9, 0, 0}, {22237, 4, 9, 0, 0}, {22241, 4, 9, 0, 0},
+  {4113, 3, 1, 0, 0}, {22245, 6, 9, 0, 0}, {22251, 4, 9, 0, 0},
+  {4380, 3, 1, 0, 0}, {9534, 4, 1, 0, 0}, {10854, 7, 9, 0, 0},
+  {22255, 9, 9, 0, 0}, {22264, 8, 9, 0, 0}, {22272, 4, 9, 0, 0},
+  {22276, 7, 0, 1, 9119}, {22283, 3, 9, 0, 0}, {9754, 6, 9, 0, 0},
+  {17136, 8, 9, 0, 0}, {22286, 5, 9, 0, 0}, {9254, 6, 9, 0, 0},
+  {9639, 5, 9, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {8524, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {16052, 3, 1, 0, 0},
+  {5851, 2, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {10254, 3, 1, 0, 0},
+  {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {10705, 4, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {10709, 6, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {4277, 3, 9, 0, 0}, {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {9639, 5, 9, 0, 0}, {9679, 7, 9, 0, 0},
+  {22291, 2, 9, 0, 0}, {8527, 8, 9, 0, 0}, {2599, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {22293, 3, 9, 0, 0}, {22296, 8, 9, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {1340, 3, 1, 1, 9120}, {1880, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {9524, 2, 1, 0, 0}, {4380, 3, 1, 0, 0}, {52, 7, 1, 0, 0},
+  {22304, 11, 1, 0, 0}, {22315, 3, 1, 0, 0}, {22318, 8, 1, 0, 0},
+  {22326, 7, 1, 0, 0}, {22333, 6, 1, 0, 0}, {22339, 5, 1, 0, 0},
+  {8678, 9, 1, 0, 0}, {22344, 8, 1, 0, 0}, {22352, 9, 1, 0, 0},
+  {22361, 16, 1, 0, 0}, {22377, 11, 1, 0, 0}, {284, 9, 1, 0, 0},
+  {22388, 3, 1, 0, 0}, {22391, 9, 1, 0, 0}, {22400, 6, 1, 0, 0},
+  {22406, 12, 1, 0, 0}, {22418, 8, 1, 0, 0}, {22426, 8, 1, 0, 0},
+  {22434, 9, 1, 0, 0}, {22443, 14, 1, 0, 0}, {22457, 11, 1, 0, 0},
+  {22468, 12, 1, 0, 0}, {377, 3, 1, 0, 0}, {22480, 12, 1, 0, 0},
+  {22492, 9, 1, 0, 0}, {22501, 7, 1, 0, 0}, {22508, 12, 1, 0, 0},
+  {22520, 10, 1, 0, 0}, {11014, 4, 1, 0, 0}, {22530, 13, 1, 0, 0},
+  {22543, 8, 1, 0, 0}, {22551, 13, 1, 0, 0}, {22564, 6, 1, 0, 0},
+  {8696, 11, 1, 0, 0}, {22570, 9, 1, 0, 0}, {22579, 7, 1, 0, 0},
+  {22586, 6, 1, 0, 0}, {22592, 9, 1, 0, 0}, {22601, 10, 1, 0, 0},
+  {22611, 8, 1, 0, 0}, {22619, 4, 1, 0, 0}, {22623, 7, 1, 0, 0},
+  {22630, 7, 1, 0, 0}, {22637, 4, 1, 0, 0}, {22641, 4, 1, 0, 0},
+  {22645, 9, 1, 0, 0}, {535, 9, 1, 0, 0}, {579, 8, 1, 0, 0},
+  {22654, 5, 1, 0, 0}, {22659, 5, 1, 0, 0}, {22664, 6, 1, 0, 0},
+  {22670, 9, 1, 0, 0}, {22679, 13, 1, 0, 0}, {22692, 8, 1, 0, 0},
+  {22700, 7, 1, 0, 0}, {22707, 8, 1, 0, 0}, {654, 6, 1, 0, 0},
+  {22715, 4, 1, 0, 0}, {688, 5, 1, 0, 0}, {22719, 6, 1, 0, 0},
+  {22725, 4, 1, 0, 0}, {22729, 7, 1, 0, 0}, {22736, 10, 1, 0, 0},
+  {22746, 4, 1, 0, 0}, {834, 6, 1, 0, 0}, {22750, 9, 1, 0, 0},
+  {22759, 15, 1, 0, 0}, {22774, 13, 1, 0, 0}, {22787, 6, 1, 0, 0},
+  {22793, 16, 1, 0, 0}, {22809, 6, 1, 0, 0}, {22815, 7, 1, 0, 0},
+  {22822, 7, 1, 0, 0}, {22829, 15, 1, 0, 0}, {22844, 9, 1, 0, 0},
+  {22853, 6, 1, 0, 0}, {22859, 7, 1, 0, 0}, {896, 8, 1, 0, 0},
+  {22866, 9, 1, 0, 0}, {22875, 8, 1, 0, 0}, {22883, 7, 1, 0, 0},
+  {22890, 3, 1, 0, 0}, {22893, 6, 1, 0, 0}, {22899, 8, 1, 0, 0},
+  {22907, 10, 1, 0, 0}, {22917, 9, 1, 0, 0}, {22926, 3, 1, 0, 0},
+  {22929, 6, 1, 0, 0}, {22935, 10, 1, 0, 0}, {22945, 7, 1, 0, 0},
+  {22952, 10, 1, 0, 0}, {22962, 14, 1, 0, 0}, {22976, 6, 1, 0, 0},
+  {22982, 7, 1, 0, 0}, {22989, 6, 1, 0, 0}, {1107, 6, 1, 0, 0},
+  {22995, 11, 1, 0, 0}, {23006, 10, 1, 0, 0}, {23016, 13, 1, 0, 0},
+  {23029, 7, 1, 0, 0}, {23036, 8, 1, 0, 0}, {23044, 9, 1, 0, 0},
+  {23053, 15, 1, 0, 0}, {23068, 12, 1, 0, 0}, {23080, 9, 1, 0, 0},
+  {23089, 14, 1, 0, 0}, {23103, 10, 1, 0, 0}, {23113, 6, 1, 0, 0},
+  {23119, 6, 1, 0, 0}, {23125, 12, 1, 0, 0}, {23137, 12, 1, 0, 0},
+  {23149, 8, 1, 0, 0}, {23157, 7, 1, 0, 0}, {23164, 5, 1, 0, 0},
+  {23169, 4, 1, 0, 0}, {23173, 14, 1, 0, 0}, {23187, 4, 1, 0, 0},
+  {23191, 7, 1, 0, 0}, {23198, 10, 1, 0, 0}, {23208, 20, 1, 0, 0},
+  {23228, 15, 1, 0, 0}, {23243, 8, 1, 0, 0}, {23251, 8, 1, 0, 0},
+  {23259, 13, 1, 0, 0}, {23272, 14, 1, 0, 0}, {1358, 9, 1, 0, 0},
+  {1381, 8, 1, 0, 0}, {23286, 15, 1, 0, 0}, {23301, 12, 1, 0, 0},
+  {23313, 15, 1, 0, 0}, {23328, 7, 1, 0, 0}, {23335, 10, 1, 0, 0},
+  {23345, 11, 1, 0, 0}, {23356, 8, 1, 0, 0}, {23364, 7, 1, 0, 0},
+  {23371, 13, 1, 0, 0}, {23384, 6, 1, 0, 0}, {23390, 6, 1, 0, 0},
+  {23396, 9, 1, 0, 0}, {23405, 8, 1, 0, 0}, {23413, 8, 1, 0, 0},
+  {23421, 14, 1, 0, 0}, {23435, 7, 1, 0, 0}, {23442, 5, 1, 0, 0},
+  {1584, 5, 1, 0, 0}, {23447, 4, 1, 0, 0}, {23451, 6, 1, 0, 0},
+  {23457, 8, 1, 0, 0}, {23465, 3, 1, 0, 0}, {23468, 14, 1, 0, 0},
+  {23482, 8, 1, 0, 0}, {23490, 11, 1, 0, 0}, {23501, 7, 1, 0, 0},
+  {23508, 5, 1, 0, 0}, {1711, 6, 1, 0, 0}, {23513, 7, 1, 0, 0},
+  {23520, 8, 1, 0, 0}, {23528, 9, 1, 0, 0}, {23537, 5, 1, 0, 0},
+  {23542, 8, 1, 0, 0}, {23550, 6, 1, 0, 0}, {23556, 10, 1, 0, 0},
+  {23566, 9, 1, 0, 0}, {1883, 9, 1, 0, 0}, {23575, 11, 1, 0, 0},
+  {23586, 8, 1, 0, 0}, {23594, 9, 1, 0, 0}, {23603, 6, 1, 0, 0},
+  {23609, 10, 1, 0, 0}, {23619, 10, 1, 0, 0}, {23629, 12, 1, 0, 0},
+  {23641, 7, 1, 0, 0}, {23648, 10, 1, 0, 0}, {23658, 11, 1, 0, 0},
+  {23669, 25, 1, 0, 0}, {23694, 8, 1, 0, 0}, {23702, 5, 1, 0, 0},
+  {1976, 6, 1, 0, 0}, {23707, 9, 1, 0, 0}, {23716, 6, 1, 0, 0},
+  {23722, 10, 1, 0, 0}, {2073, 6, 1, 0, 0}, {2086, 4, 1, 0, 0},
+  {23732, 13, 1, 0, 0}, {2090, 7, 1, 0, 0}, {23745, 9, 1, 0, 0},
+  {23754, 5, 1, 0, 0}, {23759, 8, 1, 0, 0}, {23767, 9, 1, 0, 0},
+  {2153, 4, 1, 0, 0}, {23776, 7, 1, 0, 0}, {23783, 8, 1, 0, 0},
+  {23791, 7, 1, 0, 0}, {23798, 8, 1, 0, 0}, {23806, 7, 1, 0, 0},
+  {23813, 5, 1, 0, 0}, {23818, 12, 1, 0, 0}, {23830, 9, 1, 0, 0},
+  {2309, 10, 1, 0, 0}, {23839, 9, 1, 0, 0}, {23848, 9, 1, 0, 0},
+  {23857, 12, 1, 0, 0}, {23869, 11, 1, 0, 0}, {23880, 8, 1, 0, 0},
+  {23888, 8, 1, 0, 0}, {23896, 4, 1, 0, 0}, {23900, 8, 1, 0, 0},
+  {2381, 9, 1, 0, 0}, {2404, 7, 1, 0, 0}, {2434, 6, 1, 0, 0},
+  {15547, 7, 1, 0, 0}, {23908, 9, 1, 0, 0}, {23917, 11, 1, 0, 0},
+  {23928, 7, 1, 0, 0}, {23935, 7, 1, 0, 0}, {23942, 7, 1, 0, 0},
+  {23949, 4, 1, 0, 0}, {2510, 5, 1, 0, 0}, {23953, 5, 1, 0, 0},
+  {23958, 11, 1, 0, 0}, {23969, 4, 1, 0, 0}, {23973, 8, 1, 0, 0},
+  {23981, 10, 1, 0, 0}, {2699, 7, 1, 0, 0}, {23991, 7, 1, 0, 0},
+  {23998, 18, 1, 0, 0}, {24016, 6, 1, 0, 0}, {2732, 6, 1, 0, 0},
+  {24022, 14, 1, 0, 0}, {24036, 6, 1, 0, 0}, {2752, 8, 1, 0, 0},
+  {24042, 15, 1, 0, 0}, {24057, 8, 1, 0, 0}, {24065, 8, 1, 0, 0},
+  {24073, 10, 1, 0, 0}, {24083, 17, 1, 0, 0}, {24100, 14, 1, 0, 0},
+  {24114, 10, 1, 0, 0}, {24124, 12, 1, 0, 0}, {24136, 7, 1, 0, 0},
+  {24143, 16, 1, 0, 0}, {24159, 8, 1, 0, 0}, {2913, 5, 1, 0, 0},
+  {24167, 10, 1, 0, 0}, {24177, 12, 1, 0, 0}, {24189, 13, 1, 0, 0},
+  {24202, 6, 1, 0, 0}, {24208, 7, 1, 0, 0}, {24215, 12, 1, 0, 0},
+  {24227, 12, 1, 0, 0}, {24239, 12, 1, 0, 0}, {24251, 11, 1, 0, 0},
+  {24262, 4, 1, 0, 0}, {24266, 4, 1, 0, 0}, {24270, 9, 1, 0, 0},
+  {24279, 7, 1, 0, 0}, {24286, 9, 1, 0, 0}, {24295, 9, 1, 0, 0},
+  {3168, 7, 1, 0, 0}, {24304, 6, 1, 0, 0}, {24310, 9, 1, 0, 0},
+  {24319, 3, 1, 0, 0}, {24322, 10, 1, 0, 0}, {24332, 7, 1, 0, 0},
+  {24339, 11, 1, 0, 0}, {24350, 10, 1, 0, 0}, {24360, 4, 1, 0, 0},
+  {24364, 6, 1, 0, 0}, {24370, 9, 1, 0, 0}, {3298, 4, 1, 0, 0},
+  {24379, 10, 1, 0, 0}, {3332, 5, 1, 0, 0}, {24389, 5, 1, 0, 0},
+  {24394, 13, 1, 0, 0}, {24407, 14, 1, 0, 0}, {24421, 5, 1, 0, 0},
+  {24426, 6, 1, 0, 0}, {24432, 7, 1, 0, 0}, {24439, 10, 1, 0, 0},
+  {24449, 6, 1, 0, 0}, {24455, 4, 1, 0, 0}, {24459, 7, 1, 0, 0},
+  {24466, 11, 1, 0, 0}, {3583, 7, 1, 0, 0}, {24477, 4, 1, 0, 0},
+  {3608, 6, 1, 0, 0}, {24481, 13, 1, 0, 0}, {24494, 12, 1, 0, 0},
+  {3645, 6, 1, 0, 0}, {24506, 10, 1, 0, 0}, {24516, 6, 1, 0, 0},
+  {24522, 8, 1, 0, 0}, {24530, 7, 1, 0, 0}, {24537, 10, 1, 0, 0},
+  {24547, 6, 1, 0, 0}, {24553, 3, 1, 0, 0}, {3724, 6, 1, 0, 0},
+  {24556, 8, 1, 0, 0}, {24564, 10, 1, 0, 0}, {24574, 7, 1, 0, 0},
+  {24581, 8, 1, 0, 0}, {24589, 4, 1, 0, 0}, {24593, 7, 1, 0, 0},
+  {24600, 8, 1, 0, 0}, {24608, 8, 1, 0, 0}, {24616, 8, 1, 0, 0},
+  {24624, 10, 1, 0, 0}, {3840, 5, 1, 0, 0}, {24634, 7, 1, 0, 0},
+  {24641, 19, 1, 0, 0}, {24660, 6, 1, 0, 0}, {3862, 8, 1, 0, 0},
+  {24666, 9, 1, 0, 0}, {24675, 8, 1, 0, 0}, {24683, 11, 1, 0, 0},
+  {24694, 8, 1, 0, 0}, {24702, 4, 1, 0, 0}, {24706, 6, 1, 0, 0},
+  {24712, 6, 1, 0, 0}, {24718, 9, 1, 0, 0}, {24727, 7, 1, 0, 0},
+  {24734, 8, 1, 0, 0}, {24742, 6, 1, 0, 0}, {24748, 4, 1, 0, 0},
+  {3975, 5, 1, 0, 0}, {24752, 8, 1, 0, 0}, {24760, 10, 1, 0, 0},
+  {24770, 8, 1, 0, 0}, {4001, 6, 1, 0, 0}, {24778, 10, 1, 0, 0},
+  {24788, 8, 1, 0, 0}, {24796, 8, 1, 0, 0}, {24804, 8, 1, 0, 0},
+  {24812, 6, 1, 0, 0}, {24818, 6, 1, 0, 0}, {24824, 12, 1, 0, 0},
+  {24836, 16, 1, 0, 0}, {4057, 5, 1, 0, 0}, {24852, 8, 1, 0, 0},
+  {24860, 16, 1, 0, 0}, {24876, 16, 1, 0, 0}, {24892, 14, 1, 0, 0},
+  {24906, 14, 1, 0, 0}, {24920, 20, 1, 0, 0}, {24940, 15, 1, 0, 0},
+  {24955, 6, 1, 0, 0}, {24961, 17, 1, 0, 0}, {24978, 19, 1, 0, 0},
+  {24997, 8, 1, 0, 0}, {25005, 5, 1, 0, 0}, {25010, 8, 1, 0, 0},
+  {25018, 5, 1, 0, 0}, {25023, 12, 1, 0, 0}, {25035, 9, 1, 0, 0},
+  {25044, 9, 1, 0, 0}, {25053, 7, 1, 0, 0}, {25060, 9, 1, 0, 0},
+  {25069, 7, 1, 0, 0}, {25076, 6, 1, 0, 0}, {25082, 7, 1, 0, 0},
+  {25089, 5, 1, 0, 0}, {4269, 3, 1, 0, 0}, {4277, 3, 1, 0, 0},
+  {25094, 4, 1, 0, 0}, {25098, 13, 1, 0, 0}, {25111, 15, 1, 0, 0},
+  {25126, 5, 1, 0, 0}, {4355, 6, 1, 0, 0}, {25131, 7, 1, 0, 0},
+  {25138, 7, 1, 0, 0}, {25145, 6, 1, 0, 0}, {25151, 11, 1, 0, 0},
+  {25162, 5, 1, 0, 0}, {25167, 6, 1, 0, 0}, {25173, 7, 1, 0, 0},
+  {25180, 9, 1, 0, 0}, {25189, 6, 1, 0, 0}, {25195, 5, 1, 0, 0},
+  {25200, 11, 1, 0, 0}, {25211, 6, 1, 0, 0}, {4429, 5, 1, 0, 0},
+  {25217, 8, 1, 0, 0}, {4489, 8, 1, 0, 0}, {25225, 12, 1, 0, 0},
+  {25237, 16, 1, 0, 0}, {25253, 9, 1, 0, 0}, {25262, 7, 1, 0, 0},
+  {4517, 11, 1, 0, 0}, {25269, 6, 1, 0, 0}, {25275, 10, 1, 0, 0},
+  {25285, 11, 1, 0, 0}, {25296, 10, 1, 0, 0}, {25306, 6, 1, 0, 0},
+  {25312, 5, 1, 0, 0}, {25317, 6, 1, 0, 0}, {25323, 8, 1, 0, 0},
+  {25331, 10, 1, 0, 0}, {25341, 28, 1, 0, 0}, {25369, 12, 1, 0, 0},
+  {25381, 8, 1, 0, 0}, {4667, 5, 1, 0, 0}, {25389, 7, 1, 0, 0},
+  {25396, 6, 1, 0, 0}, {25402, 5, 1, 0, 0}, {4776, 6, 1, 0, 0},
+  {25407, 8, 1, 0, 0}, {25415, 7, 1, 0, 0}, {9078, 8, 1, 0, 0},
+  {25422, 10, 1, 0, 0}, {25432, 12, 1, 0, 0}, {25444, 9, 1, 0, 0},
+  {25453, 7, 1, 0, 0}, {18896, 4, 1, 0, 0}, {25460, 6, 1, 0, 0},
+  {25466, 10, 1, 0, 0}, {25476, 5, 1, 0, 0}, {25481, 12, 1, 0, 0},
+  {25493, 8, 1, 0, 0}, {25501, 8, 1, 0, 0}, {25509, 12, 1, 0, 0},
+  {25521, 12, 1, 0, 0}, {25533, 9, 1, 0, 0}, {25542, 7, 1, 0, 0},
+  {25549, 12, 1, 0, 0}, {25561, 4, 1, 0, 0}, {25565, 10, 1, 0, 0},
+  {25575, 12, 1, 0, 0}, {25587, 11, 1, 0, 0}, {25598, 11, 1, 0, 0},
+  {5181, 6, 1, 0, 0}, {25609, 7, 1, 0, 0}, {5200, 7, 1, 0, 0},
+  {25616, 15, 1, 0, 0}, {25631, 17, 1, 0, 0}, {25648, 18, 1, 0, 0},
+  {25666, 13, 1, 0, 0}, {25679, 14, 1, 0, 0}, {25693, 14, 1, 0, 0},
+  {25707, 8, 1, 0, 0}, {25715, 18, 1, 0, 0}, {25733, 8, 1, 0, 0},
+  {25741, 7, 1, 0, 0}, {25748, 10, 1, 0, 0}, {25758, 8, 1, 0, 0},
+  {5302, 5, 1, 0, 0}, {25766, 10, 1, 0, 0}, {25776, 7, 1, 0, 0},
+  {5355, 4, 1, 0, 0}, {5378, 3, 1, 0, 0}, {25783, 5, 1, 0, 0},
+  {25788, 7, 1, 0, 0}, {25795, 7, 1, 0, 0}, {25802, 14, 1, 0, 0},
+  {25816, 13, 1, 0, 0}, {25829, 9, 1, 0, 0}, {5480, 5, 1, 0, 0},
+  {25838, 3, 1, 0, 0}, {25841, 6, 1, 0, 0}, {25847, 5, 1, 0, 0},
+  {25852, 8, 1, 0, 0}, {25860, 9, 1, 0, 0}, {25869, 5, 1, 0, 0},
+  {25874, 15, 1, 0, 0}, {25889, 7, 1, 0, 0}, {25896, 5, 1, 0, 0},
+  {25901, 10, 1, 0, 0}, {25911, 6, 1, 0, 0}, {5548, 9, 1, 0, 0},
+  {25917, 12, 1, 0, 0}, {25929, 9, 1, 0, 0}, {25938, 6, 1, 0, 0},
+  {25944, 12, 1, 0, 0}, {25956, 6, 1, 0, 0}, {25962, 8, 1, 0, 0},
+  {25970, 6, 1, 0, 0}, {5653, 6, 1, 0, 0}, {25976, 4, 1, 0, 0},
+  {25980, 3, 1, 0, 0}, {5739, 10, 1, 0, 0}, {25983, 17, 1, 0, 0},
+  {26000, 10, 1, 0, 0}, {26010, 5, 1, 0, 0}, {26015, 7, 1, 0, 0},
+  {5778, 7, 1, 0, 0}, {26022, 4, 1, 0, 0}, {26026, 11, 1, 0, 0},
+  {26037, 8, 1, 0, 0}, {19055, 6, 1, 0, 0}, {26045, 5, 1, 0, 0},
+  {5902, 4, 1, 0, 0}, {26050, 9, 1, 0, 0}, {26059, 4, 1, 0, 0},
+  {26063, 7, 1, 0, 0}, {5984, 5, 1, 0, 0}, {26070, 7, 1, 0, 0},
+  {26077, 5, 1, 0, 0}, {26082, 3, 1, 0, 0}, {26085, 8, 1, 0, 0},
+  {6040, 10, 1, 0, 0}, {26093, 3, 1, 0, 0}, {26096, 10, 1, 0, 0},
+  {26106, 6, 1, 0, 0}, {26112, 15, 1, 0, 0}, {26127, 9, 1, 0, 0},
+  {26136, 16, 1, 0, 0}, {26152, 8, 1, 0, 0}, {26160, 9, 1, 0, 0},
+  {26169, 7, 1, 0, 0}, {26176, 15, 1, 0, 0}, {26191, 4, 1, 0, 0},
+  {26195, 4, 1, 0, 0}, {26199, 6, 1, 0, 0}, {26205, 6, 1, 0, 0},
+  {26211, 10, 1, 0, 0}, {6146, 6, 1, 0, 0}, {26221, 7, 1, 0, 0},
+  {26228, 8, 1, 0, 0}, {26236, 7, 1, 0, 0}, {26243, 7, 1, 0, 0},
+  {6188, 10, 1, 0, 0}, {26250, 11, 1, 0, 0}, {6248, 5, 1, 0, 0},
+  {26261, 8, 1, 0, 0}, {26269, 3, 1, 0, 0}, {26272, 12, 1, 0, 0},
+  {26284, 15, 1, 0, 0}, {26299, 13, 1, 0, 0}, {26312, 7, 1, 0, 0},
+  {26319, 9, 1, 0, 0}, {26328, 7, 1, 0, 0}, {26335, 8, 1, 0, 0},
+  {26343, 12, 1, 0, 0}, {26355, 8, 1, 0, 0}, {26363, 8, 1, 0, 0},
+  {26371, 14, 1, 0, 0}, {26385, 20, 1, 0, 0}, {26405, 36, 1, 0, 0},
+  {26441, 10, 1, 0, 0}, {26451, 11, 1, 0, 0}, {26462, 4, 1, 0, 0},
+  {26466, 9, 1, 0, 0}, {26475, 8, 1, 0, 0}, {26483, 5, 1, 0, 0},
+  {26488, 10, 1, 0, 0}, {26498, 7, 1, 0, 0}, {112, 4, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1466, 4, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4051, 6, 1, 0, 0}, {4089, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {4677, 3, 1, 0, 0}, {50, 2, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1466, 4, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {4051, 6, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {9387, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {712, 3, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4089, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {10037, 3, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {947, 2, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {16461, 2, 1, 0, 0}, {3006, 2, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3946, 4, 1, 0, 0}, {4072, 2, 1, 0, 0}, {4089, 4, 1, 0, 0},
+  {9524, 2, 1, 0, 0}, {4380, 3, 1, 0, 0}, {4677, 3, 1, 0, 0},
+  {5181, 6, 1, 0, 0}, {6011, 2, 1, 0, 0}, {6059, 2, 1, 0, 0},
+  {6434, 2, 1, 0, 0}, {20722, 3, 0, 1, 9121}, {26505, 3, 0, 1, 9122},
+  {10696, 4, 1, 0, 0}, {8524, 3, 1, 0, 0}, {11114, 13, 9, 0, 0},
+  {26508, 14, 9, 0, 0}, {26522, 14, 9, 0, 0}, {26536, 6, 9, 0, 0},
+  {26542, 6, 9, 0, 0}, {26548, 14, 9, 0, 0}, {26562, 10, 9, 0, 0},
+  {26572, 18, 9, 0, 0}, {26590, 8, 9, 0, 0}, {26598, 16, 9, 0, 0},
+  {26614, 12, 9, 0, 0}, {26626, 20, 9, 0, 0}, {26646, 9, 9, 0, 0},
+  {26655, 17, 9, 0, 0}, {26672, 10, 9, 0, 0}, {26682, 6, 9, 0, 0},
+  {26688, 12, 9, 0, 0}, {26700, 13, 0, 1, 9123}, {26713, 12, 9, 0, 0},
+  {26725, 15, 9, 7, 9124}, {26740, 13, 9, 0, 0}, {26753, 4, 9, 0, 0},
+  {26757, 4, 9, 0, 0}, {26761, 4, 9, 0, 0}, {9639, 5, 9, 0, 0},
+  {26765, 9, 9, 0, 0}, {26774, 12, 9, 0, 0}, {11353, 7, 9, 0, 0},
+  {26786, 6, 9, 0, 0}, {26792, 8, 9, 0, 0}, {11392, 7, 9, 0, 0},
+  {26800, 8, 9, 0, 0}, {26808, 10, 9, 0, 0}, {26818, 7, 9, 0, 0},
+  {26825, 9, 9, 0, 0}, {26834, 5, 0, 1, 9131}, {26839, 9, 9, 0, 0},
+  {26848, 11, 9, 1, 9132}, {26859, 11, 9, 0, 0}, {16251, 11, 9, 0, 0},
+  {26870, 8, 9, 0, 0}, {26878, 10, 9, 0, 0}, {26888, 14, 9, 0, 0},
+  {26902, 10, 9, 2, 9133}, {26912, 13, 9, 0, 0}, {14931, 13, 9, 0, 0},
+  {26925, 11, 18, 0, 0}, {11542, 10, 9, 0, 0}, {22108, 4, 9, 0, 0},
+  {26936, 6, 9, 0, 0}, {16800, 8, 9, 0, 0}, {11685, 8, 9, 0, 0},
+  {11693, 7, 9, 0, 0}, {26942, 5, 9, 0, 0}, {26947, 7, 9, 0, 0},
+  {11721, 9, 9, 0, 0}, {11763, 7, 9, 0, 0}, {11780, 8, 9, 0, 0},
+  {26954, 9, 9, 0, 0}, {26963, 4, 9, 0, 0}, {26967, 5, 9, 0, 0},
+  {26972, 14, 9, 0, 0}, {26986, 7, 9, 0, 0}, {26993, 7, 9, 0, 0},
+  {27000, 15, 9, 0, 0}, {27015, 9, 9, 0, 0}, {27024, 17, 9, 0, 0},
+  {27041, 6, 0, 3, 9135}, {27047, 13, 9, 0, 0}, {12048, 8, 9, 0, 0},
+  {27060, 6, 0, 4, 9138}, {27066, 8, 9, 1, 9142}, {27074, 10, 9, 0, 0},
+  {27084, 8, 9, 0, 0}, {12113, 16, 9, 0, 0}, {27092, 12, 9, 0, 0},
+  {27104, 7, 9, 0, 0}, {27111, 7, 9, 0, 0}, {27118, 7, 9, 0, 0},
+  {27125, 7, 9, 0, 0}, {2443, 2, 9, 0, 0}, {27132, 7, 9, 0, 0},
+  {27139, 12, 9, 0, 0}, {27151, 6, 9, 0, 0}, {27157, 5, 9, 0, 0},
+  {27162, 7, 9, 0, 0}, {27169, 6, 9, 0, 0}, {12660, 9, 9, 0, 0},
+  {12698, 8, 9, 0, 0}, {2929, 2, 9, 0, 0}, {3006, 2, 9, 0, 0},
+  {15149, 6, 9, 0, 0}, {27175, 11, 9, 0, 0}, {15155, 6, 9, 0, 0},
+  {27186, 4, 9, 0, 0}, {27190, 7, 9, 0, 0}, {12860, 9, 9, 0, 0},
+  {12970, 9, 9, 0, 0}, {13505, 8, 9, 0, 0}, {3207, 2, 9, 0, 0},
+  {27197, 9, 9, 0, 0}, {27206, 8, 9, 0, 0}, {27214, 10, 9, 0, 0},
+  {27224, 8, 9, 0, 0}, {13679, 11, 0, 1, 9143}, {27232, 9, 9, 0, 0},
+  {27241, 6, 9, 0, 0}, {16913, 9, 9, 0, 0}, {27247, 7, 9, 0, 0},
+  {13757, 7, 9, 0, 0}, {27254, 9, 9, 0, 0}, {27263, 8, 9, 0, 0},
+  {27271, 7, 9, 0, 0}, {27278, 9, 9, 0, 0}, {27287, 5, 9, 0, 0},
+  {13798, 16, 9, 0, 0}, {9512, 12, 9, 0, 0}, {27292, 6, 9, 0, 0},
+  {9740, 5, 9, 0, 0}, {27298, 7, 9, 0, 0}, {27305, 13, 9, 0, 0},
+  {27318, 9, 9, 0, 0}, {4411, 3, 0, 2, 9144}, {27327, 5, 9, 0, 0},
+  {27332, 6, 9, 0, 0}, {27338, 7, 9, 0, 0}, {27345, 24, 9, 0, 0},
+  {14196, 8, 9, 0, 0}, {27369, 10, 9, 0, 0}, {14225, 14, 9, 0, 0},
+  {5015, 2, 9, 0, 0}, {27379, 11, 0, 2, 9146}, {27390, 10, 0, 1, 9148},
+  {27400, 10, 9, 0, 0}, {27410, 13, 9, 0, 0}, {5213, 2, 9, 0, 0},
+  {27423, 6, 9, 0, 0}, {9748, 6, 9, 0, 0}, {27429, 8, 9, 0, 0},
+  {27437, 10, 9, 0, 0}, {14309, 8, 9, 0, 0}, {27447, 9, 9, 0, 0},
+  {14357, 8, 9, 0, 0}, {27456, 14, 9, 0, 0}, {27470, 10, 9, 0, 0},
+  {27480, 8, 9, 0, 0}, {10689, 7, 9, 0, 0}, {27488, 4, 0, 2, 9149},
+  {27492, 13, 9, 0, 0}, {11076, 8, 9, 0, 0}, {27505, 5, 9, 0, 0},
+  {27510, 8, 9, 0, 0}, {27518, 9, 0, 1, 9151}, {27527, 8, 9, 0, 0},
+  {27535, 10, 9, 1, 9152}, {19652, 2, 9, 0, 0}, {27545, 8, 0, 1, 9153},
+  {10645, 6, 9, 0, 0}, {6032, 2, 9, 0, 0}, {27553, 4, 9, 0, 0},
+  {27557, 6, 9, 0, 0}, {27563, 8, 9, 1, 9154}, {9754, 6, 9, 0, 0},
+  {27571, 11, 9, 2, 9155}, {8479, 2, 9, 0, 0}, {27582, 5, 18, 0, 0},
+  {27587, 4, 9, 0, 0}, {27591, 7, 9, 0, 0}, {1308, 2, 9, 0, 0},
+  {27598, 4, 9, 0, 0}, {27602, 10, 9, 0, 0}, {11014, 4, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {11042, 4, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {27612, 5, 1, 0, 0}, {22045, 3, 1, 0, 0},
+  {10388, 3, 1, 0, 0}, {5564, 5, 1, 0, 0}, {9379, 3, 1, 0, 0},
+  {27617, 3, 9, 0, 0}, {1340, 3, 1, 1, 9157}, {1880, 3, 1, 0, 0},
+  {11042, 4, 9, 0, 0}, {16463, 3, 9, 0, 0}, {2599, 3, 1, 0, 0},
+  {9650, 1, 1, 0, 0}, {3686, 3, 9, 0, 0}, {3903, 3, 1, 0, 0},
+  {3946, 4, 1, 0, 0}, {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4177, 3, 9, 0, 0}, {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {50, 2, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {9387, 3, 1, 0, 0}, {3006, 2, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {8524, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {9379, 3, 1, 0, 0},
+  {9573, 10, 9, 0, 0}, {8527, 8, 9, 0, 0}, {27620, 7, 9, 0, 0},
+  {1308, 2, 9, 0, 0}, {27627, 5, 9, 0, 0}, {2599, 3, 9, 0, 0},
+  {27632, 15, 9, 0, 0}, {27647, 6, 9, 0, 0}, {9512, 12, 9, 0, 0},
+  {9609, 8, 18, 0, 0}, {15644, 13, 9, 0, 0}, {27653, 2, 1, 1, 9158},
+  {27655, 8, 1, 0, 0}, {27663, 6, 1, 0, 0}, {27669, 6, 1, 0, 0},
+  {27675, 7, 1, 0, 0}, {10930, 2, 1, 1, 9159}, {27682, 8, 0, 1, 9160},
+  {27690, 10, 1, 0, 0}, {27700, 8, 1, 0, 0}, {176, 2, 1, 0, 0},
+  {27708, 9, 1, 0, 0}, {27717, 7, 1, 0, 0}, {27724, 6, 1, 0, 0},
+  {27730, 9, 1, 0, 0}, {27739, 4, 1, 0, 0}, {27743, 6, 1, 0, 0},
+  {27749, 4, 1, 0, 0}, {27753, 4, 1, 0, 0}, {27757, 9, 1, 0, 0},
+  {27766, 6, 1, 0, 0}, {27772, 5, 1, 0, 0}, {27777, 5, 1, 0, 0},
+  {27782, 7, 1, 0, 0}, {27789, 7, 1, 0, 0}, {27796, 4, 1, 0, 0},
+  {27800, 6, 1, 0, 0}, {27806, 5, 1, 0, 0}, {27811, 5, 1, 0, 0},
+  {27816, 5, 1, 0, 0}, {27821, 7, 1, 0, 0}, {27828, 5, 1, 0, 0},
+  {27833, 9, 1, 0, 0}, {27842, 5, 1, 0, 0}, {27847, 4, 1, 0, 0},
+  {27851, 7, 1, 0, 0}, {27858, 14, 1, 0, 0}, {27872, 9, 1, 0, 0},
+  {27881, 9, 1, 0, 0}, {27890, 6, 1, 0, 0}, {27896, 8, 1, 0, 0},
+  {27904, 11, 1, 0, 0}, {27915, 12, 1, 0, 0}, {27927, 6, 1, 0, 0},
+  {27933, 7, 1, 0, 0}, {27940, 5, 1, 0, 0}, {27945, 10, 1, 0, 0},
+  {27955, 9, 1, 0, 0}, {27964, 9, 1, 0, 0}, {27973, 6, 1, 0, 0},
+  {27979, 5, 1, 0, 0}, {27984, 5, 1, 0, 0}, {27989, 9, 1, 0, 0},
+  {27998, 11, 1, 0, 0}, {28009, 6, 1, 0, 0}, {28015, 6, 1, 0, 0},
+  {28021, 4, 1, 0, 0}, {28025, 6, 1, 0, 0}, {28031, 8, 1, 0, 0},
+  {28039, 6, 1, 0, 0}, {28045, 6, 1, 0, 0}, {28051, 8, 1, 0, 0},
+  {28059, 7, 1, 0, 0}, {28066, 9, 1, 0, 0}, {28075, 5, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {28080, 4, 1, 0, 0}, {28084, 4, 1, 0, 0},
+  {28088, 5, 1, 0, 0}, {28093, 9, 1, 0, 0}, {28102, 7, 1, 0, 0},
+  {28109, 11, 1, 0, 0}, {28120, 10, 1, 0, 0}, {28130, 5, 1, 0, 0},
+  {28135, 2, 1, 1, 9161}, {28137, 7, 1, 0, 0}, {28144, 8, 0, 1, 9162},
+  {28152, 7, 1, 0, 0}, {28159, 5, 1, 0, 0}, {28164, 10, 1, 0, 0},
+  {1308, 2, 9, 0, 0}, {28174, 11, 1, 0, 0}, {28185, 10, 1, 0, 0},
+  {28195, 6, 1, 0, 0}, {28201, 3, 1, 0, 0}, {28204, 13, 1, 0, 0},
+  {28217, 12, 1, 0, 0}, {28229, 13, 1, 0, 0}, {28242, 5, 1, 0, 0},
+  {28247, 5, 1, 0, 0}, {28252, 7, 1, 0, 0}, {28259, 9, 1, 0, 0},
+  {28268, 6, 1, 0, 0}, {28274, 5, 1, 0, 0}, {28279, 8, 1, 0, 0},
+  {28287, 3, 1, 0, 0}, {28290, 8, 1, 0, 0}, {28298, 8, 1, 0, 0},
+  {28306, 7, 1, 0, 0}, {28313, 8, 1, 0, 0}, {28321, 9, 1, 0, 0},
+  {28330, 7, 1, 0, 0}, {28337, 7, 1, 0, 0}, {28344, 8, 1, 0, 0},
+  {28352, 4, 1, 0, 0}, {28356, 7, 1, 0, 0}, {28363, 8, 1, 0, 0},
+  {28371, 6, 1, 0, 0}, {28377, 15, 1, 0, 0}, {28392, 7, 1, 0, 0},
+  {28399, 6, 1, 0, 0}, {28405, 5, 1, 0, 0}, {28410, 3, 1, 0, 0},
+  {28413, 7, 1, 0, 0}, {28420, 3, 1, 0, 0}, {28423, 6, 1, 0, 0},
+  {28429, 6, 1, 0, 0}, {28435, 6, 1, 0, 0}, {28441, 5, 1, 0, 0},
+  {28446, 3, 1, 0, 0}, {28449, 8, 1, 0, 0}, {28457, 9, 1, 0, 0},
+  {28466, 11, 1, 0, 0}, {28477, 8, 1, 0, 0}, {28485, 5, 1, 0, 0},
+  {28490, 5, 1, 0, 0}, {2258, 2, 1, 1, 9163}, {28495, 9, 1, 0, 0},
+  {28504, 7, 1, 0, 0}, {28511, 5, 1, 0, 0}, {28516, 7, 1, 0, 0},
+  {28523, 6, 1, 0, 0}, {28529, 5, 1, 0, 0}, {28534, 11, 1, 0, 0},
+  {28545, 4, 1, 0, 0}, {28549, 5, 1, 0, 0}, {28554, 7, 1, 0, 0},
+  {28561, 6, 1, 0, 0}, {28567, 5, 1, 0, 0}, {28572, 7, 1, 0, 0},
+  {28579, 7, 1, 0, 0}, {28586, 4, 1, 0, 0}, {28590, 10, 1, 0, 0},
+  {28600, 8, 1, 0, 0}, {28608, 9, 1, 0, 0}, {28617, 5, 1, 0, 0},
+  {28622, 6, 1, 0, 0}, {28628, 10, 1, 0, 0}, {28638, 6, 1, 0, 0},
+  {28644, 7, 1, 0, 0}, {28651, 13, 1, 0, 0}, {28664, 9, 1, 0, 0},
+  {28673, 5, 1, 0, 0}, {28678, 7, 1, 0, 0}, {28685, 8, 1, 0, 0},
+  {28693, 8, 1, 0, 0}, {28701, 7, 1, 0, 0}, {28708, 6, 1, 0, 0},
+  {28714, 7, 1, 0, 0}, {28721, 3, 1, 0, 0}, {28724, 4, 1, 0, 0},
+  {28728, 5, 1, 0, 0}, {28733, 7, 1, 0, 0}, {28740, 9, 1, 0, 0},
+  {28749, 8, 1, 0, 0}, {28757, 5, 1, 0, 0}, {28762, 4, 1, 0, 0},
+  {28766, 5, 1, 0, 0}, {28771, 13, 1, 0, 0}, {10948, 2, 1, 0, 0},
+  {28784, 6, 1, 0, 0}, {28790, 6, 1, 0, 0}, {28796, 10, 1, 0, 0},
+  {28806, 6, 1, 0, 0}, {28812, 5, 1, 0, 0}, {28817, 5, 1, 0, 0},
+  {28822, 7, 1, 0, 0}, {28829, 12, 1, 0, 0}, {28841, 10, 1, 0, 0},
+  {28851, 6, 1, 0, 0}, {28857, 5, 1, 0, 0}, {28862, 6, 1, 0, 0},
+  {28868, 7, 1, 0, 0}, {28875, 6, 1, 0, 0}, {28881, 12, 1, 0, 0},
+  {28893, 9, 1, 0, 0}, {28902, 7, 0, 3, 9164}, {28909, 5, 1, 0, 0},
+  {28914, 6, 1, 0, 0}, {28920, 8, 1, 0, 0}, {28928, 5, 1, 0, 0},
+  {28933, 5, 1, 0, 0}, {28938, 8, 1, 0, 0}, {28946, 10, 1, 0, 0},
+  {10956, 2, 1, 1, 9167}, {2804, 2, 1, 1, 9168}, {28956, 5, 1, 0, 0},
+  {28961, 3, 1, 0, 0}, {28964, 8, 1, 0, 0}, {28972, 3, 1, 0, 0},
+  {28975, 4, 1, 0, 0}, {28979, 11, 1, 0, 0}, {28990, 8, 1, 0, 0},
+  {28998, 8, 1, 0, 0}, {29006, 9, 0, 1, 9169}, {29015, 9, 1, 0, 0},
+  {29024, 6, 1, 0, 0}, {29030, 8, 1, 0, 0}, {29038, 9, 1, 0, 0},
+  {29047, 6, 1, 0, 0}, {29053, 5, 1, 0, 0}, {29058, 6, 1, 0, 0},
+  {29064, 9, 1, 0, 0}, {29073, 7, 1, 0, 0}, {29080, 6, 1, 0, 0},
+  {29086, 7, 1, 0, 0}, {29093, 7, 1, 0, 0}, {29100, 4, 1, 0, 0},
+  {29104, 9, 1, 1, 9170}, {29113, 8, 1, 0, 0}, {29121, 8, 1, 0, 0},
+  {29129, 7, 1, 0, 0}, {29136, 6, 1, 0, 0}, {29142, 9, 1, 0, 0},
+  {29151, 7, 1, 0, 0}, {29158, 10, 1, 0, 0}, {29168, 8, 1, 0, 0},
+  {29176, 7, 1, 0, 0}, {29183, 6, 1, 0, 0}, {29189, 10, 1, 0, 0},
+  {29199, 8, 1, 0, 0}, {29207, 5, 1, 0, 0}, {29212, 5, 1, 0, 0},
+  {29217, 7, 1, 0, 0}, {29224, 9, 1, 0, 0}, {29233, 11, 1, 0, 0},
+  {29244, 8, 1, 0, 0}, {29252, 9, 1, 0, 0}, {29261, 7, 1, 0, 0},
+  {29268, 12, 1, 0, 0}, {29280, 12, 1, 0, 0}, {29292, 10, 1, 0, 0},
+  {29302, 12, 1, 0, 0}, {29314, 8, 1, 0, 0}, {29322, 8, 1, 0, 0},
+  {29330, 4, 1, 0, 0}, {29334, 9, 1, 0, 0}, {29343, 9, 1, 0, 0},
+  {29352, 10, 1, 0, 0}, {29362, 9, 1, 0, 0}, {29371, 7, 1, 0, 0},
+  {29378, 12, 1, 0, 0}, {29390, 6, 1, 0, 0}, {29396, 8, 1, 0, 0},
+  {29404, 6, 1, 0, 0}, {29410, 6, 1, 0, 0}, {29416, 7, 1, 0, 0},
+  {29423, 8, 1, 0, 0}, {29431, 11, 1, 0, 0}, {29442, 7, 1, 0, 0},
+  {29449, 9, 1, 0, 0}, {29458, 9, 1, 0, 0}, {29467, 7, 1, 0, 0},
+  {29474, 4, 1, 0, 0}, {29478, 7, 1, 0, 0}, {29485, 6, 1, 0, 0},
+  {29491, 6, 1, 0, 0}, {29497, 5, 1, 0, 0}, {29502, 8, 1, 0, 0},
+  {29510, 4, 1, 0, 0}, {29514, 6, 1, 0, 0}, {29520, 11, 1, 0, 0},
+  {29531, 9, 1, 0, 0}, {29540, 6, 1, 0, 0}, {29546, 9, 1, 0, 0},
+  {29555, 6, 1, 0, 0}, {29561, 8, 1, 0, 0}, {18355, 3, 1, 0, 0},
+  {29569, 5, 1, 0, 0}, {29574, 9, 1, 0, 0}, {29583, 5, 1, 0, 0},
+  {29588, 4, 1, 0, 0}, {29592, 6, 1, 0, 0}, {29598, 5, 1, 0, 0},
+  {29603, 6, 1, 0, 0}, {29609, 7, 1, 0, 0}, {29616, 6, 1, 0, 0},
+  {29622, 11, 1, 0, 0}, {29633, 7, 1, 0, 0}, {29640, 6, 1, 0, 0},
+  {29646, 6, 1, 0, 0}, {29652, 6, 1, 0, 0}, {29658, 9, 1, 0, 0},
+  {29667, 10, 1, 0, 0}, {29677, 5, 1, 0, 0}, {29682, 13, 1, 0, 0},
+  {29695, 6, 1, 0, 0}, {29701, 6, 1, 0, 0}, {29707, 6, 1, 0, 0},
+  {29713, 5, 1, 0, 0}, {29718, 7, 1, 0, 0}, {29725, 7, 1, 0, 0},
+  {29732, 14, 1, 0, 0}, {3903, 3, 1, 0, 0}, {29746, 9, 1, 0, 0},
+  {29755, 9, 1, 0, 0}, {29764, 7, 1, 0, 0}, {29771, 7, 1, 0, 0},
+  {29778, 5, 1, 0, 0}, {29783, 5, 1, 0, 0}, {29788, 15, 0, 2, 9171},
+  {29803, 7, 1, 0, 0}, {29810, 8, 1, 0, 0}, {29818, 4, 1, 0, 0},
+  {29822, 6, 1, 0, 0}, {4034, 2, 1, 1, 9173}, {29828, 6, 1, 0, 0},
+  {4051, 6, 1, 0, 0}, {9512, 12, 9, 0, 0}, {29834, 14, 1, 0, 0},
+  {29848, 10, 1, 0, 0}, {29858, 6, 1, 0, 0}, {29864, 10, 1, 0, 0},
+  {29874, 9, 1, 0, 0}, {29883, 5, 1, 0, 0}, {29888, 8, 1, 0, 0},
+  {29896, 6, 1, 0, 0}, {29902, 8, 1, 0, 0}, {29910, 8, 1, 0, 0},
+  {29918, 11, 1, 0, 0}, {29929, 5, 1, 0, 0}, {29934, 8, 1, 0, 0},
+  {29942, 12, 1, 0, 0}, {29954, 7, 1, 0, 0}, {29961, 6, 1, 0, 0},
+  {29967, 8, 1, 0, 0}, {29975, 8, 1, 0, 0}, {4215, 2, 1, 1, 9174},
+  {29983, 11, 1, 0, 0}, {29994, 9, 1, 0, 0}, {30003, 9, 1, 0, 0},
+  {30012, 7, 1, 0, 0}, {30019, 8, 1, 0, 0}, {30027, 8, 0, 4, 9175},
+  {30035, 11, 1, 0, 0}, {30046, 9, 1, 0, 0}, {30055, 13, 1, 0, 0},
+  {30068, 8, 1, 0, 0}, {30076, 8, 1, 0, 0}, {9551, 2, 1, 1, 9179},
+  {30084, 4, 1, 0, 0}, {10555, 2, 1, 1, 9180}, {30088, 6, 1, 0, 0},
+  {30094, 2, 1, 1, 9181}, {30096, 10, 1, 0, 0}, {30106, 6, 1, 0, 0},
+  {30112, 8, 1, 0, 0}, {30120, 8, 1, 0, 0}, {30128, 6, 1, 0, 0},
+  {30134, 6, 1, 0, 0}, {30140, 6, 1, 0, 0}, {30146, 5, 1, 0, 0},
+  {30151, 4, 1, 0, 0}, {30155, 4, 1, 1, 9182}, {30159, 6, 1, 0, 0},
+  {30165, 7, 1, 0, 0}, {30172, 7, 0, 1, 9183}, {30179, 11, 1, 0, 0},
+  {30190, 9, 1, 0, 0}, {30199, 10, 1, 0, 0}, {30209, 4, 1, 0, 0},
+  {30213, 8, 1, 0, 0}, {30221, 13, 1, 0, 0}, {30234, 9, 1, 0, 0},
+  {30243, 8, 1, 0, 0}, {30251, 9, 1, 0, 0}, {9534, 4, 1, 0, 0},
+  {30260, 4, 1, 0, 0}, {30264, 5, 1, 0, 0}, {30269, 11, 1, 0, 0},
+  {30280, 6, 1, 0, 0}, {30286, 5, 1, 0, 0}, {30291, 9, 1, 0, 0},
+  {30300, 8, 1, 0, 0}, {30308, 4, 1, 0, 0}, {30312, 9, 1, 0, 0},
+  {30321, 5, 1, 0, 0}, {30326, 8, 1, 0, 0}, {30334, 7, 1, 0, 0},
+  {30341, 8, 1, 0, 0}, {30349, 6, 1, 0, 0}, {30355, 7, 1, 0, 0},
+  {30362, 9, 1, 0, 0}, {30371, 9, 1, 0, 0}, {30380, 5, 1, 0, 0},
+  {30385, 5, 1, 0, 0}, {30390, 2, 1, 1, 9184}, {30392, 4, 1, 0, 0},
+  {30396, 5, 1, 0, 0}, {30401, 6, 1, 0, 0}, {30407, 5, 1, 0, 0},
+  {30412, 7, 1, 0, 0}, {30419, 5, 1, 0, 0}, {30424, 4, 1, 0, 0},
+  {30428, 6, 1, 0, 0}, {30434, 7, 1, 0, 0}, {30441, 6, 1, 0, 0},
+  {30447, 5, 1, 0, 0}, {30452, 8, 1, 0, 0}, {30460, 5, 1, 0, 0},
+  {30465, 7, 1, 0, 0}, {30472, 9, 1, 0, 0}, {30481, 10, 1, 0, 0},
+  {30491, 7, 1, 0, 0}, {30498, 12, 1, 0, 0}, {30510, 6, 1, 0, 0},
+  {30516, 9, 1, 0, 0}, {30525, 5, 1, 0, 0}, {30530, 8, 1, 0, 0},
+  {30538, 3, 1, 0, 0}, {30541, 5, 1, 0, 0}, {30546, 5, 1, 0, 0},
+  {30551, 7, 1, 0, 0}, {30558, 2, 1, 1, 9185}, {30560, 7, 1, 0, 0},
+  {30567, 6, 1, 0, 0}, {30573, 6, 1, 0, 0}, {30579, 6, 1, 0, 0},
+  {30585, 6, 1, 0, 0}, {30591, 8, 1, 0, 0}, {30599, 5, 1, 0, 0},
+  {30604, 7, 1, 0, 0}, {30611, 13, 1, 0, 0}, {5378, 3, 1, 0, 0},
+  {30624, 5, 1, 0, 0}, {30629, 7, 1, 0, 0}, {30636, 8, 1, 0, 0},
+  {30644, 5, 1, 0, 0}, {30649, 8, 1, 0, 0}, {30657, 6, 1, 0, 0},
+  {30663, 7, 1, 0, 0}, {30670, 5, 1, 0, 0}, {30675, 6, 1, 0, 0},
+  {30681, 5, 1, 0, 0}, {30686, 10, 1, 0, 0}, {30696, 6, 1, 0, 0},
+  {30702, 7, 1, 0, 0}, {30709, 5, 1, 0, 0}, {30714, 7, 1, 0, 0},
+  {30721, 4, 1, 0, 0}, {30725, 6, 1, 0, 0}, {30731, 5, 1, 0, 0},
+  {30736, 11, 1, 0, 0}, {30747, 9, 1, 0, 0}, {30756, 10, 1, 0, 0},
+  {30766, 8, 1, 0, 0}, {30774, 8, 1, 0, 0}, {30782, 12, 1, 0, 0},
+  {30794, 7, 1, 0, 0}, {30801, 8, 1, 0, 0}, {30809, 8, 1, 0, 0},
+  {30817, 5, 1, 0, 0}, {30822, 10, 1, 0, 0}, {30832, 9, 1, 0, 0},
+  {5501, 2, 1, 1, 9186}, {30841, 6, 1, 0, 0}, {30847, 4, 1, 0, 0},
+  {30851, 9, 1, 0, 0}, {30860, 9, 1, 0, 0}, {30869, 7, 1, 0, 0},
+  {30876, 7, 1, 0, 0}, {30883, 9, 1, 0, 0}, {30892, 8, 1, 0, 0},
+  {30900, 15, 1, 0, 0}, {30915, 6, 1, 0, 0}, {30921, 11, 1, 0, 0},
+  {30932, 5, 1, 0, 0}, {30937, 7, 1, 0, 0}, {30944, 9, 1, 0, 0},
+  {30953, 6, 1, 0, 0}, {30959, 7, 1, 0, 0}, {30966, 5, 1, 0, 0},
+  {30971, 4, 1, 0, 0}, {30975, 6, 1, 0, 0}, {30981, 4, 1, 0, 0},
+  {30985, 7, 1, 0, 0}, {30992, 8, 1, 0, 0}, {31000, 8, 1, 1, 9187},
+  {31008, 5, 1, 0, 0}, {31013, 7, 1, 0, 0}, {31020, 9, 1, 0, 0},
+  {31029, 4, 1, 0, 0}, {31033, 8, 1, 0, 0}, {31041, 8, 0, 2, 9188},
+  {26022, 4, 1, 0, 0}, {31049, 8, 1, 0, 0}, {31057, 4, 1, 0, 0},
+  {31061, 9, 1, 0, 0}, {31070, 5, 1, 0, 0}, {5851, 2, 1, 1, 9190},
+  {31075, 5, 1, 0, 0}, {31080, 5, 1, 0, 0}, {31085, 8, 1, 0, 0},
+  {31093, 7, 1, 0, 0}, {5916, 2, 1, 1, 9191}, {31100, 5, 1, 0, 0},
+  {31105, 6, 1, 0, 0}, {31111, 6, 1, 0, 0}, {31117, 8, 1, 0, 0},
+  {31125, 8, 1, 0, 0}, {31133, 6, 1, 0, 0}, {31139, 6, 1, 0, 0},
+  {31145, 9, 1, 0, 0}, {31154, 6, 1, 0, 0}, {31160, 11, 1, 0, 0},
+  {31171, 5, 1, 0, 0}, {31176, 6, 1, 0, 0}, {31182, 8, 1, 0, 0},
+  {31190, 6, 1, 0, 0}, {31196, 6, 1, 0, 0}, {31202, 10, 1, 0, 0},
+  {31212, 10, 1, 0, 0}, {31222, 5, 1, 0, 0}, {31227, 7, 1, 0, 0},
+  {31234, 6, 1, 0, 0}, {6065, 2, 1, 1, 9192}, {31240, 7, 1, 0, 0},
+  {31247, 5, 1, 0, 0}, {31252, 4, 1, 0, 0}, {31256, 5, 1, 0, 0},
+  {31261, 6, 1, 0, 0}, {31267, 7, 1, 0, 0}, {31274, 5, 1, 0, 0},
+  {31279, 4, 1, 0, 0}, {31283, 8, 1, 0, 0}, {31291, 5, 1, 0, 0},
+  {31296, 7, 1, 0, 0}, {31303, 5, 1, 0, 0}, {31308, 5, 1, 0, 0},
+  {31313, 4, 1, 0, 0}, {31317, 9, 1, 0, 0}, {31326, 8, 1, 0, 0},
+  {31334, 6, 1, 0, 0}, {31340, 6, 1, 0, 0}, {31346, 6, 1, 0, 0},
+  {31352, 8, 0, 1, 9193}, {31360, 7, 1, 0, 0}, {31367, 13, 1, 0, 0},
+  {31380, 12, 1, 0, 0}, {31392, 9, 1, 0, 0}, {31401, 9, 1, 0, 0},
+  {31410, 2, 1, 1, 9194}, {31412, 3, 1, 0, 0}, {31415, 3, 1, 0, 0},
+  {31418, 5, 1, 0, 0}, {31423, 10, 1, 0, 0}, {31433, 6, 1, 0, 0},
+  {31439, 5, 1, 0, 0}, {31444, 4, 1, 0, 0}, {31448, 11, 1, 0, 0},
+  {31459, 12, 1, 0, 0}, {31471, 12, 1, 0, 0}, {31483, 21, 1, 0, 0},
+  {31504, 13, 1, 0, 0}, {31517, 15, 1, 0, 0}, {31532, 18, 1, 0, 0},
+  {31550, 15, 1, 0, 0}, {31565, 18, 1, 0, 0}, {31583, 19, 1, 0, 0},
+  {31602, 13, 1, 0, 0}, {31615, 13, 1, 0, 0}, {31628, 14, 1, 0, 0},
+  {31642, 14, 1, 0, 0}, {31656, 12, 1, 0, 0}, {31668, 12, 1, 0, 0},
+  {31680, 11, 1, 0, 0}, {31691, 14, 1, 0, 0}, {31705, 18, 1, 0, 0},
+  {31723, 12, 1, 0, 0}, {31735, 16, 1, 0, 0}, {31751, 18, 1, 0, 0},
+  {31769, 12, 1, 0, 0}, {31781, 13, 1, 0, 0}, {31794, 12, 1, 0, 0},
+  {31806, 17, 1, 0, 0}, {31823, 13, 1, 0, 0}, {31836, 13, 1, 0, 0},
+  {31849, 10, 1, 0, 0}, {31859, 12, 1, 0, 0}, {31871, 12, 1, 0, 0},
+  {31883, 12, 1, 0, 0}, {31895, 12, 1, 0, 0}, {31907, 19, 1, 0, 0},
+  {31926, 16, 1, 0, 0}, {31942, 16, 1, 0, 0}, {31958, 13, 1, 0, 0},
+  {31971, 12, 1, 0, 0}, {31983, 9, 1, 0, 0}, {31992, 13, 1, 0, 0},
+  {32005, 19, 1, 0, 0}, {32024, 17, 1, 0, 0}, {32041, 19, 1, 0, 0},
+  {32060, 15, 1, 0, 0}, {32075, 12, 1, 0, 0}, {32087, 15, 1, 0, 0},
+  {32102, 13, 1, 0, 0}, {32115, 15, 1, 0, 0}, {32130, 16, 1, 0, 0},
+  {32146, 14, 1, 0, 0}, {32160, 14, 1, 0, 0}, {32174, 16, 1, 0, 0},
+  {32190, 13, 1, 0, 0}, {32203, 14, 1, 0, 0}, {32217, 12, 1, 0, 0},
+  {32229, 19, 1, 0, 0}, {32248, 14, 1, 0, 0}, {32262, 16, 1, 0, 0},
+  {32278, 17, 1, 0, 0}, {32295, 15, 1, 0, 0}, {32310, 19, 1, 0, 0},
+  {32329, 13, 1, 0, 0}, {32342, 15, 1, 0, 0}, {32357, 14, 1, 0, 0},
+  {32371, 16, 1, 0, 0}, {32387, 9, 1, 0, 0}, {32396, 16, 1, 0, 0},
+  {32412, 15, 1, 0, 0}, {32427, 15, 1, 0, 0}, {32442, 18, 1, 0, 0},
+  {32460, 14, 1, 0, 0}, {32474, 13, 1, 0, 0}, {32487, 13, 1, 0, 0},
+  {32500, 13, 1, 0, 0}, {32513, 13, 1, 0, 0}, {32526, 13, 1, 0, 0},
+  {32539, 16, 1, 0, 0}, {32555, 11, 1, 0, 0}, {32566, 12, 1, 0, 0},
+  {32578, 12, 1, 0, 0}, {32590, 12, 1, 0, 0}, {32602, 14, 1, 0, 0},
+  {32616, 16, 1, 0, 0}, {32632, 18, 1, 0, 0}, {32650, 11, 1, 0, 0},
+  {32661, 14, 1, 0, 0}, {32675, 14, 1, 0, 0}, {32689, 14, 1, 0, 0},
+  {32703, 11, 1, 0, 0}, {32714, 22, 0, 2, 9195}, {32736, 13, 1, 0, 0},
+  {32749, 20, 1, 0, 0}, {32769, 13, 1, 0, 0}, {32782, 21, 1, 0, 0},
+  {32803, 13, 1, 0, 0}, {32816, 15, 1, 0, 0}, {32831, 15, 1, 0, 0},
+  {32846, 15, 1, 0, 0}, {32861, 14, 1, 0, 0}, {32875, 13, 1, 0, 0},
+  {32888, 17, 1, 0, 0}, {32905, 12, 1, 0, 0}, {32917, 12, 1, 0, 0},
+  {32929, 11, 1, 0, 0}, {32940, 12, 1, 0, 0}, {32952, 15, 1, 0, 0},
+  {32967, 18, 1, 0, 0}, {32985, 13, 1, 0, 0}, {32998, 12, 1, 0, 0},
+  {33010, 12, 1, 0, 0}, {33022, 13, 1, 0, 0}, {33035, 15, 1, 0, 0},
+  {33050, 14, 1, 0, 0}, {33064, 12, 1, 0, 0}, {33076, 13, 1, 0, 0},
+  {33089, 11, 1, 0, 0}, {33100, 12, 1, 0, 0}, {33112, 13, 1, 0, 0},
+  {33125, 14, 1, 0, 0}, {33139, 9, 1, 0, 0}, {33148, 19, 1, 0, 0},
+  {33167, 13, 1, 0, 0}, {33180, 13, 1, 0, 0}, {33193, 12, 1, 0, 0},
+  {33205, 14, 1, 0, 0}, {33219, 15, 1, 0, 0}, {33234, 12, 1, 0, 0},
+  {33246, 13, 1, 0, 0}, {33259, 15, 1, 0, 0}, {33274, 12, 1, 0, 0},
+  {33286, 12, 1, 0, 0}, {33298, 12, 1, 0, 0}, {33310, 12, 1, 0, 0},
+  {33322, 13, 1, 0, 0}, {33335, 18, 1, 0, 0}, {33353, 12, 1, 0, 0},
+  {33365, 12, 1, 0, 0}, {33377, 17, 1, 0, 0}, {33394, 15, 1, 0, 0},
+  {33409, 15, 1, 0, 0}, {33424, 19, 1, 0, 0}, {33443, 14, 1, 0, 0},
+  {33457, 15, 1, 0, 0}, {33472, 12, 1, 0, 0}, {33484, 14, 0, 1, 9197},
+  {33498, 15, 1, 0, 0}, {33513, 22, 1, 0, 0}, {33535, 18, 1, 0, 0},
+  {33553, 12, 1, 0, 0}, {33565, 15, 1, 0, 0}, {33580, 13, 1, 0, 0},
+  {33593, 15, 1, 0, 0}, {33608, 12, 1, 0, 0}, {33620, 13, 1, 0, 0},
+  {33633, 13, 1, 0, 0}, {33646, 14, 1, 0, 0}, {33660, 12, 1, 0, 0},
+  {33672, 12, 1, 0, 0}, {33684, 16, 1, 0, 0}, {33700, 17, 1, 0, 0},
+  {33717, 11, 1, 0, 0}, {33728, 12, 1, 0, 0}, {33740, 14, 1, 0, 0},
+  {33754, 17, 1, 0, 0}, {33771, 14, 1, 0, 0}, {33785, 13, 1, 0, 0},
+  {33798, 11, 1, 0, 0}, {33809, 15, 1, 0, 0}, {33824, 20, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {33844, 15, 9, 0, 0}, {33859, 8, 9, 0, 0}, {33867, 4, 9, 0, 0},
+  {33871, 8, 9, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 1, 9198},
+  {10145, 3, 1, 0, 0}, {33879, 4, 1, 0, 0}, {16463, 3, 1, 0, 0},
+  {33883, 4, 1, 0, 0}, {2732, 6, 1, 0, 0}, {33887, 3, 1, 0, 0},
+  {3324, 4, 1, 0, 0}, {33890, 5, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {33895, 10, 1, 0, 0},
+  {5181, 6, 1, 0, 0}, {33905, 12, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3837, 3, 1, 0, 0}, {4051, 6, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {4677, 3, 1, 0, 0}, {33917, 8, 9, 0, 0},
+  {33925, 5, 9, 1, 9199}, {33930, 7, 9, 0, 0}, {9639, 5, 9, 0, 0},
+  {33937, 4, 9, 0, 0}, {33941, 10, 9, 0, 0}, {5735, 4, 9, 0, 0},
+  {33951, 9, 9, 0, 0}, {107, 2, 9, 0, 0}, {33960, 10, 9, 0, 0},
+  {33970, 5, 0, 1, 9200}, {9639, 5, 9, 0, 0}, {11353, 7, 9, 0, 0},
+  {33975, 8, 9, 0, 0}, {33983, 14, 9, 0, 0}, {33997, 18, 9, 0, 0},
+  {34015, 11, 9, 0, 0}, {34026, 6, 9, 0, 0}, {26834, 5, 0, 2, 9201},
+  {34032, 12, 0, 1, 9203}, {34044, 7, 9, 0, 0}, {9429, 7, 9, 0, 0},
+  {34051, 10, 9, 0, 0}, {34061, 16, 9, 0, 0}, {14957, 5, 9, 0, 0},
+  {15721, 11, 9, 0, 0}, {11685, 8, 9, 0, 0}, {11693, 7, 9, 0, 0},
+  {11710, 11, 9, 0, 0}, {11721, 9, 9, 0, 0}, {11730, 7, 9, 0, 0},
+  {11763, 7, 9, 0, 0}, {34077, 7, 9, 0, 0}, {34084, 6, 9, 0, 0},
+  {11780, 8, 9, 0, 0}, {9686, 6, 9, 2, 9204}, {34090, 7, 9, 0, 0},
+  {27047, 13, 9, 0, 0}, {34097, 16, 9, 0, 0}, {1992, 2, 9, 55, 9206},
+  {12048, 8, 9, 0, 0}, {34113, 16, 9, 0, 0}, {34129, 12, 9, 0, 0},
+  {34141, 13, 0, 3, 9261}, {34154, 8, 9, 0, 0}, {34162, 11, 9, 0, 0},
+  {34173, 7, 9, 0, 0}, {34180, 9, 9, 0, 0}, {10669, 6, 9, 0, 0},
+  {34189, 8, 9, 0, 0}, {2799, 2, 9, 0, 0}, {12650, 10, 9, 0, 0},
+  {34197, 7, 9, 0, 0}, {27162, 7, 9, 0, 0}, {12660, 9, 9, 0, 0},
+  {12698, 8, 9, 0, 0}, {22207, 5, 9, 0, 0}, {34204, 7, 9, 0, 0},
+  {15149, 6, 9, 0, 0}, {15155, 6, 9, 0, 0}, {34211, 14, 9, 0, 0},
+  {34225, 14, 9, 0, 0}, {34239, 15, 9, 0, 0}, {12860, 9, 9, 0, 0},
+  {12970, 9, 9, 0, 0}, {34254, 11, 9, 0, 0}, {34265, 15, 9, 0, 0},
+  {34280, 12, 9, 0, 0}, {34292, 11, 9, 0, 0}, {34303, 8, 9, 0, 0},
+  {34311, 7, 9, 0, 0}, {34318, 8, 9, 0, 0}, {34326, 11, 9, 0, 0},
+  {34337, 12, 9, 0, 0}, {34349, 12, 9, 0, 0}, {34361, 12, 9, 0, 0},
+  {34373, 13, 9, 0, 0}, {13505, 8, 9, 0, 0}, {10972, 2, 9, 0, 0},
+  {27197, 9, 9, 0, 0}, {16618, 8, 9, 0, 0}, {34386, 11, 9, 0, 0},
+  {34397, 6, 9, 0, 0}, {34403, 11, 9, 0, 0}, {34414, 11, 9, 0, 0},
+  {34425, 10, 9, 0, 0}, {9735, 5, 9, 0, 0}, {13798, 16, 9, 0, 0},
+  {34435, 6, 9, 0, 0}, {34441, 6, 9, 0, 0}, {9740, 5, 9, 0, 0},
+  {27298, 7, 9, 0, 0}, {34447, 8, 9, 0, 0}, {27338, 7, 9, 0, 0},
+  {34455, 7, 9, 0, 0}, {34462, 7, 9, 0, 0}, {34469, 6, 9, 0, 0},
+  {34475, 10, 9, 0, 0}, {34485, 10, 9, 0, 0}, {9748, 6, 9, 0, 0},
+  {34495, 13, 9, 0, 0}, {14309, 8, 9, 0, 0}, {14357, 8, 9, 0, 0},
+  {14365, 9, 9, 0, 0}, {34508, 9, 9, 0, 0}, {15343, 5, 9, 0, 0},
+  {34517, 12, 9, 0, 0}, {34529, 11, 9, 0, 0}, {34540, 7, 0, 1, 9264},
+  {34547, 9, 9, 0, 0}, {34556, 4, 9, 0, 0}, {34560, 9, 9, 0, 0},
+  {10645, 6, 9, 0, 0}, {34569, 6, 9, 0, 0}, {6059, 2, 9, 0, 0},
+  {9754, 6, 9, 0, 0}, {34575, 11, 9, 0, 0}, {34586, 7, 9, 0, 0},
+  {34593, 7, 9, 0, 0}, {8479, 2, 9, 0, 0}, {34600, 5, 9, 0, 0},
+  {34605, 7, 9, 0, 0}, {34612, 3, 1, 0, 0}, {50, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {9387, 3, 1, 0, 0},
+  {3033, 3, 1, 0, 0}, {3837, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {8524, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {15660, 3, 1, 0, 0},
+  {34615, 8, 9, 0, 0}, {22069, 3, 9, 0, 0}, {34623, 4, 9, 0, 0},
+  {34627, 6, 9, 0, 0}, {34633, 4, 9, 0, 0}, {34637, 5, 9, 0, 0},
+  {34642, 5, 9, 0, 0}, {34647, 5, 9, 0, 0}, {34652, 10, 9, 0, 0},
+  {15761, 3, 9, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {9387, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {8524, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {9650, 1, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4177, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {9254, 6, 9, 0, 0},
+  {34662, 4, 9, 0, 0}, {712, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {34666, 3, 1, 0, 0}, {9387, 3, 1, 0, 0},
+  {34669, 3, 1, 0, 0}, {34672, 3, 1, 0, 0}, {2593, 3, 1, 0, 0},
+  {34675, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {9379, 3, 1, 0, 0},
+  {9760, 4, 1, 0, 0}, {34678, 3, 1, 0, 0}, {377, 3, 9, 0, 0},
+  {34681, 3, 1, 0, 0}, {34684, 8, 1, 0, 0}, {459, 4, 1, 0, 0},
+  {34692, 10, 1, 0, 0}, {34702, 6, 1, 0, 0}, {34708, 4, 9, 0, 0},
+  {34712, 7, 1, 0, 0}, {34719, 10, 1, 0, 0}, {34729, 9, 1, 0, 0},
+  {34738, 7, 1, 0, 0}, {34745, 10, 1, 0, 0}, {712, 3, 1, 0, 0},
+  {34755, 11, 1, 0, 0}, {34766, 9, 1, 0, 0}, {34775, 5, 1, 0, 0},
+  {34780, 7, 1, 0, 0}, {1308, 2, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {34787, 7, 1, 0, 0}, {34794, 5, 1, 0, 0}, {34799, 9, 1, 0, 0},
+  {34808, 14, 9, 0, 0}, {1880, 3, 1, 0, 0}, {34822, 6, 1, 0, 0},
+  {34828, 3, 1, 0, 0}, {34831, 3, 9, 0, 0}, {34834, 6, 9, 0, 0},
+  {34840, 6, 9, 0, 0}, {34846, 7, 9, 0, 0}, {34853, 6, 1, 0, 0},
+  {34859, 5, 1, 0, 0}, {34864, 7, 1, 0, 0}, {34871, 7, 1, 0, 0},
+  {2599, 3, 1, 47, 9265}, {34878, 7, 1, 0, 0}, {34885, 3, 1, 0, 0},
+  {34888, 9, 9, 0, 0}, {34897, 5, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {34902, 8, 1, 0, 0}, {34910, 12, 1, 0, 0}, {34922, 5, 1, 0, 0},
+  {34927, 6, 1, 0, 0}, {34933, 7, 1, 0, 0}, {34940, 7, 1, 0, 0},
+  {34947, 7, 1, 0, 0}, {34954, 8, 1, 0, 0}, {34962, 15, 1, 0, 0},
+  {34977, 5, 1, 0, 0}, {34982, 7, 1, 0, 0}, {34989, 7, 1, 0, 0},
+  {34996, 10, 1, 0, 0}, {35006, 9, 1, 0, 0}, {35015, 5, 1, 0, 0},
+  {35020, 10, 1, 0, 0}, {35030, 6, 9, 0, 0}, {35036, 7, 9, 0, 0},
+  {35043, 5, 1, 0, 0}, {35048, 4, 1, 0, 0}, {35052, 6, 1, 0, 0},
+  {35058, 6, 9, 0, 0}, {35064, 7, 1, 0, 0}, {35071, 7, 1, 0, 0},
+  {35078, 8, 1, 0, 0}, {35086, 5, 1, 0, 0}, {35091, 6, 1, 0, 0},
+  {35097, 8, 9, 0, 0}, {35105, 5, 1, 0, 0}, {35110, 6, 9, 0, 0},
+  {35116, 5, 1, 0, 0}, {35121, 4, 1, 0, 0}, {35125, 7, 1, 0, 0},
+  {35132, 10, 1, 0, 0}, {35142, 8, 1, 0, 0}, {35150, 6, 1, 0, 0},
+  {3837, 3, 9, 0, 0}, {3840, 5, 1, 0, 0}, {35156, 6, 1, 0, 0},
+  {35162, 6, 1, 0, 0}, {35168, 6, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {35174, 7, 1, 0, 0}, {9512, 12, 9, 0, 0}, {35181, 5, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {35186, 13, 1, 0, 0}, {8524, 3, 1, 0, 0},
+  {35199, 8, 1, 0, 0}, {35207, 4, 1, 0, 0}, {35211, 5, 1, 0, 0},
+  {35216, 6, 1, 0, 0}, {35222, 6, 1, 0, 0}, {35228, 7, 1, 0, 0},
+  {35235, 7, 1, 0, 0}, {35242, 5, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {35247, 7, 1, 0, 0}, {35254, 9, 1, 0, 0}, {35263, 9, 1, 0, 0},
+  {35272, 10, 1, 0, 0}, {18685, 2, 1, 0, 0}, {35282, 4, 1, 0, 0},
+  {35286, 4, 1, 0, 0}, {35290, 7, 1, 0, 0}, {35297, 8, 1, 0, 0},
+  {35305, 9, 1, 0, 0}, {35314, 9, 1, 0, 0}, {35323, 7, 1, 0, 0},
+  {35330, 9, 9, 0, 0}, {35339, 6, 1, 0, 0}, {35345, 6, 9, 0, 0},
+  {9534, 4, 1, 0, 0}, {35351, 10, 1, 0, 0}, {35361, 8, 1, 0, 0},
+  {35369, 9, 1, 0, 0}, {35378, 6, 1, 0, 0}, {35384, 5, 1, 0, 0},
+  {35389, 8, 1, 0, 0}, {4804, 10, 1, 0, 0}, {16335, 3, 1, 0, 0},
+  {35397, 6, 1, 0, 0}, {35403, 7, 1, 0, 0}, {35410, 5, 1, 0, 0},
+  {35415, 8, 9, 0, 0}, {35423, 5, 1, 0, 0}, {5270, 3, 1, 0, 0},
+  {5323, 4, 1, 0, 0}, {35428, 9, 9, 0, 0}, {14489, 10, 9, 0, 0},
+  {35437, 5, 1, 0, 0}, {35442, 7, 1, 0, 0}, {35449, 5, 1, 0, 0},
+  {35454, 6, 1, 0, 0}, {35460, 5, 9, 0, 0}, {35465, 3, 1, 0, 0},
+  {35468, 9, 1, 0, 0}, {35477, 12, 1, 0, 0}, {35489, 12, 1, 0, 0},
+  {35501, 8, 1, 0, 0}, {35509, 7, 1, 0, 0}, {35516, 8, 1, 0, 0},
+  {35524, 7, 9, 0, 0}, {35531, 10, 1, 0, 0}, {35541, 11, 1, 0, 0},
+  {35552, 8, 1, 0, 0}, {35560, 8, 1, 0, 0}, {35568, 6, 1, 0, 0},
+  {35574, 5, 1, 0, 0}, {35579, 10, 1, 0, 0}, {35589, 5, 1, 0, 0},
+  {5851, 2, 1, 0, 0}, {9807, 7, 1, 0, 0}, {5938, 6, 1, 0, 0},
+  {35594, 5, 1, 0, 0}, {35599, 9, 1, 0, 0}, {35608, 5, 1, 0, 0},
+  {35613, 8, 9, 0, 0}, {35621, 5, 1, 0, 0}, {35626, 9, 1, 0, 0},
+  {35635, 6, 1, 0, 0}, {35641, 8, 1, 0, 0}, {35649, 3, 1, 0, 0},
+  {35652, 6, 1, 0, 0}, {35658, 6, 1, 0, 0}, {35664, 5, 1, 0, 0},
+  {35669, 9, 1, 0, 0}, {35678, 9, 1, 0, 0}, {35687, 7, 1, 0, 0},
+  {35694, 4, 9, 0, 0}, {35698, 7, 1, 0, 0}, {35705, 9, 1, 0, 0},
+  {35714, 5, 1, 0, 0}, {35719, 8, 9, 0, 0}, {35727, 5, 1, 0, 0},
+  {35732, 5, 1, 0, 0}, {35737, 9, 1, 0, 0}, {1308, 2, 9, 0, 0},
+  {4089, 4, 9, 0, 0}, {35746, 3, 9, 0, 0}, {1308, 2, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {35749, 5, 9, 0, 0}, {50, 2, 1, 0, 0}, {712, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {35754, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0}, {35757, 4, 1, 0, 0},
+  {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {4677, 3, 1, 0, 0}, {4695, 4, 1, 0, 0}, {0, 3, 1, 0, 0}, {35761, 3, 1, 0, 0},
+  {35764, 4, 1, 0, 0}, {15855, 6, 1, 0, 0}, {532, 3, 1, 0, 0},
+  {9639, 5, 9, 0, 0}, {9429, 7, 9, 0, 0}, {1504, 3, 1, 0, 0},
+  {35768, 8, 0, 1, 9312}, {10180, 3, 1, 0, 0}, {35776, 3, 1, 0, 0},
+  {3471, 3, 1, 0, 0}, {3837, 3, 1, 0, 0}, {35779, 5, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {35784, 3, 1, 0, 0},
+  {35787, 3, 1, 0, 0}, {35790, 12, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {14895, 4, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {35802, 4, 1, 0, 0}, {9639, 5, 9, 0, 0},
+  {35806, 5, 1, 0, 0}, {9429, 7, 9, 0, 0}, {1308, 2, 1, 0, 0},
+  {9172, 2, 1, 0, 0}, {10703, 2, 1, 0, 0}, {4108, 2, 1, 0, 0},
+  {9524, 2, 1, 0, 0}, {35811, 4, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1466, 4, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4089, 4, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0},
+  {10696, 4, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {8524, 3, 1, 0, 0}, {15761, 3, 9, 0, 0}, {35815, 4, 9, 0, 0},
+  {11014, 4, 1, 0, 0}, {9639, 5, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {1308, 2, 9, 0, 0}, {1340, 3, 1, 0, 0}, {11042, 4, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {8524, 3, 1, 0, 0}, {9551, 2, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {10388, 3, 1, 0, 0}, {5323, 4, 9, 0, 0},
+  {5564, 5, 1, 0, 0}, {5851, 2, 1, 0, 0}, {10730, 3, 1, 0, 0},
+  {9503, 9, 9, 0, 0}, {35819, 6, 9, 0, 0}, {35825, 8, 9, 0, 0},
+  {50, 2, 1, 0, 0}, {8527, 8, 9, 0, 0}, {35833, 7, 0, 1, 9313},
+  {1308, 2, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3006, 2, 1, 0, 0}, {4380, 3, 1, 0, 0}, {35840, 2, 9, 0, 0},
+  {6020, 2, 9, 0, 0}, {35842, 7, 9, 0, 0}, {50, 2, 9, 0, 0},
+  {35849, 7, 9, 0, 0}, {35856, 9, 9, 0, 0}, {35865, 3, 9, 0, 0},
+  {8527, 8, 9, 0, 0}, {35868, 3, 9, 0, 0}, {35871, 7, 0, 1, 9314},
+  {1340, 3, 9, 0, 0}, {35878, 8, 9, 0, 0}, {1880, 3, 9, 0, 0},
+  {35886, 7, 9, 0, 0}, {2599, 3, 9, 0, 0}, {35893, 6, 9, 0, 0},
+  {3063, 3, 9, 0, 0}, {35899, 8, 9, 0, 0}, {35907, 8, 9, 0, 0},
+  {35915, 3, 9, 0, 0}, {35918, 6, 9, 0, 0}, {22232, 5, 9, 1, 9315},
+  {35924, 5, 9, 0, 0}, {3903, 3, 9, 0, 0}, {16281, 8, 9, 0, 0},
+  {35929, 8, 9, 0, 0}, {35937, 3, 9, 0, 0}, {35940, 6, 9, 4, 9316},
+  {35946, 5, 9, 0, 0}, {35951, 4, 9, 0, 0}, {35955, 7, 9, 0, 0},
+  {4113, 3, 9, 0, 0}, {35962, 3, 9, 0, 0}, {4380, 3, 9, 0, 0},
+  {9568, 2, 9, 0, 0}, {35965, 10, 9, 0, 0}, {35975, 3, 9, 0, 0},
+  {35978, 12, 0, 1, 9320}, {35990, 3, 9, 0, 0}, {35993, 4, 9, 0, 0},
+  {35997, 11, 9, 0, 0}, {36008, 8, 9, 0, 0}, {908, 5, 18, 0, 0},
+  {11498, 4, 18, 0, 0}, {23457, 8, 18, 0, 0}, {36016, 11, 9, 0, 0},
+  {21985, 2, 9, 0, 0}, {36027, 9, 18, 0, 0}, {36036, 8, 9, 0, 0},
+  {10854, 7, 9, 0, 0}, {11072, 4, 9, 0, 0}, {36044, 7, 9, 0, 0},
+  {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1466, 4, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3837, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {4760, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {15761, 3, 9, 0, 0}, {1880, 3, 9, 0, 0}, {2599, 3, 9, 1, 9321},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {3837, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {6011, 2, 1, 0, 0}, {36051, 10, 9, 0, 0},
+  {9637, 1, 1, 0, 0}, {50, 2, 1, 0, 0}, {9638, 1, 1, 0, 0}, {628, 2, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {36061, 5, 1, 0, 0}, {9644, 1, 1, 0, 0},
+  {1340, 3, 9, 0, 0}, {9544, 4, 9, 0, 0}, {9645, 1, 1, 0, 0},
+  {9646, 1, 1, 0, 0}, {9647, 1, 1, 0, 0}, {36066, 2, 1, 0, 0},
+  {36068, 4, 1, 0, 0}, {36072, 3, 1, 0, 0}, {9648, 1, 1, 0, 0},
+  {9649, 1, 1, 0, 0}, {9650, 1, 1, 0, 0}, {36075, 6, 9, 0, 0},
+  {36081, 12, 9, 0, 0}, {9652, 1, 1, 0, 0}, {36093, 7, 1, 0, 0},
+  {36100, 15, 1, 0, 0}, {36115, 6, 1, 0, 0}, {9653, 1, 1, 0, 0},
+  {36121, 6, 1, 0, 0}, {9654, 1, 1, 0, 0}, {9512, 12, 9, 0, 0},
+  {9655, 1, 1, 0, 0}, {36127, 14, 1, 0, 0}, {9656, 1, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {9657, 1, 1, 0, 0}, {36141, 4, 0, 1, 9322},
+  {36145, 5, 1, 0, 0}, {9568, 2, 1, 0, 0}, {4667, 5, 1, 0, 0},
+  {9659, 1, 1, 0, 0}, {9660, 1, 1, 0, 0}, {9661, 1, 1, 0, 0},
+  {5851, 2, 1, 0, 0}, {9662, 1, 1, 0, 0}, {9664, 1, 1, 0, 0},
+  {9665, 1, 1, 0, 0}, {9666, 1, 1, 0, 0}, {9667, 1, 1, 0, 0},
+  {9266, 9, 9, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {36150, 8, 9, 0, 0}, {2599, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {22045, 3, 1, 0, 0},
+  {36158, 3, 9, 0, 0}, {1340, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {36161, 8, 9, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4248, 3, 9, 0, 0}, {4380, 3, 1, 0, 0}, {36169, 8, 0, 4, 9323},
+  {36177, 3, 9, 0, 0}, {17136, 8, 9, 0, 0}, {9639, 5, 9, 0, 0},
+  {15674, 4, 9, 0, 0}, {36180, 6, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {36186, 6, 9, 0, 0}, {36192, 7, 9, 0, 0}, {9639, 5, 9, 0, 0},
+  {36199, 4, 9, 0, 0}, {36203, 8, 18, 0, 0}, {22056, 4, 9, 0, 0},
+  {16262, 7, 9, 0, 0}, {36211, 4, 9, 0, 0}, {36215, 12, 9, 0, 0},
+  {10776, 4, 9, 0, 0}, {36227, 5, 9, 0, 0}, {9266, 9, 9, 0, 0},
+  {36232, 7, 9, 0, 0}, {36239, 8, 9, 0, 0}, {36247, 6, 9, 0, 0},
+  {36253, 10, 9, 0, 0}, {36263, 10, 18, 0, 0}, {36273, 4, 9, 0, 0},
+  {36277, 3, 18, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {377, 3, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {10705, 4, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {16330, 5, 1, 0, 0}, {9814, 4, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3835, 2, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {8535, 3, 9, 0, 0},
+  {36280, 5, 18, 0, 0}, {16289, 6, 9, 0, 0}, {36285, 4, 9, 0, 0},
+  {36289, 6, 9, 0, 0}, {712, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3835, 2, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {36295, 9, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {36304, 9, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {36313, 4, 9, 0, 0}, {4380, 3, 1, 0, 0},
+  {36317, 8, 1, 0, 0}, {36325, 7, 1, 0, 0}, {5564, 5, 1, 0, 0},
+  {36332, 6, 9, 0, 0}, {36338, 8, 9, 0, 0}, {36346, 9, 9, 0, 0},
+  {36355, 8, 9, 0, 0}, {35849, 7, 9, 0, 0}, {36363, 10, 9, 0, 0},
+  {36373, 11, 9, 0, 0}, {36384, 7, 9, 0, 0}, {36391, 8, 9, 0, 0},
+  {36399, 10, 9, 0, 0}, {36409, 8, 9, 0, 0}, {35856, 9, 9, 0, 0},
+  {36417, 7, 9, 0, 0}, {36424, 7, 9, 0, 0}, {36431, 8, 9, 0, 0},
+  {35878, 8, 9, 0, 0}, {36439, 15, 9, 0, 0}, {36454, 5, 9, 0, 0},
+  {23935, 7, 9, 0, 0}, {35893, 6, 9, 0, 0}, {36459, 7, 9, 0, 0},
+  {36466, 6, 9, 0, 0}, {35899, 8, 9, 0, 0}, {36472, 6, 9, 0, 0},
+  {36478, 7, 9, 0, 0}, {36485, 9, 9, 0, 0}, {36494, 7, 9, 0, 0},
+  {36501, 9, 9, 0, 0}, {36510, 9, 9, 0, 0}, {36519, 6, 9, 0, 0},
+  {35907, 8, 9, 0, 0}, {36525, 5, 9, 0, 0}, {36530, 10, 9, 0, 0},
+  {35929, 8, 9, 0, 0}, {35937, 3, 9, 0, 0}, {36540, 8, 9, 0, 0},
+  {35955, 7, 9, 0, 0}, {36548, 5, 9, 0, 0}, {36553, 16, 9, 0, 0},
+  {35962, 3, 9, 0, 0}, {36569, 7, 9, 0, 0}, {36576, 5, 9, 0, 0},
+  {36581, 8, 9, 0, 0}, {36589, 5, 9, 0, 0}, {35990, 3, 9, 0, 0},
+  {36594, 8, 9, 0, 0}, {36602, 6, 9, 0, 0}, {36608, 9, 9, 0, 0},
+  {36617, 7, 9, 0, 0}, {36624, 11, 9, 0, 0}, {36635, 4, 9, 0, 0},
+  {36639, 4, 9, 0, 0}, {35997, 11, 9, 0, 0}, {36008, 8, 9, 0, 0},
+  {36643, 7, 9, 0, 0}, {9639, 5, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {9387, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {4834, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {36650, 11, 9, 0, 0},
+  {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0}, {4380, 3, 1, 0, 0}, {1130, 2, 9, 0, 0},
+  {3835, 2, 9, 0, 0}, {10528, 2, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {16113, 9, 9, 0, 0}, {10768, 8, 9, 0, 0}, {1308, 2, 9, 0, 0},
+  {8535, 3, 9, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0}, {10703, 2, 1, 0, 0},
+  {3006, 2, 1, 0, 0}, {18478, 2, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4355, 6, 9, 0, 0}, {9524, 2, 1, 0, 0}, {5323, 4, 9, 0, 0}, {50, 2, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {10703, 2, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {16481, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {35993, 4, 1, 0, 0},
+  {9379, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {8524, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {1340, 3, 1, 0, 0}, {36661, 3, 1, 0, 0},
+  {10700, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {10251, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {36664, 4, 1, 0, 0}, {36668, 6, 1, 0, 0},
+  {36674, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {36677, 11, 9, 0, 0},
+  {4380, 3, 1, 0, 0}, {16330, 5, 1, 0, 0}, {9807, 7, 1, 0, 0},
+  {36688, 3, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {36691, 4, 9, 0, 0}, {4380, 3, 1, 0, 0}, {36695, 3, 9, 0, 0},
+  {10984, 12, 0, 1, 9327}, {36698, 3, 9, 0, 0}, {36701, 7, 9, 0, 0},
+  {36708, 12, 9, 0, 0}, {27298, 7, 9, 0, 0}, {36720, 5, 9, 0, 0},
+  {17387, 2, 1, 0, 0}, {36725, 3, 1, 0, 0}, {36728, 3, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {1340, 3, 1, 1, 9328}, {16461, 2, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {16463, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {15678, 3, 1, 0, 0}, {36731, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4089, 4, 1, 0, 0}, {4106, 2, 1, 1, 9329},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {15663, 3, 1, 0, 0},
+  {5749, 3, 1, 0, 0}, {36734, 3, 1, 0, 0}, {6011, 2, 1, 0, 0},
+  {9379, 3, 1, 0, 0}, {15761, 3, 9, 0, 0}, {112, 4, 1, 0, 0}, {712, 3, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {1466, 4, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {3191, 4, 1, 0, 0}, {3946, 4, 1, 0, 0},
+  {4051, 6, 1, 0, 0}, {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {4677, 3, 1, 0, 0}, {5938, 6, 1, 0, 0},
+  {36737, 11, 9, 0, 0}, {9686, 6, 9, 0, 0}, {36748, 10, 9, 0, 0},
+  {36758, 10, 9, 0, 0}, {8527, 8, 9, 0, 0}, {1293, 4, 1, 0, 0},
+  {1340, 3, 1, 1, 9330}, {36768, 4, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2422, 4, 1, 0, 0}, {2599, 3, 1, 0, 0}, {16129, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {36772, 3, 9, 0, 0}, {36775, 11, 1, 0, 0}, {16209, 10, 1, 0, 0},
+  {36786, 12, 1, 0, 0}, {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {10703, 2, 1, 0, 0}, {16365, 5, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3835, 2, 1, 0, 0}, {3903, 3, 1, 0, 0}, {3946, 4, 1, 0, 0},
+  {4108, 2, 1, 0, 0}, {9524, 2, 1, 0, 0}, {5144, 2, 1, 0, 0},
+  {6011, 2, 1, 0, 0}, {712, 3, 9, 0, 0}, {1103, 2, 9, 0, 0},
+  {36798, 9, 1, 0, 0}, {36807, 8, 1, 0, 0}, {36815, 9, 1, 0, 0},
+  {36824, 9, 1, 0, 0}, {36833, 10, 1, 0, 0}, {36843, 10, 1, 0, 0},
+  {1243, 2, 1, 0, 0}, {1306, 2, 1, 0, 0}, {1308, 2, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1507, 2, 1, 0, 0}, {36853, 6, 1, 0, 0},
+  {1576, 2, 1, 0, 0}, {1580, 2, 9, 0, 0}, {36859, 2, 1, 0, 0},
+  {36861, 14, 1, 0, 0}, {36875, 14, 1, 0, 0}, {36889, 7, 1, 0, 0},
+  {36896, 2, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {36898, 2, 1, 0, 0}, {3006, 2, 1, 0, 0}, {10254, 3, 9, 0, 0},
+  {36900, 15, 1, 0, 0}, {3291, 2, 1, 0, 0}, {36915, 7, 1, 0, 0},
+  {36922, 7, 1, 0, 0}, {36929, 7, 1, 0, 0}, {36936, 12, 1, 0, 0},
+  {36948, 12, 1, 0, 0}, {36960, 4, 1, 0, 0}, {36964, 10, 1, 0, 0},
+  {3328, 2, 1, 0, 0}, {3359, 2, 1, 0, 0}, {36974, 4, 1, 0, 0},
+  {36978, 2, 1, 0, 0}, {36980, 2, 1, 0, 0}, {36982, 4, 1, 0, 0},
+  {20895, 2, 1, 0, 0}, {3684, 2, 1, 0, 0}, {3686, 3, 9, 0, 0},
+  {36986, 7, 1, 0, 0}, {36993, 5, 1, 0, 0}, {3713, 2, 1, 0, 0},
+  {36998, 4, 1, 0, 0}, {3927, 2, 1, 0, 0}, {37002, 8, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {37010, 8, 1, 0, 0}, {37018, 2, 1, 0, 0},
+  {37020, 5, 1, 0, 0}, {37025, 6, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {4586, 2, 1, 0, 0}, {37031, 7, 1, 0, 0}, {9568, 2, 9, 0, 0},
+  {37038, 5, 1, 0, 0}, {37043, 5, 1, 0, 0}, {37048, 2, 1, 0, 0},
+  {5136, 2, 1, 0, 0}, {37050, 10, 1, 0, 0}, {37060, 10, 1, 0, 0},
+  {5400, 2, 1, 0, 0}, {37070, 4, 1, 0, 0}, {19016, 2, 1, 0, 0},
+  {37074, 8, 1, 0, 0}, {6063, 2, 1, 0, 0}, {37082, 8, 1, 0, 0},
+  {9663, 1, 9, 0, 0}, {37090, 7, 1, 0, 0}, {37097, 9, 1, 0, 0},
+  {6198, 2, 1, 0, 0}, {37106, 5, 1, 0, 0}, {37111, 5, 1, 0, 0},
+  {37116, 11, 1, 0, 0}, {37127, 12, 1, 0, 0}, {37139, 8, 1, 0, 0},
+  {37147, 8, 1, 0, 0}, {37155, 2, 1, 0, 0}, {37157, 2, 1, 0, 0},
+  {50, 2, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {10703, 2, 1, 0, 0}, {4108, 2, 1, 0, 0}, {9524, 2, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {5144, 2, 1, 0, 0}, {50, 2, 1, 0, 0}, {9639, 5, 9, 0, 0},
+  {1308, 2, 1, 11, 9331}, {37159, 4, 9, 0, 0}, {37163, 5, 9, 0, 0},
+  {2599, 3, 1, 4, 9342}, {37168, 4, 9, 0, 0}, {37172, 22, 9, 0, 0},
+  {37194, 19, 9, 0, 0}, {37213, 19, 9, 0, 0}, {37232, 17, 9, 0, 0},
+  {37249, 18, 9, 0, 0}, {3686, 3, 1, 0, 0}, {3835, 2, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {37267, 3, 1, 0, 0}, {4380, 3, 1, 6, 9346},
+  {22082, 3, 1, 0, 0}, {37270, 6, 1, 0, 0}, {37276, 14, 9, 0, 0},
+  {37290, 5, 9, 0, 0}, {37295, 16, 9, 0, 0}, {8535, 3, 2, 0, 0},
+  {37311, 2, 1, 3, 9352}, {176, 2, 1, 3, 9355}, {352, 2, 1, 3, 9358},
+  {384, 2, 1, 3, 9361}, {485, 2, 1, 3, 9364}, {947, 2, 1, 3, 9367},
+  {9429, 7, 9, 0, 0}, {1308, 2, 1, 3, 9370}, {17854, 2, 1, 3, 9373},
+  {37313, 2, 1, 3, 9376}, {1638, 2, 1, 3, 9379}, {37315, 3, 1, 0, 0},
+  {16808, 4, 9, 0, 0}, {36150, 8, 0, 1, 9382}, {37318, 3, 1, 0, 0},
+  {37321, 2, 1, 3, 9383}, {34154, 8, 9, 0, 0}, {2399, 2, 1, 3, 9386},
+  {37323, 7, 9, 0, 0}, {37330, 7, 9, 0, 0}, {2656, 2, 1, 3, 9389},
+  {10954, 2, 1, 2, 9392}, {37337, 2, 1, 3, 9394}, {2962, 2, 1, 3, 9397},
+  {2978, 2, 1, 3, 9400}, {3006, 2, 1, 3, 9403}, {37339, 5, 9, 0, 0},
+  {37344, 3, 1, 0, 0}, {3298, 4, 1, 0, 0}, {36978, 2, 1, 3, 9406},
+  {3379, 2, 1, 3, 9409}, {3388, 2, 1, 3, 9412}, {37347, 11, 9, 0, 0},
+  {3717, 2, 1, 3, 9415}, {3833, 2, 1, 3, 9418}, {3835, 2, 1, 3, 9421},
+  {18478, 2, 1, 11, 9424}, {16281, 8, 9, 0, 0}, {3942, 2, 1, 3, 9435},
+  {3944, 2, 1, 3, 9438}, {4036, 2, 1, 3, 9441}, {4041, 2, 1, 3, 9444},
+  {4106, 2, 1, 3, 9447}, {37358, 2, 1, 2, 9450}, {4108, 2, 1, 3, 9452},
+  {37360, 2, 1, 3, 9455}, {37362, 2, 1, 3, 9458}, {10978, 2, 1, 3, 9461},
+  {22251, 4, 9, 0, 0}, {37364, 3, 1, 0, 0}, {37367, 2, 1, 3, 9464},
+  {37369, 2, 1, 3, 9467}, {37371, 2, 1, 3, 9470}, {37373, 2, 1, 3, 9473},
+  {9524, 2, 1, 3, 9476}, {4414, 2, 1, 3, 9479}, {37375, 8, 9, 0, 0},
+  {37383, 7, 9, 0, 0}, {4651, 2, 1, 3, 9482}, {18879, 2, 1, 2, 9485},
+  {5144, 2, 1, 3, 9487}, {5211, 2, 1, 2, 9490}, {34517, 12, 9, 0, 0},
+  {5858, 2, 1, 3, 9492}, {37390, 2, 1, 3, 9495}, {37392, 2, 1, 3, 9498},
+  {6065, 2, 1, 3, 9501}, {6130, 2, 1, 3, 9504}, {19966, 2, 1, 3, 9507},
+  {9564, 2, 1, 3, 9510}, {37394, 2, 1, 3, 9513}, {37396, 2, 1, 1, 9516},
+  {37398, 2, 1, 3, 9517}, {1340, 3, 1, 1, 9520}, {1880, 3, 1, 0, 0},
+  {37400, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {37403, 2, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {9174, 2, 9, 1, 9521}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {11014, 4, 1, 0, 0}, {10081, 3, 1, 0, 0},
+  {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0}, {37405, 3, 1, 0, 0},
+  {1880, 3, 1, 0, 0}, {11042, 4, 1, 0, 0}, {9387, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3029, 4, 1, 0, 0}, {3063, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {8524, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {37408, 3, 1, 0, 0}, {10388, 3, 1, 0, 0},
+  {5564, 5, 1, 0, 0}, {10500, 3, 1, 0, 0}, {9379, 3, 1, 0, 0},
+  {404, 2, 9, 0, 0}, {1308, 2, 1, 0, 0}, {1340, 3, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0}, {50, 2, 1, 0, 0},
+  {712, 3, 1, 0, 0}, {8527, 8, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {2732, 6, 1, 0, 0}, {3029, 4, 1, 0, 0},
+  {3063, 3, 1, 0, 0}, {4089, 4, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {4677, 3, 1, 0, 0}, {744, 4, 9, 0, 0}, {1306, 2, 9, 0, 0},
+  {1340, 3, 1, 0, 0}, {1717, 3, 9, 0, 0}, {1880, 3, 1, 0, 0},
+  {3835, 2, 9, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {9254, 6, 9, 0, 0}, {712, 3, 9, 0, 0}, {8535, 3, 9, 0, 0}, {9254, 6, 9, 0, 0},
+  {37411, 7, 18, 0, 0}, {37418, 7, 9, 0, 0}, {1340, 3, 1, 0, 0},
+  {9686, 6, 9, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {37425, 6, 9, 0, 0}, {4113, 3, 1, 0, 0}, {4380, 3, 1, 0, 0},
+  {37431, 13, 1, 0, 0}, {37444, 11, 1, 0, 0}, {37455, 10, 1, 0, 0},
+  {37465, 11, 1, 0, 0}, {37476, 8, 1, 0, 0}, {37484, 9, 1, 0, 0},
+  {6889, 9, 1, 0, 0}, {37493, 8, 1, 0, 0}, {37501, 8, 1, 0, 0},
+  {37509, 9, 1, 0, 0}, {6667, 10, 1, 0, 0}, {16158, 10, 1, 0, 0},
+  {7883, 10, 1, 0, 0}, {10998, 10, 1, 0, 0}, {16209, 10, 1, 0, 0},
+  {16230, 11, 1, 0, 0}, {37518, 13, 1, 0, 0}, {37531, 15, 1, 0, 0},
+  {37546, 16, 1, 0, 0}, {37562, 13, 1, 0, 0}, {37575, 12, 1, 0, 0},
+  {37587, 11, 1, 0, 0}, {37598, 7, 9, 0, 0}, {37605, 14, 9, 0, 0},
+  {37619, 10, 9, 0, 0}, {37629, 9, 9, 0, 0}, {6889, 9, 9, 0, 0},
+  {37638, 9, 9, 0, 0}, {37647, 10, 9, 0, 0}, {37657, 9, 9, 0, 0},
+  {7306, 9, 9, 0, 0}, {37666, 11, 9, 0, 0}, {33975, 8, 9, 0, 0},
+  {37677, 8, 9, 0, 0}, {37685, 9, 9, 0, 0}, {9357, 7, 18, 0, 0},
+  {34600, 5, 9, 0, 0}, {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {4380, 3, 9, 0, 0}, {50, 2, 1, 0, 0}, {37694, 5, 1, 0, 0},
+  {37699, 3, 1, 0, 0}, {1308, 2, 1, 1, 9522}, {1880, 3, 1, 0, 0},
+  {2599, 3, 1, 0, 0}, {37702, 7, 1, 0, 0}, {3471, 3, 1, 0, 0},
+  {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0}, {4177, 3, 1, 0, 0},
+  {16481, 3, 1, 0, 0}, {37709, 3, 1, 0, 0}, {8524, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {5181, 6, 1, 0, 0}, {5851, 2, 1, 0, 0},
+  {9379, 3, 1, 0, 0}, {50, 2, 1, 0, 0}, {712, 3, 1, 0, 0}, {1308, 2, 1, 0, 0},
+  {1340, 3, 1, 0, 0}, {1880, 3, 1, 0, 0}, {2599, 3, 1, 0, 0},
+  {3029, 4, 1, 0, 0}, {3903, 3, 1, 0, 0}, {4113, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {8535, 3, 1, 0, 0}, {37418, 7, 9, 0, 0},
+  {21985, 2, 9, 0, 0}, {37712, 4, 9, 0, 0}, {37716, 6, 18, 0, 0},
+  {50, 2, 1, 0, 0}, {1308, 2, 1, 0, 0}, {2599, 3, 1, 0, 0}, {3903, 3, 1, 0, 0},
+  {4380, 3, 1, 0, 0}, {9637, 1, 9, 0, 0}, {37722, 11, 9, 0, 0},
+  {8527, 8, 9, 0, 0}, {37733, 3, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {6353, 4, 9, 0, 0}, {37736, 2, 18, 0, 0}, {3006, 2, 18, 0, 0},
+  {37736, 2, 18, 0, 0}, {37738, 6, 18, 0, 0}, {8527, 8, 9, 0, 0},
+  {37744, 9, 0, 1, 9523}, {9512, 12, 9, 0, 0}, {9538, 3, 1, 0, 0},
+  {1082, 8, 1, 0, 0}, {9548, 3, 1, 1, 9524}, {9551, 2, 1, 0, 0},
+  {9555, 3, 1, 0, 0}, {5040, 2, 1, 0, 0}, {9558, 3, 1, 0, 0},
+  {9561, 3, 1, 0, 0}, {9564, 2, 1, 0, 0}, {9555, 3, 1, 0, 0},
+  {5040, 2, 1, 0, 0}, {9558, 3, 1, 0, 0}, {9561, 3, 1, 0, 0},
+  {9564, 2, 1, 0, 0}, {1288, 5, 9, 0, 0}, {37753, 7, 9, 0, 0},
+  {8527, 8, 9, 0, 0}, {14489, 10, 9, 0, 0}, {37760, 12, 0, 1, 9525},
+  {50, 2, 1, 0, 0}, {176, 2, 1, 0, 0}, {233, 2, 1, 0, 0}, {17344, 2, 1, 0, 0},
+  {492, 2, 1, 0, 0}, {17798, 2, 1, 0, 0}, {37772, 2, 1, 0, 0},
+  {1971, 2, 1, 0, 0}, {10703, 2, 1, 0, 0}, {3717, 2, 1, 0, 0},
+  {3885, 2, 1, 0, 0}, {4036, 2, 1, 0, 0}, {4041, 2, 1, 0, 0},
+  {4414, 2, 1, 0, 0}, {9178, 2, 1, 0, 0}, {4472, 2, 1, 0, 0},
+  {18728, 2, 1, 0, 0}, {4651, 2, 1, 0, 0}, {37774, 2, 1, 0, 0},
+  {18894, 2, 1, 0, 0}, {4981, 2, 1, 0, 0}, {37776, 2, 1, 0, 0},
+  {5009, 2, 1, 0, 0}, {5144, 2, 1, 0, 0}, {5213, 2, 1, 0, 0},
+  {18985, 2, 1, 0, 0}, {5860, 2, 1, 0, 0}, {50, 2, 9, 0, 0}, {176, 2, 9, 0, 0},
+  {233, 2, 9, 0, 0}, {17344, 2, 9, 0, 0}, {492, 2, 9, 0, 0},
+  {17798, 2, 9, 0, 0}, {37772, 2, 9, 0, 0}, {1971, 2, 9, 0, 0},
+  {10703, 2, 9, 0, 0}, {3717, 2, 9, 0, 0}, {3885, 2, 9, 0, 0},
+  {4036, 2, 9, 0, 0}, {4041, 2, 9, 0, 0}, {4414, 2, 9, 0, 0},
+  {9178, 2, 9, 0, 0}, {4472, 2, 9, 0, 0}, {18728, 2, 9, 0, 0},
+  {4651, 2, 9, 0, 0}, {37774, 2, 9, 0, 0}, {18894, 2, 9, 0, 0},
+  {4981, 2, 9, 0, 0}, {37776, 2, 9, 0, 0}, {5009, 2, 9, 0, 0},
+  {5144, 2, 9, 0, 0}, {5213, 2, 9, 0, 0}, {18985, 2, 9, 0, 0},
+  {5860, 2, 9, 0, 0}, {8527, 8, 9, 0, 0}, {37778, 2, 9, 0, 0},
+  {37780, 9, 9, 0, 0}, {37789, 3, 18, 0, 0}, {107, 2, 0, 1, 9526},
+  {37792, 9, 9, 0, 0}, {37801, 4, 9, 0, 0}, {1992, 2, 9, 0, 0},
+  {6161, 3, 9, 0, 0}, {37805, 5, 0, 1, 9527}, {37810, 3, 9, 0, 0},
+  {16454, 2, 9, 0, 0}, {5858, 2, 9, 0, 0}, {6032, 2, 9, 0, 0},
+  {6032, 2, 9, 0, 0}, {947, 2, 9, 0, 0}, {6032, 2, 9, 0, 0}, {6059, 2, 9, 0, 0},
+  {37813, 9, 0, 3, 9528}, {37822, 6, 0, 5, 9531}, {37780, 9, 0, 2, 9536},
+  {37828, 3, 9, 0, 0}, {37831, 6, 0, 4, 9538}, {37837, 6, 0, 3, 9542},
+  {37843, 9, 9, 0, 0}, {37852, 13, 9, 0, 0}, {1130, 2, 9, 0, 0},
+  {1638, 2, 9, 0, 0}, {11177, 9, 0, 4, 9545}, {1742, 6, 9, 0, 0},
+  {8527, 8, 9, 0, 0}, {2962, 2, 9, 0, 0}, {2962, 2, 9, 0, 0},
+  {1717, 3, 18, 0, 0}, {37865, 10, 0, 1, 9549}, {37875, 9, 0, 1, 9550},
+  {37884, 14, 0, 2, 9551}, {37898, 14, 0, 4, 9553}, {37912, 14, 0, 1, 9557},
+  {37926, 10, 0, 4, 9558}, {37936, 14, 0, 2, 9562}, {37950, 14, 0, 2, 9564},
+  {37964, 12, 0, 4, 9566}, {15714, 7, 18, 0, 0}, {37976, 9, 18, 0, 0},
+  {37985, 3, 18, 0, 0}, {37988, 12, 0, 4, 9570}, {38000, 10, 0, 1, 9574},
+  {38010, 10, 0, 1, 9575}, {38020, 9, 0, 2, 9576}, {38029, 9, 0, 4, 9578},
+  {38038, 9, 0, 4, 9582}, {38047, 10, 0, 1, 9586}, {38057, 2, 9, 0, 0},
+  {38059, 17, 9, 0, 0}, {38076, 17, 9, 0, 0}, {38093, 13, 9, 0, 0},
+  {38106, 17, 9, 0, 0}, {38123, 17, 9, 0, 0}, {38140, 15, 9, 0, 0},
+  {38155, 15, 9, 0, 0}, {38170, 12, 9, 0, 0}, {38182, 12, 9, 0, 0},
+  {38194, 12, 9, 0, 0}, {38206, 13, 9, 0, 0}, {38219, 21, 9, 0, 0},
+  {38240, 12, 9, 0, 0}, {38252, 12, 9, 0, 0}, {38264, 16, 9, 0, 0},
+  {38280, 12, 9, 0, 0}, {38292, 12, 9, 0, 0}, {38304, 25, 9, 0, 0},
+  {38329, 25, 9, 0, 0}, {38354, 25, 9, 0, 0}, {38379, 20, 9, 0, 0},
+  {38399, 20, 9, 0, 0}, {38419, 20, 9, 0, 0}, {38439, 20, 9, 0, 0},
+  {38459, 20, 9, 0, 0}, {38479, 9, 0, 2, 9587}, {38488, 9, 9, 2, 9589},
+  {38497, 9, 0, 4, 9591}, {38506, 9, 0, 1, 9595}, {38515, 9, 0, 1, 9596},
+  {9659, 1, 18, 0, 0}, {38524, 5, 9, 0, 0}, {38529, 4, 9, 0, 0},
+  {38533, 7, 18, 0, 0}, {38540, 11, 18, 0, 0}, {38551, 11, 18, 0, 0},
+  {38562, 3, 18, 0, 0}, {38565, 3, 18, 0, 0}, {38568, 3, 18, 0, 0},
+  {38571, 4, 9, 0, 0}, {38575, 8, 9, 0, 0}, {37884, 14, 9, 0, 0},
+  {37898, 14, 9, 0, 0}, {37912, 14, 9, 0, 0}, {37926, 10, 9, 0, 0},
+  {37936, 14, 9, 0, 0}, {37950, 14, 9, 0, 0}, {37964, 12, 9, 0, 0},
+  {37988, 12, 9, 0, 0}, {38020, 9, 9, 0, 0}, {38029, 9, 9, 0, 0},
+  {38038, 9, 9, 0, 0}, {38479, 9, 9, 0, 0}, {38488, 9, 9, 0, 0},
+  {38497, 9, 9, 0, 0}, {38583, 13, 9, 0, 0}, {38506, 9, 9, 0, 0},
+  {38515, 9, 9, 0, 0}, {38596, 4, 9, 0, 0}, {38600, 4, 9, 0, 0},
+  {38604, 4, 9, 0, 0}, {38608, 4, 9, 0, 0}, {38612, 4, 9, 0, 0},
+  {38616, 4, 9, 0, 0}, {38620, 4, 9, 0, 0}, {38624, 4, 9, 0, 0},
+  {38628, 4, 9, 0, 0}, {38632, 4, 9, 0, 0}, {38636, 9, 9, 0, 0},
+  {38645, 12, 9, 0, 0}, {22025, 6, 9, 0, 0}, {38657, 14, 9, 0, 0},
+  {38571, 4, 9, 0, 0}, {38671, 3, 18, 0, 0}, {38674, 7, 9, 0, 0},
+  {38681, 12, 18, 0, 0}, {38693, 2, 9, 0, 0}, {333, 3, 9, 0, 0},
+  {38632, 4, 9, 0, 0}, {1992, 2, 9, 0, 0}, {38695, 7, 9, 0, 0},
+  {38702, 8, 9, 0, 0}, {38710, 8, 9, 0, 0}, {38718, 4, 9, 0, 0},
+  {38722, 6, 9, 0, 0}, {38728, 7, 9, 0, 0}, {38735, 4, 9, 0, 0},
+  {38739, 6, 9, 0, 0}, {19964, 2, 9, 0, 0}, {9665, 1, 9, 0, 0},
+  {38745, 4, 9, 0, 0}, {1288, 5, 9, 0, 0}, {22048, 6, 9, 0, 0},
+  {38749, 3, 9, 0, 0}, {1992, 2, 9, 0, 0}, {333, 3, 9, 0, 0},
+  {38752, 3, 9, 0, 0}, {5370, 4, 9, 0, 0}, {4677, 3, 9, 0, 0},
+  {38755, 3, 9, 0, 0}, {38758, 3, 9, 0, 0}, {38761, 3, 9, 0, 0},
+  {15592, 5, 9, 0, 0}, {10972, 2, 9, 0, 0}, {38764, 2, 9, 0, 0},
+  {38766, 8, 9, 0, 0}, {8527, 8, 9, 0, 0}, {27390, 10, 0, 1, 9597},
+  {1288, 5, 18, 0, 0}, {38774, 6, 9, 0, 0}, {1288, 5, 0, 2, 9598},
+  {38780, 3, 9, 0, 0}, {38780, 3, 9, 0, 0}, {9686, 6, 9, 0, 0},
+  {38780, 3, 9, 0, 0}, {3135, 2, 0, 1, 9600}, {38702, 8, 9, 0, 0},
+  {15833, 4, 18, 0, 0}, {3645, 6, 9, 0, 0}, {38783, 3, 18, 0, 0},
+  {38786, 9, 9, 0, 0}, {8527, 8, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {8527, 8, 9, 0, 0}, {10768, 8, 9, 0, 0}, {15833, 4, 9, 0, 0},
+  {2135, 2, 9, 0, 0}, {38571, 4, 9, 0, 0}, {38632, 4, 9, 0, 0},
+  {38795, 6, 9, 0, 0}, {8527, 8, 9, 0, 0}, {38801, 3, 18, 0, 0},
+  {8527, 8, 9, 0, 0}, {13835, 7, 9, 0, 0}, {38804, 7, 9, 0, 0},
+  {38811, 10, 9, 0, 0}, {3686, 3, 1, 0, 0}, {22082, 3, 1, 0, 0},
+  {333, 3, 9, 0, 0}, {38821, 9, 18, 0, 0}, {38632, 4, 9, 0, 0},
+  {38830, 5, 9, 0, 0}, {38835, 3, 9, 0, 0}, {9686, 6, 9, 0, 0},
+  {2962, 2, 9, 0, 0}, {38628, 4, 9, 0, 0}, {38838, 5, 9, 0, 0},
+  {38843, 4, 9, 0, 0}, {38847, 3, 18, 0, 0}, {38850, 7, 9, 0, 0},
+  {1717, 3, 0, 2, 9601}, {38857, 6, 0, 2, 9603}, {4680, 4, 0, 1, 9605},
+  {38863, 7, 0, 2, 9606}, {38870, 9, 9, 0, 0}, {9648, 1, 9, 0, 0},
+  {38879, 2, 9, 0, 0}, {4364, 4, 0, 1, 9608}, {38881, 5, 1, 0, 0},
+  {38886, 3, 1, 0, 0}, {38889, 4, 1, 0, 0}, {38893, 5, 1, 0, 0},
+  {38898, 6, 1, 0, 0}, {38904, 5, 1, 0, 0}, {38909, 4, 1, 0, 0},
+  {38913, 8, 1, 0, 0}, {38921, 5, 1, 0, 0}, {38926, 4, 1, 0, 0},
+  {38930, 7, 1, 0, 0}, {38937, 10, 1, 0, 0}, {38947, 10, 1, 0, 0},
+  {38957, 7, 1, 0, 0}, {38964, 7, 1, 0, 0}, {38971, 7, 1, 0, 0},
+  {38978, 7, 1, 0, 0}, {38985, 5, 1, 0, 0}, {38990, 6, 1, 0, 0},
+  {38996, 7, 1, 0, 0}, {39003, 4, 1, 0, 0}, {39007, 6, 1, 0, 0},
+  {39013, 6, 1, 0, 0}, {39019, 5, 1, 0, 0}, {39024, 4, 1, 0, 0},
+  {39028, 6, 1, 0, 0}, {39034, 7, 1, 0, 0}, {39041, 6, 1, 0, 0},
+  {39047, 7, 1, 0, 0}, {39054, 3, 1, 0, 0}, {39057, 6, 1, 0, 0},
+  {39063, 5, 1, 0, 0}, {39068, 7, 1, 0, 0}, {39075, 10, 1, 0, 0},
+  {39085, 4, 1, 0, 0}, {39089, 8, 1, 0, 0}, {39097, 9, 1, 0, 0},
+  {39106, 7, 1, 0, 0}, {39113, 6, 1, 0, 0}, {39119, 8, 1, 0, 0},
+  {39127, 9, 1, 0, 0}, {39136, 4, 1, 0, 0}, {39140, 4, 1, 0, 0},
+  {39144, 5, 1, 0, 0}, {39149, 8, 1, 0, 0}, {39157, 7, 1, 0, 0},
+  {39164, 9, 1, 0, 0}, {39173, 8, 1, 0, 0}, {39181, 6, 1, 0, 0},
+  {5906, 6, 1, 0, 0}, {39187, 8, 1, 0, 0}, {39195, 6, 1, 0, 0},
+  {20394, 5, 1, 0, 0}, {39201, 6, 1, 0, 0}, {39207, 8, 1, 0, 0},
+  {39215, 6, 1, 0, 0}, {39221, 11, 1, 0, 0}, {39232, 6, 1, 0, 0},
+  {39238, 13, 1, 0, 0}, {39251, 5, 1, 0, 0}, {39256, 6, 1, 0, 0},
+  {39262, 5, 1, 0, 0}, {39267, 9, 1, 0, 0}, {39276, 7, 1, 0, 0},
+  {39283, 8, 1, 0, 0}, {39291, 6, 1, 0, 0}, {39297, 9, 1, 0, 0},
+  {39306, 6, 1, 0, 0}, {39312, 5, 1, 0, 0}, {39317, 6, 1, 0, 0},
+  {39323, 6, 1, 0, 0}, {39329, 9, 1, 0, 0}, {39338, 6, 1, 0, 0},
+  {39344, 7, 1, 0, 0}, {39351, 5, 1, 0, 0}, {39356, 3, 1, 0, 0},
+  {39359, 5, 1, 0, 0}, {39364, 7, 1, 0, 0}, {39371, 6, 1, 0, 0},
+  {39377, 9, 1, 0, 0}, {20404, 6, 1, 0, 0}, {39386, 6, 1, 0, 0},
+  {39392, 9, 1, 0, 0}, {39401, 9, 1, 0, 0}, {39410, 7, 1, 0, 0},
+  {39417, 8, 1, 0, 0}, {39425, 9, 1, 0, 0}, {39434, 8, 1, 0, 0},
+  {39442, 6, 1, 0, 0}, {39448, 5, 1, 0, 0}, {39453, 10, 1, 0, 0},
+  {39463, 6, 1, 0, 0}, {39469, 6, 1, 0, 0}, {39475, 5, 1, 0, 0},
+  {39480, 8, 1, 0, 0}, {39488, 7, 1, 0, 0}, {39495, 10, 1, 0, 0},
+  {39505, 6, 1, 0, 0}, {39511, 5, 1, 0, 0}, {39516, 6, 1, 0, 0},
+  {39522, 7, 1, 0, 0}, {39529, 7, 1, 0, 0}, {39536, 5, 1, 0, 0},
+  {39541, 5, 1, 0, 0}, {39546, 6, 1, 0, 0}, {39552, 6, 1, 0, 0},
+  {39558, 6, 1, 0, 0}, {39564, 4, 1, 0, 0}, {39568, 9, 1, 0, 0},
+  {39577, 6, 1, 0, 0}, {39583, 10, 1, 0, 0}, {39593, 8, 1, 0, 0},
+  {39601, 8, 1, 0, 0}, {38947, 10, 1, 0, 0}, {39609, 5, 1, 0, 0},
+  {39614, 5, 1, 0, 0}, {39619, 8, 1, 0, 0}, {39627, 8, 1, 0, 0},
+  {39635, 7, 1, 0, 0}, {39642, 6, 1, 0, 0}, {39648, 8, 1, 0, 0},
+  {39656, 7, 1, 0, 0}, {39663, 8, 1, 0, 0}, {39671, 6, 1, 0, 0},
+  {39677, 8, 1, 0, 0}, {39685, 6, 1, 0, 0}, {39691, 7, 1, 0, 0},
+  {39698, 6, 1, 0, 0}, {39028, 6, 1, 0, 0}, {39704, 10, 1, 0, 0},
+  {39714, 6, 1, 0, 0}, {39720, 9, 1, 0, 0}, {39729, 6, 1, 0, 0},
+  {39735, 10, 1, 0, 0}, {39745, 9, 1, 0, 0}, {39754, 6, 1, 0, 0},
+  {39760, 4, 1, 0, 0}, {39764, 13, 1, 0, 0}, {39777, 7, 1, 0, 0},
+  {39784, 6, 1, 0, 0}, {39790, 5, 1, 0, 0}, {39795, 5, 1, 0, 0},
+  {5060, 6, 1, 0, 0}, {39800, 9, 1, 0, 0}, {39809, 7, 1, 0, 0},
+  {39816, 6, 1, 0, 0}, {39822, 6, 1, 0, 0}, {39828, 9, 1, 0, 0},
+  {39837, 4, 1, 0, 0}, {39841, 4, 1, 0, 0}, {39845, 8, 1, 0, 0},
+  {39853, 6, 1, 0, 0}, {39859, 8, 1, 0, 0}, {39867, 8, 1, 0, 0},
+  {39875, 7, 1, 0, 0}, {39882, 9, 1, 0, 0}, {39891, 7, 1, 0, 0},
+  {39898, 10, 1, 0, 0}, {39908, 15, 1, 0, 0}, {39923, 10, 1, 0, 0},
+  {39933, 5, 1, 0, 0}, {39938, 5, 1, 0, 0}, {39943, 5, 1, 0, 0},
+  {39948, 7, 1, 0, 0}, {39955, 3, 1, 0, 0}, {39958, 8, 1, 0, 0},
+  {39966, 6, 1, 0, 0}, {39972, 9, 1, 0, 0}, {39981, 6, 1, 0, 0},
+  {39987, 7, 1, 0, 0}, {39994, 9, 1, 0, 0}, {40003, 8, 1, 0, 0},
+  {40011, 7, 1, 0, 0}, {40018, 3, 1, 0, 0}, {40021, 5, 1, 0, 0},
+  {40026, 5, 1, 0, 0}, {40031, 11, 1, 0, 0}, {40042, 4, 1, 0, 0},
+  {40046, 4, 1, 0, 0}, {40050, 6, 1, 0, 0}, {40056, 7, 1, 0, 0},
+  {40063, 10, 1, 0, 0}, {40073, 7, 1, 0, 0}, {40080, 7, 1, 0, 0},
+  {20638, 5, 1, 0, 0}, {40087, 5, 1, 0, 0}, {40092, 9, 1, 0, 0},
+  {39028, 6, 1, 0, 0}, {40101, 13, 1, 0, 0}, {40114, 5, 1, 0, 0},
+  {40119, 3, 1, 0, 0}, {40122, 3, 1, 0, 0}, {40125, 5, 1, 0, 0},
+  {40130, 5, 1, 0, 0}, {39119, 8, 1, 0, 0}, {40135, 7, 1, 0, 0},
+  {40142, 6, 1, 0, 0}, {40148, 6, 1, 0, 0}, {40154, 5, 1, 0, 0},
+  {40159, 7, 1, 0, 0}, {40166, 7, 1, 0, 0}, {40173, 7, 1, 0, 0},
+  {40180, 10, 1, 0, 0}, {40190, 8, 1, 0, 0}, {39564, 4, 1, 0, 0},
+  {40198, 7, 1, 0, 0}, {40205, 7, 1, 0, 0}, {40212, 6, 1, 0, 0},
+  {40218, 7, 1, 0, 0}, {40225, 8, 1, 0, 0}, {40233, 8, 1, 0, 0},
+  {40241, 6, 1, 0, 0}, {40247, 8, 1, 0, 0}, {40255, 4, 1, 0, 0},
+  {40259, 6, 1, 0, 0}, {40265, 6, 1, 0, 0}, {40271, 6, 1, 0, 0},
+  {40277, 6, 1, 0, 0}, {40283, 4, 1, 0, 0}, {40287, 6, 1, 0, 0},
+  {40293, 6, 1, 0, 0}, {40299, 6, 1, 0, 0}, {40305, 6, 1, 0, 0},
+  {40311, 6, 1, 0, 0}, {40317, 6, 1, 0, 0}, {40323, 8, 1, 0, 0},
+  {40331, 8, 1, 0, 0}, {40339, 8, 1, 0, 0}, {40347, 8, 1, 0, 0},
+  {40355, 6, 1, 0, 0}, {40361, 5, 1, 0, 0}, {40366, 6, 1, 0, 0},
+  {40372, 5, 1, 0, 0}, {40377, 7, 1, 0, 0}, {40384, 5, 1, 0, 0},
+  {40389, 3, 1, 0, 0}, {40392, 5, 1, 0, 0}, {40397, 4, 1, 0, 0},
+  {40401, 5, 1, 0, 0}, {40406, 3, 1, 0, 0}, {40409, 7, 1, 0, 0},
+  {40416, 8, 1, 0, 0}, {40424, 6, 1, 0, 0}, {40430, 13, 1, 0, 0},
+  {40443, 6, 1, 0, 0}, {40449, 5, 1, 0, 0}, {40454, 3, 1, 0, 0},
+  {40457, 9, 1, 0, 0}, {40466, 6, 1, 0, 0}, {40472, 6, 1, 0, 0},
+  {40478, 4, 1, 0, 0}, {40482, 7, 1, 0, 0}, {40489, 6, 1, 0, 0},
+  {40495, 5, 1, 0, 0}, {40500, 3, 1, 0, 0}, {40503, 4, 1, 0, 0},
+  {40507, 6, 1, 0, 0}, {40513, 4, 1, 0, 0}, {40517, 8, 1, 0, 0},
+  {40525, 9, 1, 0, 0}, {40534, 9, 1, 0, 0}, {40543, 10, 1, 0, 0},
+  {40553, 13, 1, 0, 0}, {40566, 7, 1, 0, 0}, {40573, 6, 1, 0, 0},
+  {1612, 4, 1, 0, 0}, {20650, 9, 1, 0, 0}, {40579, 8, 1, 0, 0},
+  {40587, 6, 1, 0, 0}, {40593, 6, 1, 0, 0}, {40218, 7, 1, 0, 0},
+  {40599, 6, 1, 0, 0}, {40605, 6, 1, 0, 0}, {40611, 6, 1, 0, 0},
+  {40617, 10, 1, 0, 0}, {20779, 8, 1, 0, 0}, {40627, 5, 1, 0, 0},
+  {40632, 9, 1, 0, 0}, {40641, 10, 1, 0, 0}, {40651, 8, 1, 0, 0},
+  {40659, 8, 1, 0, 0}, {40667, 8, 1, 0, 0}, {40675, 12, 1, 0, 0},
+  {40687, 5, 1, 0, 0}, {40692, 8, 1, 0, 0}, {40700, 6, 1, 0, 0},
+  {40706, 6, 1, 0, 0}, {40712, 7, 1, 0, 0}, {40719, 5, 1, 0, 0},
+  {40724, 5, 1, 0, 0}, {40729, 9, 1, 0, 0}, {40738, 7, 1, 0, 0},
+  {40745, 5, 1, 0, 0}, {40750, 7, 1, 0, 0}, {40122, 3, 1, 0, 0},
+  {40757, 5, 1, 0, 0}, {40762, 8, 1, 0, 0}, {40770, 7, 1, 0, 0},
+  {40777, 9, 1, 0, 0}, {40786, 5, 1, 0, 0}, {40791, 4, 1, 0, 0},
+  {40795, 8, 1, 0, 0}, {40803, 7, 1, 0, 0}, {40810, 8, 1, 0, 0},
+  {40818, 8, 1, 0, 0}, {40826, 5, 1, 0, 0}, {40831, 6, 1, 0, 0},
+  {40837, 6, 1, 0, 0}, {40843, 9, 1, 0, 0}, {40852, 7, 1, 0, 0},
+  {40859, 6, 1, 0, 0}, {40865, 7, 1, 0, 0}, {40872, 3, 1, 0, 0},
+  {20659, 4, 1, 0, 0}, {40875, 5, 1, 0, 0}, {40880, 4, 1, 0, 0},
+  {40884, 4, 1, 0, 0}, {40888, 7, 1, 0, 0}, {40895, 7, 1, 0, 0},
+  {40902, 4, 1, 0, 0}, {40906, 16, 1, 0, 0}, {40922, 7, 1, 0, 0},
+  {40087, 5, 1, 0, 0}, {40929, 12, 1, 0, 0}, {40941, 4, 1, 0, 0},
+  {40945, 8, 1, 0, 0}, {40953, 9, 1, 0, 0}, {40962, 6, 1, 0, 0},
+  {40968, 8, 1, 0, 0}, {40976, 4, 1, 0, 0}, {40980, 8, 1, 0, 0},
+  {40988, 6, 1, 0, 0}, {40994, 8, 1, 0, 0}, {41002, 6, 1, 0, 0},
+  {41008, 11, 1, 0, 0}, {41019, 5, 1, 0, 0}, {41024, 8, 1, 0, 0},
+  {41032, 4, 1, 0, 0}, {41036, 10, 1, 0, 0}, {40777, 9, 1, 0, 0},
+  {41046, 6, 1, 0, 0}, {41052, 8, 1, 0, 0}, {41060, 5, 1, 0, 0},
+  {41065, 4, 1, 0, 0}, {41069, 6, 1, 0, 0}, {41075, 8, 1, 0, 0},
+  {21863, 8, 1, 0, 0}, {41083, 6, 1, 0, 0}, {41089, 4, 1, 0, 0},
+  {41093, 6, 1, 0, 0}, {41099, 7, 1, 0, 0}, {41106, 7, 1, 0, 0},
+  {41113, 15, 1, 0, 0}, {41128, 7, 1, 0, 0}, {41135, 7, 1, 0, 0},
+  {41142, 5, 1, 0, 0}, {41147, 5, 1, 0, 0}, {41152, 9, 1, 0, 0},
+  {41161, 6, 1, 0, 0}, {41167, 5, 1, 0, 0}, {41172, 7, 1, 0, 0},
+  {41179, 8, 1, 0, 0}, {41187, 5, 1, 0, 0}, {39698, 6, 1, 0, 0},
+  {41192, 8, 1, 0, 0}, {41200, 10, 1, 0, 0}, {41210, 8, 1, 0, 0},
+  {41218, 7, 1, 0, 0}, {41225, 6, 1, 0, 0}, {41231, 6, 1, 0, 0},
+  {41237, 3, 1, 0, 0}, {41240, 3, 1, 0, 0}, {41243, 9, 1, 0, 0},
+  {41252, 9, 1, 0, 0}, {41261, 6, 1, 0, 0}, {40786, 5, 1, 0, 0},
+  {41267, 8, 1, 0, 0}, {41052, 8, 1, 0, 0}, {41275, 8, 1, 0, 0},
+  {41283, 11, 1, 0, 0}, {41294, 7, 1, 0, 0}, {41301, 9, 1, 0, 0},
+  {41310, 8, 1, 0, 0}, {41318, 4, 1, 0, 0}, {41322, 8, 1, 0, 0},
+  {41330, 9, 1, 0, 0}, {41339, 5, 1, 0, 0}, {41344, 7, 1, 0, 0},
+  {41351, 5, 1, 0, 0}, {41356, 8, 1, 0, 0}, {41364, 11, 1, 0, 0},
+  {41375, 16, 1, 0, 0}, {41391, 5, 1, 0, 0}, {41396, 12, 1, 0, 0},
+  {41408, 5, 1, 0, 0}, {41413, 3, 1, 0, 0}, {41416, 6, 1, 0, 0},
+  {41422, 4, 1, 0, 0}, {41426, 6, 1, 0, 0}, {39034, 7, 1, 0, 0},
+  {41432, 4, 1, 0, 0}, {41436, 8, 1, 0, 0}, {41444, 13, 1, 0, 0},
+  {41457, 5, 1, 0, 0}, {41462, 4, 1, 0, 0}, {41466, 4, 1, 0, 0},
+  {41470, 9, 1, 0, 0}, {41479, 8, 1, 0, 0}, {41487, 7, 1, 0, 0},
+  {41494, 8, 1, 0, 0}, {41502, 8, 1, 0, 0}, {41510, 5, 1, 0, 0},
+  {41515, 7, 1, 0, 0}, {41522, 7, 1, 0, 0}, {41529, 7, 1, 0, 0},
+  {41536, 9, 1, 0, 0}, {41545, 9, 1, 0, 0}, {41554, 6, 1, 0, 0},
+  {41560, 6, 1, 0, 0}, {41566, 6, 1, 0, 0}, {41572, 5, 1, 0, 0},
+  {41577, 4, 1, 0, 0}, {41581, 6, 1, 0, 0}, {41587, 6, 1, 0, 0},
+  {41593, 8, 1, 0, 0}, {41601, 11, 1, 0, 0}, {41612, 7, 1, 0, 0},
+  {1612, 4, 1, 0, 0}, {41619, 6, 1, 0, 0}, {41625, 7, 1, 0, 0},
+  {41632, 5, 1, 0, 0}, {41637, 5, 1, 0, 0}, {41642, 4, 1, 0, 0},
+  {41646, 6, 1, 0, 0}, {41652, 8, 1, 0, 0}, {20650, 9, 1, 0, 0},
+  {41660, 6, 1, 0, 0}, {41666, 8, 1, 0, 0}, {41674, 6, 1, 0, 0},
+  {41680, 8, 1, 0, 0}, {41688, 12, 1, 0, 0}, {41700, 6, 1, 0, 0},
+  {41706, 13, 1, 0, 0}, {41719, 11, 1, 0, 0}, {41730, 5, 1, 0, 0},
+  {41735, 7, 1, 0, 0}, {41742, 6, 1, 0, 0}, {41748, 8, 1, 0, 0},
+  {41756, 9, 1, 0, 0}, {41765, 8, 1, 0, 0}, {40087, 5, 1, 0, 0},
+  {41773, 7, 1, 0, 0}, {41780, 8, 1, 0, 0}, {41788, 9, 1, 0, 0},
+  {41797, 6, 1, 0, 0}, {41803, 10, 1, 0, 0}, {41813, 8, 1, 0, 0},
+  {41821, 11, 1, 0, 0}, {41832, 12, 1, 0, 0}, {41844, 8, 1, 0, 0},
+  {41852, 6, 1, 0, 0}, {41858, 8, 1, 0, 0}, {41866, 7, 1, 0, 0},
+  {41873, 9, 1, 0, 0}, {41882, 13, 1, 0, 0}, {41895, 6, 1, 0, 0},
+  {41901, 8, 1, 0, 0}, {41909, 9, 1, 0, 0}, {41918, 8, 1, 0, 0},
+  {41926, 8, 1, 0, 0}, {41934, 12, 1, 0, 0}, {41946, 7, 1, 0, 0},
+  {41953, 7, 1, 0, 0}, {39312, 5, 1, 0, 0}, {41960, 7, 1, 0, 0},
+  {41967, 8, 1, 0, 0}, {41975, 6, 1, 0, 0}, {41981, 12, 1, 0, 0},
+  {41993, 8, 1, 0, 0}, {42001, 8, 1, 0, 0}, {42009, 6, 1, 0, 0},
+  {42015, 7, 1, 0, 0}, {42022, 4, 1, 0, 0}, {40347, 8, 1, 0, 0},
+  {42026, 12, 1, 0, 0}, {42038, 12, 1, 0, 0}, {42050, 5, 1, 0, 0},
+  {42055, 7, 1, 0, 0}, {42062, 6, 1, 0, 0}, {42068, 6, 1, 0, 0},
+  {42074, 8, 1, 0, 0}, {42082, 4, 1, 0, 0}, {42086, 11, 1, 0, 0},
+  {42097, 11, 1, 0, 0}, {41225, 6, 1, 0, 0}, {42108, 7, 1, 0, 0},
+  {42115, 5, 1, 0, 0}, {42120, 5, 1, 0, 0}, {42125, 6, 1, 0, 0},
+  {42131, 5, 1, 0, 0}, {42136, 5, 1, 0, 0}, {42141, 7, 1, 0, 0},
+  {42148, 9, 1, 0, 0}, {42157, 4, 1, 0, 0}, {42161, 5, 1, 0, 0},
+  {42166, 5, 1, 0, 0}, {42171, 8, 1, 0, 0}, {42179, 5, 1, 0, 0},
+  {42184, 9, 1, 0, 0}, {42193, 7, 1, 0, 0}, {42200, 11, 1, 0, 0},
+  {42211, 6, 1, 0, 0}, {42217, 9, 1, 0, 0}, {42226, 8, 1, 0, 0},
+  {42234, 5, 1, 0, 0}, {42239, 8, 1, 0, 0}, {42247, 8, 1, 0, 0},
+  {42255, 7, 1, 0, 0}, {42262, 7, 1, 0, 0}, {42269, 9, 1, 0, 0},
+  {42278, 7, 1, 0, 0}, {42285, 9, 1, 0, 0}, {42294, 12, 1, 0, 0},
+  {42306, 8, 1, 0, 0}, {42314, 9, 1, 0, 0}, {42323, 7, 1, 0, 0},
+  {42330, 9, 1, 0, 0}, {42339, 7, 1, 0, 0}, {42346, 8, 1, 0, 0},
+  {42354, 5, 1, 0, 0}, {42359, 6, 1, 0, 0}, {42365, 8, 1, 0, 0},
+  {42373, 8, 1, 0, 0}, {42381, 9, 1, 0, 0}, {42390, 7, 1, 0, 0},
+  {42397, 5, 1, 0, 0}, {42402, 9, 1, 0, 0}, {42411, 6, 1, 0, 0},
+  {42417, 4, 1, 0, 0}, {42421, 6, 1, 0, 0}, {42427, 8, 1, 0, 0},
+  {42435, 7, 1, 0, 0}, {42442, 8, 1, 0, 0}, {42450, 9, 1, 0, 0},
+  {42459, 7, 1, 0, 0}, {42466, 6, 1, 0, 0}, {42472, 4, 1, 0, 0},
+  {42476, 9, 1, 0, 0}, {42485, 8, 1, 0, 0}, {42493, 7, 1, 0, 0},
+  {42500, 6, 1, 0, 0}, {42506, 6, 1, 0, 0}, {42512, 4, 1, 0, 0},
+  {42516, 6, 1, 0, 0}, {42522, 3, 1, 0, 0}, {42525, 9, 1, 0, 0},
+  {42534, 6, 1, 0, 0}, {42540, 5, 1, 0, 0}, {40148, 6, 1, 0, 0},
+  {42545, 5, 1, 0, 0}, {42550, 8, 1, 0, 0}, {42558, 7, 1, 0, 0},
+  {42565, 6, 1, 0, 0}, {42571, 6, 1, 0, 0}, {39601, 8, 1, 0, 0},
+  {42577, 7, 1, 0, 0}, {42584, 5, 1, 0, 0}, {42589, 8, 1, 0, 0},
+  {42597, 8, 1, 0, 0}, {41813, 8, 1, 0, 0}, {42605, 5, 1, 0, 0},
+  {40259, 6, 1, 0, 0}, {42610, 9, 1, 0, 0}, {42619, 4, 1, 0, 0},
+  {42623, 11, 1, 0, 0}, {42634, 11, 1, 0, 0}, {42645, 9, 1, 0, 0},
+  {40122, 3, 1, 0, 0}, {42654, 5, 1, 0, 0}, {42659, 6, 1, 0, 0},
+  {42665, 8, 1, 0, 0}, {42673, 4, 1, 0, 0}, {40424, 6, 1, 0, 0},
+  {42677, 9, 1, 0, 0}, {42686, 5, 1, 0, 0}, {42691, 6, 1, 0, 0},
+  {42697, 6, 1, 0, 0}, {42703, 4, 1, 0, 0}, {42707, 10, 1, 0, 0},
+  {42717, 8, 1, 0, 0}, {42725, 6, 1, 0, 0}, {42731, 5, 1, 0, 0},
+  {42736, 7, 1, 0, 0}, {42743, 7, 1, 0, 0}, {42750, 4, 1, 0, 0},
+  {42754, 7, 1, 0, 0}, {42761, 4, 1, 0, 0}, {42765, 6, 1, 0, 0},
+  {42771, 3, 1, 0, 0}, {39541, 5, 1, 0, 0}, {42774, 5, 1, 0, 0},
+  {42779, 8, 1, 0, 0}, {42787, 5, 1, 0, 0}, {42792, 9, 1, 0, 0},
+  {2789, 7, 1, 0, 0}, {42801, 11, 1, 0, 0}, {42812, 12, 1, 0, 0},
+  {42824, 10, 1, 0, 0}, {20766, 7, 1, 0, 0}, {42834, 3, 1, 0, 0},
+  {42837, 8, 1, 0, 0}, {42845, 5, 1, 0, 0}, {42850, 5, 1, 0, 0},
+  {42855, 4, 1, 0, 0}, {42859, 6, 1, 0, 0}, {42865, 6, 1, 0, 0},
+  {42871, 7, 1, 0, 0}, {42878, 11, 1, 0, 0}, {40283, 4, 1, 0, 0},
+  {42889, 4, 1, 0, 0}, {42893, 4, 1, 0, 0}, {42897, 6, 1, 0, 0},
+  {41432, 4, 1, 0, 0}, {42903, 8, 1, 0, 0}, {42911, 5, 1, 0, 0},
+  {42916, 5, 1, 0, 0}, {42921, 7, 1, 0, 0}, {42928, 9, 1, 0, 0},
+  {40130, 5, 1, 0, 0}, {42937, 10, 1, 0, 0}, {42947, 9, 1, 0, 0},
+  {42956, 10, 1, 0, 0}, {42966, 9, 1, 0, 0}, {42975, 4, 1, 0, 0},
+  {42979, 5, 1, 0, 0}, {42984, 8, 1, 0, 0}, {42992, 11, 1, 0, 0},
+  {39144, 5, 1, 0, 0}, {43003, 6, 1, 0, 0}, {43009, 4, 1, 0, 0},
+  {43013, 6, 1, 0, 0}, {43019, 9, 1, 0, 0}, {43028, 7, 1, 0, 0},
+  {43035, 8, 1, 0, 0}, {43043, 6, 1, 0, 0}, {39891, 7, 1, 0, 0},
+  {21863, 8, 1, 0, 0}, {43049, 6, 1, 0, 0}, {43055, 4, 1, 0, 0},
+  {43059, 7, 1, 0, 0}, {43066, 5, 1, 0, 0}, {43071, 7, 1, 0, 0},
+  {43078, 4, 1, 0, 0}, {43082, 6, 1, 0, 0}, {43088, 8, 1, 0, 0},
+  {43096, 8, 1, 0, 0}, {3337, 7, 1, 0, 0}, {43104, 8, 1, 0, 0},
+  {43112, 5, 1, 0, 0}, {43117, 4, 1, 0, 0}, {43121, 8, 1, 0, 0},
+  {43129, 4, 1, 0, 0}, {43133, 5, 1, 0, 0}, {43138, 4, 1, 0, 0},
+  {43142, 7, 1, 0, 0}, {43149, 7, 1, 0, 0}, {43156, 8, 1, 0, 0},
+  {43164, 6, 1, 0, 0}, {43170, 5, 1, 0, 0}, {43175, 8, 1, 0, 0},
+  {43183, 8, 1, 0, 0}, {43191, 9, 1, 0, 0}, {40605, 6, 1, 0, 0},
+  {43200, 8, 1, 0, 0}, {43208, 10, 1, 0, 0}, {43218, 8, 1, 0, 0},
+  {20792, 5, 1, 0, 0}, {43226, 6, 1, 0, 0}, {43232, 8, 1, 0, 0},
+  {43240, 10, 1, 0, 0}, {43250, 7, 1, 0, 0}, {43257, 5, 1, 0, 0},
+  {43262, 8, 1, 0, 0}, {43270, 4, 1, 0, 0}, {43274, 6, 1, 0, 0},
+  {43280, 8, 1, 0, 0}, {40311, 6, 1, 0, 0}, {43288, 8, 1, 0, 0},
+  {43296, 7, 1, 0, 0}, {43303, 6, 1, 0, 0}, {39760, 4, 1, 0, 0},
+  {43309, 7, 1, 0, 0}, {43316, 4, 1, 0, 0}, {43320, 7, 1, 0, 0},
+  {43327, 13, 1, 0, 0}, {43340, 5, 1, 0, 0}, {43345, 11, 1, 0, 0},
+  {43356, 6, 1, 0, 0}, {43362, 8, 1, 0, 0}, {43370, 4, 1, 0, 0},
+  {43374, 6, 1, 0, 0}, {40507, 6, 1, 0, 0}, {43380, 7, 1, 0, 0},
+  {43387, 13, 1, 0, 0}, {43400, 7, 1, 0, 0}, {43407, 8, 1, 0, 0},
+  {43415, 5, 1, 0, 0}, {43420, 8, 1, 0, 0}, {43428, 6, 1, 0, 0},
+  {43434, 8, 1, 0, 0}, {43442, 6, 1, 0, 0}, {43448, 7, 1, 0, 0},
+  {43455, 9, 1, 0, 0}, {43464, 7, 1, 0, 0}, {43471, 8, 1, 0, 0},
+  {43479, 5, 1, 0, 0}, {43484, 8, 1, 0, 0}, {43492, 5, 1, 0, 0},
+  {43497, 5, 1, 0, 0}, {43502, 5, 1, 0, 0}, {37344, 3, 1, 0, 0},
+  {43507, 4, 1, 0, 0}, {43511, 5, 1, 0, 0}, {20812, 9, 1, 0, 0},
+  {43516, 6, 1, 0, 0}, {43522, 8, 1, 0, 0}, {43530, 5, 1, 0, 0},
+  {43535, 7, 1, 0, 0}, {43542, 10, 1, 0, 0}, {43552, 9, 1, 0, 0},
+  {43561, 10, 1, 0, 0}, {43571, 8, 1, 0, 0}, {43579, 12, 1, 0, 0},
+  {43591, 13, 1, 0, 0}, {43604, 3, 1, 0, 0}, {43607, 8, 1, 0, 0},
+  {43615, 5, 1, 0, 0}, {43620, 6, 1, 0, 0}, {43626, 6, 1, 0, 0},
+  {43632, 5, 1, 0, 0}, {43637, 9, 1, 0, 0}, {43646, 5, 1, 0, 0},
+  {43175, 8, 1, 0, 0}, {43651, 6, 1, 0, 0}, {43657, 6, 1, 0, 0},
+  {43663, 9, 1, 0, 0}, {43672, 7, 1, 0, 0}, {43679, 6, 1, 0, 0},
+  {43685, 8, 1, 0, 0}, {43693, 8, 1, 0, 0}, {43701, 7, 1, 0, 0},
+  {43708, 14, 1, 0, 0}, {43722, 5, 1, 0, 0}, {43727, 5, 1, 0, 0},
+  {43732, 8, 1, 0, 0}, {43740, 7, 1, 0, 0}, {43747, 2, 1, 0, 0},
+  {43749, 4, 1, 0, 0}, {43753, 10, 1, 0, 0}, {43763, 8, 1, 0, 0},
+  {43771, 6, 1, 0, 0}, {43777, 8, 1, 0, 0}, {40837, 6, 1, 0, 0},
+  {43785, 8, 1, 0, 0}, {43793, 8, 1, 0, 0}, {43801, 4, 1, 0, 0},
+  {43805, 5, 1, 0, 0}, {1231, 4, 4, 0, 0}, {1231, 4, 4, 0, 0},
+  {1231, 4, 4, 0, 0}, {43810, 3, 1, 0, 0}, {43813, 6, 1, 0, 0},
+  {41700, 6, 1, 0, 0}, {43819, 12, 1, 0, 0}, {43831, 3, 1, 0, 0},
+  {43834, 6, 1, 0, 0}, {43840, 4, 1, 0, 0}, {43844, 8, 1, 0, 0},
+  {20877, 5, 1, 0, 0}, {41426, 6, 1, 0, 0}, {43852, 8, 1, 0, 0},
+  {43860, 6, 1, 0, 0}, {43866, 6, 1, 0, 0}, {43872, 8, 1, 0, 0},
+  {43880, 7, 1, 0, 0}, {43887, 9, 1, 0, 0}, {43896, 10, 1, 0, 0},
+  {43906, 4, 1, 0, 0}, {40384, 5, 1, 0, 0}, {43910, 5, 1, 0, 0},
+  {43915, 6, 1, 0, 0}, {43921, 6, 1, 0, 0}, {43927, 6, 1, 0, 0},
+  {43933, 6, 1, 0, 0}, {43939, 4, 1, 0, 0}, {43943, 11, 1, 0, 0},
+  {43954, 4, 1, 0, 0}, {43958, 5, 1, 0, 0}, {43963, 5, 1, 0, 0},
+  {43968, 6, 1, 0, 0}, {43974, 8, 1, 0, 0}, {43982, 7, 1, 0, 0},
+  {43989, 4, 1, 0, 0}, {43993, 3, 1, 0, 0}, {43996, 5, 1, 0, 0},
+  {44001, 7, 1, 0, 0}, {44008, 11, 1, 0, 0}, {44019, 7, 1, 0, 0},
+  {20882, 8, 1, 0, 0}, {44026, 7, 1, 0, 0}, {44033, 6, 1, 0, 0},
+  {44039, 8, 1, 0, 0}, {44047, 11, 1, 0, 0}, {44058, 6, 1, 0, 0},
+  {44064, 9, 1, 0, 0}, {44073, 5, 1, 0, 0}, {40018, 3, 1, 0, 0},
+  {42691, 6, 1, 0, 0}, {44078, 8, 1, 0, 0}, {44086, 3, 1, 0, 0},
+  {44089, 3, 1, 0, 0}, {44092, 6, 1, 0, 0}, {40837, 6, 1, 0, 0},
+  {44098, 10, 1, 0, 0}, {44108, 5, 1, 0, 0}, {44113, 11, 1, 0, 0},
+  {44124, 11, 1, 0, 0}, {44135, 3, 1, 0, 0}, {44138, 3, 1, 0, 0},
+  {44141, 4, 1, 0, 0}, {44145, 7, 1, 0, 0}, {44152, 4, 1, 0, 0},
+  {44156, 4, 1, 0, 0}, {44160, 4, 1, 0, 0}, {44164, 8, 1, 0, 0},
+  {44172, 8, 1, 0, 0}, {44180, 9, 1, 0, 0}, {44189, 8, 1, 0, 0},
+  {44197, 7, 1, 0, 0}, {40305, 6, 1, 0, 0}, {44204, 15, 1, 0, 0},
+  {44219, 6, 1, 0, 0}, {44225, 4, 1, 0, 0}, {44229, 10, 1, 0, 0},
+  {44239, 7, 1, 0, 0}, {44246, 6, 1, 0, 0}, {44252, 9, 1, 0, 0},
+  {44261, 5, 1, 0, 0}, {44266, 5, 1, 0, 0}, {44271, 6, 1, 0, 0},
+  {44277, 3, 1, 0, 0}, {44280, 9, 1, 0, 0}, {44289, 6, 1, 0, 0},
+  {44295, 9, 1, 0, 0}, {44304, 6, 1, 0, 0}, {39541, 5, 1, 0, 0},
+  {44310, 5, 1, 0, 0}, {44315, 3, 1, 0, 0}, {44318, 8, 1, 0, 0},
+  {44326, 7, 1, 0, 0}, {44333, 4, 1, 0, 0}, {44337, 8, 1, 0, 0},
+  {44345, 4, 1, 0, 0}, {44349, 6, 1, 0, 0}, {41416, 6, 1, 0, 0},
+  {44355, 6, 1, 0, 0}, {44361, 9, 1, 0, 0}, {41187, 5, 1, 0, 0},
+  {39028, 6, 1, 0, 0}, {44370, 9, 1, 0, 0}, {44379, 6, 1, 0, 0},
+  {40317, 6, 1, 0, 0}, {44385, 6, 1, 0, 0}, {44391, 5, 1, 0, 0},
+  {44396, 6, 1, 0, 0}, {44402, 4, 1, 0, 0}, {42354, 5, 1, 0, 0},
+  {44406, 4, 1, 0, 0}, {44410, 6, 1, 0, 0}, {44416, 4, 1, 0, 0},
+  {44420, 3, 1, 0, 0}, {44423, 5, 1, 0, 0}, {44428, 8, 1, 0, 0},
+  {44436, 7, 1, 0, 0}, {44443, 9, 1, 0, 0}, {44452, 8, 1, 0, 0},
+  {44460, 17, 1, 0, 0}, {44477, 10, 1, 0, 0}, {44487, 7, 1, 0, 0},
+  {44494, 6, 1, 0, 0}, {43840, 4, 1, 0, 0}, {20839, 8, 1, 0, 0},
+  {44500, 8, 1, 0, 0}, {44508, 10, 1, 0, 0}, {44518, 13, 1, 0, 0},
+  {39317, 6, 1, 0, 0}, {44531, 6, 1, 0, 0}, {44537, 6, 1, 0, 0},
+  {44543, 7, 1, 0, 0}, {44550, 5, 1, 0, 0}, {44555, 7, 1, 0, 0},
+  {44562, 5, 1, 0, 0}, {44567, 4, 1, 0, 0}, {44571, 6, 1, 0, 0},
+  {44577, 7, 1, 0, 0}, {44584, 13, 1, 0, 0}, {44597, 7, 1, 0, 0},
+  {44604, 8, 1, 0, 0}, {44612, 9, 1, 0, 0}, {44621, 6, 1, 0, 0},
+  {44627, 5, 1, 0, 0}, {44632, 4, 1, 0, 0}, {44636, 6, 1, 0, 0},
+  {44642, 6, 1, 0, 0}, {44648, 6, 1, 0, 0}, {44654, 8, 1, 0, 0},
+  {44662, 3, 1, 0, 0}, {44665, 3, 1, 0, 0}, {44668, 5, 1, 0, 0},
+  {44673, 6, 1, 0, 0}, {44679, 5, 1, 0, 0}, {44684, 8, 1, 0, 0},
+  {44692, 10, 1, 0, 0}, {44702, 4, 1, 0, 0}, {43844, 8, 1, 0, 0},
+  {40667, 8, 1, 0, 0}, {44706, 7, 1, 0, 0}, {44713, 9, 1, 0, 0},
+  {44722, 8, 1, 0, 0}, {44730, 7, 1, 0, 0}, {44737, 6, 1, 0, 0},
+  {44743, 10, 1, 0, 0}, {20958, 8, 1, 0, 0}, {44753, 9, 1, 0, 0},
+  {44762, 8, 1, 0, 0}, {44770, 9, 1, 0, 0}, {44779, 7, 1, 0, 0},
+  {44786, 5, 1, 0, 0}, {44791, 6, 1, 0, 0}, {44797, 8, 1, 0, 0},
+  {44805, 8, 1, 0, 0}, {44813, 8, 1, 0, 0}, {44821, 8, 1, 0, 0},
+  {43958, 5, 1, 0, 0}, {44829, 4, 1, 0, 0}, {44833, 8, 1, 0, 0},
+  {44841, 4, 1, 0, 0}, {44845, 4, 1, 0, 0}, {39541, 5, 1, 0, 0},
+  {44849, 7, 1, 0, 0}, {44856, 9, 1, 0, 0}, {44865, 7, 1, 0, 0},
+  {44872, 5, 1, 0, 0}, {44877, 6, 1, 0, 0}, {44883, 6, 1, 0, 0},
+  {44889, 4, 1, 0, 0}, {44893, 6, 1, 0, 0}, {44899, 4, 1, 0, 0},
+  {44903, 6, 1, 0, 0}, {44909, 6, 1, 0, 0}, {44915, 6, 1, 0, 0},
+  {40087, 5, 1, 0, 0}, {44921, 7, 1, 0, 0}, {42834, 3, 1, 0, 0},
+  {44928, 9, 1, 0, 0}, {44937, 8, 1, 0, 0}, {44945, 4, 1, 0, 0},
+  {44949, 13, 1, 0, 0}, {44962, 8, 1, 0, 0}, {44970, 8, 1, 0, 0},
+  {44978, 6, 1, 0, 0}, {44984, 9, 1, 0, 0}, {43552, 9, 1, 0, 0},
+  {44993, 5, 1, 0, 0}, {44998, 10, 1, 0, 0}, {45008, 10, 1, 0, 0},
+  {45018, 12, 1, 0, 0}, {45030, 6, 1, 0, 0}, {45036, 6, 1, 0, 0},
+  {45042, 6, 1, 0, 0}, {45048, 9, 1, 0, 0}, {20986, 6, 1, 0, 0},
+  {45057, 6, 1, 0, 0}, {45063, 6, 1, 0, 0}, {40347, 8, 1, 0, 0},
+  {45069, 6, 1, 0, 0}, {45075, 11, 1, 0, 0}, {45086, 5, 1, 0, 0},
+  {42916, 5, 1, 0, 0}, {45091, 5, 1, 0, 0}, {45096, 6, 1, 0, 0},
+  {45102, 3, 1, 0, 0}, {45105, 6, 1, 0, 0}, {45111, 7, 1, 0, 0},
+  {39790, 5, 1, 0, 0}, {45118, 5, 1, 0, 0}, {39795, 5, 1, 0, 0},
+  {45123, 6, 1, 0, 0}, {45129, 4, 1, 0, 0}, {45133, 6, 1, 0, 0},
+  {45139, 9, 1, 0, 0}, {45148, 12, 1, 0, 0}, {45160, 8, 1, 0, 0},
+  {45168, 4, 1, 0, 0}, {45172, 6, 1, 0, 0}, {45178, 6, 1, 0, 0},
+  {44078, 8, 1, 0, 0}, {41052, 8, 1, 0, 0}, {45184, 9, 1, 0, 0},
+  {42736, 7, 1, 0, 0}, {45193, 9, 1, 0, 0}, {45202, 6, 1, 0, 0},
+  {45208, 4, 1, 0, 0}, {45212, 4, 1, 0, 0}, {45216, 4, 1, 0, 0},
+  {21863, 8, 1, 0, 0}, {45220, 10, 1, 0, 0}, {45230, 6, 1, 0, 0},
+  {45236, 7, 1, 0, 0}, {45243, 7, 1, 0, 0}, {45250, 5, 1, 0, 0},
+  {45255, 4, 1, 0, 0}, {45259, 6, 1, 0, 0}, {45265, 6, 1, 0, 0},
+  {15810, 3, 1, 0, 0}, {45271, 7, 1, 0, 0}, {45278, 8, 1, 0, 0},
+  {45286, 10, 1, 0, 0}, {45296, 8, 1, 0, 0}, {20992, 8, 1, 0, 0},
+  {40114, 5, 1, 0, 0}, {45304, 5, 1, 0, 0}, {45309, 5, 1, 0, 0},
+  {45314, 6, 1, 0, 0}, {45320, 6, 1, 0, 0}, {45326, 5, 1, 0, 0},
+  {45331, 9, 1, 0, 0}, {45340, 12, 1, 0, 0}, {45352, 7, 1, 0, 0},
+  {39187, 8, 1, 0, 0}, {45359, 5, 1, 0, 0}, {1231, 4, 4, 0, 0},
+  {45364, 4, 1, 0, 0}, {45368, 4, 1, 0, 0}, {45372, 6, 1, 0, 0},
+  {45378, 14, 1, 0, 0}, {45392, 7, 1, 0, 0}, {45399, 5, 1, 0, 0},
+  {45404, 12, 1, 0, 0}, {45416, 7, 1, 0, 0}, {45423, 7, 1, 0, 0},
+  {45430, 9, 1, 0, 0}, {45439, 9, 1, 0, 0}, {43257, 5, 1, 0, 0},
+  {44937, 8, 1, 0, 0}, {42610, 9, 1, 0, 0}, {45448, 5, 1, 0, 0},
+  {45453, 8, 1, 0, 0}, {45461, 6, 1, 0, 0}, {45467, 6, 1, 0, 0},
+  {21007, 4, 1, 0, 0}, {45473, 8, 1, 0, 0}, {45481, 3, 1, 0, 0},
+  {45484, 4, 1, 0, 0}, {45488, 5, 1, 0, 0}, {45493, 7, 1, 0, 0},
+  {45500, 5, 1, 0, 0}, {45505, 9, 1, 0, 0}, {45514, 13, 1, 0, 0},
+  {45527, 6, 1, 0, 0}, {45533, 4, 1, 0, 0}, {45537, 8, 1, 0, 0},
+  {45545, 10, 1, 0, 0}, {45555, 7, 1, 0, 0}, {45562, 5, 1, 0, 0},
+  {45567, 3, 1, 0, 0}, {45570, 14, 1, 0, 0}, {45584, 12, 1, 0, 0},
+  {45596, 7, 1, 0, 0}, {45603, 7, 1, 0, 0}, {45610, 7, 0, 1, 9609},
+  {45617, 6, 9, 0, 0}, {45623, 3, 1, 0, 0}, {45626, 5, 1, 0, 0},
+  {45631, 5, 1, 0, 0}, {45636, 8, 1, 0, 0}, {45644, 9, 1, 0, 0},
+  {45653, 6, 1, 0, 0}, {44152, 4, 1, 0, 0}, {45659, 6, 1, 0, 0},
+  {45665, 11, 1, 0, 0}, {45676, 12, 1, 0, 0}, {45688, 7, 1, 0, 0},
+  {45695, 5, 1, 0, 0}, {45700, 8, 1, 0, 0}, {45708, 5, 1, 0, 0},
+  {45713, 7, 1, 0, 0}, {21011, 7, 1, 0, 0}, {45720, 5, 1, 0, 0},
+  {45102, 3, 1, 0, 0}, {45725, 4, 1, 0, 0}, {45729, 5, 1, 0, 0},
+  {45734, 5, 1, 0, 0}, {45739, 6, 1, 0, 0}, {45745, 8, 1, 0, 0},
+  {44577, 7, 1, 0, 0}, {45753, 6, 1, 0, 0}, {45759, 6, 1, 0, 0},
+  {45765, 6, 1, 0, 0}, {45771, 9, 1, 0, 0}, {45780, 7, 1, 0, 0},
+  {45787, 6, 1, 0, 0}, {45793, 6, 1, 0, 0}, {45799, 6, 1, 0, 0},
+  {45805, 5, 1, 0, 0}, {45810, 6, 1, 0, 0}, {45816, 5, 1, 0, 0},
+  {45821, 8, 1, 0, 0}, {45829, 11, 1, 0, 0}, {45840, 6, 1, 0, 0},
+  {45846, 4, 1, 0, 0}, {45850, 9, 1, 0, 0}, {45859, 4, 1, 0, 0},
+  {45863, 8, 1, 0, 0}, {45871, 7, 1, 0, 0}, {45878, 4, 1, 0, 0},
+  {45882, 8, 1, 0, 0}, {45890, 4, 1, 0, 0}, {21035, 4, 1, 0, 0},
+  {45894, 5, 1, 0, 0}, {45899, 6, 1, 0, 0}, {45905, 7, 1, 0, 0},
+  {26093, 3, 1, 0, 0}, {45912, 5, 1, 0, 0}, {45917, 4, 1, 0, 0},
+  {45921, 6, 1, 0, 0}, {45927, 8, 1, 0, 0}, {45935, 5, 1, 0, 0},
+  {45940, 9, 1, 0, 0}, {45949, 5, 1, 0, 0}, {45954, 8, 1, 0, 0},
+  {45962, 7, 1, 0, 0}, {45969, 8, 1, 0, 0}, {45977, 7, 1, 0, 0},
+  {45984, 9, 1, 0, 0}, {45993, 6, 1, 0, 0}, {45999, 6, 1, 0, 0},
+  {46005, 4, 1, 0, 0}, {46009, 5, 1, 0, 0}, {46014, 12, 1, 0, 0},
+  {21039, 7, 1, 0, 0}, {46026, 7, 1, 0, 0}, {46033, 8, 1, 0, 0},
+  {45527, 6, 1, 0, 0}, {46041, 4, 1, 0, 0}, {46045, 4, 1, 0, 0},
+  {46049, 9, 1, 0, 0}, {46058, 6, 1, 0, 0}, {46064, 7, 1, 0, 0},
+  {46071, 4, 1, 0, 0}, {46075, 6, 1, 0, 0}, {46081, 5, 1, 0, 0},
+  {46086, 7, 1, 0, 0}, {46093, 6, 1, 0, 0}, {46099, 9, 1, 0, 0},
+  {46108, 7, 1, 0, 0}, {40218, 7, 1, 0, 0}, {46115, 6, 1, 0, 0},
+  {46121, 5, 1, 0, 0}, {46126, 8, 1, 0, 0}, {20779, 8, 1, 0, 0},
+  {46134, 6, 1, 0, 0}, {46140, 5, 1, 0, 0}, {46145, 6, 1, 0, 0},
+  {46151, 3, 1, 0, 0}, {46154, 9, 1, 0, 0}, {46163, 14, 1, 0, 0},
+  {46177, 8, 1, 0, 0}, {46185, 8, 1, 0, 0}, {46193, 11, 1, 0, 0},
+  {46204, 6, 1, 0, 0}, {46210, 4, 1, 0, 0}, {46214, 4, 1, 0, 0},
+  {46218, 10, 1, 0, 0}, {46228, 7, 1, 0, 0}, {46235, 5, 1, 0, 0},
+  {44064, 9, 1, 0, 0}, {46240, 5, 1, 0, 0}, {4299, 7, 1, 0, 0},
+  {46245, 4, 1, 0, 0}, {46249, 7, 1, 0, 0}, {46256, 8, 1, 0, 0},
+  {46264, 6, 1, 0, 0}, {46270, 9, 1, 0, 0}, {46279, 10, 1, 0, 0},
+  {46289, 6, 1, 0, 0}, {46295, 6, 1, 0, 0}, {46301, 5, 1, 0, 0},
+  {46306, 5, 1, 0, 0}, {46311, 7, 1, 0, 0}, {46318, 8, 1, 0, 0},
+  {46326, 8, 1, 0, 0}, {46334, 6, 1, 0, 0}, {46340, 5, 1, 0, 0},
+  {46345, 14, 1, 0, 0}, {39564, 4, 1, 0, 0}, {46359, 5, 1, 0, 0},
+  {46364, 9, 1, 0, 0}, {46373, 8, 1, 0, 0}, {46381, 6, 1, 0, 0},
+  {46387, 12, 1, 0, 0}, {46399, 16, 1, 0, 0}, {46415, 15, 1, 0, 0},
+  {46430, 8, 1, 0, 0}, {20766, 7, 1, 0, 0}, {40087, 5, 1, 0, 0},
+  {43511, 5, 1, 0, 0}, {46438, 9, 1, 0, 0}, {46447, 9, 1, 0, 0},
+  {46456, 6, 1, 0, 0}, {46462, 7, 1, 0, 0}, {46469, 5, 1, 0, 0},
+  {46474, 9, 1, 0, 0}, {46483, 6, 1, 0, 0}, {46489, 13, 1, 0, 0},
+  {46502, 9, 1, 0, 0}, {44156, 4, 1, 0, 0}, {46511, 8, 1, 0, 0},
+  {46519, 9, 1, 0, 0}, {46528, 6, 1, 0, 0}, {46534, 5, 1, 0, 0},
+  {45999, 6, 1, 0, 0}, {46539, 9, 1, 0, 0}, {46548, 8, 1, 0, 0},
+  {40361, 5, 1, 0, 0}, {46556, 4, 1, 0, 0}, {46560, 11, 1, 0, 0},
+  {40130, 5, 1, 0, 0}, {46571, 6, 1, 0, 0}, {46577, 6, 1, 0, 0},
+  {46583, 6, 1, 0, 0}, {46589, 11, 1, 0, 0}, {46600, 9, 1, 0, 0},
+  {46609, 5, 1, 0, 0}, {46614, 7, 1, 0, 0}, {42697, 6, 1, 0, 0},
+  {46621, 6, 1, 0, 0}, {46627, 8, 1, 0, 0}, {46635, 9, 1, 0, 0},
+  {46644, 12, 1, 0, 0}, {46656, 8, 1, 0, 0}, {46664, 6, 1, 0, 0},
+  {46670, 3, 1, 0, 0}, {46673, 6, 1, 0, 0}, {46679, 5, 1, 0, 0},
+  {46684, 8, 1, 0, 0}, {46692, 6, 1, 0, 0}, {46698, 8, 1, 0, 0},
+  {46706, 5, 1, 0, 0}, {46711, 5, 1, 0, 0}, {46716, 8, 1, 0, 0},
+  {46724, 7, 1, 0, 0}, {46731, 7, 1, 0, 0}, {42871, 7, 1, 0, 0},
+  {40968, 8, 1, 0, 0}, {46738, 8, 1, 0, 0}, {46746, 6, 1, 0, 0},
+  {46752, 7, 1, 0, 0}, {46759, 7, 1, 0, 0}, {46766, 10, 1, 0, 0},
+  {46776, 3, 1, 0, 0}, {45096, 6, 1, 0, 0}, {46779, 5, 1, 0, 0},
+  {21150, 4, 1, 0, 0}, {44612, 9, 1, 0, 0}, {46784, 4, 1, 0, 0},
+  {46788, 4, 1, 0, 0}, {46792, 4, 1, 0, 0}, {46796, 11, 1, 0, 0},
+  {46807, 7, 1, 0, 0}, {46814, 5, 1, 0, 0}, {46819, 8, 1, 0, 0},
+  {44877, 6, 1, 0, 0}, {46827, 8, 1, 0, 0}, {46835, 6, 1, 0, 0},
+  {46841, 5, 1, 0, 0}, {46846, 5, 1, 0, 0}, {46851, 6, 1, 0, 0},
+  {46857, 8, 1, 0, 0}, {46865, 8, 1, 0, 0}, {41700, 6, 1, 0, 0},
+  {46873, 15, 1, 0, 0}, {46888, 16, 1, 0, 0}, {39251, 5, 1, 0, 0},
+  {42834, 3, 1, 0, 0}, {46904, 5, 1, 0, 0}, {46909, 8, 1, 0, 0},
+  {46917, 9, 1, 0, 0}, {41813, 8, 1, 0, 0}, {46926, 8, 1, 0, 0},
+  {46934, 8, 1, 0, 0}, {44326, 7, 1, 0, 0}, {46942, 9, 1, 0, 0},
+  {46951, 8, 1, 0, 0}, {46959, 4, 1, 0, 0}, {46963, 8, 1, 0, 0},
+  {46971, 9, 1, 0, 0}, {46980, 7, 1, 0, 0}, {46987, 4, 1, 0, 0},
+  {46991, 8, 1, 0, 0}, {46999, 10, 1, 0, 0}, {47009, 6, 1, 0, 0},
+  {39317, 6, 1, 0, 0}, {47015, 9, 1, 0, 0}, {39034, 7, 1, 0, 0},
+  {47024, 8, 1, 0, 0}, {47032, 8, 1, 0, 0}, {47040, 8, 1, 0, 0},
+  {47048, 5, 1, 0, 0}, {47053, 5, 1, 0, 0}, {42916, 5, 1, 0, 0},
+  {47058, 5, 1, 0, 0}, {47063, 7, 1, 0, 0}, {47070, 5, 1, 0, 0},
+  {39790, 5, 1, 0, 0}, {47075, 6, 1, 0, 0}, {47081, 7, 1, 0, 0},
+  {21154, 7, 1, 0, 0}, {47088, 6, 1, 0, 0}, {47094, 5, 1, 0, 0},
+  {46571, 6, 1, 0, 0}, {47099, 5, 1, 0, 0}, {47104, 8, 1, 0, 0},
+  {47112, 4, 1, 0, 0}, {47116, 6, 1, 0, 0}, {47122, 4, 1, 0, 0},
+  {47126, 8, 1, 0, 0}, {47134, 10, 1, 0, 0}, {47144, 12, 1, 0, 0},
+  {47156, 5, 1, 0, 0}, {47161, 6, 1, 0, 0}, {47167, 6, 1, 0, 0},
+  {47173, 6, 1, 0, 0}, {47179, 4, 1, 0, 0}, {47183, 5, 1, 0, 0},
+  {47188, 7, 1, 0, 0}, {47195, 9, 1, 0, 0}, {47204, 7, 1, 0, 0},
+  {1231, 4, 4, 0, 0}, {1231, 4, 4, 0, 0}, {47211, 5, 1, 0, 0},
+  {47216, 4, 1, 0, 0}, {47220, 10, 1, 0, 0}, {47230, 6, 1, 0, 0},
+  {47236, 4, 1, 0, 0}, {39019, 5, 1, 0, 0}, {47240, 5, 1, 0, 0},
+  {47245, 4, 1, 0, 0}, {41172, 7, 1, 0, 0}, {47249, 7, 1, 0, 0},
+  {47256, 8, 1, 0, 0}, {47264, 8, 1, 0, 0}, {47272, 9, 1, 0, 0},
+  {47281, 8, 1, 0, 0}, {47289, 11, 1, 0, 0}, {47300, 4, 1, 0, 0},
+  {47304, 5, 1, 0, 0}, {47309, 5, 1, 0, 0}, {47314, 9, 1, 0, 0},
+  {46635, 9, 1, 0, 0}, {47323, 8, 1, 0, 0}, {47331, 8, 1, 0, 0},
+  {47339, 4, 1, 0, 0}, {47343, 5, 1, 0, 0}, {38886, 3, 1, 0, 0},
+  {47348, 5, 1, 0, 0}, {47353, 6, 1, 0, 0}, {47359, 12, 1, 0, 0},
+  {47371, 6, 1, 0, 0}, {47377, 6, 1, 0, 0}, {47383, 5, 1, 0, 0},
+  {47388, 8, 1, 0, 0}, {47396, 6, 1, 0, 0}, {47402, 6, 1, 0, 0},
+  {39317, 6, 1, 0, 0}, {47408, 12, 1, 0, 0}, {47420, 4, 1, 0, 0},
+  {47424, 10, 1, 0, 0}, {47434, 8, 1, 0, 0}, {21194, 7, 1, 0, 0},
+  {47442, 6, 1, 0, 0}, {47448, 7, 1, 0, 0}, {47455, 5, 1, 0, 0},
+  {42500, 6, 1, 0, 0}, {47460, 6, 1, 0, 0}, {47466, 7, 1, 0, 0},
+  {47473, 4, 1, 0, 0}, {47477, 5, 1, 0, 0}, {47482, 4, 1, 0, 0},
+  {47486, 7, 1, 0, 0}, {47493, 8, 1, 0, 0}, {47501, 10, 1, 0, 0},
+  {47511, 7, 1, 0, 0}, {47518, 7, 1, 0, 0}, {47525, 7, 1, 0, 0},
+  {47532, 9, 1, 0, 0}, {47541, 10, 1, 0, 0}, {47551, 3, 1, 0, 0},
+  {47554, 5, 1, 0, 0}, {47559, 3, 1, 0, 0}, {47562, 9, 1, 0, 0},
+  {47571, 8, 1, 0, 0}, {47579, 7, 1, 0, 0}, {47586, 9, 1, 0, 0},
+  {47595, 6, 1, 0, 0}, {47601, 8, 1, 0, 0}, {47609, 5, 1, 0, 0},
+  {47614, 10, 1, 0, 0}, {47624, 9, 1, 0, 0}, {47633, 9, 1, 0, 0},
+  {40712, 7, 1, 0, 0}, {47642, 9, 1, 0, 0}, {47651, 8, 1, 0, 0},
+  {47659, 6, 1, 0, 0}, {47665, 8, 1, 0, 0}, {47673, 7, 1, 0, 0},
+  {42278, 7, 1, 0, 0}, {47680, 7, 1, 0, 0}, {21201, 8, 1, 0, 0},
+  {47687, 6, 1, 0, 0}, {47693, 5, 1, 0, 0}, {47188, 7, 1, 0, 0},
+  {47698, 8, 1, 0, 0}, {47706, 4, 1, 0, 0}, {47710, 4, 1, 0, 0},
+  {47714, 7, 1, 0, 0}, {47721, 7, 1, 0, 0}, {47728, 10, 1, 0, 0},
+  {47738, 6, 1, 0, 0}, {47744, 10, 1, 0, 0}, {47754, 7, 1, 0, 0},
+  {47761, 7, 1, 0, 0}, {47768, 4, 1, 0, 0}, {47772, 4, 1, 0, 0},
+  {47776, 6, 1, 0, 0}, {47782, 4, 1, 0, 0}, {47786, 12, 1, 0, 0},
+  {47798, 5, 1, 0, 0}, {47803, 9, 1, 0, 0}, {47812, 4, 1, 0, 0},
+  {44550, 5, 1, 0, 0}, {47816, 8, 1, 0, 0}, {47824, 5, 1, 0, 0},
+  {5060, 6, 1, 0, 0}, {47829, 4, 1, 0, 0}, {47833, 10, 1, 0, 0},
+  {47843, 6, 1, 0, 0}, {47849, 10, 1, 0, 0}, {21254, 7, 1, 0, 0},
+  {47859, 5, 1, 0, 0}, {47864, 5, 1, 0, 0}, {47869, 10, 1, 0, 0},
+  {47879, 5, 1, 0, 0}, {47884, 6, 1, 0, 0}, {44841, 4, 1, 0, 0},
+  {47890, 6, 1, 0, 0}, {47896, 5, 1, 0, 0}, {47901, 6, 1, 0, 0},
+  {47907, 12, 1, 0, 0}, {47919, 10, 1, 0, 0}, {47929, 4, 1, 0, 0},
+  {40305, 6, 1, 0, 0}, {39034, 7, 1, 0, 0}, {47933, 4, 1, 0, 0},
+  {40347, 8, 1, 0, 0}, {47937, 6, 1, 0, 0}, {47943, 9, 1, 0, 0},
+  {47952, 9, 1, 0, 0}, {21261, 9, 1, 0, 0}, {47961, 6, 1, 0, 0},
+  {47967, 6, 1, 0, 0}, {47973, 7, 1, 0, 0}, {47980, 8, 1, 0, 0},
+  {47988, 9, 1, 0, 0}, {46807, 7, 1, 0, 0}, {47997, 6, 1, 0, 0},
+  {41099, 7, 1, 0, 0}, {48003, 5, 1, 0, 0}, {39564, 4, 1, 0, 0},
+  {48008, 7, 1, 0, 0}, {41351, 5, 1, 0, 0}, {48015, 5, 1, 0, 0},
+  {48020, 7, 1, 0, 0}, {48027, 8, 1, 0, 0}, {48035, 6, 1, 0, 0},
+  {48041, 13, 1, 0, 0}, {48054, 15, 1, 0, 0}, {48069, 13, 1, 0, 0},
+  {48082, 4, 1, 0, 0}, {48086, 6, 1, 0, 0}, {48092, 8, 1, 0, 0},
+  {48100, 5, 1, 0, 0}, {48105, 8, 1, 0, 0}, {48113, 10, 1, 0, 0},
+  {44156, 4, 1, 0, 0}, {48123, 6, 1, 0, 0}, {48129, 7, 1, 0, 0},
+  {48136, 7, 1, 0, 0}, {48143, 9, 1, 0, 0}, {48152, 5, 1, 0, 0},
+  {47245, 4, 1, 0, 0}, {48157, 10, 1, 0, 0}, {48167, 9, 1, 0, 0},
+  {48176, 7, 1, 0, 0}, {48183, 6, 1, 0, 0}, {46528, 6, 1, 0, 0},
+  {48189, 6, 1, 0, 0}, {48195, 6, 1, 0, 0}, {48201, 15, 1, 0, 0},
+  {48216, 9, 1, 0, 0}, {45069, 6, 1, 0, 0}, {48225, 6, 1, 0, 0},
+  {48231, 9, 1, 0, 0}, {48240, 7, 1, 0, 0}, {48247, 3, 1, 0, 0},
+  {48250, 6, 1, 0, 0}, {41240, 3, 1, 0, 0}, {48256, 8, 1, 0, 0},
+  {48264, 7, 1, 0, 0}, {48271, 9, 1, 0, 0}, {48280, 8, 1, 0, 0},
+  {48288, 8, 1, 0, 0}, {48296, 6, 1, 0, 0}, {48302, 9, 1, 0, 0},
+  {48311, 5, 1, 0, 0}, {48316, 4, 1, 0, 0}, {48320, 7, 1, 0, 0},
+  {48327, 5, 1, 0, 0}, {48082, 4, 1, 0, 0}, {48332, 8, 1, 0, 0},
+  {48340, 4, 1, 0, 0}, {48344, 7, 1, 0, 0}, {48351, 6, 1, 0, 0},
+  {48357, 5, 1, 0, 0}, {44762, 8, 1, 0, 0}, {48362, 11, 1, 0, 0},
+  {21278, 7, 1, 0, 0}, {40142, 6, 1, 0, 0}, {48373, 4, 1, 0, 0},
+  {48377, 6, 1, 0, 0}, {39541, 5, 1, 0, 0}, {41351, 5, 1, 0, 0},
+  {48383, 9, 1, 0, 0}, {48392, 9, 1, 0, 0}, {48401, 4, 1, 0, 0},
+  {48405, 5, 1, 0, 0}, {48410, 5, 1, 0, 0}, {48415, 6, 1, 0, 0},
+  {48421, 8, 1, 0, 0}, {48429, 6, 1, 0, 0}, {48435, 11, 1, 0, 0},
+  {48446, 10, 1, 0, 0}, {48456, 5, 1, 0, 0}, {48461, 6, 1, 0, 0},
+  {48467, 5, 1, 0, 0}, {48472, 5, 1, 0, 0}, {48477, 7, 1, 0, 0},
+  {39845, 8, 1, 0, 0}, {48484, 4, 1, 0, 0}, {48488, 6, 1, 0, 0},
+  {21285, 6, 1, 0, 0}, {48494, 7, 1, 0, 0}, {48501, 4, 1, 0, 0},
+  {40507, 6, 1, 0, 0}, {48505, 5, 1, 0, 0}, {48510, 9, 1, 0, 0},
+  {48519, 4, 1, 0, 0}, {48523, 9, 1, 0, 0}, {41700, 6, 1, 0, 0},
+  {48532, 8, 1, 0, 0}, {48410, 5, 1, 0, 0}, {48540, 5, 1, 0, 0},
+  {47901, 6, 1, 0, 0}, {48545, 9, 1, 0, 0}, {45439, 9, 1, 0, 0},
+  {48554, 6, 1, 0, 0}, {48560, 8, 1, 0, 0}, {48568, 8, 1, 0, 0},
+  {48576, 4, 1, 0, 0}, {48580, 4, 1, 0, 0}, {48584, 8, 1, 0, 0},
+  {48592, 8, 1, 0, 0}, {48600, 9, 1, 0, 0}, {39028, 6, 1, 0, 0},
+  {39317, 6, 1, 0, 0}, {48609, 13, 1, 0, 0}, {40424, 6, 1, 0, 0},
+  {48622, 9, 1, 0, 0}, {48631, 5, 1, 0, 0}, {44271, 6, 1, 0, 0},
+  {21324, 8, 1, 0, 0}, {48636, 5, 1, 0, 0}, {48641, 4, 1, 0, 0},
+  {39541, 5, 1, 0, 0}, {48645, 8, 1, 0, 0}, {48653, 9, 1, 0, 0},
+  {48662, 4, 1, 0, 0}, {43082, 6, 1, 0, 0}, {48666, 10, 1, 0, 0},
+  {40651, 8, 1, 0, 0}, {42610, 9, 1, 0, 0}, {48676, 10, 1, 0, 0},
+  {48686, 6, 1, 0, 0}, {48692, 8, 1, 0, 0}, {48700, 5, 1, 0, 0},
+  {48705, 8, 1, 0, 0}, {48713, 5, 1, 0, 0}, {48718, 9, 1, 0, 0},
+  {48727, 9, 1, 0, 0}, {48736, 2, 1, 0, 0}, {44073, 5, 1, 0, 0},
+  {48738, 6, 1, 0, 0}, {48744, 7, 1, 0, 0}, {48751, 5, 1, 0, 0},
+  {48756, 6, 1, 0, 0}, {48762, 8, 1, 0, 0}, {45527, 6, 1, 0, 0},
+  {48770, 9, 1, 0, 0}, {40443, 6, 1, 0, 0}, {48779, 8, 1, 0, 0},
+  {48787, 5, 1, 0, 0}, {48792, 6, 1, 0, 0}, {48798, 8, 1, 0, 0},
+  {21863, 8, 1, 0, 0}, {48806, 8, 1, 0, 0}, {48814, 8, 1, 0, 0},
+  {48822, 4, 1, 0, 0}, {48826, 3, 1, 0, 0}, {48829, 4, 1, 0, 0},
+  {48833, 6, 1, 0, 0}, {48839, 4, 1, 0, 0}, {48843, 7, 1, 0, 0},
+  {48850, 9, 1, 0, 0}, {48859, 5, 1, 0, 0}, {48864, 6, 1, 0, 0},
+  {48250, 6, 1, 0, 0}, {48870, 11, 1, 0, 0}, {48881, 6, 1, 0, 0},
+  {48887, 6, 1, 0, 0}, {48893, 8, 1, 0, 0}, {5906, 6, 1, 0, 0},
+  {48901, 3, 1, 0, 0}, {48904, 3, 1, 0, 0}, {39564, 4, 1, 0, 0},
+  {48907, 5, 1, 0, 0}, {48912, 7, 1, 0, 0}, {47493, 8, 1, 0, 0},
+  {48919, 15, 1, 0, 0}, {48934, 11, 1, 0, 0}, {48945, 8, 1, 0, 0},
+  {41742, 6, 1, 0, 0}, {48953, 14, 1, 0, 0}, {48967, 3, 1, 0, 0},
+  {48970, 4, 1, 0, 0}, {48974, 5, 1, 0, 0}, {48979, 6, 1, 0, 0},
+  {48985, 11, 1, 0, 0}, {48996, 6, 1, 0, 0}, {49002, 9, 1, 0, 0},
+  {48357, 5, 1, 0, 0}, {49011, 8, 1, 0, 0}, {49019, 8, 1, 0, 0},
+  {49027, 12, 1, 0, 0}, {49039, 6, 1, 0, 0}, {43915, 6, 1, 0, 0},
+  {40786, 5, 1, 0, 0}, {49045, 8, 1, 0, 0}, {49053, 5, 1, 0, 0},
+  {49058, 8, 1, 0, 0}, {49066, 10, 1, 0, 0}, {21880, 9, 1, 0, 0},
+  {1231, 4, 4, 0, 0}, {8527, 8, 9, 0, 0}, {49076, 5, 9, 0, 0},
+  {1717, 3, 9, 0, 0}, {49081, 5, 9, 0, 0}, {49086, 9, 9, 0, 0},
+  {5370, 4, 9, 0, 0}, {8527, 8, 9, 0, 0}, {49095, 6, 9, 0, 0},
+  {49095, 6, 9, 0, 0}, {4680, 4, 0, 1, 9610}, {9628, 1, 9, 0, 0},
+  {9629, 1, 9, 0, 0}, {49101, 9, 9, 0, 0}, {49110, 8, 9, 0, 0},
+  {49118, 7, 9, 0, 0}, {49125, 10, 9, 0, 0}, {49135, 7, 9, 0, 0},
+  {9659, 1, 9, 0, 0}, {9662, 1, 9, 0, 0}, {49142, 7, 9, 0, 0},
+  {49149, 8, 9, 0, 0}, {49157, 8, 9, 0, 0}, {49165, 8, 9, 0, 0},
+  {49173, 8, 9, 0, 0}, {49181, 7, 9, 0, 0}, {3764, 3, 9, 0, 0},
+  {4680, 4, 0, 2, 9611}, {49188, 3, 0, 3, 9613}, {3764, 3, 9, 0, 0},
+  {38632, 4, 0, 6, 9616}, {2883, 7, 18, 0, 0}, {49191, 7, 18, 0, 0},
+  {10768, 8, 9, 0, 0}, {49198, 12, 9, 0, 0}, {9651, 1, 9, 0, 0},
+  {15666, 3, 9, 0, 0}, {15833, 4, 9, 0, 0}, {38529, 4, 9, 0, 0},
+  {15592, 5, 9, 0, 0}, {10768, 8, 9, 0, 0}, {10768, 8, 0, 3, 9622},
+  {5557, 7, 9, 0, 0}, {6321, 7, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0}, {49210, 3, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {49210, 3, 1, 0, 0}, {2652, 2, 1, 0, 0},
+  {49213, 2, 1, 0, 0}, {49215, 5, 1, 0, 0}, {49220, 12, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0}, {49213, 2, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {49232, 5, 1, 0, 0}, {49237, 5, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0}, {781, 2, 1, 0, 0},
+  {49232, 5, 1, 0, 0}, {49242, 9, 1, 0, 0}, {49251, 12, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {49215, 5, 1, 0, 0}, {2652, 2, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0}, {781, 2, 1, 0, 0},
+  {49242, 9, 1, 0, 0}, {2652, 2, 1, 0, 0}, {2652, 2, 1, 0, 0},
+  {2652, 2, 1, 0, 0}, {49237, 5, 1, 0, 0}, {2652, 2, 1, 0, 0},
+  {49237, 5, 1, 0, 0}, {49251, 12, 1, 0, 0}, {49220, 12, 1, 0, 0},
+  {8527, 8, 9, 0, 0}, {49263, 7, 9, 0, 0}, {49270, 4, 9, 0, 0},
+  {9644, 1, 9, 0, 0}, {49274, 3, 9, 0, 0}, {49277, 6, 0, 1, 9625},
+  {10703, 2, 9, 0, 0}, {49283, 4, 9, 0, 0}, {176, 2, 9, 0, 0},
+  {10696, 4, 9, 0, 0}, {404, 2, 9, 0, 0}, {421, 2, 9, 0, 0}, {630, 2, 9, 0, 0},
+  {676, 2, 9, 0, 0}, {947, 2, 9, 0, 0}, {1105, 2, 9, 0, 0}, {1130, 2, 9, 0, 0},
+  {1306, 2, 9, 0, 0}, {1582, 2, 9, 0, 0}, {1593, 2, 9, 0, 0},
+  {1638, 2, 9, 0, 0}, {1782, 2, 9, 0, 0}, {1880, 3, 9, 0, 0},
+  {1892, 2, 9, 0, 0}, {1971, 2, 9, 0, 0}, {2135, 2, 9, 0, 0},
+  {2322, 2, 9, 0, 0}, {2606, 2, 9, 0, 0}, {2921, 2, 9, 0, 0},
+  {2929, 2, 9, 0, 0}, {2964, 2, 9, 0, 0}, {2978, 2, 9, 0, 0},
+  {3006, 2, 9, 0, 0}, {3063, 3, 9, 0, 0}, {3115, 2, 9, 0, 0},
+  {3135, 2, 9, 0, 0}, {3207, 2, 9, 0, 0}, {3359, 2, 9, 0, 0},
+  {3684, 2, 9, 0, 0}, {3693, 2, 9, 0, 0}, {3713, 2, 9, 0, 0},
+  {3823, 2, 9, 0, 0}, {3835, 2, 9, 0, 0}, {3927, 2, 9, 0, 0},
+  {4041, 2, 9, 0, 0}, {4074, 2, 9, 0, 0}, {4113, 3, 9, 0, 0},
+  {4175, 2, 9, 0, 0}, {4215, 2, 9, 0, 0}, {4217, 2, 9, 0, 0},
+  {4280, 2, 9, 0, 0}, {4429, 5, 9, 0, 0}, {4586, 2, 9, 0, 0},
+  {4758, 2, 9, 0, 0}, {49287, 3, 9, 0, 0}, {4981, 2, 9, 0, 0},
+  {5015, 2, 9, 0, 0}, {5213, 2, 9, 0, 0}, {5353, 2, 9, 0, 0},
+  {5376, 2, 9, 0, 0}, {5916, 2, 9, 0, 0}, {6032, 2, 9, 0, 0},
+  {6059, 2, 9, 0, 0}, {1288, 5, 9, 0, 0}, {49213, 2, 0, 1, 9626},
+  {15610, 3, 0, 1, 9627}, {38057, 2, 9, 0, 0}, {17344, 2, 1, 0, 0},
+  {49290, 4, 1, 0, 0}, {49294, 2, 1, 0, 0}, {3115, 2, 1, 0, 0},
+  {49296, 5, 1, 0, 0}, {49301, 8, 1, 0, 0}, {49309, 5, 1, 0, 0},
+  {49314, 3, 1, 0, 0}, {49317, 5, 1, 0, 0}, {49322, 3, 1, 0, 0},
+  {4070, 2, 1, 0, 0}, {49325, 4, 1, 0, 0}, {49329, 3, 1, 0, 0},
+  {4414, 2, 1, 0, 0}, {49332, 4, 1, 0, 0}, {49336, 3, 1, 0, 0},
+  {18768, 2, 1, 0, 0}, {49339, 3, 1, 0, 0}, {49342, 4, 1, 0, 0},
+  {49346, 3, 1, 0, 0}, {49349, 4, 1, 0, 0}, {5040, 2, 1, 0, 0},
+  {49353, 3, 1, 0, 0}, {49356, 3, 1, 0, 0}, {5418, 2, 1, 0, 0},
+  {5494, 2, 1, 0, 0}, {49359, 9, 1, 0, 0}, {6030, 2, 1, 0, 0},
+  {49368, 4, 1, 0, 0}, {49372, 2, 1, 0, 0}, {49374, 4, 1, 0, 0},
+  {49378, 4, 1, 0, 0}, {49382, 4, 1, 0, 0}, {6059, 2, 1, 0, 0},
+  {49386, 2, 1, 0, 0}, {49388, 3, 1, 0, 0}, {49391, 3, 1, 0, 0},
+  {49394, 4, 1, 0, 0}, {49398, 4, 1, 0, 0}, {49402, 4, 1, 0, 0},
+  {49406, 4, 1, 0, 0}, {49410, 3, 1, 0, 0}, {49413, 3, 1, 0, 0},
+  {49416, 4, 1, 0, 0}, {49420, 4, 1, 0, 0}, {49424, 6, 1, 0, 0},
+  {37155, 2, 1, 0, 0}, {49430, 3, 9, 0, 0}, {5323, 4, 9, 0, 0},
+  {10950, 2, 9, 0, 0}, {49433, 3, 9, 0, 0}, {2883, 7, 18, 0, 0},
+  {49436, 7, 18, 0, 0}, {49443, 8, 18, 0, 0}, {49433, 3, 18, 0, 0},
+  {10768, 8, 9, 0, 0}, {33930, 7, 9, 0, 0}, {5591, 2, 9, 0, 0},
+  {10567, 2, 9, 0, 0}, {49451, 3, 9, 0, 0}, {1992, 2, 9, 0, 0},
+  {6059, 2, 9, 0, 0}, {1742, 6, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {2599, 3, 1, 0, 0}, {49454, 8, 9, 0, 0}, {49462, 5, 9, 0, 0},
+  {9639, 5, 9, 0, 0}, {11332, 11, 9, 0, 0}, {8527, 8, 9, 0, 0},
+  {49467, 8, 0, 2, 9628}, {49475, 10, 0, 1, 9630}, {9512, 12, 9, 0, 0},
+  {49485, 7, 9, 0, 0}, {9740, 5, 9, 0, 0}, {49492, 9, 0, 1, 9631},
+  {15742, 13, 9, 0, 0}, {38752, 3, 9, 0, 0}, {49501, 8, 9, 0, 0},
+  {49509, 10, 9, 0, 0}, {33930, 7, 9, 0, 0}, {49519, 15, 9, 0, 0},
+  {49534, 4, 9, 0, 0}, {49538, 3, 9, 0, 0}, {49541, 4, 9, 0, 0},
+  {49545, 11, 9, 0, 0}, {49556, 13, 9, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 9, 0, 0}, {49569, 3, 9, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 3, 9632}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {49572, 9, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {49581, 3, 1, 0, 0}, {49584, 3, 1, 0, 0},
+  {49587, 5, 1, 0, 0}, {16463, 3, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {10334, 3, 1, 0, 0}, {10500, 3, 1, 0, 0},
+  {49592, 9, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0},
+  {1103, 2, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {15678, 3, 1, 0, 0},
+  {15690, 3, 1, 0, 0}, {1103, 2, 1, 0, 0}, {1103, 2, 1, 0, 0},
+  {15678, 3, 1, 0, 0}, {15690, 3, 1, 0, 0}, {8527, 8, 9, 0, 0},
+  {9645, 1, 9, 0, 0}, {8527, 8, 9, 0, 0}, {49601, 3, 9, 0, 0},
+  {49604, 7, 1, 0, 0}, {49611, 5, 0, 1, 9635}, {49616, 4, 9, 0, 0},
+  {49620, 3, 0, 1, 9636}, {49623, 8, 9, 0, 0}, {49631, 8, 9, 0, 0},
+  {49639, 8, 9, 0, 0}, {49647, 3, 9, 1, 9637}, {37828, 3, 9, 1, 9638},
+  {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0}, {49660, 3, 9, 0, 0},
+  {9534, 4, 9, 0, 0}, {4760, 3, 9, 0, 0}, {37828, 3, 9, 1, 9639},
+  {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0}, {49660, 3, 9, 0, 0},
+  {37828, 3, 9, 1, 9640}, {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0},
+  {49663, 10, 0, 1, 9641}, {15714, 7, 18, 0, 0}, {49673, 2, 0, 2, 9642},
+  {37985, 3, 18, 0, 0}, {49675, 6, 0, 2, 9644}, {49675, 6, 0, 2, 9646},
+  {49675, 6, 0, 2, 9648}, {49681, 9, 0, 1, 9650}, {49675, 6, 0, 2, 9651},
+  {49681, 9, 0, 1, 9653}, {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0},
+  {49675, 6, 0, 2, 9654}, {49675, 6, 0, 2, 9656}, {49681, 9, 0, 1, 9658},
+  {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0}, {49675, 6, 0, 2, 9659},
+  {49681, 9, 0, 1, 9661}, {49675, 6, 0, 2, 9662}, {49681, 9, 0, 1, 9664},
+  {49675, 6, 0, 2, 9665}, {49681, 9, 0, 1, 9667}, {38057, 2, 9, 0, 0},
+  {49650, 10, 9, 0, 0}, {49675, 6, 0, 2, 9668}, {49681, 9, 0, 1, 9670},
+  {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0}, {49675, 6, 0, 2, 9671},
+  {49675, 6, 0, 2, 9673}, {49675, 6, 0, 2, 9675}, {49681, 9, 0, 1, 9677},
+  {49675, 6, 0, 2, 9678}, {49681, 9, 0, 1, 9680}, {38057, 2, 9, 0, 0},
+  {49650, 10, 9, 0, 0}, {49675, 6, 0, 2, 9681}, {49681, 9, 0, 1, 9683},
+  {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0}, {49675, 6, 0, 2, 9684},
+  {49675, 6, 0, 2, 9686}, {49681, 9, 0, 1, 9688}, {49675, 6, 0, 2, 9689},
+  {49681, 9, 0, 1, 9691}, {49675, 6, 0, 2, 9692}, {49681, 9, 0, 1, 9694},
+  {38057, 2, 9, 0, 0}, {49650, 10, 9, 0, 0}, {49675, 6, 0, 2, 9695},
+  {49675, 6, 0, 2, 9697}, {9651, 1, 9, 0, 0}, {49690, 3, 9, 0, 0},
+  {49693, 3, 9, 0, 0}, {15592, 5, 9, 0, 0}, {49696, 4, 9, 0, 0},
+  {14218, 7, 9, 0, 0}, {49696, 4, 9, 0, 0}, {14218, 7, 9, 0, 0},
+  {49696, 4, 9, 0, 0}, {49696, 4, 9, 0, 0}, {14218, 7, 9, 0, 0},
+  {10768, 8, 0, 1, 9699}, {15833, 4, 9, 0, 0}, {49700, 3, 9, 0, 0},
+  {9637, 1, 9, 0, 0}, {2518, 6, 9, 0, 0}, {9637, 1, 9, 0, 0},
+  {9638, 1, 9, 0, 0}, {2518, 6, 9, 0, 0}, {49703, 4, 9, 0, 0},
+  {49707, 5, 9, 0, 0}, {49712, 5, 9, 0, 0}, {49717, 4, 9, 0, 0},
+  {49721, 4, 9, 0, 0}, {49725, 4, 9, 0, 0}, {49729, 3, 9, 0, 0},
+  {49732, 3, 9, 0, 0}, {49735, 3, 9, 0, 0}, {49188, 3, 9, 0, 0},
+  {333, 3, 9, 0, 0}, {49213, 2, 0, 1, 9700}, {49738, 2, 9, 0, 0},
+  {49740, 2, 9, 0, 0}, {9651, 1, 9, 0, 0}, {49696, 4, 9, 0, 0},
+  {49742, 4, 1, 0, 0}, {49746, 6, 1, 0, 0}, {16073, 3, 1, 0, 0},
+  {49752, 5, 9, 0, 0}, {37810, 3, 9, 0, 0}, {49757, 9, 9, 0, 0},
+  {49766, 5, 9, 0, 0}, {49766, 5, 9, 0, 0}, {49766, 5, 9, 0, 0},
+  {38057, 2, 9, 0, 0}, {49663, 10, 9, 0, 0}, {49771, 14, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {49785, 3, 9, 0, 0},
+  {49788, 14, 9, 0, 0}, {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0},
+  {38057, 2, 9, 0, 0}, {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0},
+  {38057, 2, 9, 0, 0}, {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {49785, 3, 9, 0, 0},
+  {49788, 14, 9, 0, 0}, {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0},
+  {38057, 2, 9, 0, 0}, {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0},
+  {38057, 2, 9, 0, 0}, {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0},
+  {38057, 2, 9, 0, 0}, {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {38057, 2, 9, 0, 0},
+  {49785, 3, 9, 0, 0}, {49788, 14, 9, 0, 0}, {49785, 3, 9, 0, 0},
+  {49788, 14, 9, 0, 0}, {1288, 5, 9, 0, 0}, {333, 3, 9, 0, 0},
+};
+
+const size_t kNodeCount = 9701;
+
+}  // namespace public_suffix
+}  // namespace whatwgurl
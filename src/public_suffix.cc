@@ -0,0 +1,133 @@
+#include "public_suffix.h"
+#include <string.h>
+#include <algorithm>
+
+namespace whatwgurl {
+
+using public_suffix::kException;
+using public_suffix::kLabels;
+using public_suffix::kNodes;
+using public_suffix::kPrivateException;
+using public_suffix::kPrivateRule;
+using public_suffix::kPrivateWildcard;
+using public_suffix::kRule;
+using public_suffix::kWildcard;
+using public_suffix::Node;
+
+namespace {
+
+const Node* FindChild(const Node* node, const char* label, size_t length) {
+  const Node* low = kNodes + node->first_child;
+  const Node* high = low + node->child_count;
+  while (low < high) {
+    const Node* middle = low + (high - low) / 2;
+    size_t middle_length = middle->label_length;
+    int result = memcmp(kLabels + middle->label,
+                        label,
+                        std::min<size_t>(middle_length, length));
+    if (result == 0) {
+      result = (middle_length > length) - (middle_length < length);
+    }
+
+    if (result == 0) return middle;
+    if (result < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return nullptr;
+}
+
+// Whether `node` has a rule of the kind `flag` that applies.
+inline bool HasRule(const Node* node,
+                    uint8_t flag,
+                    uint8_t private_flag,
+                    bool icann_only) {
+  return (node->flags & flag) != 0 &&
+         !(icann_only && (node->flags & private_flag) != 0);
+}
+
+// The start of the public suffix of `[begin, end)`, a domain without its
+// trailing dot, by the Public Suffix List's algorithm: the longest rule that
+// matches, unless an exception does, and "*" if none does.
+const char* FindPublicSuffix(const char* begin,
+                             const char* end,
+                             bool icann_only) {
+  const Node* node = kNodes;
+  const char* label_end = end;
+  const char* suffix = nullptr;
+  while (true) {
+    const char* label_start = label_end;
+    while (label_start > begin && label_start[-1] != '.') label_start--;
+    if (suffix == nullptr) suffix = label_start;
+
+    const Node* child = FindChild(node, label_start, label_end - label_start);
+
+    // The exception is a rule of its own, minus its leftmost label, and wins.
+    if (child != nullptr &&
+        HasRule(child, kException, kPrivateException, icann_only)) {
+      return label_end + 1;
+    }
+
+    if (HasRule(node, kWildcard, kPrivateWildcard, icann_only)) {
+      suffix = label_start;
+    }
+    if (child == nullptr) break;
+    if (HasRule(child, kRule, kPrivateRule, icann_only)) suffix = label_start;
+
+    if (label_start == begin) break;
+    node = child;
+    label_end = label_start - 1;
+  }
+
+  return suffix;
+}
+
+}  // namespace
+
+bool PublicSuffix(const StringView& domain,
+                  StringView* suffix,
+                  bool icann_only) {
+  // A trailing dot is set aside for the lookup, and kept in the result.
+  const char* begin = domain.begin();
+  const char* end = domain.end();
+  if (end > begin && end[-1] == '.') end--;
+
+  const char* start = FindPublicSuffix(begin, end, icann_only);
+  *suffix = StringView(start, domain.end() - start);
+  return true;
+}
+
+bool RegistrableDomain(const StringView& domain,
+                       StringView* registrable_domain,
+                       bool icann_only) {
+  StringView suffix;
+  PublicSuffix(domain, &suffix, icann_only);
+
+  // If host’s public suffix is host, then return null. Otherwise it is the
+  // public suffix with the label to its left.
+  const char* begin = domain.begin();
+  const char* start = suffix.begin();
+  if (start == begin) return false;
+  start--;
+  while (start > begin && start[-1] != '.') start--;
+
+  *registrable_domain = StringView(start, domain.end() - start);
+  return true;
+}
+
+bool PublicSuffix(const HostItem& host, StringView* suffix, bool icann_only) {
+  // If host is not a domain, then return null.
+  if (host.type != kDomain) return false;
+  return PublicSuffix(StringView(host.host.domain), suffix, icann_only);
+}
+
+bool RegistrableDomain(const HostItem& host,
+                       StringView* domain,
+                       bool icann_only) {
+  if (host.type != kDomain) return false;
+  return RegistrableDomain(StringView(host.host.domain), domain, icann_only);
+}
+
+}  // namespace whatwgurl
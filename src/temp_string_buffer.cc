@@ -5,8 +5,9 @@ namespace whatwgurl {
 
 #define MAX_STEP (1024)
 
-TempStringBuffer::TempStringBuffer(size_t init_max_len)
-    : _buffer(init_max_len + 1) {
+TempStringBuffer::TempStringBuffer(size_t init_max_len) {
+  _buffer.set_allocation_site(kTempStringBufferAllocation);
+  _buffer.Realloc(init_max_len + 1);
   _buffer.buffer()[0] = 0;
   _length = 0;
 }
@@ -17,6 +18,7 @@ void TempStringBuffer::Append(char c) {
     size_t new_length =
         std::min(released.length << 1, released.length + MAX_STEP);
     _buffer.Realloc(new_length);
+    RecordRegrowth(kTempStringBufferAllocation);
     memcpy(_buffer.buffer(), released.buffer, released.length);
     released.Free();
   }
@@ -31,6 +33,7 @@ void TempStringBuffer::Append(const std::string& str) {
         std::max(std::min(released.length << 1, released.length + MAX_STEP),
                  _length + str.length() + 1);
     _buffer.Realloc(new_length);
+    RecordRegrowth(kTempStringBufferAllocation);
     memcpy(_buffer.buffer(), released.buffer, released.length);
     released.Free();
   }
@@ -46,6 +49,7 @@ void TempStringBuffer::Append(const char* str, size_t len) {
         std::max(std::min(released.length << 1, released.length + MAX_STEP),
                  _length + len + 1);
     _buffer.Realloc(new_length);
+    RecordRegrowth(kTempStringBufferAllocation);
     memcpy(_buffer.buffer(), released.buffer, released.length);
     released.Free();
   }
@@ -60,6 +64,7 @@ void TempStringBuffer::Prepend(char c) {
     size_t new_length =
         std::min(released.length << 1, released.length + MAX_STEP);
     _buffer.Realloc(new_length);
+    RecordRegrowth(kTempStringBufferAllocation);
 
     unsigned char* buffer = _buffer.buffer();
     memcpy(buffer + 1, released.buffer, released.length);
@@ -81,6 +86,7 @@ void TempStringBuffer::Prepend(const std::string& str) {
         std::max(std::min(released.length << 1, released.length + MAX_STEP),
                  _length + str.length() + 1);
     _buffer.Realloc(new_length);
+    RecordRegrowth(kTempStringBufferAllocation);
     unsigned char* buffer = _buffer.buffer();
     memcpy(buffer + str.length(), released.buffer, released.length);
     memcpy(buffer, str.c_str(), str.length());
@@ -101,6 +107,7 @@ void TempStringBuffer::Prepend(const char* str, size_t len) {
         std::max(std::min(released.length << 1, released.length + MAX_STEP),
                  _length + len + 1);
     _buffer.Realloc(new_length);
+    RecordRegrowth(kTempStringBufferAllocation);
     unsigned char* buffer = _buffer.buffer();
     memcpy(buffer + len, released.buffer, released.length);
     memcpy(buffer, str, len);
@@ -0,0 +1,95 @@
+#ifndef SRC_THREAD_COUNTERS_INL_H_
+#define SRC_THREAD_COUNTERS_INL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <mutex>  // NOLINT(build/c++11)
+#include <unordered_set>
+
+namespace whatwgurl {
+
+// `N` counters that every thread bumps on its own, summed on demand.
+//
+// Only the owning thread writes its counters, so they are bumped with a
+// relaxed load and store instead of a read-modify-write and never contend;
+// the atomics are there for `Sum()` reading them from another thread. `Tag`
+// tells apart instantiations with the same `N`.
+template <typename Tag, size_t N>
+class ThreadCounters {
+ public:
+  static inline void Add(size_t index, uint64_t value) {
+    std::atomic<uint64_t>& counter = Current()->_counters[index];
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+                  std::memory_order_relaxed);
+  }
+
+  // Stores into `out` what every thread counted since the last `Reset()`.
+  static void Sum(uint64_t out[N]) {
+    Registry* registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    SumLocked(*registry, out);
+    for (size_t i = 0; i < N; i++) out[i] -= registry->baseline[i];
+  }
+
+  static void Reset() {
+    Registry* registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    SumLocked(*registry, registry->baseline);
+  }
+
+  ThreadCounters(const ThreadCounters&) = delete;
+  ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+ private:
+  // Threads that are counting, plus what the threads that are gone counted.
+  struct Registry {
+    std::mutex mutex;
+    std::unordered_set<ThreadCounters*> threads;
+    uint64_t exited[N] = {};
+    uint64_t baseline[N] = {};
+  };
+
+  ThreadCounters() {
+    for (size_t i = 0; i < N; i++) _counters[i] = 0;
+
+    Registry* registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    registry->threads.insert(this);
+  }
+
+  ~ThreadCounters() {
+    Registry* registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    for (size_t i = 0; i < N; i++) {
+      registry->exited[i] += _counters[i].load(std::memory_order_relaxed);
+    }
+    registry->threads.erase(this);
+  }
+
+  static Registry* GetRegistry() {
+    // Leaked on purpose: threads may still exit after static destructors ran.
+    static Registry* registry = new Registry();
+    return registry;
+  }
+
+  static ThreadCounters* Current() {
+    static thread_local ThreadCounters counters;
+    return &counters;
+  }
+
+  static void SumLocked(const Registry& registry, uint64_t out[N]) {
+    for (size_t i = 0; i < N; i++) out[i] = registry.exited[i];
+    for (const ThreadCounters* thread : registry.threads) {
+      for (size_t i = 0; i < N; i++) {
+        out[i] += thread->_counters[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  std::atomic<uint64_t> _counters[N];
+};
+
+}  // namespace whatwgurl
+
+#endif  // SRC_THREAD_COUNTERS_INL_H_
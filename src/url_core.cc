@@ -1,4 +1,5 @@
 #include "url_core.h"
+#include "href_writer.h"
 #include "parse.h"
 #include "percent_encode.h"
 #include "scheme.h"
@@ -7,45 +8,72 @@
 namespace whatwgurl {
 
 void InitEnvironment(const InitParams& params) {
-  InitSchemePorts();
-  kIDNAToASCII = params.idna_to_ascii;
+  SetIDNAToASCIIFunction(params.idna_to_ascii);
 }
 
 void CleanEnvironment() {
-  kSchemePorts.clear();
-  kIDNAToASCII = nullptr;
+  SetIDNAToASCIIFunction(nullptr);
 }
 
 using std::make_shared;
 using std::shared_ptr;
 using std::string;
 
-URLCore::URLCore(const string& url) {
-  _failed = !Parse(url, nullptr, &_parsed_url, &_validation_error);
+constexpr uint32_t URLComponents::kOmittedComponent;
+
+URLCore::URLCore(const string& url, ParserContext* context)
+    : _context(context) {
+  _failed = !Parse(
+      url, nullptr, &_parsed_url, &_validation_error, kNotGiven, _context);
 }
 
-URLCore::URLCore(const string& url, const string& base) {
+URLCore::URLCore(const string& url,
+                 const string& base,
+                 ParserContext* context)
+    : _context(context) {
   shared_ptr<ParsedURL> base_url;
-  _failed = !Parse(base, nullptr, &base_url, &_validation_error);
+  _failed = !Parse(
+      base, nullptr, &base_url, &_validation_error, kNotGiven, _context);
   if (_failed) return;
 
-  _failed = !Parse(url, base_url.get(), &_parsed_url, &_validation_error);
+  _failed = !Parse(url,
+                   base_url.get(),
+                   &_parsed_url,
+                   &_validation_error,
+                   kNotGiven,
+                   _context);
 }
 
-URLCore::URLCore(const string& url, const URLCore& base) {
+URLCore::URLCore(const string& url,
+                 const URLCore& base,
+                 ParserContext* context)
+    : _context(context) {
   if (base.failed()) {
     _failed = true;
     return;
   }
 
-  _failed =
-      !Parse(url, base._parsed_url.get(), &_parsed_url, &_validation_error);
+  _failed = !Parse(url,
+                   base._parsed_url.get(),
+                   &_parsed_url,
+                   &_validation_error,
+                   kNotGiven,
+                   _context);
 }
 
-URLCore::URLCore(const string& url, const ParsedURL& base) {
-  _failed = !Parse(url, &base, &_parsed_url, &_validation_error);
+URLCore::URLCore(const string& url,
+                 const ParsedURL& base,
+                 ParserContext* context)
+    : _context(context) {
+  _failed = !Parse(
+      url, &base, &_parsed_url, &_validation_error, kNotGiven, _context);
 }
 
+URLCore::URLCore(shared_ptr<ParsedURL> parsed_url, ParserContext* context)
+    : _parsed_url(parsed_url),
+      _context(context),
+      _failed(!parsed_url.get()) {}
+
 URLCore::~URLCore() {
   _parsed_url.reset();
 
@@ -55,6 +83,47 @@ URLCore::~URLCore() {
   }
 }
 
+bool URLCore::CanParse(const string& url, ParserContext* context) {
+  return HrefLength(url, nullptr, context);
+}
+
+bool URLCore::CanParse(const string& url,
+                       const string& base,
+                       ParserContext* context) {
+  return HrefLength(url, base, nullptr, context);
+}
+
+bool URLCore::CanParse(const string& url,
+                       const URLCore& base,
+                       ParserContext* context) {
+  if (base.failed()) return false;
+
+  bool validation_error;
+  return Validate(
+      url, base._parsed_url.get(), nullptr, &validation_error, context);
+}
+
+bool URLCore::HrefLength(const string& url,
+                         size_t* length,
+                         ParserContext* context) {
+  bool validation_error;
+  return Validate(url, nullptr, length, &validation_error, context);
+}
+
+bool URLCore::HrefLength(const string& url,
+                         const string& base,
+                         size_t* length,
+                         ParserContext* context) {
+  // The base is needed in full: relative URLs copy its components.
+  shared_ptr<ParsedURL> base_url;
+  bool validation_error;
+  if (!Parse(base, nullptr, &base_url, &validation_error, kNotGiven, context)) {
+    return false;
+  }
+
+  return Validate(url, base_url.get(), length, &validation_error, context);
+}
+
 bool URLCore::set_href(const string& url) {
   CHECK(!_failed);
 
@@ -62,7 +131,8 @@ bool URLCore::set_href(const string& url) {
   // value.
   shared_ptr<ParsedURL> parsed_url;
   bool validation_error;
-  bool failed = !Parse(url, nullptr, &parsed_url, &validation_error);
+  bool failed = !Parse(
+      url, nullptr, &parsed_url, &validation_error, kNotGiven, _context);
 
   // If parsedURL is failure, then throw a TypeError.
   if (failed) {
@@ -106,7 +176,8 @@ bool URLCore::set_protocol(const string& protocol) {
                nullptr,
                &_parsed_url,
                &_validation_error,
-               kSchemeStartState);
+               kSchemeStartState,
+               _context);
 }
 
 #define V(name)                                                                \
@@ -157,7 +228,8 @@ bool URLCore::set_host(const string& host) {
 
   // Basic URL parse the given value with this’s URL as url and host state as
   // state override.
-  return Parse(host, nullptr, &_parsed_url, &_validation_error, kHostState);
+  return Parse(
+      host, nullptr, &_parsed_url, &_validation_error, kHostState, _context);
 }
 
 string URLCore::hostname() const {
@@ -179,8 +251,12 @@ bool URLCore::set_hostname(const string& hostname) {
 
   // Basic URL parse the given value with this’s URL as url and hostname state
   // as state override.
-  return Parse(
-      hostname, nullptr, &_parsed_url, &_validation_error, kHostNameState);
+  return Parse(hostname,
+               nullptr,
+               &_parsed_url,
+               &_validation_error,
+               kHostNameState,
+               _context);
 }
 
 string URLCore::port() const {
@@ -208,7 +284,8 @@ bool URLCore::set_port(const string& port) {
 
   // Otherwise, basic URL parse the given value with this’s URL as url and port
   // state as state override.
-  return Parse(port, nullptr, &_parsed_url, &_validation_error, kPortState);
+  return Parse(
+      port, nullptr, &_parsed_url, &_validation_error, kPortState, _context);
 }
 
 bool URLCore::set_pathname(const string& pathname) {
@@ -223,8 +300,12 @@ bool URLCore::set_pathname(const string& pathname) {
 
   // Basic URL parse the given value with this’s URL as url and path start state
   // as state override.
-  return Parse(
-      pathname, nullptr, &_parsed_url, &_validation_error, kPathStartState);
+  return Parse(pathname,
+               nullptr,
+               &_parsed_url,
+               &_validation_error,
+               kPathStartState,
+               _context);
 }
 
 string URLCore::search() const {
@@ -273,7 +354,12 @@ bool URLCore::set_search(const string& search) {
   url->query = "";
 
   // Basic URL parse input with url as url and query state as state override.
-  if (!Parse(input, nullptr, &_parsed_url, &_validation_error, kQueryState)) {
+  if (!Parse(input,
+             nullptr,
+             &_parsed_url,
+             &_validation_error,
+             kQueryState,
+             _context)) {
     return false;
   }
 
@@ -344,8 +430,12 @@ bool URLCore::set_hash(const string& hash) {
 
   // Basic URL parse input with this’s URL as url and fragment state as state
   // override.
-  return Parse(
-      input, nullptr, &_parsed_url, &_validation_error, kFragmentState);
+  return Parse(input,
+               nullptr,
+               &_parsed_url,
+               &_validation_error,
+               kFragmentState,
+               _context);
 }
 
 // The origin of a URL url is the origin returned by running these steps,
@@ -377,17 +467,11 @@ void URLCore::GetOriginObject(TupleOrigin* origin) const {
   if (_parsed_url->IsSpecial()) {
     // Return the tuple origin (url’s scheme, url’s host, url’s port, null).
     CHECK(!_parsed_url->host.is_null());
-    TupleOriginItem item;
-    item.scheme = _parsed_url->scheme;
-    item.host = _parsed_url->host.value();
-    item.port = _parsed_url->port;
-    if (item.host.type == kDomain) {
-      item.domain = item.host.domain();
-    } else {
-      item.domain = nullptr;
-    }
-
-    origin->SetValue(item);
+    TupleOriginItem* item = origin->SetTuple();
+    item->scheme = _parsed_url->scheme;
+    item->host = _parsed_url->host.value();
+    item->port = _parsed_url->port;
+    item->domain = nullptr;
     return;
   }
 
@@ -396,76 +480,185 @@ void URLCore::GetOriginObject(TupleOrigin* origin) const {
   return;
 }
 
+string URLCore::Serialize(bool exclude_fragment,
+                          URLComponents* components) const {
+  string output;
+  StringWriter writer(&output);
+  Write(&writer,
+        exclude_fragment ? kHashAllParts & ~kHashFragment : kHashAllParts,
+        components);
+  return output;
+}
+
+bool URLCore::Equals(const URLCore& other, bool exclude_fragment) const {
+  if (failed() || other.failed()) return failed() == other.failed();
+  if (_parsed_url == other._parsed_url) return true;
+  return _parsed_url->Equals(*other._parsed_url, exclude_fragment);
+}
+
+int URLCore::Compare(const URLCore& other, bool exclude_fragment) const {
+  if (failed() || other.failed()) return other.failed() - failed();
+  if (_parsed_url == other._parsed_url) return 0;
+  return _parsed_url->Compare(*other._parsed_url, exclude_fragment);
+}
+
+void URLCore::SerializeInto(const ParsedURL& url,
+                            string* href,
+                            URLComponents* components) {
+  href->clear();
+  StringWriter writer(href);
+  WriteURL(url, &writer, kHashAllParts, components);
+}
+
+uint64_t URLCore::Hash(unsigned parts, uint64_t seed) const {
+  HashWriter writer(seed);
+  Write(&writer, parts);
+  return writer.Digest();
+}
+
 // The URL serializer takes a URL url, with an optional boolean exclude fragment
 // (default false), and then runs these steps. They return an ASCII string.
-string URLCore::Serialize(bool exclude_fragment) const {
-  CHECK(!_failed);
+//
+// Here the parts of the output go to `writer` as they are produced, and an
+// excluded fragment is just one of the slices `parts` may leave out.
+template <typename Writer>
+void URLCore::WriteURL(const ParsedURL& url,
+                       Writer* writer,
+                       unsigned parts,
+                       URLComponents* components) {
+  URLComponents unused;
+  if (components == nullptr) components = &unused;
 
   // Let output be url’s scheme and U+003A (:) concatenated.
-  string output = _parsed_url->scheme + ":";
-  printf("Serialize: %s\n", output.c_str());
+  if (parts & kHashProtocol) {
+    const string& scheme = url.scheme;
+    writer->Append(scheme.data(), scheme.length());
+    writer->Append(':');
+  }
+  components->protocol_end = writer->length();
+  components->port = URLComponents::kOmittedComponent;
 
   // If url’s host is non-null:
-  Host& host = _parsed_url->host;
+  const Host& host = url.host;
   if (!host.is_null()) {
     // Append "//" to output.
-    output += "//";
+    if (parts & kHashHost) writer->Append("//", 2);
+    components->username_start = writer->length();
+    components->username_end = writer->length();
+    components->password_start = writer->length();
+    components->password_end = writer->length();
 
     // If url includes credentials, then:
-    if (_parsed_url->IncludeCredentials()) {
+    if ((parts & kHashCredentials) && url.IncludeCredentials()) {
       // Append url’s username to output.
-      output += _parsed_url->username;
+      const string& username = url.username;
+      writer->Append(username.data(), username.length());
+      components->username_end = writer->length();
+      components->password_start = writer->length();
+      components->password_end = writer->length();
 
       // If url’s password is not the empty string, then append U+003A (:),
       // followed by url’s password, to output.
-      if (!_parsed_url->password.empty()) {
-        output += ":" + _parsed_url->password;
+      const string& password = url.password;
+      if (!password.empty()) {
+        writer->Append(':');
+        components->password_start = writer->length();
+        writer->Append(password.data(), password.length());
+        components->password_end = writer->length();
       }
 
       // Append U+0040 (@) to output.
-      output += "@";
+      writer->Append('@');
     }
 
     // Append url’s host, serialized, to output.
-    output += host->Serialize();
+    components->host_start = writer->length();
+    if (parts & kHashHost) host->Write(writer);
+    components->host_end = writer->length();
 
     // If url’s port is non-null, append U+003A (:) followed by url’s port,
     // serialized, to output.
-    if (!_parsed_url->port.is_null()) {
-      output += ":" + _parsed_url->port.Serialize();
+    if (!url.port.is_null()) {
+      if (parts & kHashHost) {
+        writer->Append(':');
+        url.port.Write(writer);
+      }
+      components->port = url.port.value();
     }
+  } else {
+    components->username_start = writer->length();
+    components->username_end = writer->length();
+    components->password_start = writer->length();
+    components->password_end = writer->length();
+    components->host_start = writer->length();
+    components->host_end = writer->length();
   }
 
-  // If url’s host is null, url does not have an opaque path, url’s path’s size
-  // is greater than 1, and url’s path[0] is the empty string, then append
-  // U+002F (/) followed by U+002E (.) to output.
-  if (host.is_null() && !_parsed_url->HasOpaquePath() &&
-      _parsed_url->path.size() > 1 && _parsed_url->path[0] == "") {
-    // This prevents web+demo:/.//not-a-host/ or web+demo:/path/..//not-a-host/,
-    // when parsed and then serialized, from ending up as web+demo://not-a-host/
-    // (they end up as web+demo:/.//not-a-host/).
-    output += "/.";
-  }
+  if (parts & kHashPathname) {
+    // If url’s host is null, url does not have an opaque path, url’s path’s
+    // size is greater than 1, and url’s path[0] is the empty string, then
+    // append U+002F (/) followed by U+002E (.) to output.
+    const Path& path = url.path;
+    bool opaque_path = url.HasOpaquePath();
+    if (host.is_null() && !opaque_path && path.size() > 1 && path[0] == "") {
+      // This prevents web+demo:/.//not-a-host/ or
+      // web+demo:/path/..//not-a-host/, when parsed and then serialized, from
+      // ending up as web+demo://not-a-host/ (they end up as
+      // web+demo:/.//not-a-host/).
+      writer->Append("/.", 2);
+    }
 
-  // Append the result of URL path serializing url to output.
-  output += SerializePath();
+    // Append the result of URL path serializing url to output.
+    components->pathname_start = writer->length();
+    if (opaque_path) {
+      const string& ascii = path.ASCIIString();
+      writer->Append(ascii.data(), ascii.length());
+    } else {
+      size_t size = path.size();
+      for (size_t i = 0; i < size; ++i) {
+        const string& segment = path[i];
+        writer->Append('/');
+        writer->Append(segment.data(), segment.length());
+      }
+    }
+  } else {
+    components->pathname_start = writer->length();
+  }
 
   // If url’s query is non-null, append U+003F (?), followed by url’s query, to
   // output.
-  if (!_parsed_url->query.is_null()) {
-    output += "?" + *_parsed_url->query;
+  components->search_start = writer->length();
+  if ((parts & kHashSearch) && !url.query.is_null()) {
+    const string& query = *url.query;
+    writer->Append('?');
+    writer->Append(query.data(), query.length());
   }
 
   // If exclude fragment is false and url’s fragment is non-null, then append
   // U+0023 (#), followed by url’s fragment, to output.
-  if (!exclude_fragment && !_parsed_url->fragment.is_null()) {
-    output += "#" + *_parsed_url->fragment;
+  components->hash_start = writer->length();
+  if ((parts & kHashFragment) && !url.fragment.is_null()) {
+    const string& fragment = *url.fragment;
+    writer->Append('#');
+    writer->Append(fragment.data(), fragment.length());
   }
+}
 
-  // Return output.
-  return output;
+template <typename Writer>
+void URLCore::Write(Writer* writer,
+                    unsigned parts,
+                    URLComponents* components) const {
+  CHECK(!_failed);
+  WriteURL(*_parsed_url, writer, parts, components);
 }
 
+template void URLCore::Write(StringWriter* writer,
+                             unsigned parts,
+                             URLComponents* components) const;
+template void URLCore::Write(HashWriter* writer,
+                             unsigned parts,
+                             URLComponents* components) const;
+
 string URLCore::SerializePath() const {
   CHECK(!_failed);
 
@@ -1,7 +1,13 @@
 #include "url_search_params.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 #include <algorithm>
+#include <cmath>
+#include <utility>
 #include "code_points.h"
 #include "percent_encode.h"
+#include "string_utils.h"
 #include "temp_string_buffer.h"
 #include "url_core.h"
 #include "utils/assert.h"
@@ -54,7 +60,6 @@ static inline void ApplicationXWWWFormUrlencodedParse(
                                                                                \
   break
 
-  uint32_t idx = 0;
   for (; ptr < end; ptr++) {
     switch (state) {
       case kKey: {
@@ -68,8 +73,8 @@ static inline void ApplicationXWWWFormUrlencodedParse(
               continue;
             }
 
-            list->push_back(URLSearchParamsKVPairWithIndex(
-                string(key.string(), key.length()), "", idx++));
+            list->push_back(URLSearchParamsKVPair(
+                string(key.string(), key.length()), ""));
             key.SetEmpty();
             value.SetEmpty();
             break;
@@ -93,10 +98,9 @@ static inline void ApplicationXWWWFormUrlencodedParse(
       case kValue: {
         switch (*ptr) {
           case '&':
-            list->push_back(URLSearchParamsKVPairWithIndex(
-                string(key.string(), key.length()),
-                string(value.string(), value.length()),
-                idx++));
+            list->push_back(
+                URLSearchParamsKVPair(string(key.string(), key.length()),
+                                      string(value.string(), value.length())));
             key.SetEmpty();
             value.SetEmpty();
             state = kKey;
@@ -126,12 +130,11 @@ static inline void ApplicationXWWWFormUrlencodedParse(
 
   if (state == kValue) {
     list->push_back(
-        URLSearchParamsKVPairWithIndex(string(key.string(), key.length()),
-                                       string(value.string(), value.length()),
-                                       idx++));
+        URLSearchParamsKVPair(string(key.string(), key.length()),
+                              string(value.string(), value.length())));
   } else if (key.length() > 0) {
-    list->push_back(URLSearchParamsKVPairWithIndex(
-        string(key.string(), key.length()), "", idx++));
+    list->push_back(
+        URLSearchParamsKVPair(string(key.string(), key.length()), ""));
   }
 }
 
@@ -182,6 +185,65 @@ static inline string ApplicationXWWWFormUrlencodedSerialize(
   return output;
 }
 
+constexpr size_t kInsertionSortThreshold = 8;
+
+static inline bool NameLessThan(const URLSearchParamsKVPair* a,
+                                const URLSearchParamsKVPair* b) {
+  // Refs:
+  // https://github.com/rmisev/url_whatwg/blob/9388886d903cb5f676320c90c24e8ac8223b28fd/src/url_search_params.h#L461
+  return CompareByCodeUnits(a->key, b->key) < 0;
+}
+
+// Stable merge sort over pointers to the pairs. The pairs themselves are only
+// moved once, after the final order is known. Short runs are sorted by
+// insertion sort, which is also stable because it only shifts an item past
+// strictly greater names.
+//
+// `scratch` must be able to hold at least `length / 2 + 1` pointers.
+static void StableSortByName(URLSearchParamsKVPair** items,
+                             URLSearchParamsKVPair** scratch,
+                             size_t length) {
+  if (length <= kInsertionSortThreshold) {
+    for (size_t i = 1; i < length; i++) {
+      URLSearchParamsKVPair* current = items[i];
+      size_t j = i;
+      while (j > 0 && NameLessThan(current, items[j - 1])) {
+        items[j] = items[j - 1];
+        j--;
+      }
+      items[j] = current;
+    }
+    return;
+  }
+
+  size_t half = length / 2;
+  StableSortByName(items, scratch, half);
+  StableSortByName(items + half, scratch, length - half);
+
+  // The two runs are already in order, e.g. the list was sorted before.
+  if (!NameLessThan(items[half], items[half - 1])) {
+    return;
+  }
+
+  // Merge the left run (copied to `scratch`) with the right run in place. Ties
+  // are taken from the left run to keep the sort stable.
+  memcpy(scratch, items, half * sizeof(*items));
+  size_t left = 0;
+  size_t right = half;
+  size_t out = 0;
+  while (left < half && right < length) {
+    if (NameLessThan(items[right], scratch[left])) {
+      items[out++] = items[right++];
+    } else {
+      items[out++] = scratch[left++];
+    }
+  }
+
+  while (left < half) {
+    items[out++] = scratch[left++];
+  }
+}
+
 URLSearchParams::URLSearchParams(const string& init,
                                  bool force_reserve_first_letter)
     : _url(nullptr) {
@@ -204,37 +266,31 @@ URLSearchParams::URLSearchParams(const URLSearchParamsList& init)
 
 URLSearchParams::URLSearchParams(const map<string, string>& init)
     : _url(nullptr) {
-  uint32_t index = 0;
   // Otherwise, if init is a record, then for each name → value of init, append
   // a new name-value pair whose name is name and value is value, to query’s
   // list.
   for (const auto& pair : init) {
-    _list.push_back(
-        URLSearchParamsKVPairWithIndex(pair.first, pair.second, index++));
+    _list.push_back(URLSearchParamsKVPair(pair.first, pair.second));
   }
 }
 
 void URLSearchParams::Append(const string& name, const string& value) {
   // Append a new name-value pair whose name is name and value is value, to
   // list.
-  _list.push_back(URLSearchParamsKVPairWithIndex(name, value, _list.size()));
+  _list.push_back(URLSearchParamsKVPair(name, value));
 
   // Update this.
   Update();
 }
 
 void URLSearchParams::Delete(const string& name) {
-  uint32_t index = 0;
-
   // Remove all name-value pairs whose name is name from list.
-  for (auto it = _list.begin(); it != _list.end();) {
-    if (it->key == name) {
-      it = _list.erase(it);
-    } else {
-      it->index = index++;
-      ++it;
-    }
-  }
+  _list.erase(std::remove_if(_list.begin(),
+                             _list.end(),
+                             [&name](const URLSearchParamsKVPair& p) {
+                               return p.key == name;
+                             }),
+              _list.end());
 
   // Update this.
   Update();
@@ -280,7 +336,6 @@ bool URLSearchParams::Has(const string& name) const {
 }
 
 void URLSearchParams::Set(const string& name, const string& value) {
-  uint32_t index = 0;
   // The set(name, value) method steps are:
 
   // If this’s list contains any name-value pairs whose name is name, then set
@@ -292,12 +347,10 @@ void URLSearchParams::Set(const string& name, const string& value) {
         it = _list.erase(it);
       } else {
         it->value = value;
-        it->index = index++;
         found = true;
         ++it;
       }
     } else {
-      it->index = index++;
       ++it;
     }
   }
@@ -305,35 +358,199 @@ void URLSearchParams::Set(const string& name, const string& value) {
   // Otherwise, append a new name-value pair whose name is name and value is
   // value, to this’s list.
   if (!found) {
-    _list.push_back(URLSearchParamsKVPairWithIndex(name, value, _list.size()));
+    _list.push_back(URLSearchParamsKVPair(name, value));
   }
 
   // Update this.
   Update();
 }
 
+const URLSearchParamsKVPair* URLSearchParams::Find(
+    const StringView& name) const {
+  for (const auto& p : _list) {
+    if (StringView(p.key) == name) {
+      return &p;
+    }
+  }
+
+  return nullptr;
+}
+
+bool URLSearchParams::Get(const StringView& name, StringView* value) const {
+  const URLSearchParamsKVPair* p = Find(name);
+  if (p == nullptr) return false;
+
+  *value = StringView(p->value);
+  return true;
+}
+
+void URLSearchParams::GetAll(const StringView& name,
+                             std::vector<StringView>* values) const {
+  values->clear();
+  for (const auto& p : _list) {
+    if (StringView(p.key) == name) {
+      values->push_back(StringView(p.value));
+    }
+  }
+}
+
+bool URLSearchParams::GetInteger(const StringView& name,
+                                 int64_t* result) const {
+  const URLSearchParamsKVPair* p = Find(name);
+  if (p == nullptr) return false;
+
+  const char* ptr = p->value.c_str();
+  const char* end = ptr + p->value.length();
+  bool negative = false;
+  if (ptr < end && (*ptr == '-' || *ptr == '+')) {
+    negative = *ptr == '-';
+    ptr++;
+  }
+
+  if (ptr == end) return false;
+
+  // Accumulate as a negative number so that INT64_MIN does not overflow.
+  int64_t value = 0;
+  for (; ptr < end; ptr++) {
+    if (!IsASCIIDigit(*ptr)) return false;
+
+    int digit = *ptr - '0';
+    if (value < (INT64_MIN + digit) / 10) return false;
+    value = value * 10 - digit;
+  }
+
+  if (!negative) {
+    if (value == INT64_MIN) return false;
+    value = -value;
+  }
+
+  *result = value;
+  return true;
+}
+
+bool URLSearchParams::GetFloat(const StringView& name, double* result) const {
+  const URLSearchParamsKVPair* p = Find(name);
+  if (p == nullptr || p->value.empty()) return false;
+
+  // `strtod` would skip leading whitespace.
+  const char* begin = p->value.c_str();
+  if (!IsASCIIDigit(*begin) && *begin != '-' && *begin != '+' &&
+      *begin != '.') {
+    return false;
+  }
+
+  // The value is a `std::string`, which is always NUL-terminated. Infinities
+  // and NaNs, spelled out (e.g. "-inf") or overflowing (e.g. "1e999"), are
+  // rejected, and so are results that underflow.
+  char* parsed_end = nullptr;
+  errno = 0;
+  double value = strtod(begin, &parsed_end);
+  if (parsed_end != begin + p->value.length() || errno == ERANGE ||
+      !std::isfinite(value)) {
+    return false;
+  }
+
+  *result = value;
+  return true;
+}
+
+static inline bool EqualsIgnoringASCIICase(const std::string& str,
+                                           const char* lower) {
+  size_t length = strlen(lower);
+  if (str.length() != length) return false;
+  for (size_t i = 0; i < length; i++) {
+    if (string_utils::ToLower(str[i]) != lower[i]) return false;
+  }
+  return true;
+}
+
+bool URLSearchParams::GetBoolean(const StringView& name, bool* result) const {
+  const URLSearchParamsKVPair* p = Find(name);
+  if (p == nullptr) return false;
+
+  const std::string& value = p->value;
+  if (value.empty() || EqualsIgnoringASCIICase(value, "true") ||
+      EqualsIgnoringASCIICase(value, "1") ||
+      EqualsIgnoringASCIICase(value, "yes") ||
+      EqualsIgnoringASCIICase(value, "on")) {
+    *result = true;
+    return true;
+  }
+
+  if (EqualsIgnoringASCIICase(value, "false") ||
+      EqualsIgnoringASCIICase(value, "0") ||
+      EqualsIgnoringASCIICase(value, "no") ||
+      EqualsIgnoringASCIICase(value, "off")) {
+    *result = false;
+    return true;
+  }
+
+  return false;
+}
+
+bool URLSearchParams::GetList(const StringView& name,
+                              std::vector<StringView>* result,
+                              char separator) const {
+  const URLSearchParamsKVPair* p = Find(name);
+  if (p == nullptr) return false;
+
+  result->clear();
+  const char* ptr = p->value.c_str();
+  const char* end = ptr + p->value.length();
+  while (ptr <= end) {
+    const char* item_end = static_cast<const char*>(
+        memchr(ptr, separator, static_cast<size_t>(end - ptr)));
+    if (item_end == nullptr) item_end = end;
+
+    const char* item_begin = ptr;
+    while (item_begin < item_end && IsASCIIWhitespace(*item_begin)) {
+      item_begin++;
+    }
+    const char* item_last = item_end;
+    while (item_last > item_begin && IsASCIIWhitespace(*(item_last - 1))) {
+      item_last--;
+    }
+
+    if (item_last > item_begin) {
+      result->push_back(StringView(item_begin, item_last - item_begin));
+    }
+
+    ptr = item_end + 1;
+  }
+
+  return true;
+}
+
 void URLSearchParams::Sort() {
   // The sort() method steps are:
 
   // Sort all name-value pairs, if any, by their names. Sorting must be done by
   // comparison of code units. The relative order between name-value pairs with
   // equal names must be preserved.
-  std::sort(_list.begin(),
-            _list.end(),
-            [](const URLSearchParamsKVPairWithIndex& a,
-               const URLSearchParamsKVPairWithIndex& b) {
-              // Refs:
-              // https://github.com/rmisev/url_whatwg/blob/9388886d903cb5f676320c90c24e8ac8223b28fd/src/url_search_params.h#L461
-              int ret = CompareByCodeUnits(a.key, b.key);
-              if (ret < 0) return true;
-              if (ret > 0) return false;
-
-              return a.index < b.index;
-            });
-
-  uint32_t index = 0;
-  for (auto& p : _list) {
-    p.index = index++;
+  size_t length = _list.size();
+  if (length > 1) {
+    std::vector<URLSearchParamsKVPair*> items(length);
+    std::vector<URLSearchParamsKVPair*> scratch(length / 2 + 1);
+    for (size_t i = 0; i < length; i++) {
+      items[i] = &_list[i];
+    }
+
+    StableSortByName(items.data(), scratch.data(), length);
+
+    // Only move the pairs around if the order actually changed.
+    size_t first_moved = 0;
+    while (first_moved < length && items[first_moved] == &_list[first_moved]) {
+      first_moved++;
+    }
+
+    if (first_moved < length) {
+      URLSearchParamsList sorted;
+      sorted.reserve(length);
+      for (size_t i = 0; i < length; i++) {
+        sorted.push_back(std::move(*items[i]));
+      }
+      _list.swap(sorted);
+    }
   }
 
   // Update this.
@@ -0,0 +1,76 @@
+#include "validation_error.h"
+#include "code_points.h"
+#include "parser_context.h"
+#include "thread_counters-inl.h"
+#include "utils/assert.h"
+
+namespace whatwgurl {
+
+namespace {
+
+struct ValidationErrorCountersTag {};
+typedef ThreadCounters<ValidationErrorCountersTag, kValidationErrorCount>
+    ValidationErrorCounters;
+
+}  // namespace
+
+const char* ValidationErrorName(ValidationErrorCode code) {
+  static const char* const names[kValidationErrorCount] = {
+#define V(_, spec_name) spec_name,
+      VALIDATION_ERRORS(V)
+#undef V
+  };
+
+  CHECK_LT(code, kValidationErrorCount);
+  return names[code];
+}
+
+uint64_t ValidationErrorCounts::total() const {
+  uint64_t ret = 0;
+  for (uint64_t count : counts) ret += count;
+  return ret;
+}
+
+ValidationErrorCounts GetValidationErrorCounts() {
+  ValidationErrorCounts ret;
+  ValidationErrorCounters::Sum(ret.counts);
+  return ret;
+}
+
+void ResetValidationErrorCounts() {
+  ValidationErrorCounters::Reset();
+}
+
+ValidationErrorReporter::ValidationErrorReporter(bool* validation_error,
+                                                 ParserContext* context)
+    : _validation_error(validation_error),
+      _context(context),
+      _enabled(context->validation_error_sink() != nullptr ||
+               context->collect_counters()) {}
+
+size_t ValidationErrorReporter::MapOffset(size_t offset) const {
+  if (_input == nullptr) return offset;
+  if (!_removed_tab_or_newline) return _leading + offset;
+
+  // Count `offset` code units that were kept, skipping the removed ones.
+  size_t i = _leading;
+  for (; i < _input->length(); i++) {
+    if (IsASCIITabOrNewline((*_input)[i])) continue;
+    if (offset == 0) break;
+    offset--;
+  }
+
+  return i;
+}
+
+void ValidationErrorReporter::Dispatch(ValidationErrorCode code,
+                                       size_t offset) {
+  if (_context->collect_counters()) ValidationErrorCounters::Add(code, 1);
+
+  ValidationErrorSink sink = _context->validation_error_sink();
+  if (sink != nullptr) {
+    sink(_context->validation_error_sink_data(), code, offset);
+  }
+}
+
+}  // namespace whatwgurl
@@ -0,0 +1,147 @@
+#include "xxhash64.h"
+#include <string.h>
+
+namespace whatwgurl {
+
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t RotateLeft(uint64_t value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+// The spec reads lanes as little-endian.
+inline uint64_t Read64(const unsigned char* ptr) {
+  uint64_t value = 0;
+  for (int i = 7; i >= 0; i--) value = (value << 8) | ptr[i];
+  return value;
+}
+
+inline uint32_t Read32(const unsigned char* ptr) {
+  return static_cast<uint32_t>(ptr[0]) | static_cast<uint32_t>(ptr[1]) << 8 |
+         static_cast<uint32_t>(ptr[2]) << 16 |
+         static_cast<uint32_t>(ptr[3]) << 24;
+}
+
+inline uint64_t Round(uint64_t accumulator, uint64_t lane) {
+  accumulator += lane * kPrime2;
+  accumulator = RotateLeft(accumulator, 31);
+  return accumulator * kPrime1;
+}
+
+inline uint64_t MergeAccumulator(uint64_t hash, uint64_t accumulator) {
+  hash ^= Round(0, accumulator);
+  return hash * kPrime1 + kPrime4;
+}
+
+// Consumes the 32-byte stripes of `[*ptr, end)`.
+inline void ConsumeStripes(uint64_t* accumulators,
+                           const unsigned char** ptr,
+                           const unsigned char* end) {
+  const unsigned char* p = *ptr;
+  for (; end - p >= 32; p += 32) {
+    accumulators[0] = Round(accumulators[0], Read64(p));
+    accumulators[1] = Round(accumulators[1], Read64(p + 8));
+    accumulators[2] = Round(accumulators[2], Read64(p + 16));
+    accumulators[3] = Round(accumulators[3], Read64(p + 24));
+  }
+  *ptr = p;
+}
+
+// Steps 3 to 6 of the spec: converges the accumulators (if a stripe was
+// consumed), adds the length, consumes the `remaining` bytes and mixes.
+uint64_t Finish(const uint64_t* accumulators,
+                uint64_t seed,
+                uint64_t total_length,
+                const unsigned char* remaining,
+                size_t length) {
+  uint64_t hash;
+  if (total_length >= 32) {
+    hash = RotateLeft(accumulators[0], 1) + RotateLeft(accumulators[1], 7) +
+           RotateLeft(accumulators[2], 12) + RotateLeft(accumulators[3], 18);
+    for (int i = 0; i < 4; i++) hash = MergeAccumulator(hash, accumulators[i]);
+  } else {
+    hash = seed + kPrime5;
+  }
+
+  hash += total_length;
+
+  const unsigned char* ptr = remaining;
+  const unsigned char* end = remaining + length;
+  for (; end - ptr >= 8; ptr += 8) {
+    hash ^= Round(0, Read64(ptr));
+    hash = RotateLeft(hash, 27) * kPrime1 + kPrime4;
+  }
+  if (end - ptr >= 4) {
+    hash ^= Read32(ptr) * kPrime1;
+    hash = RotateLeft(hash, 23) * kPrime2 + kPrime3;
+    ptr += 4;
+  }
+  for (; ptr < end; ptr++) {
+    hash ^= *ptr * kPrime5;
+    hash = RotateLeft(hash, 11) * kPrime1;
+  }
+
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+}  // namespace
+
+XXH64::XXH64(uint64_t seed) : _seed(seed) {
+  _accumulators[0] = seed + kPrime1 + kPrime2;
+  _accumulators[1] = seed + kPrime2;
+  _accumulators[2] = seed;
+  _accumulators[3] = seed - kPrime1;
+}
+
+void XXH64::Update(const void* data, size_t length) {
+  const unsigned char* ptr = static_cast<const unsigned char*>(data);
+  const unsigned char* end = ptr + length;
+  _total_length += length;
+
+  if (_buffered > 0) {
+    size_t needed = sizeof(_buffer) - _buffered;
+    if (length < needed) {
+      memcpy(_buffer + _buffered, ptr, length);
+      _buffered += length;
+      return;
+    }
+
+    memcpy(_buffer + _buffered, ptr, needed);
+    ptr += needed;
+    const unsigned char* stripe = _buffer;
+    ConsumeStripes(_accumulators, &stripe, _buffer + sizeof(_buffer));
+    _buffered = 0;
+  }
+
+  ConsumeStripes(_accumulators, &ptr, end);
+  if (ptr < end) {
+    memcpy(_buffer, ptr, end - ptr);
+    _buffered = end - ptr;
+  }
+}
+
+uint64_t XXH64::Digest() const {
+  return Finish(_accumulators, _seed, _total_length, _buffer, _buffered);
+}
+
+uint64_t XXH64::Hash(const void* data, size_t length, uint64_t seed) {
+  uint64_t accumulators[4] = {
+      seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1};
+  const unsigned char* ptr = static_cast<const unsigned char*>(data);
+  ConsumeStripes(accumulators, &ptr, ptr + length);
+  const unsigned char* start = static_cast<const unsigned char*>(data);
+  return Finish(accumulators, seed, length, ptr, length - (ptr - start));
+}
+
+}  // namespace whatwgurl
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""Generates src/public_suffix-data.cc out of a Public Suffix List.
+
+Usage:
+  gen_public_suffix_data.py public_suffix_list.dat > src/public_suffix-data.cc
+
+The rules become a trie of their labels, right to left, laid out breadth
+first so that the children of every node are contiguous and sorted (see
+include/public_suffix.h). Labels are converted to ASCII the way the host
+parser converts domains, so that lookups compare bytes.
+"""
+
+import sys
+
+RULE = 1
+WILDCARD = 2
+EXCEPTION = 4
+PRIVATE_RULE = 8
+PRIVATE_WILDCARD = 16
+PRIVATE_EXCEPTION = 32
+
+PRIVATE = {RULE: PRIVATE_RULE, WILDCARD: PRIVATE_WILDCARD,
+           EXCEPTION: PRIVATE_EXCEPTION}
+
+
+def to_ascii(label):
+    if label.isascii():
+        return label.lower()
+    return 'xn--' + label.lower().encode('punycode').decode('ascii')
+
+
+def read_rules(path):
+    private = False
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('// ===BEGIN PRIVATE DOMAINS==='):
+                private = True
+            if not line or line.startswith('//'):
+                continue
+
+            # A rule is the first word of its line.
+            rule = line.split()[0]
+            kind = RULE
+            if rule.startswith('!'):
+                kind, rule = EXCEPTION, rule[1:]
+            elif rule.startswith('*.'):
+                kind, rule = WILDCARD, rule[2:]
+            yield [to_ascii(label) for label in rule.split('.')], kind, private
+
+
+class Node(object):
+    def __init__(self, label):
+        self.label = label
+        self.icann = 0
+        self.private = 0
+        self.children = {}
+
+    @property
+    def flags(self):
+        # A kind of rule is private only if no ICANN rule is of that kind.
+        flags = self.icann | self.private
+        for kind in (RULE, WILDCARD, EXCEPTION):
+            if self.private & ~self.icann & kind:
+                flags |= PRIVATE[kind]
+        return flags
+
+
+def build_trie(rules):
+    root = Node('')
+    for labels, kind, private in rules:
+        # An exception stands for the rule one label shorter.
+        assert kind != EXCEPTION or len(labels) > 1, labels
+        node = root
+        for label in reversed(labels):
+            node = node.children.setdefault(label, Node(label))
+        if private:
+            node.private |= kind
+        else:
+            node.icann |= kind
+    return root
+
+
+def layout(root):
+    """Numbers the nodes breadth first."""
+    nodes = [root]
+    index = 0
+    while index < len(nodes):
+        node = nodes[index]
+        node.children = [node.children[label]
+                         for label in sorted(node.children)]
+        node.first_child = len(nodes) if node.children else 0
+        nodes.extend(node.children)
+        index += 1
+    return nodes
+
+
+def main(argv):
+    if len(argv) != 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    nodes = layout(build_trie(read_rules(argv[1])))
+
+    labels = []
+    offsets = {}
+    length = 0
+    for node in nodes:
+        if node.label not in offsets:
+            offsets[node.label] = length
+            labels.append(node.label)
+            length += len(node.label)
+
+    out = sys.stdout
+    out.write('// Generated by tools/gen_public_suffix_data.py; do not edit.\n')
+    out.write('//\n')
+    out.write('// The data comes from the Public Suffix List\n')
+    out.write('// (https://publicsuffix.org/list/), which is subject to the '
+              'terms of the\n')
+    out.write('// Mozilla Public License, v. 2.0 '
+              '(https://mozilla.org/MPL/2.0/).\n')
+    out.write('\n#include "public_suffix.h"\n\n')
+    out.write('namespace whatwgurl {\nnamespace public_suffix {\n\n')
+
+    out.write('const char kLabels[] =\n')
+    line = ''
+    for label in labels:
+        if len(line) + len(label) > 72:
+            out.write('    "%s"\n' % line)
+            line = ''
+        line += label
+    out.write('    "%s";\n\n' % line)
+
+    out.write('const Node kNodes[] = {\n')
+    line = ' '
+    for node in nodes:
+        item = ' {%d, %d, %d, %d, %d},' % (offsets[node.label], len(node.label),
+                                           node.flags, len(node.children),
+                                           node.first_child)
+        if len(line) + len(item) > 80:
+            out.write(line + '\n')
+            line = ' '
+        line += item
+    out.write(line + '\n};\n\n')
+    out.write('const size_t kNodeCount = %d;\n\n' % len(nodes))
+
+    out.write('}  // namespace public_suffix\n}  // namespace whatwgurl\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
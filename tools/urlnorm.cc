@@ -0,0 +1,633 @@
+// Normalizes newline-delimited URLs, e.g. the request URLs of access logs.
+//
+//   urlnorm [--base=URL] [--threads=N] [--format=tsv|ndjson]
+//           [--fields=F,...] [--output=PATH] <input>
+//   urlnorm --aggregate [--top=K] [--base=URL] [--threads=N]
+//           [--output=PATH] <input>
+//
+// Every line of the input is parsed, against the base if one is given, and
+// written out in input order: as a row of tab-separated fields, or as a JSON
+// object per line. The fields are any of href, protocol, username, password,
+// host, hostname, port, pathname, search and hash; only href by default, so
+// plain `urlnorm <input>` writes one href per line.
+//
+// A line that is not a valid URL still gets an output line (empty fields, or
+// `null`), so that output and input line up, and is reported on stderr with
+// its line number. The exit status is 2 when some line was invalid.
+//
+// With `--aggregate`, nothing is written per line. Every thread feeds its own
+// `CorpusAggregator` instead, and the merged statistics are written as one
+// JSON object, listing the K most frequent hosts (20 by default).
+//
+// The input is memory-mapped and cut at line boundaries into chunks that the
+// threads (one per CPU by default) take in turn. The main thread writes the
+// chunks out as they complete, and no more than a few chunks per thread are
+// in flight at a time, so memory use does not grow with the input.
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+#include "base_resolver.h"
+#include "corpus_aggregator.h"
+#include "parse.h"
+#include "url_core.h"
+
+namespace whatwgurl {
+namespace urlnorm {
+
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+// Bytes of input per chunk, give or take a line.
+constexpr size_t kChunkSize = 4 << 20;
+
+// Chunks in flight per thread: being parsed, or parsed and waiting for the
+// chunks before them to be written.
+constexpr size_t kChunksPerThread = 4;
+
+// The most `--threads` accepts.
+constexpr uint64_t kMaxThreads = 1024;
+
+// The fields urlnorm can write, as named on the command line and in NDJSON.
+#define URLNORM_FIELDS(V)                                                      \
+  V(kHref, "href")                                                             \
+  V(kProtocol, "protocol")                                                     \
+  V(kUsername, "username")                                                     \
+  V(kPassword, "password")                                                     \
+  V(kHost, "host")                                                             \
+  V(kHostname, "hostname")                                                     \
+  V(kPort, "port")                                                             \
+  V(kPathname, "pathname")                                                     \
+  V(kSearch, "search")                                                         \
+  V(kHash, "hash")
+
+enum Field {
+#define V(id, name) id,
+  URLNORM_FIELDS(V)
+#undef V
+};
+
+const char* const kFieldNames[] = {
+#define V(id, name) name,
+    URLNORM_FIELDS(V)
+#undef V
+};
+
+enum Format {
+  kTSV,
+  kNDJSON,
+};
+
+struct Options {
+  const char* input = nullptr;
+  const char* output = nullptr;
+  const char* base = nullptr;
+  unsigned threads = 0;
+  Format format = kTSV;
+  vector<Field> fields;
+  bool aggregate = false;
+  size_t top_hosts = 20;
+};
+
+// Appends `field` of the URL serialized as `href`, the same string the
+// `URLCore` getter of that name would return.
+static void AppendField(Field field,
+                        const string& href,
+                        const URLComponents& c,
+                        string* out) {
+  const char* data = href.data();
+  switch (field) {
+    case kHref:
+      out->append(href);
+      break;
+    case kProtocol:
+      out->append(data, c.protocol_end);
+      break;
+    case kUsername:
+      out->append(data + c.username_start, c.username_end - c.username_start);
+      break;
+    case kPassword:
+      out->append(data + c.password_start, c.password_end - c.password_start);
+      break;
+    case kHost:
+      out->append(data + c.host_start, c.host_end - c.host_start);
+      if (c.port != URLComponents::kOmittedComponent) {
+        out->push_back(':');
+        out->append(std::to_string(c.port));
+      }
+      break;
+    case kHostname:
+      out->append(data + c.host_start, c.host_end - c.host_start);
+      break;
+    case kPort:
+      if (c.port != URLComponents::kOmittedComponent) {
+        out->append(std::to_string(c.port));
+      }
+      break;
+    case kPathname:
+      out->append(data + c.pathname_start, c.search_start - c.pathname_start);
+      break;
+    case kSearch:
+      // An empty query serializes as "", like a null one.
+      if (c.hash_start - c.search_start > 1) {
+        out->append(data + c.search_start, c.hash_start - c.search_start);
+      }
+      break;
+    case kHash:
+      if (href.length() - c.hash_start > 1) {
+        out->append(data + c.hash_start, href.length() - c.hash_start);
+      }
+      break;
+  }
+}
+
+// Appends `value` as the contents of a JSON string. A serialized URL is ASCII
+// without controls in every component but an opaque path, which may still
+// hold quotes and backslashes.
+static void AppendJSONString(const char* value, size_t length, string* out) {
+  for (size_t i = 0; i < length; i++) {
+    unsigned char c = value[i];
+    if (c == '"' || c == '\\') {
+      out->push_back('\\');
+      out->push_back(c);
+    } else if (c < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      out->append(escaped);
+    } else {
+      out->push_back(c);
+    }
+  }
+}
+
+// A newline-delimited input, memory-mapped (or read whole, for stdin).
+class Input {
+ public:
+  Input() = default;
+  Input(const Input&) = delete;
+  Input& operator=(const Input&) = delete;
+
+  ~Input() {
+    if (_mapped) munmap(const_cast<char*>(_data), _size);
+  }
+
+  bool Load(const char* path) {
+    if (strcmp(path, "-") == 0) return Read(STDIN_FILENO, path);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+      perror(path);
+      return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      perror(path);
+      close(fd);
+      return false;
+    }
+
+    // Pipes and the like cannot be mapped.
+    if (!S_ISREG(st.st_mode)) {
+      bool ret = Read(fd, path);
+      close(fd);
+      return ret;
+    }
+
+    _size = st.st_size;
+    if (_size == 0) {
+      close(fd);
+      return true;
+    }
+
+    void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+      perror(path);
+      return false;
+    }
+
+    _data = static_cast<const char*>(data);
+    _mapped = true;
+    madvise(data, _size, MADV_SEQUENTIAL);
+    return true;
+  }
+
+  inline const char* data() const { return _data; }
+  inline size_t size() const { return _size; }
+
+ private:
+  bool Read(int fd, const char* path) {
+    char buffer[1 << 16];
+    while (true) {
+      ssize_t read_size = read(fd, buffer, sizeof(buffer));
+      if (read_size < 0) {
+        perror(path);
+        return false;
+      }
+      if (read_size == 0) break;
+      _buffer.append(buffer, read_size);
+    }
+
+    _data = _buffer.data();
+    _size = _buffer.size();
+    return true;
+  }
+
+  const char* _data = nullptr;
+  size_t _size = 0;
+  bool _mapped = false;
+  string _buffer;
+};
+
+// A run of whole lines of the input, and what they normalized to.
+struct Chunk {
+  const char* begin;
+  const char* end;
+
+  string output;
+  size_t lines = 0;
+
+  // The invalid lines, as indices into the chunk and their text.
+  struct InvalidLine {
+    size_t index;
+    const char* text;
+    size_t length;
+  };
+  vector<InvalidLine> invalid;
+
+  bool done = false;
+};
+
+class Normalizer {
+ public:
+  // `base` and `parsed_base` are the same base, for normalizing and for
+  // aggregating respectively; both are null without one.
+  Normalizer(const Options& options,
+             const BaseResolver* base,
+             const ParsedURL* parsed_base,
+             FILE* out)
+      : _options(options),
+        _base(base),
+        _parsed_base(parsed_base),
+        _out(out) {}
+
+  // Normalizes `input` into `_out`. Returns the number of invalid lines.
+  size_t Run(const Input& input) {
+    Split(input);
+
+    unsigned threads = _options.threads;
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    threads = static_cast<unsigned>(
+        std::min<size_t>(threads, std::max<size_t>(_chunks.size(), 1)));
+    _window = threads * kChunksPerThread;
+
+    vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; i++) {
+      workers.emplace_back(&Normalizer::Work, this);
+    }
+
+    size_t invalid = Write();
+    for (std::thread& worker : workers) worker.join();
+
+    if (_options.aggregate) {
+      string json = _aggregator.ToJSON(_options.top_hosts);
+      json.push_back('\n');
+      fwrite(json.data(), 1, json.size(), _out);
+    }
+
+    return invalid;
+  }
+
+ private:
+  // Cuts the input into chunks of about `kChunkSize` bytes, each ending right
+  // after a newline (or at the end of the input).
+  void Split(const Input& input) {
+    const char* ptr = input.data();
+    const char* end = ptr + input.size();
+    while (ptr < end) {
+      const char* chunk_end = ptr + std::min<size_t>(kChunkSize, end - ptr);
+      if (chunk_end < end) {
+        const char* eol = static_cast<const char*>(
+            memchr(chunk_end, '\n', end - chunk_end));
+        chunk_end = eol == nullptr ? end : eol + 1;
+      }
+
+      _chunks.emplace_back();
+      _chunks.back().begin = ptr;
+      _chunks.back().end = chunk_end;
+      ptr = chunk_end;
+    }
+  }
+
+  void Work() {
+    unique_ptr<CorpusAggregator> aggregator;
+    if (_options.aggregate) aggregator.reset(new CorpusAggregator());
+
+    while (true) {
+      size_t index;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _can_take.wait(lock, [this] {
+          return _next_taken == _chunks.size() ||
+                 _next_taken < _next_written + _window;
+        });
+        if (_next_taken == _chunks.size()) break;
+        index = _next_taken++;
+      }
+
+      Normalize(&_chunks[index], aggregator.get());
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _chunks[index].done = true;
+      }
+      _done.notify_all();
+    }
+
+    if (aggregator) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _aggregator.Merge(*aggregator);
+    }
+  }
+
+  // Writes the chunks out in order as they are done, and reports their
+  // invalid lines. Returns the number of invalid lines.
+  size_t Write() {
+    size_t line = 1;
+    size_t invalid = 0;
+    for (size_t i = 0; i < _chunks.size(); i++) {
+      Chunk* chunk = &_chunks[i];
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [chunk] { return chunk->done; });
+      }
+
+      fwrite(chunk->output.data(), 1, chunk->output.size(), _out);
+      for (const Chunk::InvalidLine& invalid_line : chunk->invalid) {
+        fprintf(stderr,
+                "%s:%zu: invalid URL: %.*s\n",
+                _options.input,
+                line + invalid_line.index,
+                static_cast<int>(std::min<size_t>(invalid_line.length, 200)),
+                invalid_line.text);
+      }
+      line += chunk->lines;
+      invalid += chunk->invalid.size();
+
+      string().swap(chunk->output);
+      vector<Chunk::InvalidLine>().swap(chunk->invalid);
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _next_written++;
+      }
+      _can_take.notify_all();
+    }
+
+    return invalid;
+  }
+
+  // Normalizes the lines of `chunk` into its output or, if `aggregator` is
+  // non-null, adds them to it.
+  void Normalize(Chunk* chunk, CorpusAggregator* aggregator) {
+    const char* ptr = chunk->begin;
+    string input;
+    string href;
+    URLComponents components;
+
+    while (ptr < chunk->end) {
+      const char* eol =
+          static_cast<const char*>(memchr(ptr, '\n', chunk->end - ptr));
+      if (eol == nullptr) eol = chunk->end;
+
+      const char* line_end = eol;
+      if (line_end > ptr && line_end[-1] == '\r') --line_end;
+      input.assign(ptr, line_end - ptr);
+
+      bool valid;
+      if (aggregator != nullptr) {
+        valid = aggregator->Add(input, _parsed_base);
+      } else if (_base != nullptr) {
+        valid = _base->Resolve(input, &href, &components);
+      } else {
+        URLCore url(input);
+        valid = !url.failed();
+        if (valid) href = url.href(&components);
+      }
+
+      if (!valid) {
+        chunk->invalid.push_back({chunk->lines, ptr, input.length()});
+      }
+      if (aggregator == nullptr) {
+        WriteLine(valid, href, components, &chunk->output);
+      }
+
+      chunk->lines++;
+      ptr = eol + 1;
+    }
+  }
+
+  void WriteLine(bool valid,
+                 const string& href,
+                 const URLComponents& components,
+                 string* out) const {
+    const vector<Field>& fields = _options.fields;
+    if (_options.format == kNDJSON) {
+      if (!valid) {
+        out->append("null\n");
+        return;
+      }
+
+      out->push_back('{');
+      for (size_t i = 0; i < fields.size(); i++) {
+        if (i > 0) out->push_back(',');
+        out->push_back('"');
+        out->append(kFieldNames[fields[i]]);
+        out->append("\":\"");
+        _scratch.clear();
+        AppendField(fields[i], href, components, &_scratch);
+        AppendJSONString(_scratch.data(), _scratch.length(), out);
+        out->push_back('"');
+      }
+      out->append("}\n");
+      return;
+    }
+
+    for (size_t i = 0; i < fields.size(); i++) {
+      if (i > 0) out->push_back('\t');
+      if (valid) AppendField(fields[i], href, components, out);
+    }
+    out->push_back('\n');
+  }
+
+  const Options& _options;
+  const BaseResolver* _base;
+  const ParsedURL* _parsed_base;
+  FILE* _out;
+
+  vector<Chunk> _chunks;
+  size_t _window = 0;
+
+  std::mutex _mutex;
+  std::condition_variable _can_take;
+  std::condition_variable _done;
+  size_t _next_taken = 0;
+  size_t _next_written = 0;
+
+  // What the threads aggregated, merged as they finish.
+  CorpusAggregator _aggregator;
+
+  // Per thread, for the fields that need escaping.
+  static thread_local string _scratch;
+};
+
+thread_local string Normalizer::_scratch;
+
+static bool ParseFields(const char* list, vector<Field>* fields) {
+  fields->clear();
+  while (true) {
+    const char* comma = strchr(list, ',');
+    size_t length = comma == nullptr ? strlen(list) : comma - list;
+
+    bool found = false;
+    for (size_t i = 0; i < sizeof(kFieldNames) / sizeof(*kFieldNames); i++) {
+      if (strlen(kFieldNames[i]) == length &&
+          memcmp(kFieldNames[i], list, length) == 0) {
+        fields->push_back(static_cast<Field>(i));
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      fprintf(stderr, "Unknown field: %.*s\n", static_cast<int>(length), list);
+      return false;
+    }
+
+    if (comma == nullptr) return true;
+    list = comma + 1;
+  }
+}
+
+// Parses the decimal count `value` into `*count`. Fails on anything but
+// digits, e.g. a sign, and on counts over `max`.
+static bool ParseCount(const char* value, uint64_t max, uint64_t* count) {
+  // `strtoull` would skip leading whitespace, and take "-1" as ULLONG_MAX.
+  if (!isdigit(static_cast<unsigned char>(*value))) return false;
+
+  char* end;
+  errno = 0;
+  *count = strtoull(value, &end, 10);
+  return *end == 0 && errno != ERANGE && *count <= max;
+}
+
+static int Usage(const char* argv0) {
+  fprintf(stderr,
+          "Usage: %s [--base=URL] [--threads=N] [--format=tsv|ndjson]\n"
+          "          [--fields=F,...] [--output=PATH] <input>\n"
+          "       %s --aggregate [--top=K] [--base=URL] [--threads=N]\n"
+          "          [--output=PATH] <input>\n"
+          "\n"
+          "Fields: href, protocol, username, password, host, hostname, port,\n"
+          "        pathname, search, hash (default: href)\n"
+          "An input of - reads stdin.\n",
+          argv0,
+          argv0);
+  return 1;
+}
+
+static int Main(int argc, char* argv[]) {
+  Options options;
+  options.fields.push_back(kHref);
+
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    if (strncmp(arg, "--base=", 7) == 0) {
+      options.base = arg + 7;
+    } else if (strncmp(arg, "--threads=", 10) == 0) {
+      uint64_t threads;
+      if (!ParseCount(arg + 10, kMaxThreads, &threads)) return Usage(argv[0]);
+      options.threads = static_cast<unsigned>(threads);
+    } else if (strcmp(arg, "--format=tsv") == 0) {
+      options.format = kTSV;
+    } else if (strcmp(arg, "--format=ndjson") == 0) {
+      options.format = kNDJSON;
+    } else if (strncmp(arg, "--fields=", 9) == 0) {
+      if (!ParseFields(arg + 9, &options.fields)) return Usage(argv[0]);
+    } else if (strcmp(arg, "--aggregate") == 0) {
+      options.aggregate = true;
+    } else if (strncmp(arg, "--top=", 6) == 0) {
+      uint64_t top_hosts;
+      if (!ParseCount(arg + 6, SIZE_MAX, &top_hosts)) return Usage(argv[0]);
+      options.top_hosts = static_cast<size_t>(top_hosts);
+    } else if (strncmp(arg, "--output=", 9) == 0) {
+      options.output = arg + 9;
+    } else if (options.input == nullptr && (arg[0] != '-' || arg[1] == 0)) {
+      options.input = arg;
+    } else {
+      return Usage(argv[0]);
+    }
+  }
+
+  if (options.input == nullptr) return Usage(argv[0]);
+
+  unique_ptr<BaseResolver> base;
+  ParsedURL parsed_base;
+  if (options.base != nullptr) {
+    base.reset(new BaseResolver(options.base));
+    bool validation_error;
+    if (base->failed() ||
+        !ParseInto(options.base, nullptr, &parsed_base, &validation_error)) {
+      fprintf(stderr, "Invalid base URL: %s\n", options.base);
+      return 1;
+    }
+  }
+
+  Input input;
+  if (!input.Load(options.input)) return 1;
+
+  FILE* out = stdout;
+  if (options.output != nullptr) {
+    out = fopen(options.output, "w");
+    if (out == nullptr) {
+      perror(options.output);
+      return 1;
+    }
+  }
+
+  Normalizer normalizer(
+      options, base.get(), base ? &parsed_base : nullptr, out);
+  size_t invalid = normalizer.Run(input);
+
+  if (fflush(out) != 0 || ferror(out)) {
+    perror(options.output == nullptr ? "stdout" : options.output);
+    return 1;
+  }
+  if (out != stdout) fclose(out);
+
+  return invalid == 0 ? 0 : 2;
+}
+
+}  // namespace urlnorm
+}  // namespace whatwgurl
+
+int main(int argc, char* argv[]) {
+  return whatwgurl::urlnorm::Main(argc, argv);
+}